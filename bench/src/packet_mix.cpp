@@ -0,0 +1,257 @@
+#include "packet_mix.h"
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <vrt/vrt_init.h>
+#include <vrt/vrt_string.h>
+#include <vrt/vrt_types.h>
+#include <vrt/vrt_words.h>
+#include <vrt/vrt_write.h>
+
+/* A short data body, as in low latency streams */
+static constexpr int32_t kWordsBodyMinimal = 8;
+/* A typical data body that fits in a standard 1500 B Ethernet frame */
+static constexpr int32_t kWordsBodyTypical = 360;
+
+/**
+ * Initialize IF data packet.
+ *
+ * \param p           Packet to initialize.
+ * \param words_body  Number of body words.
+ * \param timestamped True if it shall have class ID, timestamps, and trailer.
+ * \param storage     Storage owning the body.
+ */
+static void init_data(vrt_packet* p, int32_t words_body, bool timestamped, PacketStorage* storage) {
+    storage->body.assign(words_body, 0x01020304);
+
+    p->header.packet_type = VRT_PT_IF_DATA_WITH_STREAM_ID;
+    p->fields.stream_id   = 0xABCD0123;
+    p->words_body         = words_body;
+    p->body               = storage->body.data();
+
+    if (timestamped) {
+        p->header.has.class_id                 = true;
+        p->header.has.trailer                  = true;
+        p->header.tsi                          = VRT_TSI_UTC;
+        p->header.tsf                          = VRT_TSF_REAL_TIME;
+        p->fields.class_id.oui                 = 0x00FEDCBA;
+        p->fields.class_id.packet_class_code   = 0x0001;
+        p->fields.integer_seconds_timestamp    = 1700000000;
+        p->fields.fractional_seconds_timestamp = 123456789012;
+        p->trailer.has.valid_data              = true;
+        p->trailer.valid_data                  = true;
+        p->trailer.has.reference_lock          = true;
+        p->trailer.reference_lock              = true;
+    }
+}
+
+/**
+ * Initialize IF context packet with every fixed size field present.
+ *
+ * \param p Packet to initialize.
+ */
+static void init_full_context(vrt_packet* p) {
+    vrt_if_context* c = &p->if_context;
+
+    p->header.packet_type = VRT_PT_IF_CONTEXT;
+    p->header.tsi         = VRT_TSI_UTC;
+    p->header.tsf         = VRT_TSF_REAL_TIME;
+    p->fields.stream_id   = 0xABCD0123;
+
+    p->fields.integer_seconds_timestamp    = 1700000000;
+    p->fields.fractional_seconds_timestamp = 123456789012;
+
+    c->context_field_change_indicator     = true;
+    c->has.reference_point_identifier     = true;
+    c->has.bandwidth                      = true;
+    c->has.if_reference_frequency         = true;
+    c->has.rf_reference_frequency         = true;
+    c->has.rf_reference_frequency_offset  = true;
+    c->has.if_band_offset                 = true;
+    c->has.reference_level                = true;
+    c->has.gain                           = true;
+    c->has.over_range_count               = true;
+    c->has.sample_rate                    = true;
+    c->has.timestamp_adjustment           = true;
+    c->has.timestamp_calibration_time     = true;
+    c->has.temperature                    = true;
+    c->has.device_identifier              = true;
+    c->has.state_and_event_indicators     = true;
+    c->has.data_packet_payload_format     = true;
+    c->has.formatted_gps_geolocation      = true;
+    c->has.formatted_ins_geolocation      = true;
+    c->has.ecef_ephemeris                 = true;
+    c->has.relative_ephemeris             = true;
+    c->has.ephemeris_reference_identifier = true;
+
+    c->reference_point_identifier    = 0x00000001;
+    c->bandwidth                     = 20e6;
+    c->if_reference_frequency        = 0.0;
+    c->rf_reference_frequency        = 2.4e9;
+    c->rf_reference_frequency_offset = 1e3;
+    c->if_band_offset                = -1e3;
+    c->reference_level               = -10.0F;
+    c->gain.stage1                   = 12.0F;
+    c->gain.stage2                   = 3.0F;
+    c->over_range_count              = 7;
+    c->sample_rate                   = 25e6;
+    c->timestamp_adjustment          = 1000;
+    c->timestamp_calibration_time    = 1600000000;
+    c->temperature                   = 41.5F;
+    c->device_identifier.oui         = 0x00123456;
+    c->device_identifier.device_code = 0x0042;
+
+    c->state_and_event_indicators.has.valid_data = true;
+    c->state_and_event_indicators.valid_data     = true;
+
+    c->data_packet_payload_format.real_or_complex         = VRT_ROC_COMPLEX_CARTESIAN;
+    c->data_packet_payload_format.data_item_format        = VRT_DIF_SIGNED_FIXED_POINT;
+    c->data_packet_payload_format.item_packing_field_size = 15;
+    c->data_packet_payload_format.data_item_size          = 15;
+
+    vrt_formatted_geolocation* g   = &c->formatted_gps_geolocation;
+    g->tsi                         = VRT_TSI_UTC;
+    g->tsf                         = VRT_TSF_REAL_TIME;
+    g->integer_second_timestamp    = 1700000000;
+    g->fractional_second_timestamp = 123456789012;
+    g->has.latitude                = true;
+    g->has.longitude               = true;
+    g->has.altitude                = true;
+    g->latitude                    = 57.7;
+    g->longitude                   = 11.97;
+    g->altitude                    = 12.0;
+
+    c->formatted_ins_geolocation = c->formatted_gps_geolocation;
+
+    vrt_ephemeris* e               = &c->ecef_ephemeris;
+    e->tsi                         = VRT_TSI_UTC;
+    e->tsf                         = VRT_TSF_REAL_TIME;
+    e->integer_second_timestamp    = 1700000000;
+    e->fractional_second_timestamp = 123456789012;
+    e->has.position_x              = true;
+    e->has.position_y              = true;
+    e->has.position_z              = true;
+    e->position_x                  = 3.3e6;
+    e->position_y                  = 0.7e6;
+    e->position_z                  = 5.4e6;
+
+    c->relative_ephemeris             = c->ecef_ephemeris;
+    c->ephemeris_reference_identifier = 0x00000002;
+}
+
+void init_packet(PacketKind kind, PacketStorage* storage) {
+    vrt_packet* p = &storage->packet;
+    vrt_init_packet(p);
+
+    switch (kind) {
+        case PacketKind::kMinimalData: {
+            init_data(p, kWordsBodyMinimal, false, storage);
+            break;
+        }
+        case PacketKind::kTimestampedData: {
+            init_data(p, kWordsBodyTypical, true, storage);
+            break;
+        }
+        case PacketKind::kFullContext: {
+            init_full_context(p);
+            break;
+        }
+        case PacketKind::kGpsAscii: {
+            const char* sentence = "$GPGGA,092750.000,5321.6802,N,00630.3372,W,1,8,1.03,61.7,M,55.2,M,,*76";
+            storage->ascii.assign(sentence, sentence + std::strlen(sentence));
+            storage->ascii.resize((storage->ascii.size() + 3) / 4 * 4, '\0');
+
+            p->header.packet_type                   = VRT_PT_IF_CONTEXT;
+            p->fields.stream_id                     = 0xABCD0123;
+            p->if_context.has.gps_ascii             = true;
+            p->if_context.gps_ascii.oui             = 0x00123456;
+            p->if_context.gps_ascii.ascii           = storage->ascii.data();
+            p->if_context.gps_ascii.number_of_words = static_cast<uint32_t>(storage->ascii.size() / 4);
+            break;
+        }
+        case PacketKind::kAssociationLists: {
+            storage->list.assign(64, 0xABCD0000);
+            for (std::size_t i = 0; i < storage->list.size(); ++i) {
+                storage->list[i] += static_cast<uint32_t>(i);
+            }
+
+            vrt_context_association_lists* l = &p->if_context.context_association_lists;
+
+            p->header.packet_type                       = VRT_PT_IF_CONTEXT;
+            p->fields.stream_id                         = 0xABCD0123;
+            p->if_context.has.context_association_lists = true;
+
+            l->source_list_size                              = 8;
+            l->system_list_size                              = 8;
+            l->vector_component_list_size                    = 16;
+            l->asynchronous_channel_list_size                = 16;
+            l->has.asynchronous_channel_tag_list             = true;
+            l->source_context_association_list               = storage->list.data();
+            l->system_context_association_list               = storage->list.data() + 8;
+            l->vector_component_context_association_list     = storage->list.data() + 16;
+            l->asynchronous_channel_context_association_list = storage->list.data() + 32;
+            l->asynchronous_channel_tag_list                 = storage->list.data() + 48;
+            break;
+        }
+    }
+
+    p->header.packet_size = static_cast<uint16_t>(vrt_words_packet(p));
+}
+
+/**
+ * Append packet to buffer.
+ *
+ * \param p   Packet.
+ * \param buf Buffer to append to.
+ */
+static void append_packet(vrt_packet* p, std::vector<uint32_t>* buf) {
+    std::size_t offset = buf->size();
+    buf->resize(offset + p->header.packet_size);
+    int32_t rv = vrt_write_packet(p, buf->data() + offset, p->header.packet_size, VRT_VALIDATION_FULL);
+    if (rv < 0) {
+        throw std::runtime_error(std::string("Failed to write benchmark packet: ") + vrt_string_error(rv));
+    }
+    p->header.packet_count = (p->header.packet_count + 1) & 0x0F;
+}
+
+std::vector<uint32_t> write_packets(PacketKind kind, int n) {
+    PacketStorage storage;
+    init_packet(kind, &storage);
+
+    std::vector<uint32_t> buf;
+    for (int i = 0; i < n; ++i) {
+        append_packet(&storage.packet, &buf);
+    }
+    return buf;
+}
+
+std::vector<uint32_t> write_packet_mix(int n) {
+    PacketStorage data;
+    PacketStorage context;
+    init_packet(PacketKind::kTimestampedData, &data);
+    init_packet(PacketKind::kFullContext, &context);
+
+    std::vector<uint32_t> buf;
+    for (int i = 0; i < n; ++i) {
+        /* One context packet every 16 packets */
+        append_packet(i % 16 == 0 ? &context.packet : &data.packet, &buf);
+    }
+    return buf;
+}
+
+void set_rates(benchmark::State& state, int64_t packets, int64_t words) {
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * packets);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * words * 4);
+}
+
+void all_kinds(benchmark::internal::Benchmark* b) {
+    b->ArgName("kind");
+    for (PacketKind kind : {PacketKind::kMinimalData, PacketKind::kTimestampedData, PacketKind::kFullContext,
+                            PacketKind::kGpsAscii, PacketKind::kAssociationLists}) {
+        b->Arg(static_cast<int64_t>(kind));
+    }
+}
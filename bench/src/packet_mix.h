@@ -0,0 +1,76 @@
+#ifndef BENCH_SRC_PACKET_MIX_H_
+#define BENCH_SRC_PACKET_MIX_H_
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include <vrt/vrt_types.h>
+
+/**
+ * Packet kinds used to build realistic packet mixes.
+ */
+enum class PacketKind {
+    kMinimalData,     /**< IF data packet with stream ID only, and a short body. */
+    kTimestampedData, /**< IF data packet with stream ID, class ID, timestamps, trailer, and a typical body. */
+    kFullContext,     /**< IF context packet with every fixed size field present. */
+    kGpsAscii,        /**< IF context packet with a GPS ASCII field. */
+    kAssociationLists /**< IF context packet with context association lists. */
+};
+
+/**
+ * Owner of a packet struct and the buffers it points to.
+ */
+struct PacketStorage {
+    vrt_packet            packet{};
+    std::vector<uint32_t> body;
+    std::vector<uint32_t> list;
+    std::vector<char>     ascii;
+};
+
+/**
+ * Initialize packet of a specific kind.
+ *
+ * \param kind    Kind of packet.
+ * \param storage Storage to initialize.
+ */
+void init_packet(PacketKind kind, PacketStorage* storage);
+
+/**
+ * Write packets of a specific kind back to back into a buffer, in host order.
+ *
+ * \param kind Kind of packet.
+ * \param n    Number of packets.
+ *
+ * \return Buffer with n packets.
+ */
+std::vector<uint32_t> write_packets(PacketKind kind, int n);
+
+/**
+ * Write a mix of packets back to back into a buffer, in host order. Mostly data packets with an occasional context
+ * packet, as in a typical stream.
+ *
+ * \param n Number of packets.
+ *
+ * \return Buffer with n packets.
+ */
+std::vector<uint32_t> write_packet_mix(int n);
+
+/**
+ * Report packets/s and bytes/s.
+ *
+ * \param state   Benchmark state.
+ * \param packets Number of processed packets per iteration.
+ * \param words   Number of processed 32-bit words per iteration.
+ */
+void set_rates(benchmark::State& state, int64_t packets, int64_t words);
+
+/**
+ * Register a benchmark for every packet kind, with the kind as the first argument.
+ *
+ * \param b Benchmark.
+ */
+void all_kinds(benchmark::internal::Benchmark* b);
+
+#endif
@@ -0,0 +1,180 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <vrt/vrt_byte_swap.h>
+#include <vrt/vrt_convert.h>
+#include <vrt/vrt_types.h>
+
+/* Number of body words. A typical jumbo frame body. */
+static constexpr int32_t kWords = 2048;
+
+/* Map 16-bit signed items to [-1, 1) */
+static constexpr float kScale = 1.0F / 32768;
+
+static std::vector<uint32_t> random_body() {
+    std::mt19937          gen(42);
+    std::vector<uint32_t> body(kWords);
+    for (uint32_t& w : body) {
+        w = gen();
+    }
+    return body;
+}
+
+static vrt_data_packet_payload_format complex_int16_format() {
+    vrt_data_packet_payload_format f{};
+    f.packing_method          = VRT_PM_PROCESSING_EFFICIENT;
+    f.real_or_complex         = VRT_ROC_COMPLEX_CARTESIAN;
+    f.data_item_format        = VRT_DIF_SIGNED_FIXED_POINT;
+    f.item_packing_field_size = 15;
+    f.data_item_size          = 15;
+    return f;
+}
+
+static void BM_convert_to_float_scalar_loop(benchmark::State& state) {
+    std::vector<uint32_t> body = random_body();
+    std::vector<float>    dst(2 * kWords);
+    for (auto _ : state) {
+        for (int32_t i = 0; i < kWords; ++i) {
+            dst[2 * i]     = static_cast<float>(static_cast<int16_t>(body[i] >> 16)) * kScale;
+            dst[2 * i + 1] = static_cast<float>(static_cast<int16_t>(body[i] & 0xFFFFU)) * kScale;
+        }
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * 2 * kWords);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * kWords * 4);
+}
+BENCHMARK(BM_convert_to_float_scalar_loop);
+
+static void BM_convert_to_float(benchmark::State& state) {
+    std::vector<uint32_t>          body = random_body();
+    std::vector<float>             dst(2 * kWords);
+    vrt_data_packet_payload_format f = complex_int16_format();
+    vrt_converter                  c{};
+    if (vrt_init_converter(&c, &f, kScale) < 0) {
+        state.SkipWithError("Failed to initialize converter");
+        return;
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(vrt_convert_to_float(&c, body.data(), kWords, dst.data(), 2 * kWords));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * 2 * kWords);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * kWords * 4);
+}
+BENCHMARK(BM_convert_to_float);
+
+static void BM_convert_to_float_be(benchmark::State& state) {
+    std::vector<uint32_t>          body = random_body();
+    std::vector<float>             dst(2 * kWords);
+    vrt_data_packet_payload_format f = complex_int16_format();
+    vrt_converter                  c{};
+    if (vrt_init_converter(&c, &f, kScale) < 0) {
+        state.SkipWithError("Failed to initialize converter");
+        return;
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(vrt_convert_to_float_be(&c, body.data(), kWords, dst.data(), 2 * kWords));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * 2 * kWords);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * kWords * 4);
+}
+BENCHMARK(BM_convert_to_float_be);
+
+static vrt_data_packet_payload_format link_int12_format() {
+    vrt_data_packet_payload_format f = complex_int16_format();
+    f.packing_method                 = VRT_PM_LINK_EFFICIENT;
+    f.item_packing_field_size        = 11;
+    f.data_item_size                 = 11;
+    return f;
+}
+
+static void BM_convert_to_float_link12(benchmark::State& state) {
+    std::vector<uint32_t>          body = random_body();
+    std::vector<float>             dst(kWords * 32 / 12);
+    vrt_data_packet_payload_format f = link_int12_format();
+    vrt_converter                  c{};
+    if (vrt_init_converter(&c, &f, kScale) < 0) {
+        state.SkipWithError("Failed to initialize converter");
+        return;
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            vrt_convert_to_float(&c, body.data(), kWords, dst.data(), static_cast<int32_t>(dst.size())));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(dst.size()));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * kWords * 4);
+}
+BENCHMARK(BM_convert_to_float_link12);
+
+static void BM_unpack_items_link12(benchmark::State& state) {
+    std::vector<uint32_t>          body = random_body();
+    std::vector<int64_t>           items(kWords * 32 / 12);
+    vrt_data_packet_payload_format f = link_int12_format();
+    vrt_converter                  c{};
+    if (vrt_init_converter(&c, &f, kScale) < 0) {
+        state.SkipWithError("Failed to initialize converter");
+        return;
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(vrt_unpack_items(&c, body.data(), kWords, items.data(), nullptr, nullptr,
+                                                  static_cast<int32_t>(items.size())));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(items.size()));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * kWords * 4);
+}
+BENCHMARK(BM_unpack_items_link12);
+
+static std::vector<float> random_floats(std::size_t n) {
+    std::mt19937                          gen(42);
+    std::uniform_real_distribution<float> dist(-1.1F, 1.1F);
+    std::vector<float>                    src(n);
+    for (float& x : src) {
+        x = dist(gen);
+    }
+    return src;
+}
+
+static void BM_convert_from_float(benchmark::State& state) {
+    std::vector<float>             src = random_floats(2 * kWords);
+    std::vector<uint32_t>          body(kWords);
+    vrt_data_packet_payload_format f = complex_int16_format();
+    vrt_converter                  c{};
+    if (vrt_init_converter(&c, &f, kScale) < 0) {
+        state.SkipWithError("Failed to initialize converter");
+        return;
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(vrt_convert_from_float(&c, src.data(), 2 * kWords, body.data(), kWords));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * 2 * kWords);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * kWords * 4);
+}
+BENCHMARK(BM_convert_from_float);
+
+static void BM_convert_from_float_link12(benchmark::State& state) {
+    std::vector<float>             src = random_floats(kWords * 32 / 12);
+    std::vector<uint32_t>          body(kWords);
+    vrt_data_packet_payload_format f = link_int12_format();
+    vrt_converter                  c{};
+    if (vrt_init_converter(&c, &f, 1.0F / 2048) < 0) {
+        state.SkipWithError("Failed to initialize converter");
+        return;
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            vrt_convert_from_float(&c, src.data(), static_cast<int32_t>(src.size()), body.data(), kWords));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(src.size()));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * kWords * 4);
+}
+BENCHMARK(BM_convert_from_float_link12);
@@ -0,0 +1,368 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <vrt/vrt_byte_swap.h>
+#include <vrt/vrt_context_cache.h>
+#include <vrt/vrt_demux.h>
+#include <vrt/vrt_if_context_view.h>
+#include <vrt/vrt_read.h>
+#include <vrt/vrt_read_inline.h>
+#include <vrt/vrt_types.h>
+#include <vrt/vrt_validate.h>
+#include <vrt/vrt_words.h>
+
+#include "../../src/vrt_util_internal.h"
+#include "packet_mix.h"
+
+/* Number of packets in each buffer. Large enough to not fit in L1 cache for the bigger packet kinds. */
+static constexpr int kPackets = 256;
+
+static void BM_read_header(benchmark::State& state) {
+    std::vector<uint32_t> buf = write_packets(PacketKind::kTimestampedData, kPackets);
+    vrt_header            h{};
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < buf.size(); i += h.packet_size) {
+            benchmark::DoNotOptimize(vrt_read_header(buf.data() + i, 1, &h, VRT_VALIDATION_FULL));
+        }
+        benchmark::ClobberMemory();
+    }
+    set_rates(state, kPackets, kPackets);
+}
+BENCHMARK(BM_read_header);
+
+static void BM_read_fields(benchmark::State& state) {
+    std::vector<uint32_t> buf = write_packets(PacketKind::kTimestampedData, kPackets);
+    vrt_header            h{};
+    vrt_fields            f{};
+    if (vrt_read_header(buf.data(), 1, &h, VRT_VALIDATION_FULL) < 0) {
+        state.SkipWithError("Failed to read header");
+        return;
+    }
+    const int32_t words_fields = vrt_words_fields(&h);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < buf.size(); i += h.packet_size) {
+            benchmark::DoNotOptimize(vrt_read_fields(&h, buf.data() + i + 1, words_fields, &f, VRT_VALIDATION_FULL));
+        }
+        benchmark::ClobberMemory();
+    }
+    set_rates(state, kPackets, static_cast<int64_t>(kPackets) * words_fields);
+}
+BENCHMARK(BM_read_fields);
+
+static void BM_read_header_fields_inline(benchmark::State& state) {
+    std::vector<uint32_t> buf = write_packets(PacketKind::kTimestampedData, kPackets);
+    vrt_header            h{};
+    vrt_fields            f{};
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < buf.size(); i += h.packet_size) {
+            benchmark::DoNotOptimize(vrt_read_header_inline(buf.data() + i, 1, &h, VRT_VALIDATION_NONE));
+            benchmark::DoNotOptimize(vrt_read_fields_inline(&h, buf.data() + i + 1, 6, &f, VRT_VALIDATION_NONE));
+        }
+        benchmark::ClobberMemory();
+    }
+    set_rates(state, kPackets, static_cast<int64_t>(kPackets) * (1 + vrt_words_fields(&h)));
+}
+BENCHMARK(BM_read_header_fields_inline);
+
+static void BM_read_header_fields_library(benchmark::State& state) {
+    std::vector<uint32_t> buf = write_packets(PacketKind::kTimestampedData, kPackets);
+    vrt_header            h{};
+    vrt_fields            f{};
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < buf.size(); i += h.packet_size) {
+            benchmark::DoNotOptimize(vrt_read_header(buf.data() + i, 1, &h, VRT_VALIDATION_NONE));
+            benchmark::DoNotOptimize(vrt_read_fields(&h, buf.data() + i + 1, 6, &f, VRT_VALIDATION_NONE));
+        }
+        benchmark::ClobberMemory();
+    }
+    set_rates(state, kPackets, static_cast<int64_t>(kPackets) * (1 + vrt_words_fields(&h)));
+}
+BENCHMARK(BM_read_header_fields_library);
+
+static void BM_read_trailer_random(benchmark::State& state) {
+    /* Random trailer contents, so that indicator enables can't be predicted */
+    std::vector<uint32_t> buf(kPackets);
+    std::mt19937          rng(1);
+    for (uint32_t& w : buf) {
+        w = static_cast<uint32_t>(rng());
+    }
+    vrt_trailer t{};
+    for (auto _ : state) {
+        for (const uint32_t& w : buf) {
+            benchmark::DoNotOptimize(vrt_read_trailer(&w, 1, &t));
+        }
+        benchmark::ClobberMemory();
+    }
+    set_rates(state, kPackets, kPackets);
+}
+BENCHMARK(BM_read_trailer_random);
+
+static void BM_read_if_context(benchmark::State& state) {
+    const auto            kind = static_cast<PacketKind>(state.range(0));
+    std::vector<uint32_t> buf  = write_packets(kind, kPackets);
+    vrt_packet            p{};
+    if (vrt_read_packet(buf.data(), static_cast<int32_t>(buf.size()), &p, VRT_VALIDATION_FULL) < 0 ||
+        p.header.packet_type != VRT_PT_IF_CONTEXT) {
+        state.SkipWithError("Not an IF context packet");
+        return;
+    }
+    const int32_t  words_packet = p.header.packet_size;
+    const int32_t  words_pre    = 1 + vrt_words_fields(&p.header);
+    vrt_if_context c{};
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < buf.size(); i += words_packet) {
+            benchmark::DoNotOptimize(
+                vrt_read_if_context(buf.data() + i + words_pre, words_packet - words_pre, &c, VRT_VALIDATION_FULL));
+        }
+        benchmark::ClobberMemory();
+    }
+    set_rates(state, kPackets, static_cast<int64_t>(kPackets) * (words_packet - words_pre));
+}
+BENCHMARK(BM_read_if_context)
+    ->ArgName("kind")
+    ->Arg(static_cast<int64_t>(PacketKind::kFullContext))
+    ->Arg(static_cast<int64_t>(PacketKind::kGpsAscii))
+    ->Arg(static_cast<int64_t>(PacketKind::kAssociationLists));
+
+static void BM_read_if_context_view(benchmark::State& state) {
+    std::vector<uint32_t> buf = write_packets(PacketKind::kFullContext, kPackets);
+    vrt_packet            p{};
+    if (vrt_read_packet(buf.data(), static_cast<int32_t>(buf.size()), &p, VRT_VALIDATION_FULL) < 0) {
+        state.SkipWithError("Failed to read packet");
+        return;
+    }
+    const int32_t       words_packet = p.header.packet_size;
+    const int32_t       words_pre    = 1 + vrt_words_fields(&p.header);
+    vrt_if_context_view v{};
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < buf.size(); i += words_packet) {
+            double sample_rate            = 0.0;
+            double rf_reference_frequency = 0.0;
+            benchmark::DoNotOptimize(vrt_read_if_context_view(buf.data() + i + words_pre, words_packet - words_pre, &v,
+                                                              VRT_VALIDATION_FULL));
+            benchmark::DoNotOptimize(vrt_if_context_view_sample_rate(&v, &sample_rate));
+            benchmark::DoNotOptimize(vrt_if_context_view_rf_reference_frequency(&v, &rf_reference_frequency));
+        }
+        benchmark::ClobberMemory();
+    }
+    set_rates(state, kPackets, static_cast<int64_t>(kPackets) * (words_packet - words_pre));
+}
+BENCHMARK(BM_read_if_context_view);
+
+/**
+ * Size of the fixed size fields of an IF context section, with one branch per field as before weighted popcounts were
+ * used. Kept as a reference for BM_if_context_offset.
+ */
+static int32_t if_context_offset_branches(uint32_t indicator) {
+    int32_t words = 1;
+    for (uint32_t bit = 30; bit > VRT_CIF0_BIT_GPS_ASCII; --bit) {
+        if ((indicator & (1U << bit)) != 0) {
+            if ((VRT_CIF0_WORDS_1 & (1U << bit)) != 0) {
+                words += 1;
+            } else if ((VRT_CIF0_WORDS_2 & (1U << bit)) != 0) {
+                words += 2;
+            } else if ((VRT_CIF0_WORDS_11 & (1U << bit)) != 0) {
+                words += 11;
+            } else {
+                words += 13;
+            }
+        }
+    }
+    return words;
+}
+
+static void BM_if_context_offset(benchmark::State& state) {
+    const bool branches = state.range(0) != 0;
+    /* Random indicator fields, so that field presence can't be predicted */
+    std::vector<uint32_t> indicators(kPackets);
+    std::mt19937          rng(3);
+    for (uint32_t& indicator : indicators) {
+        indicator = static_cast<uint32_t>(rng()) & 0x7FFFFC00U;
+        if (vrt_if_context_offset(indicator, VRT_CIF0_BIT_GPS_ASCII) != if_context_offset_branches(indicator)) {
+            state.SkipWithError("Offsets differ");
+            return;
+        }
+    }
+    for (auto _ : state) {
+        for (uint32_t indicator : indicators) {
+            benchmark::DoNotOptimize(branches ? if_context_offset_branches(indicator)
+                                              : vrt_if_context_offset(indicator, VRT_CIF0_BIT_GPS_ASCII));
+        }
+        benchmark::ClobberMemory();
+    }
+    set_rates(state, kPackets, kPackets);
+}
+BENCHMARK(BM_if_context_offset)->ArgName("branches")->Arg(0)->Arg(1);
+
+static void BM_read_if_context_cached(benchmark::State& state) {
+    std::vector<uint32_t> buf = write_packets(PacketKind::kFullContext, kPackets);
+    vrt_packet            p{};
+    if (vrt_read_packet(buf.data(), static_cast<int32_t>(buf.size()), &p, VRT_VALIDATION_FULL) < 0) {
+        state.SkipWithError("Failed to read packet");
+        return;
+    }
+    const int32_t words_packet = p.header.packet_size;
+    const int32_t words_pre    = 1 + vrt_words_fields(&p.header);
+    /* Unchanged context, as in the steady state of a stream */
+    for (std::size_t i = 0; i < buf.size(); i += words_packet) {
+        buf[i + words_pre] &= ~0x80000000U;
+    }
+
+    std::array<vrt_context_cache_entry, 4> entries{};
+    std::vector<uint32_t>                  words(entries.size() * words_packet);
+    vrt_context_cache                      cache{};
+    if (vrt_init_context_cache(&cache, entries.data(), entries.size(), words.data(), words_packet) < 0) {
+        state.SkipWithError("Failed to initialize cache");
+        return;
+    }
+    const vrt_if_context* c = nullptr;
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < buf.size(); i += words_packet) {
+            benchmark::DoNotOptimize(vrt_read_if_context_cached(&cache, p.fields.stream_id, buf.data() + i + words_pre,
+                                                                words_packet - words_pre, &c, VRT_VALIDATION_FULL));
+        }
+        benchmark::ClobberMemory();
+    }
+    set_rates(state, kPackets, static_cast<int64_t>(kPackets) * (words_packet - words_pre));
+}
+BENCHMARK(BM_read_if_context_cached);
+
+static void BM_read_packet(benchmark::State& state) {
+    const auto            kind = static_cast<PacketKind>(state.range(0));
+    std::vector<uint32_t> buf  = write_packets(kind, kPackets);
+    vrt_packet            p{};
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < buf.size();) {
+            int32_t rv = vrt_read_packet(buf.data() + i, static_cast<int32_t>(buf.size() - i), &p, VRT_VALIDATION_FULL);
+            if (rv <= 0) {
+                state.SkipWithError("Failed to read packet");
+                return;
+            }
+            i += rv;
+        }
+        benchmark::ClobberMemory();
+    }
+    set_rates(state, kPackets, static_cast<int64_t>(buf.size()));
+}
+BENCHMARK(BM_read_packet)->Apply(all_kinds);
+
+static void BM_read_packet_mix(benchmark::State& state) {
+    const auto            validate = static_cast<vrt_validation>(state.range(0));
+    std::vector<uint32_t> buf      = write_packet_mix(kPackets);
+    vrt_packet            p{};
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < buf.size();) {
+            int32_t rv = vrt_read_packet(buf.data() + i, static_cast<int32_t>(buf.size() - i), &p, validate);
+            if (rv <= 0) {
+                state.SkipWithError("Failed to read packet");
+                return;
+            }
+            i += rv;
+        }
+        benchmark::ClobberMemory();
+    }
+    set_rates(state, kPackets, static_cast<int64_t>(buf.size()));
+}
+BENCHMARK(BM_read_packet_mix)
+    ->ArgName("validate")
+    ->Arg(VRT_VALIDATION_NONE)
+    ->Arg(VRT_VALIDATION_STRUCTURAL)
+    ->Arg(VRT_VALIDATION_FULL);
+
+static void BM_read_packet_be_mix(benchmark::State& state) {
+    std::vector<uint32_t> buf = write_packet_mix(kPackets);
+    vrt_byte_swap(buf.data(), buf.data(), static_cast<int32_t>(buf.size()));
+    vrt_packet p{};
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < buf.size();) {
+            int32_t rv =
+                vrt_read_packet_be(buf.data() + i, static_cast<int32_t>(buf.size() - i), &p, VRT_VALIDATION_FULL);
+            if (rv <= 0) {
+                state.SkipWithError("Failed to read packet");
+                return;
+            }
+            i += rv;
+        }
+        benchmark::ClobberMemory();
+    }
+    set_rates(state, kPackets, static_cast<int64_t>(buf.size()));
+}
+BENCHMARK(BM_read_packet_be_mix);
+
+static void BM_read_packets_mix(benchmark::State& state) {
+    std::vector<uint32_t>              buf = write_packet_mix(kPackets);
+    std::vector<vrt_packet_descriptor> descs(kPackets);
+    int32_t                            words_read = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(vrt_read_packets(buf.data(), static_cast<int32_t>(buf.size()), descs.data(),
+                                                  kPackets, &words_read, VRT_VALIDATION_FULL));
+        benchmark::ClobberMemory();
+    }
+    set_rates(state, kPackets, static_cast<int64_t>(buf.size()));
+}
+BENCHMARK(BM_read_packets_mix);
+
+static void BM_validate_packets_mix(benchmark::State& state) {
+    std::vector<uint32_t> buf        = write_packet_mix(kPackets);
+    int32_t               words_read = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(vrt_validate_packets(buf.data(), static_cast<int32_t>(buf.size()), &words_read));
+        benchmark::ClobberMemory();
+    }
+    set_rates(state, kPackets, static_cast<int64_t>(buf.size()));
+}
+BENCHMARK(BM_validate_packets_mix);
+
+static void count_packet(const vrt_packet_descriptor* /*descriptor*/, void* user) {
+    *static_cast<int64_t*>(user) += 1;
+}
+
+static void BM_demux_dispatch(benchmark::State& state) {
+    const auto                         streams = static_cast<uint32_t>(state.range(0));
+    std::vector<uint32_t>              buf     = write_packet_mix(kPackets);
+    std::vector<vrt_packet_descriptor> descs(kPackets);
+    int32_t                            words_read = 0;
+    if (vrt_read_packets(buf.data(), static_cast<int32_t>(buf.size()), descs.data(), kPackets, &words_read,
+                         VRT_VALIDATION_FULL) != kPackets) {
+        state.SkipWithError("Failed to read packets");
+        return;
+    }
+    /* Interleave streams in runs of 4 packets */
+    for (std::size_t i = 0; i < descs.size(); ++i) {
+        descs[i].fields.stream_id = static_cast<uint32_t>(i / 4) % streams;
+    }
+
+    std::vector<vrt_demux_entry> entries(256);
+    std::vector<int64_t>         counts(streams);
+    vrt_demux                    demux{};
+    if (vrt_init_demux(&demux, entries.data(), static_cast<int32_t>(entries.size()), nullptr, nullptr) < 0) {
+        state.SkipWithError("Failed to initialize demultiplexer");
+        return;
+    }
+    for (uint32_t i = 0; i < streams; ++i) {
+        if (vrt_demux_add(&demux, i, count_packet, &counts[i]) < 0) {
+            state.SkipWithError("Failed to add stream");
+            return;
+        }
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(vrt_demux_dispatch(&demux, descs.data(), kPackets));
+        benchmark::ClobberMemory();
+    }
+    set_rates(state, kPackets, static_cast<int64_t>(buf.size()));
+}
+BENCHMARK(BM_demux_dispatch)->ArgName("streams")->Arg(1)->Arg(32);
+
+static void BM_byte_swap(benchmark::State& state) {
+    std::vector<uint32_t> buf(state.range(0), 0x01020304);
+    for (auto _ : state) {
+        vrt_byte_swap(buf.data(), buf.data(), static_cast<int32_t>(buf.size()));
+        benchmark::ClobberMemory();
+    }
+    set_rates(state, 1, static_cast<int64_t>(buf.size()));
+}
+BENCHMARK(BM_byte_swap)->ArgName("words")->Arg(8)->Arg(360)->Arg(16384);
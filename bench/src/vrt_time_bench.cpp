@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+
+#include <vrt/vrt_time.h>
+#include <vrt/vrt_types.h>
+
+#include "packet_mix.h"
+
+/* Sample rate used when TSF is sample count */
+static constexpr double kSampleRate = 25e6;
+
+static void BM_time_difference_fields(benchmark::State& state) {
+    PacketStorage storage;
+    init_packet(PacketKind::kTimestampedData, &storage);
+    const vrt_packet* p1 = &storage.packet;
+    vrt_packet        p2 = *p1;
+    p2.fields.integer_seconds_timestamp += 3;
+    p2.fields.fractional_seconds_timestamp /= 2;
+    vrt_time diff{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            vrt_time_difference_fields(&p2.header, &p2.fields, &p1->header, &p1->fields, kSampleRate, &diff));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_time_difference_fields);
+
+static void BM_time_calendar_fields(benchmark::State& state) {
+    PacketStorage storage;
+    init_packet(PacketKind::kTimestampedData, &storage);
+    const vrt_packet* p = &storage.packet;
+    vrt_calendar_time cal{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(vrt_time_calendar_fields(&p->header, &p->fields, kSampleRate, &cal));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_time_calendar_fields);
+
+static void BM_time_calendar_gps_geolocation(benchmark::State& state) {
+    PacketStorage storage;
+    init_packet(PacketKind::kFullContext, &storage);
+    const vrt_packet* p = &storage.packet;
+    vrt_calendar_time cal{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(vrt_time_calendar_gps_geolocation(&p->if_context, kSampleRate, &cal));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_time_calendar_gps_geolocation);
+
+static void BM_time_calendar_ecef_ephemeris(benchmark::State& state) {
+    PacketStorage storage;
+    init_packet(PacketKind::kFullContext, &storage);
+    const vrt_packet* p = &storage.packet;
+    vrt_calendar_time cal{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(vrt_time_calendar_ecef_ephemeris(&p->if_context, kSampleRate, &cal));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_time_calendar_ecef_ephemeris);
@@ -0,0 +1,220 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <vrt/vrt_context_encoder.h>
+#include <vrt/vrt_init.h>
+#include <vrt/vrt_packet_template.h>
+#include <vrt/vrt_packetizer.h>
+#include <vrt/vrt_read.h>
+#include <vrt/vrt_types.h>
+#include <vrt/vrt_words.h>
+#include <vrt/vrt_write.h>
+
+#include "packet_mix.h"
+
+static void BM_write_header(benchmark::State& state) {
+    PacketStorage storage;
+    init_packet(PacketKind::kTimestampedData, &storage);
+    uint32_t buf = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(vrt_write_header(&storage.packet.header, &buf, 1, VRT_VALIDATION_FULL));
+        benchmark::ClobberMemory();
+    }
+    set_rates(state, 1, 1);
+}
+BENCHMARK(BM_write_header);
+
+static void BM_write_fields(benchmark::State& state) {
+    PacketStorage storage;
+    init_packet(PacketKind::kTimestampedData, &storage);
+    const vrt_packet*     p = &storage.packet;
+    std::vector<uint32_t> buf(vrt_words_fields(&p->header));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(vrt_write_fields(&p->header, &p->fields, buf.data(), static_cast<int32_t>(buf.size()),
+                                                  VRT_VALIDATION_FULL));
+        benchmark::ClobberMemory();
+    }
+    set_rates(state, 1, static_cast<int64_t>(buf.size()));
+}
+BENCHMARK(BM_write_fields);
+
+static void BM_write_trailer_random(benchmark::State& state) {
+    /* Random trailer contents, so that indicator enables can't be predicted */
+    std::vector<vrt_trailer> trailers(256);
+    std::mt19937             rng(1);
+    for (vrt_trailer& t : trailers) {
+        const auto w = static_cast<uint32_t>(rng());
+        if (vrt_read_trailer(&w, 1, &t) < 0) {
+            state.SkipWithError("Failed to read trailer");
+            return;
+        }
+    }
+    uint32_t buf = 0;
+    for (auto _ : state) {
+        for (const vrt_trailer& t : trailers) {
+            benchmark::DoNotOptimize(vrt_write_trailer(&t, &buf, 1, VRT_VALIDATION_FULL));
+            benchmark::ClobberMemory();
+        }
+    }
+    set_rates(state, static_cast<int64_t>(trailers.size()), static_cast<int64_t>(trailers.size()));
+}
+BENCHMARK(BM_write_trailer_random);
+
+static void BM_write_if_context(benchmark::State& state) {
+    PacketStorage storage;
+    init_packet(static_cast<PacketKind>(state.range(0)), &storage);
+    const vrt_if_context* c = &storage.packet.if_context;
+    std::vector<uint32_t> buf(vrt_words_if_context(c));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(vrt_write_if_context(c, buf.data(), static_cast<int32_t>(buf.size()),
+                                                      VRT_VALIDATION_FULL));
+        benchmark::ClobberMemory();
+    }
+    set_rates(state, 1, static_cast<int64_t>(buf.size()));
+}
+BENCHMARK(BM_write_if_context)
+    ->ArgName("kind")
+    ->Arg(static_cast<int64_t>(PacketKind::kFullContext))
+    ->Arg(static_cast<int64_t>(PacketKind::kGpsAscii))
+    ->Arg(static_cast<int64_t>(PacketKind::kAssociationLists));
+
+static void BM_write_if_context_delta(benchmark::State& state) {
+    PacketStorage storage;
+    init_packet(static_cast<PacketKind>(state.range(0)), &storage);
+    const vrt_if_context* c = &storage.packet.if_context;
+    std::vector<uint32_t> buf(vrt_words_if_context(c));
+    vrt_context_encoder   encoder{};
+    vrt_init_context_encoder(&encoder);
+    for (auto _ : state) {
+        /* Periodic full resend of unchanged context */
+        benchmark::DoNotOptimize(vrt_write_if_context_delta(&encoder, c, true, buf.data(),
+                                                            static_cast<int32_t>(buf.size()), VRT_VALIDATION_FULL));
+        benchmark::ClobberMemory();
+    }
+    set_rates(state, 1, static_cast<int64_t>(buf.size()));
+}
+BENCHMARK(BM_write_if_context_delta)
+    ->ArgName("kind")
+    ->Arg(static_cast<int64_t>(PacketKind::kFullContext))
+    ->Arg(static_cast<int64_t>(PacketKind::kGpsAscii));
+
+static void BM_write_packet(benchmark::State& state) {
+    PacketStorage storage;
+    init_packet(static_cast<PacketKind>(state.range(0)), &storage);
+    const vrt_packet*     p = &storage.packet;
+    std::vector<uint32_t> buf(p->header.packet_size);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(vrt_write_packet(p, buf.data(), static_cast<int32_t>(buf.size()),
+                                                  VRT_VALIDATION_FULL));
+        benchmark::ClobberMemory();
+    }
+    set_rates(state, 1, static_cast<int64_t>(buf.size()));
+}
+BENCHMARK(BM_write_packet)->Apply(all_kinds);
+
+static void BM_write_packet_be(benchmark::State& state) {
+    PacketStorage storage;
+    init_packet(static_cast<PacketKind>(state.range(0)), &storage);
+    const vrt_packet*     p = &storage.packet;
+    std::vector<uint32_t> buf(p->header.packet_size);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(vrt_write_packet_be(p, buf.data(), static_cast<int32_t>(buf.size()),
+                                                     VRT_VALIDATION_FULL));
+        benchmark::ClobberMemory();
+    }
+    set_rates(state, 1, static_cast<int64_t>(buf.size()));
+}
+BENCHMARK(BM_write_packet_be)->Apply(all_kinds);
+
+static void BM_write_packet_template(benchmark::State& state) {
+    PacketStorage storage;
+    init_packet(PacketKind::kTimestampedData, &storage);
+    const vrt_packet*   p = &storage.packet;
+    vrt_packet_template tmpl{};
+    if (vrt_compile_packet_template(&p->header, &p->fields, &p->trailer, &tmpl, VRT_VALIDATION_FULL) < 0) {
+        state.SkipWithError("Failed to compile template");
+        return;
+    }
+    std::vector<uint32_t> buf(p->header.packet_size);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(vrt_write_packet_template(&tmpl, p->fields.integer_seconds_timestamp,
+                                                           p->fields.fractional_seconds_timestamp, p->body,
+                                                           p->words_body, buf.data(),
+                                                           static_cast<int32_t>(buf.size())));
+        benchmark::ClobberMemory();
+    }
+    set_rates(state, 1, static_cast<int64_t>(buf.size()));
+}
+BENCHMARK(BM_write_packet_template);
+
+/* Burst of 1 MB of complex 16-bit samples, split into jumbo frames of 9000 bytes */
+static constexpr int32_t kBurstSamples = 262144;
+static constexpr int32_t kFrameWords   = 2250;
+
+/**
+ * Initialize packetizer of timestamped complex 16-bit samples, with stream ID and trailer.
+ */
+static int32_t init_burst_packetizer(vrt_packetizer* packetizer) {
+    vrt_header  h{};
+    vrt_fields  f{};
+    vrt_trailer t{};
+    vrt_init_header(&h);
+    vrt_init_fields(&f);
+    vrt_init_trailer(&t);
+    h.packet_type = VRT_PT_IF_DATA_WITH_STREAM_ID;
+    h.has.trailer = true;
+    h.tsi         = VRT_TSI_UTC;
+    h.tsf         = VRT_TSF_REAL_TIME;
+
+    vrt_data_packet_payload_format format{};
+    format.packing_method          = VRT_PM_PROCESSING_EFFICIENT;
+    format.real_or_complex         = VRT_ROC_COMPLEX_CARTESIAN;
+    format.data_item_format        = VRT_DIF_SIGNED_FIXED_POINT;
+    format.item_packing_field_size = 15;
+    format.data_item_size          = 15;
+
+    return vrt_init_packetizer(&h, &f, &t, &format, 1.0F / 32768, 10e6, kFrameWords, packetizer, VRT_VALIDATION_FULL);
+}
+
+static void BM_packetize_float(benchmark::State& state) {
+    vrt_packetizer packetizer{};
+    const int32_t  samples = init_burst_packetizer(&packetizer);
+    if (samples < 0) {
+        state.SkipWithError("Failed to initialize packetizer");
+        return;
+    }
+    const int32_t         packets = (kBurstSamples + samples - 1) / samples;
+    std::vector<float>    src(2 * kBurstSamples, 0.5F);
+    std::vector<uint32_t> buf(static_cast<std::size_t>(packets) * kFrameWords);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(vrt_packetize_float(&packetizer, src.data(), static_cast<int32_t>(src.size()),
+                                                     buf.data(), static_cast<int32_t>(buf.size())));
+        benchmark::ClobberMemory();
+    }
+    set_rates(state, packets, kBurstSamples);
+}
+BENCHMARK(BM_packetize_float);
+
+static void BM_packetize_iov(benchmark::State& state) {
+    vrt_packetizer packetizer{};
+    const int32_t  samples = init_burst_packetizer(&packetizer);
+    if (samples < 0) {
+        state.SkipWithError("Failed to initialize packetizer");
+        return;
+    }
+    const int32_t          packets = (kBurstSamples + samples - 1) / samples;
+    std::vector<uint32_t>  body(kBurstSamples);
+    std::vector<uint32_t>  parts(static_cast<std::size_t>(packets) * packetizer.words_overhead);
+    std::vector<vrt_iovec> iov(static_cast<std::size_t>(packets) * 3);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(vrt_packetize_iov(&packetizer, body.data(), 2 * kBurstSamples, parts.data(),
+                                                   static_cast<int32_t>(parts.size()), iov.data(),
+                                                   static_cast<int32_t>(iov.size())));
+        benchmark::ClobberMemory();
+    }
+    set_rates(state, packets, kBurstSamples);
+}
+BENCHMARK(BM_packetize_iov);
@@ -34,4 +34,6 @@ function(setup_target target)
     install(TARGETS "${target}" DESTINATION lib)
     file(GLOB FILES_HEADER CONFIGURE_DEPENDS "include/${target}/*.h")
     install(FILES ${FILES_HEADER} DESTINATION "include/${target}")
+    file(GLOB FILES_HEADER_DETAIL CONFIGURE_DEPENDS "include/${target}/detail/*.h")
+    install(FILES ${FILES_HEADER_DETAIL} DESTINATION "include/${target}/detail")
 endfunction()
@@ -0,0 +1,50 @@
+/*
+ * Read all VRT packets in a recording file, without copying them out of the file mapping, and count them per packet
+ * type. Note that this will fail to read a big endian-format, i.e. standard conforming, recording on a little endian
+ * platform. Use vrt_read_file_packets_be() for those.
+ */
+
+#include <vrt/vrt_file.h>
+#include <vrt/vrt_string.h>
+#include <vrt/vrt_types.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Number of packets to describe per call */
+#define N 64
+
+int main() {
+    /* Open file */
+    const char*            file_path = "signal.vrt";
+    struct vrt_file_reader reader;
+    int32_t                rv = vrt_open_file_reader(&reader, file_path, 0);
+    if (rv < 0) {
+        fprintf(stderr, "Failed to open file '%s': %s\n", file_path, vrt_string_error(rv));
+        return EXIT_FAILURE;
+    }
+
+    /* Walk all packets */
+    struct vrt_packet_descriptor d[N];
+    uint64_t                     counts[16] = {0};
+    while ((rv = vrt_read_file_packets(&reader, d, N, VRT_VALIDATION_FULL)) > 0) {
+        for (int32_t i = 0; i < rv; ++i) {
+            counts[d[i].header.packet_type] += 1;
+        }
+    }
+    vrt_close_file_reader(&reader);
+    if (rv < 0) {
+        fprintf(stderr, "Failed to read packets: %s\n", vrt_string_error(rv));
+        return EXIT_FAILURE;
+    }
+
+    /* Print number of packets of each type */
+    for (int32_t t = 0; t < 16; ++t) {
+        if (counts[t] > 0) {
+            printf("%s: %llu\n", vrt_string_packet_type((enum vrt_packet_type)t), (unsigned long long)counts[t]);
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -44,7 +44,7 @@ int main() {
     /* Parse header */
     int32_t           offset = 0;
     struct vrt_header h;
-    int32_t           rv = vrt_read_header(b + offset, SIZE - offset, &h, true);
+    int32_t           rv = vrt_read_header(b + offset, SIZE - offset, &h, VRT_VALIDATION_FULL);
     if (rv < 0) {
         fprintf(stderr, "Failed to parse header: %s\n", vrt_string_error(rv));
         return EXIT_FAILURE;
@@ -64,7 +64,7 @@ int main() {
 
     /* Parse fields */
     struct vrt_fields f;
-    rv = vrt_read_fields(&h, b + offset, SIZE - offset, &f, true);
+    rv = vrt_read_fields(&h, b + offset, SIZE - offset, &f, VRT_VALIDATION_FULL);
     if (rv < 0) {
         fprintf(stderr, "Failed to parse fields section: %s\n", vrt_string_error(rv));
         return EXIT_FAILURE;
@@ -83,7 +83,7 @@ int main() {
     if (h.packet_type == VRT_PT_IF_CONTEXT) {
         /* Parse context */
         struct vrt_if_context c;
-        rv = vrt_read_if_context(b + offset, SIZE - offset, &c, true);
+        rv = vrt_read_if_context(b + offset, SIZE - offset, &c, VRT_VALIDATION_FULL);
         if (rv < 0) {
             fprintf(stderr, "Failed to parse IF context section: %s\n", vrt_string_error(rv));
             return EXIT_FAILURE;
@@ -44,7 +44,7 @@ int main() {
 
     /* Parse packet */
     struct vrt_packet p;
-    int32_t           rv = vrt_read_packet(b, SIZE, &p, true);
+    int32_t           rv = vrt_read_packet(b, SIZE, &p, VRT_VALIDATION_FULL);
     if (rv < 0) {
         fprintf(stderr, "Failed to parse packet: %s\n", vrt_string_error(rv));
         return EXIT_FAILURE;
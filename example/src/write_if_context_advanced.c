@@ -43,7 +43,7 @@ int main() {
 
     /* Write header to buffer */
     int32_t offset = 0;
-    int32_t rv     = vrt_write_header(&h, b + offset, SIZE - offset, true);
+    int32_t rv     = vrt_write_header(&h, b + offset, SIZE - offset, VRT_VALIDATION_FULL);
     if (rv < 0) {
         fprintf(stderr, "Failed to write header: %s\n", vrt_string_error(rv));
         return EXIT_FAILURE;
@@ -51,7 +51,7 @@ int main() {
     offset += rv;
 
     /* Write fields to buffer */
-    rv = vrt_write_fields(&h, &f, b + offset, SIZE - offset, true);
+    rv = vrt_write_fields(&h, &f, b + offset, SIZE - offset, VRT_VALIDATION_FULL);
     if (rv < 0) {
         fprintf(stderr, "Failed to write fields section: %s\n", vrt_string_error(rv));
         return EXIT_FAILURE;
@@ -59,7 +59,7 @@ int main() {
     offset += rv;
 
     /* Write IF context to buffer */
-    rv = vrt_write_if_context(&c, b + offset, SIZE - offset, true);
+    rv = vrt_write_if_context(&c, b + offset, SIZE - offset, VRT_VALIDATION_FULL);
     if (rv < 0) {
         fprintf(stderr, "Failed to write IF context section: %s\n", vrt_string_error(rv));
         return EXIT_FAILURE;
@@ -36,7 +36,7 @@ int main() {
     p.if_context.temperature     = 24.0F;
 
     /* Write to buffer */
-    int32_t rv = vrt_write_packet(&p, b, SIZE, true);
+    int32_t rv = vrt_write_packet(&p, b, SIZE, VRT_VALIDATION_FULL);
     if (rv < 0) {
         fprintf(stderr, "Failed to write packet: %s\n", vrt_string_error(rv));
         return EXIT_FAILURE;
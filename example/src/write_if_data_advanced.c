@@ -53,7 +53,7 @@ int main() {
 
     /* Write header to buffer */
     int32_t offset = 0;
-    int32_t rv     = vrt_write_header(&h, b + offset, SIZE - offset, true);
+    int32_t rv     = vrt_write_header(&h, b + offset, SIZE - offset, VRT_VALIDATION_FULL);
     if (rv < 0) {
         fprintf(stderr, "Failed to write header: %s\n", vrt_string_error(rv));
         return EXIT_FAILURE;
@@ -61,7 +61,7 @@ int main() {
     offset += rv;
 
     /* Write fields to buffer */
-    rv = vrt_write_fields(&h, &f, b + offset, SIZE - offset, true);
+    rv = vrt_write_fields(&h, &f, b + offset, SIZE - offset, VRT_VALIDATION_FULL);
     if (rv < 0) {
         fprintf(stderr, "Failed to write fields section: %s\n", vrt_string_error(rv));
         return EXIT_FAILURE;
@@ -74,7 +74,7 @@ int main() {
     offset += SIZE - 3;
 
     /* Write trailer to buffer */
-    rv = vrt_write_trailer(&t, b + offset, SIZE - offset, true);
+    rv = vrt_write_trailer(&t, b + offset, SIZE - offset, VRT_VALIDATION_FULL);
     if (rv < 0) {
         fprintf(stderr, "Failed to write trailer: %s\n", vrt_string_error(rv));
         return EXIT_FAILURE;
@@ -49,7 +49,7 @@ int main() {
     p.trailer.reference_lock     = true;
 
     /* Write to buffer */
-    int32_t rv = vrt_write_packet(&p, b, SIZE, true);
+    int32_t rv = vrt_write_packet(&p, b, SIZE, VRT_VALIDATION_FULL);
     if (rv < 0) {
         fprintf(stderr, "Failed to write packet: %s\n", vrt_string_error(rv));
         return EXIT_FAILURE;
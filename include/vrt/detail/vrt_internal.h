@@ -0,0 +1,137 @@
+#ifndef INCLUDE_VRT_DETAIL_VRT_INTERNAL_H_
+#define INCLUDE_VRT_DETAIL_VRT_INTERNAL_H_
+
+/*
+ * Helpers shared by the library and the header-only inline readers and writers. Not part of the public API, and may
+ * change without notice.
+ */
+
+#include "../vrt_types.h"
+#include "../vrt_util.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Force inlining of functions specialized by constant arguments */
+#if defined(__GNUC__) || defined(__clang__)
+#define VRT_INTERNAL_FORCE_INLINE inline __attribute__((always_inline))
+#elif defined(_MSC_VER)
+#define VRT_INTERNAL_FORCE_INLINE __forceinline
+#else
+#define VRT_INTERNAL_FORCE_INLINE inline
+#endif
+
+/**
+ * True if 32-bit words must be byte swapped to convert between host order and network order (big endian). Evaluated
+ * at compile time when the compiler tells the platform endianess.
+ */
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__)
+#define VRT_INTERNAL_NETWORK_ORDER_SWAP (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#elif defined(_MSC_VER)
+#define VRT_INTERNAL_NETWORK_ORDER_SWAP true
+#else
+#define VRT_INTERNAL_NETWORK_ORDER_SWAP vrt_is_platform_little_endian()
+#endif
+
+/**
+ * Convert bool to uint32.
+ *
+ * \param b Bool to convert.
+ *
+ * \return 1 if true and 0 otherwise.
+ */
+inline uint32_t vrt_internal_b2u(bool b) {
+    return b ? 1 : 0;
+}
+
+/**
+ * Convert uint32 to bool.
+ *
+ * \param u uint32 to convert.
+ *
+ * \return false if 0 and true otherwise.
+ */
+inline uint32_t vrt_internal_u2b(uint32_t u) {
+    return u != 0;
+}
+
+/**
+ * Check if a packet has the fractional timestamp.
+ *
+ * \param t TSF field.
+ *
+ * \return true if it has the fractional timestamp.
+ */
+inline bool vrt_internal_has_fractional_timestamp(enum vrt_tsf t) {
+    return t != VRT_TSF_NONE;
+}
+
+/**
+ * Check if the packet structure shall be validated, i.e. packet type, sizes, and reserved bits.
+ *
+ * \param v Validation level.
+ *
+ * \return true for structural and full validation.
+ */
+inline bool vrt_internal_validate_structure(enum vrt_validation v) {
+    return v != VRT_VALIDATION_NONE;
+}
+
+/**
+ * Check if field contents shall be validated, i.e. bounds and consistency between fields.
+ *
+ * \param v Validation level.
+ *
+ * \return true for full validation, and for values outside the enum.
+ */
+inline bool vrt_internal_validate_content(enum vrt_validation v) {
+    return v != VRT_VALIDATION_NONE && v != VRT_VALIDATION_STRUCTURAL;
+}
+
+/**
+ * Reverse byte order of a 32-bit word.
+ *
+ * \param u Word.
+ *
+ * \return Byte swapped word.
+ */
+inline uint32_t vrt_internal_bswap32(uint32_t u) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap32(u);
+#else
+    return (u >> 24U) | ((u >> 8U) & 0x0000FF00U) | ((u << 8U) & 0x00FF0000U) | (u << 24U);
+#endif
+}
+
+/**
+ * Load a 32-bit word from buffer, and convert it to host order if required.
+ *
+ * \param b    Buffer to read from.
+ * \param swap True if the word shall be byte swapped.
+ *
+ * \return Word in host order.
+ */
+inline uint32_t vrt_internal_load(const uint32_t* b, bool swap) {
+    return swap ? vrt_internal_bswap32(*b) : *b;
+}
+
+/**
+ * Store a 32-bit host order word to buffer, and convert it to buffer order if required.
+ *
+ * \param u    Word in host order.
+ * \param b    Buffer to write to.
+ * \param swap True if the word shall be byte swapped.
+ */
+inline void vrt_internal_store(uint32_t u, uint32_t* b, bool swap) {
+    *b = swap ? vrt_internal_bswap32(u) : u;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
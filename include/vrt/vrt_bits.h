@@ -0,0 +1,263 @@
+#ifndef INCLUDE_VRT_VRT_BITS_H_
+#define INCLUDE_VRT_VRT_BITS_H_
+
+#include "vrt_util.h"
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Bit layout of the fields in header, trailer, context indicator field 0, and state and event indicator words. Each
+ * layout expands to the position of the field, counted from lsb, followed by its number of bits. Pass a layout directly
+ * to vrt_get_bits() or vrt_set_bits() to access a single field of a raw word, e.g.
+ *
+ *     vrt_get_bits(word, VRT_BITS_HEADER_PACKET_SIZE)
+ *
+ * The read and write functions decode and encode the structs from the same layouts.
+ */
+
+/**
+ * Position of a field, counted from lsb, given one of the layouts, e.g. VRT_BITS_POS(VRT_BITS_CIF0_GAIN).
+ */
+#define VRT_BITS_POS(layout)  VRT_BITS_POS_(layout)
+#define VRT_BITS_POS_(pos, n) (pos)
+/**
+ * Mask of a field in place, given one of the layouts, e.g. VRT_BITS_MASK(VRT_BITS_HEADER_PACKET_COUNT).
+ */
+#define VRT_BITS_MASK(layout)  VRT_BITS_MASK_(layout)
+#define VRT_BITS_MASK_(pos, n) ((0xFFFFFFFFU >> (32U - (n))) << (pos))
+
+/* Header word */
+/** Packet type. See enum vrt_packet_type. */
+#define VRT_BITS_HEADER_PACKET_TYPE 28, 4
+/** Class ID indicator (C). Set if the packet has the Class ID field. */
+#define VRT_BITS_HEADER_HAS_CLASS_ID 27, 1
+/** Trailer indicator (T). Set if the packet has the trailer. Data packets only. */
+#define VRT_BITS_HEADER_HAS_TRAILER 26, 1
+/** Reserved. Shall be 0. */
+#define VRT_BITS_HEADER_RESERVED 25, 1
+/** Timestamp mode (TSM). See enum vrt_tsm. Context packets only. */
+#define VRT_BITS_HEADER_TSM 24, 1
+/** Integer-seconds timestamp type (TSI). See enum vrt_tsi. */
+#define VRT_BITS_HEADER_TSI 22, 2
+/** Fractional-seconds timestamp type (TSF). See enum vrt_tsf. */
+#define VRT_BITS_HEADER_TSF 20, 2
+/** Packet count, modulo 16. */
+#define VRT_BITS_HEADER_PACKET_COUNT 16, 4
+/** Packet size in 32-bit words, including the header. */
+#define VRT_BITS_HEADER_PACKET_SIZE 0, 16
+
+/* Trailer word */
+/** Calibrated time enable. Set if the Calibrated time indicator is present. */
+#define VRT_BITS_TRAILER_HAS_CALIBRATED_TIME 31, 1
+/** Valid data enable. Set if the Valid data indicator is present. */
+#define VRT_BITS_TRAILER_HAS_VALID_DATA 30, 1
+/** Reference lock enable. Set if the Reference lock indicator is present. */
+#define VRT_BITS_TRAILER_HAS_REFERENCE_LOCK 29, 1
+/** AGC/MGC enable. Set if the AGC/MGC indicator is present. */
+#define VRT_BITS_TRAILER_HAS_AGC_OR_MGC 28, 1
+/** Detected signal enable. Set if the Detected signal indicator is present. */
+#define VRT_BITS_TRAILER_HAS_DETECTED_SIGNAL 27, 1
+/** Spectral inversion enable. Set if the Spectral inversion indicator is present. */
+#define VRT_BITS_TRAILER_HAS_SPECTRAL_INVERSION 26, 1
+/** Over-range enable. Set if the Over-range indicator is present. */
+#define VRT_BITS_TRAILER_HAS_OVER_RANGE 25, 1
+/** Sample loss enable. Set if the Sample loss indicator is present. */
+#define VRT_BITS_TRAILER_HAS_SAMPLE_LOSS 24, 1
+/** User defined 11 enable. Set if the User defined 11 indicator is present. */
+#define VRT_BITS_TRAILER_HAS_USER_DEFINED11 23, 1
+/** User defined 10 enable. Set if the User defined 10 indicator is present. */
+#define VRT_BITS_TRAILER_HAS_USER_DEFINED10 22, 1
+/** User defined 9 enable. Set if the User defined 9 indicator is present. */
+#define VRT_BITS_TRAILER_HAS_USER_DEFINED9 21, 1
+/** User defined 8 enable. Set if the User defined 8 indicator is present. */
+#define VRT_BITS_TRAILER_HAS_USER_DEFINED8 20, 1
+/** Calibrated time indicator. */
+#define VRT_BITS_TRAILER_CALIBRATED_TIME 19, 1
+/** Valid data indicator. */
+#define VRT_BITS_TRAILER_VALID_DATA 18, 1
+/** Reference lock indicator. */
+#define VRT_BITS_TRAILER_REFERENCE_LOCK 17, 1
+/** AGC/MGC indicator. See enum vrt_agc_or_mgc. */
+#define VRT_BITS_TRAILER_AGC_OR_MGC 16, 1
+/** Detected signal indicator. */
+#define VRT_BITS_TRAILER_DETECTED_SIGNAL 15, 1
+/** Spectral inversion indicator. */
+#define VRT_BITS_TRAILER_SPECTRAL_INVERSION 14, 1
+/** Over-range indicator. */
+#define VRT_BITS_TRAILER_OVER_RANGE 13, 1
+/** Sample loss indicator. */
+#define VRT_BITS_TRAILER_SAMPLE_LOSS 12, 1
+/** User defined 11 indicator. */
+#define VRT_BITS_TRAILER_USER_DEFINED11 11, 1
+/** User defined 10 indicator. */
+#define VRT_BITS_TRAILER_USER_DEFINED10 10, 1
+/** User defined 9 indicator. */
+#define VRT_BITS_TRAILER_USER_DEFINED9 9, 1
+/** User defined 8 indicator. */
+#define VRT_BITS_TRAILER_USER_DEFINED8 8, 1
+/** Associated context packet count enable (E). Set if the count is present. */
+#define VRT_BITS_TRAILER_HAS_ASSOCIATED_CONTEXT_PACKET_COUNT 7, 1
+/** Associated context packet count. */
+#define VRT_BITS_TRAILER_ASSOCIATED_CONTEXT_PACKET_COUNT 0, 7
+
+/* Context indicator field 0 (CIF0) word, i.e. the first word of the IF context section */
+/** Context field change indicator. Set if any context field has changed. */
+#define VRT_BITS_CIF0_CONTEXT_FIELD_CHANGE_INDICATOR 31, 1
+/** Set if the Reference point identifier field is present. */
+#define VRT_BITS_CIF0_REFERENCE_POINT_IDENTIFIER 30, 1
+/** Set if the Bandwidth field is present. */
+#define VRT_BITS_CIF0_BANDWIDTH 29, 1
+/** Set if the IF reference frequency field is present. */
+#define VRT_BITS_CIF0_IF_REFERENCE_FREQUENCY 28, 1
+/** Set if the RF reference frequency field is present. */
+#define VRT_BITS_CIF0_RF_REFERENCE_FREQUENCY 27, 1
+/** Set if the RF reference frequency offset field is present. */
+#define VRT_BITS_CIF0_RF_REFERENCE_FREQUENCY_OFFSET 26, 1
+/** Set if the IF band offset field is present. */
+#define VRT_BITS_CIF0_IF_BAND_OFFSET 25, 1
+/** Set if the Reference level field is present. */
+#define VRT_BITS_CIF0_REFERENCE_LEVEL 24, 1
+/** Set if the Gain field is present. */
+#define VRT_BITS_CIF0_GAIN 23, 1
+/** Set if the Over-range count field is present. */
+#define VRT_BITS_CIF0_OVER_RANGE_COUNT 22, 1
+/** Set if the Sample rate field is present. */
+#define VRT_BITS_CIF0_SAMPLE_RATE 21, 1
+/** Set if the Timestamp adjustment field is present. */
+#define VRT_BITS_CIF0_TIMESTAMP_ADJUSTMENT 20, 1
+/** Set if the Timestamp calibration time field is present. */
+#define VRT_BITS_CIF0_TIMESTAMP_CALIBRATION_TIME 19, 1
+/** Set if the Temperature field is present. */
+#define VRT_BITS_CIF0_TEMPERATURE 18, 1
+/** Set if the Device identifier field is present. */
+#define VRT_BITS_CIF0_DEVICE_IDENTIFIER 17, 1
+/** Set if the State and event indicators field is present. */
+#define VRT_BITS_CIF0_STATE_AND_EVENT_INDICATORS 16, 1
+/** Set if the Data packet payload format field is present. */
+#define VRT_BITS_CIF0_DATA_PACKET_PAYLOAD_FORMAT 15, 1
+/** Set if the Formatted GPS geolocation field is present. */
+#define VRT_BITS_CIF0_FORMATTED_GPS_GEOLOCATION 14, 1
+/** Set if the Formatted INS geolocation field is present. */
+#define VRT_BITS_CIF0_FORMATTED_INS_GEOLOCATION 13, 1
+/** Set if the ECEF ephemeris field is present. */
+#define VRT_BITS_CIF0_ECEF_EPHEMERIS 12, 1
+/** Set if the Relative ephemeris field is present. */
+#define VRT_BITS_CIF0_RELATIVE_EPHEMERIS 11, 1
+/** Set if the Ephemeris reference identifier field is present. */
+#define VRT_BITS_CIF0_EPHEMERIS_REFERENCE_IDENTIFIER 10, 1
+/** Set if the GPS ASCII field is present. */
+#define VRT_BITS_CIF0_GPS_ASCII 9, 1
+/** Set if the Context association lists field is present. */
+#define VRT_BITS_CIF0_CONTEXT_ASSOCIATION_LISTS 8, 1
+/** Reserved. Shall be 0. */
+#define VRT_BITS_CIF0_RESERVED 0, 8
+
+/* State and event indicators word */
+/** Calibrated time enable. Set if the Calibrated time indicator is present. */
+#define VRT_BITS_STATE_AND_EVENT_HAS_CALIBRATED_TIME 31, 1
+/** Valid data enable. Set if the Valid data indicator is present. */
+#define VRT_BITS_STATE_AND_EVENT_HAS_VALID_DATA 30, 1
+/** Reference lock enable. Set if the Reference lock indicator is present. */
+#define VRT_BITS_STATE_AND_EVENT_HAS_REFERENCE_LOCK 29, 1
+/** AGC/MGC enable. Set if the AGC/MGC indicator is present. */
+#define VRT_BITS_STATE_AND_EVENT_HAS_AGC_OR_MGC 28, 1
+/** Detected signal enable. Set if the Detected signal indicator is present. */
+#define VRT_BITS_STATE_AND_EVENT_HAS_DETECTED_SIGNAL 27, 1
+/** Spectral inversion enable. Set if the Spectral inversion indicator is present. */
+#define VRT_BITS_STATE_AND_EVENT_HAS_SPECTRAL_INVERSION 26, 1
+/** Over-range enable. Set if the Over-range indicator is present. */
+#define VRT_BITS_STATE_AND_EVENT_HAS_OVER_RANGE 25, 1
+/** Sample loss enable. Set if the Sample loss indicator is present. */
+#define VRT_BITS_STATE_AND_EVENT_HAS_SAMPLE_LOSS 24, 1
+/** Reserved, after the enables. Shall be 0. */
+#define VRT_BITS_STATE_AND_EVENT_RESERVED_HIGH 20, 4
+/** Calibrated time indicator. */
+#define VRT_BITS_STATE_AND_EVENT_CALIBRATED_TIME 19, 1
+/** Valid data indicator. */
+#define VRT_BITS_STATE_AND_EVENT_VALID_DATA 18, 1
+/** Reference lock indicator. */
+#define VRT_BITS_STATE_AND_EVENT_REFERENCE_LOCK 17, 1
+/** AGC/MGC indicator. See enum vrt_agc_or_mgc. */
+#define VRT_BITS_STATE_AND_EVENT_AGC_OR_MGC 16, 1
+/** Detected signal indicator. */
+#define VRT_BITS_STATE_AND_EVENT_DETECTED_SIGNAL 15, 1
+/** Spectral inversion indicator. */
+#define VRT_BITS_STATE_AND_EVENT_SPECTRAL_INVERSION 14, 1
+/** Over-range indicator. */
+#define VRT_BITS_STATE_AND_EVENT_OVER_RANGE 13, 1
+/** Sample loss indicator. */
+#define VRT_BITS_STATE_AND_EVENT_SAMPLE_LOSS 12, 1
+/** Reserved, after the indicators. Shall be 0. */
+#define VRT_BITS_STATE_AND_EVENT_RESERVED_LOW 8, 4
+/** User defined bits. */
+#define VRT_BITS_STATE_AND_EVENT_USER_DEFINED 0, 8
+
+/**
+ * Shift and mask a specified number of consecutive bits from a specified position in a word.
+ *
+ * \param val Word to read from.
+ * \param pos Position of bits in word, starting from lsb.
+ * \param n   Number of bits to mask. Less than 32.
+ *
+ * \return Value of shifted and masked bits.
+ */
+inline uint32_t vrt_mskr(uint32_t val, uint32_t pos, uint32_t n) {
+    uint32_t mask = (1U << n) - 1;
+    return (val >> pos) & mask;
+}
+
+/**
+ * Mask a specified number of consecutive bits and shift them to a position in a word.
+ *
+ * \param val Word to mask.
+ * \param pos Position of bits in word, starting from lsb.
+ * \param n   Number of bits to mask. Less than 32.
+ *
+ * \return Bits after masking and shifting.
+ */
+inline uint32_t vrt_mskw(uint32_t val, uint32_t pos, uint32_t n) {
+    uint32_t mask = (1U << n) - 1;
+    return (val & mask) << pos;
+}
+
+/**
+ * Get a single field from a raw header, trailer, context indicator field 0, or state and event indicators word.
+ *
+ * \param word Word in host order.
+ * \param pos  Position of field in word, starting from lsb.
+ * \param n    Number of bits in field.
+ *
+ * \return Field value.
+ *
+ * \note The pos and n arguments are meant to be given by one of the VRT_BITS_* layouts.
+ */
+inline uint32_t vrt_get_bits(uint32_t word, uint32_t pos, uint32_t n) {
+    return vrt_mskr(word, pos, n);
+}
+
+/**
+ * Set a single field in a raw header, trailer, context indicator field 0, or state and event indicators word, and leave
+ * the other bits as they are.
+ *
+ * \param word Word in host order.
+ * \param pos  Position of field in word, starting from lsb.
+ * \param n    Number of bits in field.
+ * \param val  Field value. Bits that don't fit in the field are ignored.
+ *
+ * \return Word with field set.
+ *
+ * \note The pos and n arguments are meant to be given by one of the VRT_BITS_* layouts.
+ */
+inline uint32_t vrt_set_bits(uint32_t word, uint32_t pos, uint32_t n, uint32_t val) {
+    return (word & ~vrt_mskw(0xFFFFFFFFU, pos, n)) | vrt_mskw(val, pos, n);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
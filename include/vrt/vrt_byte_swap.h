@@ -0,0 +1,26 @@
+#ifndef INCLUDE_VRT_VRT_BYTE_SWAP_H_
+#define INCLUDE_VRT_VRT_BYTE_SWAP_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Reverse the byte order of each 32-bit word in a buffer, e.g. to convert packet body data between network byte order
+ * (big endian) and host order on a little endian platform. Uses AVX2 or SSSE3 instructions when the CPU supports them.
+ *
+ * \param src   Buffer to read from.
+ * \param dst   Buffer to write to. May be the same as src for an in-place swap, but may otherwise not overlap src.
+ * \param words Number of 32-bit words to swap. Nothing is done if words <= 0.
+ *
+ * \note Neither src nor dst are required to be aligned.
+ */
+void vrt_byte_swap(const void* src, void* dst, int32_t words);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
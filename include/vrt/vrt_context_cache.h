@@ -0,0 +1,86 @@
+#ifndef INCLUDE_VRT_VRT_CONTEXT_CACHE_H_
+#define INCLUDE_VRT_VRT_CONTEXT_CACHE_H_
+
+#include "vrt_util.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct vrt_context_cache;
+struct vrt_context_cache_entry;
+struct vrt_if_context;
+
+/**
+ * Initialize context cache without any streams.
+ *
+ * \param cache           Cache to initialize.
+ * \param entries         Hash table storage, which must outlive the cache.
+ * \param capacity        Number of entries in storage. Must be a power of two. At most 3/4 of it are used, to keep
+ *                        probe sequences short.
+ * \param words           Storage of cached words, with capacity * words_per_entry words, which must outlive the cache.
+ * \param words_per_entry Largest IF context section, in 32-bit words, that can be cached.
+ *
+ * \return 0, or a negative number if error.
+ * \retval VRT_ERR_INVALID_CAPACITY Capacity is not a power of two.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_init_context_cache(struct vrt_context_cache*       cache,
+                               struct vrt_context_cache_entry* entries,
+                               int32_t                         capacity,
+                               uint32_t*                       words,
+                               int32_t                         words_per_entry);
+
+/**
+ * Read IF context section of a stream, through the cache. If the context field change indicator is clear and the words
+ * are identical to the cached ones, decoding is skipped and the cached context is returned. Otherwise the words are
+ * copied into the cache and decoded from there.
+ *
+ * \param cache      Cache.
+ * \param stream_id  Stream ID.
+ * \param buf        IF context section, e.g. the body of a packet descriptor from vrt_read_packets().
+ * \param words_buf  Size of IF context section in 32-bit words.
+ * \param if_context Set to the decoded context, owned by the cache. Valid until the next read of the same stream.
+ * \param validate   Level of validation.
+ *
+ * \return Number of read 32-bit words, or a negative number if error. See vrt_read_if_context() for more error codes.
+ * \retval VRT_ERR_BUFFER_SIZE  Section is larger than words_per_entry.
+ * \retval VRT_ERR_STREAMS_FULL No free stream entries.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_read_if_context_cached(struct vrt_context_cache*     cache,
+                                   uint32_t                      stream_id,
+                                   const void*                   buf,
+                                   int32_t                       words_buf,
+                                   const struct vrt_if_context** if_context,
+                                   enum vrt_validation           validate);
+
+/**
+ * Same as vrt_read_if_context_cached(), but buf is in network byte order (big endian) regardless of platform endianess.
+ *
+ * \param cache      Cache.
+ * \param stream_id  Stream ID.
+ * \param buf        IF context section.
+ * \param words_buf  Size of IF context section in 32-bit words.
+ * \param if_context Set to the decoded context, owned by the cache. Valid until the next read of the same stream.
+ * \param validate   Level of validation.
+ *
+ * \return Number of read 32-bit words, or a negative number if error. See vrt_read_if_context_cached() for error
+ *         codes.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_read_if_context_cached_be(struct vrt_context_cache*     cache,
+                                      uint32_t                      stream_id,
+                                      const void*                   buf,
+                                      int32_t                       words_buf,
+                                      const struct vrt_if_context** if_context,
+                                      enum vrt_validation           validate);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,77 @@
+#ifndef INCLUDE_VRT_VRT_CONTEXT_ENCODER_H_
+#define INCLUDE_VRT_VRT_CONTEXT_ENCODER_H_
+
+#include "vrt_util.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct vrt_context_encoder;
+struct vrt_if_context;
+
+/**
+ * Initialize context encoder without any emitted context.
+ *
+ * \param encoder Encoder to initialize.
+ */
+void vrt_init_context_encoder(struct vrt_context_encoder* encoder);
+
+/**
+ * Write IF context section, comparing it to the last one written by the encoder. Only fields that changed since then
+ * are converted and validated, while the cached words are reused for the rest.
+ *
+ * If full is true, all fields are written. Otherwise only changed fields are written, or nothing at all if no field
+ * changed. A full section is written anyway if a field has been removed, since that can't be expressed as a change.
+ * The context field change indicator is set if any field except Over-range count was added, removed, or changed.
+ *
+ * \note GPS ASCII and Context association lists are written whenever present, also in change-only sections, since
+ *       changes in their contents are not detected. They don't set the context field change indicator unless added.
+ *
+ * \param encoder    Encoder.
+ * \param if_context Context to write. The context_field_change_indicator member is ignored.
+ * \param full       True if a full section shall be written, e.g. periodically for late joining receivers.
+ * \param buf        Buffer to write to.
+ * \param words_buf  Size of buf in 32-bit words.
+ * \param validate   Level of validation.
+ *
+ * \return Number of written words, 0 if nothing changed, no variable size field is present, and full is false, or a
+ *         negative number if error. See vrt_write_if_context() for error codes. The encoder is unchanged on error.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_write_if_context_delta(struct vrt_context_encoder*  encoder,
+                                   const struct vrt_if_context* if_context,
+                                   bool                         full,
+                                   void*                        buf,
+                                   int32_t                      words_buf,
+                                   enum vrt_validation          validate);
+
+/**
+ * Same as vrt_write_if_context_delta(), but buf is in network byte order (big endian) regardless of platform endianess.
+ *
+ * \param encoder    Encoder.
+ * \param if_context Context to write. The context_field_change_indicator member is ignored.
+ * \param full       True if a full section shall be written.
+ * \param buf        Buffer to write to.
+ * \param words_buf  Size of buf in 32-bit words.
+ * \param validate   Level of validation.
+ *
+ * \return Number of written words, 0 if nothing changed, no variable size field is present, and full is false, or a
+ *         negative number if error. See vrt_write_if_context() for error codes.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_write_if_context_delta_be(struct vrt_context_encoder*  encoder,
+                                      const struct vrt_if_context* if_context,
+                                      bool                         full,
+                                      void*                        buf,
+                                      int32_t                      words_buf,
+                                      enum vrt_validation          validate);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,228 @@
+#ifndef INCLUDE_VRT_VRT_CONVERT_H_
+#define INCLUDE_VRT_VRT_CONVERT_H_
+
+#include "vrt_util.h"
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct vrt_converter;
+struct vrt_data_packet_payload_format;
+
+/**
+ * Initialize converter of data packet bodies, to and from float or integer items. Supports processing-efficient and
+ * link-efficient packing of signed or unsigned fixed-point items, with item packing fields of 1 to 64 bits. The data
+ * item is in the most significant bits of each field, and the channel tag in the least significant bits, with the event
+ * tag immediately above it.
+ *
+ * Items of 8, 16, or 32 bits without tags use AVX2 or SSSE3 instructions when the CPU supports them, and so do
+ * link-efficient items of 12, 14, or 24 bits without tags with AVX2. Packing uses SSSE3 for items of 8, 16, or 32 bits
+ * without tags. Other formats use a generic bit reader or writer.
+ *
+ * \param converter Converter to initialize.
+ * \param format    Payload format, e.g. from the IF context of the stream.
+ * \param scale     Factor each item is multiplied with, e.g. 1.0F / 32768 to map 16-bit signed items to [-1, 1).
+ *
+ * \return 0, or a negative number if error.
+ * \retval VRT_ERR_UNSUPPORTED_FORMAT Payload format is not supported, or data item and tags don't fit in the item
+ *                                    packing field.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_init_converter(struct vrt_converter*                        converter,
+                           const struct vrt_data_packet_payload_format* format,
+                           float                                        scale);
+
+/**
+ * Convert data packet body to float. Items are converted in order, so complex items end up interleaved, e.g. as I, Q,
+ * I, Q, ... Event and channel tags are skipped. Trailing bits that don't make up a whole item packing field are
+ * ignored as padding.
+ *
+ * \param converter  Converter.
+ * \param body       Body words.
+ * \param words_body Number of 32-bit words in body.
+ * \param dst        Buffer to convert into.
+ * \param n_dst      Number of floats in dst.
+ *
+ * \return Number of floats written, i.e. number of items in body, or a negative number if error.
+ * \retval VRT_ERR_BUFFER_SIZE Buffer is too small.
+ *
+ * \note Requires body words to be byte swapped if platform endianess isn't big endian (network order). See
+ *       vrt_convert_to_float_be() for an alternative.
+ * \note Neither body nor dst are required to be aligned.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_convert_to_float(const struct vrt_converter* converter,
+                             const void*                 body,
+                             int32_t                     words_body,
+                             float*                      dst,
+                             int32_t                     n_dst);
+
+/**
+ * Same as vrt_convert_to_float(), but body is in network byte order (big endian) regardless of platform endianess. The
+ * byte swap is done in the same pass as the conversion.
+ *
+ * \param converter  Converter.
+ * \param body       Body words, in network byte order.
+ * \param words_body Number of 32-bit words in body.
+ * \param dst        Buffer to convert into.
+ * \param n_dst      Number of floats in dst.
+ *
+ * \return Number of floats written, or a negative number if error. See vrt_convert_to_float() for error codes.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_convert_to_float_be(const struct vrt_converter* converter,
+                                const void*                 body,
+                                int32_t                     words_body,
+                                float*                      dst,
+                                int32_t                     n_dst);
+
+/**
+ * Unpack data packet body into integer items, and event and channel tags. Signed items are sign extended, and unsigned
+ * 64-bit items keep their bit pattern. Trailing bits that don't make up a whole item packing field are ignored as
+ * padding. The scale of the converter is not used.
+ *
+ * \param converter    Converter.
+ * \param body         Body words.
+ * \param words_body   Number of 32-bit words in body.
+ * \param items        Buffer to unpack items into.
+ * \param event_tags   Buffer to unpack event tags into, or NULL to skip them.
+ * \param channel_tags Buffer to unpack channel tags into, or NULL to skip them.
+ * \param n            Number of elements in each buffer.
+ *
+ * \return Number of items unpacked, or a negative number if error.
+ * \retval VRT_ERR_BUFFER_SIZE Buffers are too small.
+ *
+ * \note Requires body words to be byte swapped if platform endianess isn't big endian (network order). See
+ *       vrt_unpack_items_be() for an alternative.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_unpack_items(const struct vrt_converter* converter,
+                         const void*                 body,
+                         int32_t                     words_body,
+                         int64_t*                    items,
+                         uint8_t*                    event_tags,
+                         uint16_t*                   channel_tags,
+                         int32_t                     n);
+
+/**
+ * Same as vrt_unpack_items(), but body is in network byte order (big endian) regardless of platform endianess.
+ *
+ * \param converter    Converter.
+ * \param body         Body words, in network byte order.
+ * \param words_body   Number of 32-bit words in body.
+ * \param items        Buffer to unpack items into.
+ * \param event_tags   Buffer to unpack event tags into, or NULL to skip them.
+ * \param channel_tags Buffer to unpack channel tags into, or NULL to skip them.
+ * \param n            Number of elements in each buffer.
+ *
+ * \return Number of items unpacked, or a negative number if error. See vrt_unpack_items() for error codes.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_unpack_items_be(const struct vrt_converter* converter,
+                            const void*                 body,
+                            int32_t                     words_body,
+                            int64_t*                    items,
+                            uint8_t*                    event_tags,
+                            uint16_t*                   channel_tags,
+                            int32_t                     n);
+
+/**
+ * Pack floats into data packet body, e.g. directly after the fields written with vrt_write_fields(). Each float is
+ * multiplied with the reciprocal of the converter scale, rounded to nearest with ties to even, and saturated to the
+ * item range. NaN is saturated to the minimum. Event and channel tags, unused bits, and padding are zero.
+ *
+ * \param converter  Converter.
+ * \param src        Floats to pack, e.g. interleaved as I, Q, I, Q, ... for complex items.
+ * \param n          Number of floats.
+ * \param body       Body to write to.
+ * \param words_body Number of 32-bit words in body buffer.
+ *
+ * \return Number of words written, or a negative number if error.
+ * \retval VRT_ERR_BUFFER_SIZE Buffer is too small.
+ *
+ * \note Writes body words in platform byte order. See vrt_convert_from_float_be() for an alternative.
+ * \note Neither src nor body are required to be aligned.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_convert_from_float(const struct vrt_converter* converter,
+                               const float*                src,
+                               int32_t                     n,
+                               void*                       body,
+                               int32_t                     words_body);
+
+/**
+ * Same as vrt_convert_from_float(), but body is written in network byte order (big endian) regardless of platform
+ * endianess. The byte swap is done in the same pass as the conversion.
+ *
+ * \param converter  Converter.
+ * \param src        Floats to pack.
+ * \param n          Number of floats.
+ * \param body       Body to write to, in network byte order.
+ * \param words_body Number of 32-bit words in body buffer.
+ *
+ * \return Number of words written, or a negative number if error. See vrt_convert_from_float() for error codes.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_convert_from_float_be(const struct vrt_converter* converter,
+                                  const float*                src,
+                                  int32_t                     n,
+                                  void*                       body,
+                                  int32_t                     words_body);
+
+/**
+ * Pack integer items, and event and channel tags, into data packet body. Items are saturated to the item range, where
+ * unsigned 64-bit items are taken as their bit pattern. Tags are truncated to the tag sizes. Unused bits and padding
+ * are zero.
+ *
+ * \param converter    Converter.
+ * \param items        Items to pack.
+ * \param event_tags   Event tags to pack, or NULL for zero.
+ * \param channel_tags Channel tags to pack, or NULL for zero.
+ * \param n            Number of items.
+ * \param body         Body to write to.
+ * \param words_body   Number of 32-bit words in body buffer.
+ *
+ * \return Number of words written, or a negative number if error.
+ * \retval VRT_ERR_BUFFER_SIZE Buffer is too small.
+ *
+ * \note Writes body words in platform byte order. See vrt_pack_items_be() for an alternative.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_pack_items(const struct vrt_converter* converter,
+                       const int64_t*              items,
+                       const uint8_t*              event_tags,
+                       const uint16_t*             channel_tags,
+                       int32_t                     n,
+                       void*                       body,
+                       int32_t                     words_body);
+
+/**
+ * Same as vrt_pack_items(), but body is written in network byte order (big endian) regardless of platform endianess.
+ *
+ * \param converter    Converter.
+ * \param items        Items to pack.
+ * \param event_tags   Event tags to pack, or NULL for zero.
+ * \param channel_tags Channel tags to pack, or NULL for zero.
+ * \param n            Number of items.
+ * \param body         Body to write to, in network byte order.
+ * \param words_body   Number of 32-bit words in body buffer.
+ *
+ * \return Number of words written, or a negative number if error. See vrt_pack_items() for error codes.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_pack_items_be(const struct vrt_converter* converter,
+                          const int64_t*              items,
+                          const uint8_t*              event_tags,
+                          const uint16_t*             channel_tags,
+                          int32_t                     n,
+                          void*                       body,
+                          int32_t                     words_body);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,89 @@
+#ifndef INCLUDE_VRT_VRT_DEMUX_H_
+#define INCLUDE_VRT_VRT_DEMUX_H_
+
+#include "vrt_types.h"
+#include "vrt_util.h"
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct vrt_demux;
+struct vrt_demux_entry;
+struct vrt_packet_descriptor;
+
+/**
+ * Initialize demultiplexer without any streams.
+ *
+ * \param demux         Demultiplexer to initialize.
+ * \param entries       Hash table storage, which must outlive the demultiplexer.
+ * \param capacity      Number of entries in storage. Must be a power of two. At most 3/4 of it are used, to keep
+ *                      probe sequences short.
+ * \param fallback      Called for packets without stream ID or with an unknown stream ID. May be NULL.
+ * \param fallback_user User data passed to fallback.
+ *
+ * \return 0, or a negative number if error.
+ * \retval VRT_ERR_INVALID_CAPACITY Capacity is not a power of two.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_init_demux(struct vrt_demux*       demux,
+                       struct vrt_demux_entry* entries,
+                       int32_t                 capacity,
+                       vrt_demux_callback      fallback,
+                       void*                   fallback_user);
+
+/**
+ * Add stream to demultiplexer, or replace callback and user data if it already exists.
+ *
+ * \param demux     Demultiplexer.
+ * \param stream_id Stream ID.
+ * \param callback  Called for each packet in stream. Must not be NULL.
+ * \param user      User data, e.g. per-stream state, passed to callback.
+ *
+ * \return 0, or a negative number if error.
+ * \retval VRT_ERR_STREAMS_FULL No free stream entries.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_demux_add(struct vrt_demux* demux, uint32_t stream_id, vrt_demux_callback callback, void* user);
+
+/**
+ * Remove stream from demultiplexer.
+ *
+ * \param demux     Demultiplexer.
+ * \param stream_id Stream ID.
+ *
+ * \return True if stream was removed, false if it doesn't exist.
+ */
+bool vrt_demux_remove(struct vrt_demux* demux, uint32_t stream_id);
+
+/**
+ * Find stream entry.
+ *
+ * \param demux     Demultiplexer.
+ * \param stream_id Stream ID.
+ *
+ * \return Entry, or NULL if stream doesn't exist.
+ */
+struct vrt_demux_entry* vrt_demux_find(struct vrt_demux* demux, uint32_t stream_id);
+
+/**
+ * Route packets, e.g. from vrt_read_packets(), to the callbacks of their streams. Consecutive packets from the same
+ * stream bypass the hash table lookup.
+ *
+ * \param demux       Demultiplexer.
+ * \param descriptors Packets.
+ * \param n           Number of packets.
+ *
+ * \return Number of packets routed to a stream callback, i.e. not to the fallback.
+ *
+ * \warning Callbacks must not add or remove streams.
+ */
+int32_t vrt_demux_dispatch(struct vrt_demux* demux, const struct vrt_packet_descriptor* descriptors, int32_t n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -212,7 +212,35 @@ enum vrt_error_code {
     /**
      * Expected a field that was not present.
      */
-    VRT_ERR_EXPECTED_FIELD = -51
+    VRT_ERR_EXPECTED_FIELD = -51,
+    /**
+     * Invalid capacity, e.g. not positive or not a power of two, as required by the function.
+     */
+    VRT_ERR_INVALID_CAPACITY = -52,
+    /**
+     * No free stream entries.
+     */
+    VRT_ERR_STREAMS_FULL = -53,
+    /**
+     * File could not be opened, inspected, or memory mapped.
+     */
+    VRT_ERR_FILE = -54,
+    /**
+     * Index file has the wrong format, version, byte order, or size.
+     */
+    VRT_ERR_INDEX_FORMAT = -55,
+    /**
+     * Data packet payload format is not supported.
+     */
+    VRT_ERR_UNSUPPORTED_FORMAT = -56,
+    /**
+     * Number of items is not a whole number of samples.
+     */
+    VRT_ERR_PARTIAL_SAMPLE = -57,
+    /**
+     * Packet type is not a data packet type.
+     */
+    VRT_ERR_EXPECTED_DATA_PACKET = -58
 };
 
 #ifdef __cplusplus
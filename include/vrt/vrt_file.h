@@ -0,0 +1,97 @@
+#ifndef INCLUDE_VRT_VRT_FILE_H_
+#define INCLUDE_VRT_VRT_FILE_H_
+
+#include "vrt_types.h"
+#include "vrt_util.h"
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct vrt_file_reader;
+struct vrt_packet_descriptor;
+
+/**
+ * Open recording file for reading, by memory mapping it. The kernel is hinted that the file is read sequentially.
+ *
+ * \param reader Reader to initialize.
+ * \param path   Path of recording file.
+ * \param window Maximum number of bytes to map at a time, which is rounded up to a multiple of page size and to fit at
+ *               least the largest possible packet. If 0, the whole file is mapped at once on 64-bit platforms, and
+ *               256 MiB windows are used on 32-bit platforms.
+ *
+ * \return 0, or a negative number if error.
+ * \retval VRT_ERR_FILE File could not be opened or inspected, or the platform doesn't support memory mapping.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_open_file_reader(struct vrt_file_reader* reader, const char* path, uint64_t window);
+
+/**
+ * Unmap and close recording file. Does nothing if already closed.
+ *
+ * \param reader Reader.
+ */
+void vrt_close_file_reader(struct vrt_file_reader* reader);
+
+/**
+ * Move read position of recording file, e.g. to a packet offset from a recording index. The window is moved on the next
+ * read, if needed.
+ *
+ * \param reader Reader.
+ * \param offset File offset of packet in bytes. Must be a multiple of 4.
+ */
+void vrt_seek_file_reader(struct vrt_file_reader* reader, uint64_t offset);
+
+/**
+ * Read next packets in recording file, by describing them in place with vrt_read_packets(). Reading stops when all
+ * descriptors are filled, or at the end of the current window.
+ *
+ * \param reader      Reader.
+ * \param descriptors Descriptors to read into. Their offsets are relative to reader->offset before the call.
+ * \param n           Number of descriptors.
+ * \param validate    Level of validation. If VRT_VALIDATION_NONE, only buffer and packet sizes are validated.
+ *
+ * \return Number of read packets, 0 at end of file, or a negative number if error. See vrt_read_packets() for error
+ *         codes.
+ * \retval VRT_ERR_BUFFER_SIZE Last packet is cut off by end of file.
+ * \retval VRT_ERR_FILE        File could not be memory mapped.
+ *
+ * \note On error, the reader is left at the erroneous packet, and the descriptors of all packets before it are still
+ *       filled in.
+ *
+ * \warning The descriptor body pointers point into the read-only mapping, and are only valid until the next call,
+ *          which may slide the window.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_read_file_packets(struct vrt_file_reader*       reader,
+                              struct vrt_packet_descriptor* descriptors,
+                              int32_t                       n,
+                              enum vrt_validation           validate);
+
+/**
+ * Same as vrt_read_file_packets(), but the file is in network byte order (big endian) regardless of platform
+ * endianess.
+ *
+ * \param reader      Reader.
+ * \param descriptors Descriptors to read into. Their offsets are relative to reader->offset before the call.
+ * \param n           Number of descriptors.
+ * \param validate    Level of validation. If VRT_VALIDATION_NONE, only buffer and packet sizes are validated.
+ *
+ * \return Number of read packets, 0 at end of file, or a negative number if error. See vrt_read_file_packets() for
+ *         error codes.
+ *
+ * \warning Body words are left in network byte order.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_read_file_packets_be(struct vrt_file_reader*       reader,
+                                 struct vrt_packet_descriptor* descriptors,
+                                 int32_t                       n,
+                                 enum vrt_validation           validate);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
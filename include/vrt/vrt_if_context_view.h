@@ -0,0 +1,215 @@
+#ifndef INCLUDE_VRT_VRT_IF_CONTEXT_VIEW_H_
+#define INCLUDE_VRT_VRT_IF_CONTEXT_VIEW_H_
+
+#include "vrt_util.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct vrt_device_identifier;
+struct vrt_gain;
+struct vrt_if_context_view;
+
+/**
+ * Set up a view of an IF context section without decoding it. Only the indicator field is read, and the position of
+ * each present field is computed from it. Use the vrt_if_context_view_*() accessors to decode single fields. This is
+ * much cheaper than vrt_read_if_context() when only a few fields are of interest.
+ *
+ * \param buf       Buffer to read from. Must outlive the view.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param view      View to set up.
+ * \param validate  Level of validation. Only the reserved bits in the indicator field are validated.
+ *
+ * \return Number of 32-bit words in the IF context section, or a negative number if error.
+ * \retval VRT_ERR_BUFFER_SIZE Buffer is too small.
+ * \retval VRT_ERR_RESERVED    One or multiple reserved bits are set.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_read_if_context_view(const void*                 buf,
+                                 int32_t                     words_buf,
+                                 struct vrt_if_context_view* view,
+                                 enum vrt_validation         validate);
+
+/**
+ * Same as vrt_read_if_context_view(), but buf is in network byte order (big endian) regardless of platform endianess.
+ * Fields are byte swapped when they are decoded by the accessors.
+ *
+ * \param buf       Buffer to read from, in network byte order. Must outlive the view.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param view      View to set up.
+ * \param validate  Level of validation. Only the reserved bits in the indicator field are validated.
+ *
+ * \return Number of 32-bit words in the IF context section, or a negative number if error. See
+ *         vrt_read_if_context_view() for error codes.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_read_if_context_view_be(const void*                 buf,
+                                    int32_t                     words_buf,
+                                    struct vrt_if_context_view* view,
+                                    enum vrt_validation         validate);
+
+/**
+ * Decode Reference point identifier field.
+ *
+ * \param view                       View.
+ * \param reference_point_identifier Value to write to. Unchanged if the field isn't present.
+ *
+ * \return True if the field is present.
+ */
+bool vrt_if_context_view_reference_point_identifier(const struct vrt_if_context_view* view,
+                                                    uint32_t*                         reference_point_identifier);
+
+/**
+ * Decode Bandwidth field.
+ *
+ * \param view      View.
+ * \param bandwidth Value to write to [Hz]. Unchanged if the field isn't present.
+ *
+ * \return True if the field is present.
+ */
+bool vrt_if_context_view_bandwidth(const struct vrt_if_context_view* view, double* bandwidth);
+
+/**
+ * Decode IF reference frequency field.
+ *
+ * \param view                   View.
+ * \param if_reference_frequency Value to write to [Hz]. Unchanged if the field isn't present.
+ *
+ * \return True if the field is present.
+ */
+bool vrt_if_context_view_if_reference_frequency(const struct vrt_if_context_view* view, double* if_reference_frequency);
+
+/**
+ * Decode RF reference frequency field.
+ *
+ * \param view                   View.
+ * \param rf_reference_frequency Value to write to [Hz]. Unchanged if the field isn't present.
+ *
+ * \return True if the field is present.
+ */
+bool vrt_if_context_view_rf_reference_frequency(const struct vrt_if_context_view* view, double* rf_reference_frequency);
+
+/**
+ * Decode RF reference frequency offset field.
+ *
+ * \param view                          View.
+ * \param rf_reference_frequency_offset Value to write to [Hz]. Unchanged if the field isn't present.
+ *
+ * \return True if the field is present.
+ */
+bool vrt_if_context_view_rf_reference_frequency_offset(const struct vrt_if_context_view* view,
+                                                       double*                           rf_reference_frequency_offset);
+
+/**
+ * Decode IF band offset field.
+ *
+ * \param view           View.
+ * \param if_band_offset Value to write to [Hz]. Unchanged if the field isn't present.
+ *
+ * \return True if the field is present.
+ */
+bool vrt_if_context_view_if_band_offset(const struct vrt_if_context_view* view, double* if_band_offset);
+
+/**
+ * Decode Reference level field.
+ *
+ * \param view            View.
+ * \param reference_level Value to write to [dBm]. Unchanged if the field isn't present.
+ *
+ * \return True if the field is present.
+ */
+bool vrt_if_context_view_reference_level(const struct vrt_if_context_view* view, float* reference_level);
+
+/**
+ * Decode Gain field.
+ *
+ * \param view View.
+ * \param gain Value to write to. Unchanged if the field isn't present.
+ *
+ * \return True if the field is present.
+ */
+bool vrt_if_context_view_gain(const struct vrt_if_context_view* view, struct vrt_gain* gain);
+
+/**
+ * Decode Over-range count field.
+ *
+ * \param view             View.
+ * \param over_range_count Value to write to. Unchanged if the field isn't present.
+ *
+ * \return True if the field is present.
+ */
+bool vrt_if_context_view_over_range_count(const struct vrt_if_context_view* view, uint32_t* over_range_count);
+
+/**
+ * Decode Sample rate field.
+ *
+ * \param view        View.
+ * \param sample_rate Value to write to [Hz]. Unchanged if the field isn't present.
+ *
+ * \return True if the field is present.
+ */
+bool vrt_if_context_view_sample_rate(const struct vrt_if_context_view* view, double* sample_rate);
+
+/**
+ * Decode Timestamp adjustment field.
+ *
+ * \param view                 View.
+ * \param timestamp_adjustment Value to write to [ps]. Unchanged if the field isn't present.
+ *
+ * \return True if the field is present.
+ */
+bool vrt_if_context_view_timestamp_adjustment(const struct vrt_if_context_view* view, uint64_t* timestamp_adjustment);
+
+/**
+ * Decode Timestamp calibration time field.
+ *
+ * \param view                       View.
+ * \param timestamp_calibration_time Value to write to. Unchanged if the field isn't present.
+ *
+ * \return True if the field is present.
+ */
+bool vrt_if_context_view_timestamp_calibration_time(const struct vrt_if_context_view* view,
+                                                    uint32_t*                         timestamp_calibration_time);
+
+/**
+ * Decode Temperature field.
+ *
+ * \param view        View.
+ * \param temperature Value to write to [degrees Celsius]. Unchanged if the field isn't present.
+ *
+ * \return True if the field is present.
+ */
+bool vrt_if_context_view_temperature(const struct vrt_if_context_view* view, float* temperature);
+
+/**
+ * Decode Device identifier field.
+ *
+ * \param view              View.
+ * \param device_identifier Value to write to. Unchanged if the field isn't present.
+ *
+ * \return True if the field is present.
+ */
+bool vrt_if_context_view_device_identifier(const struct vrt_if_context_view* view,
+                                           struct vrt_device_identifier*     device_identifier);
+
+/**
+ * Decode Ephemeris reference identifier field.
+ *
+ * \param view                           View.
+ * \param ephemeris_reference_identifier Value to write to. Unchanged if the field isn't present.
+ *
+ * \return True if the field is present.
+ */
+bool vrt_if_context_view_ephemeris_reference_identifier(
+    const struct vrt_if_context_view* view,
+    uint32_t*                         ephemeris_reference_identifier);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
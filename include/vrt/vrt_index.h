@@ -0,0 +1,148 @@
+#ifndef INCLUDE_VRT_VRT_INDEX_H_
+#define INCLUDE_VRT_VRT_INDEX_H_
+
+#include "vrt_types.h"
+#include "vrt_util.h"
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct vrt_index;
+struct vrt_index_entry;
+struct vrt_index_stream_entry;
+struct vrt_time;
+struct vrt_time_index;
+struct vrt_time_index_block;
+
+/**
+ * Index file format version. Index files with another version are rejected.
+ */
+#define VRT_INDEX_VERSION 1
+
+/**
+ * Scan recording file and write an index file for it, with one struct vrt_index_entry per packet and a table of packets
+ * per stream. The index file starts with a header of 8 magic bytes "VRTINDEX", a 32-bit format version, a 32-bit byte
+ * order mark 0x01020304, and the 64-bit numbers of packets and of packets with stream ID. Then follow the packet
+ * entries, and the stream entries. All numbers are in platform byte order.
+ *
+ * \param recording_path Path of recording file.
+ * \param index_path     Path of index file to write. Overwritten if it exists.
+ *
+ * \return 0, or a negative number if error. See vrt_read_file_packets() for error codes.
+ * \retval VRT_ERR_FILE File could not be opened, written, or memory mapped.
+ *
+ * \note The header is written last, so an interrupted build leaves an index file which is rejected when opened.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_build_index(const char* recording_path, const char* index_path);
+
+/**
+ * Same as vrt_build_index(), but the recording is in network byte order (big endian) regardless of platform endianess.
+ * The index file is still in platform byte order.
+ *
+ * \param recording_path Path of recording file, in network byte order.
+ * \param index_path     Path of index file to write. Overwritten if it exists.
+ *
+ * \return 0, or a negative number if error. See vrt_build_index() for error codes.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_build_index_be(const char* recording_path, const char* index_path);
+
+/**
+ * Open index file, by memory mapping it.
+ *
+ * \param index Index to initialize.
+ * \param path  Path of index file.
+ *
+ * \return 0, or a negative number if error.
+ * \retval VRT_ERR_FILE         File could not be opened or memory mapped.
+ * \retval VRT_ERR_INDEX_FORMAT File has the wrong magic bytes, format version, byte order, or size.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_open_index(struct vrt_index* index, const char* path);
+
+/**
+ * Unmap index file. Does nothing if already closed.
+ *
+ * \param index Index.
+ */
+void vrt_close_index(struct vrt_index* index);
+
+/**
+ * Look up packet by number, in constant time.
+ *
+ * \param index  Index.
+ * \param packet Packet number, i.e. position in recording.
+ *
+ * \return Packet, or NULL if out of range.
+ */
+const struct vrt_index_entry* vrt_index_packet(const struct vrt_index* index, uint64_t packet);
+
+/**
+ * Look up packets of a stream, in logarithmic time. Use the packet numbers of the returned entries with
+ * vrt_index_packet().
+ *
+ * \param index     Index.
+ * \param stream_id Stream ID.
+ * \param packets   Set to the first stream entry of the stream, in recording order, or NULL if there are none.
+ *
+ * \return Number of packets in stream.
+ */
+uint64_t vrt_index_stream(const struct vrt_index*               index,
+                          uint32_t                              stream_id,
+                          const struct vrt_index_stream_entry** packets);
+
+/**
+ * Initialize sparse time index of a stream, for seeking by time. The stream is split into at most capacity blocks of
+ * equal size, and the time of the first packet in each block is stored.
+ *
+ * \param time_index  Time index to initialize.
+ * \param index       Recording index, which must outlive the time index.
+ * \param stream_id   Stream ID.
+ * \param sample_rate Sample rate [Hz], e.g. from the IF context of the stream. Truncated to an integer. May be set to 0
+ *                    if TSF is neither VRT_TSF_SAMPLE_COUNT nor VRT_TSF_FREE_RUNNING_COUNT.
+ * \param blocks      Block storage, which must outlive the time index.
+ * \param capacity    Number of blocks in storage. Must be positive. A larger capacity makes the linear part of a seek
+ *                    shorter.
+ *
+ * \return 0, or a negative number if error.
+ * \retval VRT_ERR_INVALID_CAPACITY    Capacity is not positive.
+ * \retval VRT_ERR_EXPECTED_FIELD      Packet has neither integer nor fractional timestamp.
+ * \retval VRT_ERR_MISSING_SAMPLE_RATE Sample rate is required but is not provided (< 1).
+ * \retval VRT_ERR_BOUNDS_SAMPLE_COUNT Fractional timestamp is outside valid bounds (>= truncated sample rate).
+ * \retval VRT_ERR_BOUNDS_REAL_TIME    TSF is VRT_TSF_REAL_TIME but fractional timestamp is outside valid bounds
+ *                                     (> 999999999999 ps).
+ */
+VRT_WARN_UNUSED
+int32_t vrt_init_time_index(struct vrt_time_index*       time_index,
+                            const struct vrt_index*      index,
+                            uint32_t                     stream_id,
+                            double                       sample_rate,
+                            struct vrt_time_index_block* blocks,
+                            uint64_t                     capacity);
+
+/**
+ * Seek to the first packet of a stream at or after a point in time, in logarithmic time. Packet timestamps are
+ * converted to seconds and picoseconds according to their TSF. Free running count timestamps are divided by sample rate
+ * and their integer seconds timestamp is ignored, as it is less precise.
+ *
+ * \param time_index Time index of stream.
+ * \param t          Point in time, in the same epoch as the stream timestamps.
+ * \param packet     Set to the position of the packet among the packets of the stream, or to the number of packets
+ *                   in the stream if all are before t. Use it with the stream entries of the time index.
+ *
+ * \return 0, or a negative number if error. See vrt_init_time_index() for error codes.
+ *
+ * \warning Timestamps must be nondecreasing within the stream.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_seek_time_index(const struct vrt_time_index* time_index, const struct vrt_time* t, uint64_t* packet);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
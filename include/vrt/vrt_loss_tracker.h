@@ -0,0 +1,59 @@
+#ifndef INCLUDE_VRT_VRT_LOSS_TRACKER_H_
+#define INCLUDE_VRT_VRT_LOSS_TRACKER_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct vrt_fields;
+struct vrt_header;
+struct vrt_loss_tracker;
+struct vrt_packet_descriptor;
+
+/**
+ * Initialize loss tracker of a stream.
+ *
+ * The 4-bit packet count alone can't tell 16 lost packets from none. If sample rate and samples per packet are given,
+ * and packets have timestamps, the number of elapsed packets is instead estimated from the timestamp difference and
+ * then snapped to the nearest value that agrees with the packet count. Packets with TSF VRT_TSF_FREE_RUNNING_COUNT only
+ * need samples per packet.
+ *
+ * \param tracker            Tracker to initialize.
+ * \param sample_rate        Sample rate [Hz], or 0 if unknown. Truncated to an integer.
+ * \param samples_per_packet Number of samples per packet, or 0 if unknown.
+ */
+void vrt_init_loss_tracker(struct vrt_loss_tracker* tracker, double sample_rate, uint32_t samples_per_packet);
+
+/**
+ * Update loss tracker with the next received packet of its stream.
+ *
+ * Without timestamps, a packet count up to 8 steps behind the last one is late, and further ahead means lost packets.
+ * A late packet is counted as reordered if it was counted as lost, up to 8 packets behind the last one, and as
+ * duplicated otherwise.
+ *
+ * \param tracker Tracker.
+ * \param header  Header of packet.
+ * \param fields  Fields of packet.
+ */
+void vrt_update_loss_tracker(struct vrt_loss_tracker* tracker,
+                             const struct vrt_header* header,
+                             const struct vrt_fields* fields);
+
+/**
+ * Update loss tracker with consecutive received packets of its stream, e.g. from vrt_read_packets().
+ *
+ * \param tracker     Tracker.
+ * \param descriptors Packets.
+ * \param n           Number of packets.
+ */
+void vrt_update_loss_tracker_packets(struct vrt_loss_tracker*            tracker,
+                                     const struct vrt_packet_descriptor* descriptors,
+                                     int32_t                             n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,128 @@
+#ifndef INCLUDE_VRT_VRT_PACKET_TEMPLATE_H_
+#define INCLUDE_VRT_VRT_PACKET_TEMPLATE_H_
+
+#include "vrt_util.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct vrt_fields;
+struct vrt_header;
+struct vrt_packet_template;
+struct vrt_trailer;
+
+/**
+ * Compile a packet template from header, fields, and trailer. Everything is encoded, and optionally validated, once
+ * here. Packets are then written with vrt_write_packet_template(), which only patches packet count, packet size, and
+ * timestamps. Templates are for data packets only.
+ *
+ * \param header   Header. Packet type must be a data packet type. Packet size is ignored, since it is set when
+ *                 writing.
+ * \param fields   Fields. Timestamps are ignored, since they are set when writing.
+ * \param trailer  Trailer. Only used if header has a trailer, and may otherwise be NULL.
+ * \param tmpl     Template to compile into.
+ * \param validate Level of validation.
+ *
+ * \return Number of 32-bit words the template adds to each packet, i.e. header, fields, and trailer words, or a
+ *         negative number if error.
+ * \retval VRT_ERR_INVALID_PACKET_TYPE                    Packet type is an invalid value.
+ * \retval VRT_ERR_EXPECTED_DATA_PACKET                   Packet type is a context packet type, or an invalid value
+ *                                                        if not validated.
+ * \retval VRT_ERR_TRAILER_IN_CONTEXT                     Context packet has trailer bit set.
+ * \retval VRT_ERR_TSM_IN_DATA                            Data packet has TSM bit set.
+ * \retval VRT_ERR_INVALID_TSM                            TSM is an invalid value.
+ * \retval VRT_ERR_INVALID_TSI                            TSI is an invalid value.
+ * \retval VRT_ERR_INVALID_TSF                            TSF is an invalid value.
+ * \retval VRT_ERR_BOUNDS_PACKET_COUNT                    Packet count is outside valid bounds (> 0xF).
+ * \retval VRT_ERR_BOUNDS_OUI                             OUI is outside valid bounds (> 0x00FFFFFF).
+ * \retval VRT_ERR_BOUNDS_ASSOCIATED_CONTEXT_PACKET_COUNT Associated context packet count is outside valid bounds
+ *                                                        (> 0x7F).
+ */
+VRT_WARN_UNUSED
+int32_t vrt_compile_packet_template(const struct vrt_header*    header,
+                                    const struct vrt_fields*    fields,
+                                    const struct vrt_trailer*   trailer,
+                                    struct vrt_packet_template* tmpl,
+                                    enum vrt_validation         validate);
+
+/**
+ * Same as vrt_compile_packet_template(), but packets are written in network byte order (big endian) regardless of
+ * platform endianess.
+ *
+ * \param header   Header. Packet type must be a data packet type. Packet size is ignored, since it is set when
+ *                 writing.
+ * \param fields   Fields. Timestamps are ignored, since they are set when writing.
+ * \param trailer  Trailer. Only used if header has a trailer, and may otherwise be NULL.
+ * \param tmpl     Template to compile into.
+ * \param validate Level of validation.
+ *
+ * \return Number of 32-bit words the template adds to each packet, or a negative number if error. See
+ *         vrt_compile_packet_template() for error codes.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_compile_packet_template_be(const struct vrt_header*    header,
+                                       const struct vrt_fields*    fields,
+                                       const struct vrt_trailer*   trailer,
+                                       struct vrt_packet_template* tmpl,
+                                       enum vrt_validation         validate);
+
+/**
+ * Write a packet from a template. The packet count is that of the template, which is then incremented modulo 16.
+ *
+ * \param tmpl                         Template to write from.
+ * \param integer_seconds_timestamp    Integer seconds timestamp. Ignored if TSI is VRT_TSI_NONE.
+ * \param fractional_seconds_timestamp Fractional seconds timestamp. Ignored if TSF is VRT_TSF_NONE.
+ * \param body                         Body to copy, as is. May be NULL, in which case the body words in buf are left
+ *                                     untouched, e.g. when the body has already been written in place.
+ * \param words_body                   Number of 32-bit words in body.
+ * \param buf                          Buffer to write to.
+ * \param words_buf                    Size of buf in 32-bit words.
+ *
+ * \return Number of written 32-bit words, or a negative number if error.
+ * \retval VRT_ERR_BUFFER_SIZE        Buffer is too small.
+ * \retval VRT_ERR_BOUNDS_PACKET_SIZE Body size is negative, or packet is too large to fit in packet size field.
+ *
+ * \note Timestamps aren't validated, e.g. that the fractional timestamp is within bounds for VRT_TSF_REAL_TIME.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_write_packet_template(struct vrt_packet_template* tmpl,
+                                  uint32_t                    integer_seconds_timestamp,
+                                  uint64_t                    fractional_seconds_timestamp,
+                                  const void*                 body,
+                                  int32_t                     words_body,
+                                  void*                       buf,
+                                  int32_t                     words_buf);
+
+/**
+ * Same as vrt_write_packet_template(), but header and fields section, and trailer, are written to separate buffers. For
+ * scatter/gather I/O, where the body is sent from where it is, e.g. with writev() or sendmsg().
+ *
+ * \param tmpl                         Template to write from.
+ * \param integer_seconds_timestamp    Integer seconds timestamp. Ignored if TSI is VRT_TSI_NONE.
+ * \param fractional_seconds_timestamp Fractional seconds timestamp. Ignored if TSF is VRT_TSF_NONE.
+ * \param words_body                   Number of 32-bit words in body.
+ * \param prefix                       Buffer to write header and fields section to. Must fit tmpl->words_prefix
+ *                                     words.
+ * \param trailer                      Buffer to write trailer to. Must fit one word if template has a trailer, and may
+ *                                     otherwise be NULL.
+ *
+ * \return Number of 32-bit words in packet, or a negative number if error.
+ * \retval VRT_ERR_BOUNDS_PACKET_SIZE Body size is negative, or packet is too large to fit in packet size field.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_write_packet_template_parts(struct vrt_packet_template* tmpl,
+                                        uint32_t                    integer_seconds_timestamp,
+                                        uint64_t                    fractional_seconds_timestamp,
+                                        int32_t                     words_body,
+                                        void*                       prefix,
+                                        void*                       trailer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,137 @@
+#ifndef INCLUDE_VRT_VRT_PACKETIZER_H_
+#define INCLUDE_VRT_VRT_PACKETIZER_H_
+
+#include "vrt_util.h"
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct vrt_data_packet_payload_format;
+struct vrt_fields;
+struct vrt_header;
+struct vrt_iovec;
+struct vrt_packetizer;
+struct vrt_trailer;
+
+/**
+ * Initialize a packetizer, which splits sample buffers into consecutive data packets of a stream. Each packet holds as
+ * many samples as fit in the maximum packet size, except the last packet of a burst which holds the rest. Packet
+ * count and timestamps are advanced between packets as with vrt_init_sequencer().
+ *
+ * Packets end on a sample and word boundary without padding, so that a body packed in one go, e.g. with
+ * vrt_convert_from_float(), can be split into packets without repacking. This may leave a few words of the maximum
+ * packet size unused for link-efficient packing.
+ *
+ * \param header       Header of first packet. Packet size is ignored.
+ * \param fields       Fields of first packet.
+ * \param trailer      Trailer. Only used if header has a trailer, and may otherwise be NULL.
+ * \param format       Payload format.
+ * \param scale        Factor each item is multiplied with when read, e.g. 1.0F / 32768 for 16-bit signed items. See
+ *                     vrt_init_converter().
+ * \param sample_rate  Sample rate [Hz]. See vrt_init_sequencer().
+ * \param words_packet Maximum number of 32-bit words in each packet, e.g. from the MTU. Values above the largest
+ *                     packet size (0xFFFF) are clamped.
+ * \param packetizer   Packetizer to initialize.
+ * \param validate     Level of validation.
+ *
+ * \return Number of samples in each packet, or a negative number if error. See vrt_init_sequencer() and
+ *         vrt_init_converter() for more error codes.
+ * \retval VRT_ERR_BOUNDS_PACKET_SIZE Maximum packet size doesn't fit header, fields, trailer, and a sample.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_init_packetizer(const struct vrt_header*                     header,
+                            const struct vrt_fields*                     fields,
+                            const struct vrt_trailer*                    trailer,
+                            const struct vrt_data_packet_payload_format* format,
+                            float                                        scale,
+                            double                                       sample_rate,
+                            int32_t                                      words_packet,
+                            struct vrt_packetizer*                       packetizer,
+                            enum vrt_validation                          validate);
+
+/**
+ * Same as vrt_init_packetizer(), but packets are written in network byte order (big endian) regardless of platform
+ * endianess.
+ *
+ * \param header       Header of first packet. Packet size is ignored.
+ * \param fields       Fields of first packet.
+ * \param trailer      Trailer. Only used if header has a trailer, and may otherwise be NULL.
+ * \param format       Payload format.
+ * \param scale        Factor each item is multiplied with when read.
+ * \param sample_rate  Sample rate [Hz].
+ * \param words_packet Maximum number of 32-bit words in each packet.
+ * \param packetizer   Packetizer to initialize.
+ * \param validate     Level of validation.
+ *
+ * \return Number of samples in each packet, or a negative number if error. See vrt_init_packetizer() for error codes.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_init_packetizer_be(const struct vrt_header*                     header,
+                               const struct vrt_fields*                     fields,
+                               const struct vrt_trailer*                    trailer,
+                               const struct vrt_data_packet_payload_format* format,
+                               float                                        scale,
+                               double                                       sample_rate,
+                               int32_t                                      words_packet,
+                               struct vrt_packetizer*                       packetizer,
+                               enum vrt_validation                          validate);
+
+/**
+ * Convert floats into a burst of consecutive packets, written back to back into one buffer. Packet count and
+ * timestamps continue from the previous burst. They are left as is if error.
+ *
+ * \param packetizer Packetizer.
+ * \param src        Floats to pack, interleaved as I, Q, I, Q, ... for complex items. See vrt_convert_from_float().
+ * \param n          Number of floats. Must be a whole number of samples.
+ * \param buf        Buffer to write packets to.
+ * \param words_buf  Size of buf in 32-bit words.
+ *
+ * \return Number of written 32-bit words, or a negative number if error.
+ * \retval VRT_ERR_PARTIAL_SAMPLE Number of floats is not a whole number of samples.
+ * \retval VRT_ERR_BUFFER_SIZE    Buffer is too small.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_packetize_float(struct vrt_packetizer* packetizer,
+                            const float*           src,
+                            int32_t                n,
+                            void*                  buf,
+                            int32_t                words_buf);
+
+/**
+ * Split an already packed body into a burst of consecutive packets, described by an array of scatter/gather buffers
+ * that e.g. can be passed to writev(). The body isn't copied. Header and fields section, and trailer, of each packet
+ * are written to parts, and each packet is described by two buffers, or three if it has a trailer: header and fields,
+ * body, and trailer. Packet count and timestamps continue from the previous burst. They are left as is if error.
+ *
+ * \param packetizer  Packetizer.
+ * \param body        Body of n items packed with the payload format, e.g. with vrt_convert_from_float(), or with
+ *                    vrt_convert_from_float_be() if the packetizer was initialized with vrt_init_packetizer_be().
+ *                    Must stay valid for as long as the buffers are used.
+ * \param n           Number of items. Must be a whole number of samples.
+ * \param parts       Buffer to write header, fields, and trailer words of all packets to. Must stay valid for as long
+ *                    as the buffers are used.
+ * \param words_parts Size of parts in 32-bit words.
+ * \param iov         Array to write buffers to.
+ * \param n_iov       Number of elements in iov.
+ *
+ * \return Number of written buffers, or a negative number if error.
+ * \retval VRT_ERR_PARTIAL_SAMPLE Number of items is not a whole number of samples.
+ * \retval VRT_ERR_BUFFER_SIZE    Parts or iov is too small.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_packetize_iov(struct vrt_packetizer* packetizer,
+                          const void*            body,
+                          int32_t                n,
+                          void*                  parts,
+                          int32_t                words_parts,
+                          struct vrt_iovec*      iov,
+                          int32_t                n_iov);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -14,6 +14,7 @@ struct vrt_fields;
 struct vrt_header;
 struct vrt_if_context;
 struct vrt_packet;
+struct vrt_packet_descriptor;
 struct vrt_trailer;
 
 /**
@@ -22,7 +23,7 @@ struct vrt_trailer;
  * \param buf       Buffer to read from.
  * \param words_buf Size of buf in 32-bit words.
  * \param header    Header to read into.
- * \param validate  True if validation shall be done. If false, only buffer size is validated.
+ * \param validate  Level of validation. If VRT_VALIDATION_NONE, only buffer size is validated.
  *
  * \return Number of read 32-bit words, or a negative number if error.
  * \retval VRT_ERR_BUFFER_SIZE          Buffer is too small.
@@ -31,10 +32,25 @@ struct vrt_trailer;
  * \retval VRT_ERR_TRAILER_IN_CONTEXT   Context packet has trailer bit set.
  * \retval VRT_ERR_TSM_IN_DATA          Data packet has TSM bit set.
  *
- * \note Requires input buffer data to be byte swapped if platform endianess isn't big endian (network order).
+ * \note Requires input buffer data to be byte swapped if platform endianess isn't big endian (network order). See
+ *       vrt_read_header_be() for an alternative.
  */
 VRT_WARN_UNUSED
-int32_t vrt_read_header(const void* buf, int32_t words_buf, struct vrt_header* header, bool validate);
+int32_t vrt_read_header(const void* buf, int32_t words_buf, struct vrt_header* header, enum vrt_validation validate);
+
+/**
+ * Same as vrt_read_header(), but buf is in network byte order (big endian) regardless of platform endianess. Words are
+ * byte swapped as they are decoded, so there is no need to swap the buffer beforehand.
+ *
+ * \param buf       Buffer to read from, in network byte order.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param header    Header to read into.
+ * \param validate  Level of validation. If VRT_VALIDATION_NONE, only buffer size is validated.
+ *
+ * \return Number of read 32-bit words, or a negative number if error. See vrt_read_header() for error codes.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_read_header_be(const void* buf, int32_t words_buf, struct vrt_header* header, enum vrt_validation validate);
 
 /**
  * Low-level function that reads VRT fields section.
@@ -44,7 +60,7 @@ int32_t vrt_read_header(const void* buf, int32_t words_buf, struct vrt_header* h
  *                  header word.
  * \param words_buf Size of buf in 32-bit words.
  * \param fields    Fields section to read into.
- * \param validate  True if validation shall be done. If false, only buffer size is validated.
+ * \param validate  Level of validation. If VRT_VALIDATION_NONE, only buffer size is validated.
  *
  * \return Number of read 32-bit words, or a negative number if error.
  * \retval VRT_ERR_BUFFER_SIZE      Buffer is too small.
@@ -57,7 +73,26 @@ int32_t vrt_read_fields(const struct vrt_header* header,
                         const void*              buf,
                         int32_t                  words_buf,
                         struct vrt_fields*       fields,
-                        bool                     validate);
+                        enum vrt_validation      validate);
+
+/**
+ * Same as vrt_read_fields(), but buf is in network byte order (big endian) regardless of platform endianess.
+ *
+ * \param header    Header.
+ * \param buf       Buffer to read from, in network byte order. This must point to the first field in the sequence,
+ *                  i.e. directly following the header word.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param fields    Fields section to read into.
+ * \param validate  Level of validation. If VRT_VALIDATION_NONE, only buffer size is validated.
+ *
+ * \return Number of read 32-bit words, or a negative number if error. See vrt_read_fields() for error codes.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_read_fields_be(const struct vrt_header* header,
+                           const void*              buf,
+                           int32_t                  words_buf,
+                           struct vrt_fields*       fields,
+                           enum vrt_validation      validate);
 
 /**
  * Low-level function that reads VRT trailer section.
@@ -75,13 +110,27 @@ int32_t vrt_read_fields(const struct vrt_header* header,
 VRT_WARN_UNUSED
 int32_t vrt_read_trailer(const void* buf, int32_t words_buf, struct vrt_trailer* trailer);
 
+/**
+ * Same as vrt_read_trailer(), but buf is in network byte order (big endian) regardless of platform endianess.
+ *
+ * \param buf       Buffer to read from, in network byte order. This must point to the position of the trailer word,
+ *                  i.e. the last word in the packet.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param trailer   Trailer to read into.
+ *
+ * \return Number of read 32-bit words, i.e. 1, or a negative number if error.
+ * \retval VRT_ERR_BUFFER_SIZE Buffer is too small.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_read_trailer_be(const void* buf, int32_t words_buf, struct vrt_trailer* trailer);
+
 /**
  * Low-level function that reads VRT IF context section.
  *
  * \param buf        Buffer to read from.
  * \param words_buf  Size of buf in 32-bit words.
  * \param if_context IF context struct to read into.
- * \param validate   True if validation shall be done. If false, only buffer size is validated.
+ * \param validate   Level of validation. If VRT_VALIDATION_NONE, only buffer size is validated.
  *
  * \return Number of read 32-bit words, or a negative number if error.
  * \retval VRT_ERR_BUFFER_SIZE                          Buffer is too small.
@@ -113,7 +162,68 @@ int32_t vrt_read_trailer(const void* buf, int32_t words_buf, struct vrt_trailer*
  *          sample_rate, may in rare cases lose precision since double only has 53 bits of precision.
  */
 VRT_WARN_UNUSED
-int32_t vrt_read_if_context(const void* buf, int32_t words_buf, struct vrt_if_context* if_context, bool validate);
+int32_t vrt_read_if_context(const void*            buf,
+                            int32_t                words_buf,
+                            struct vrt_if_context* if_context,
+                            enum vrt_validation    validate);
+
+/**
+ * Same as vrt_read_if_context(), but buf is in network byte order (big endian) regardless of platform endianess.
+ *
+ * \param buf        Buffer to read from, in network byte order.
+ * \param words_buf  Size of buf in 32-bit words.
+ * \param if_context IF context struct to read into.
+ * \param validate   Level of validation. If VRT_VALIDATION_NONE, only buffer size is validated.
+ *
+ * \return Number of read 32-bit words, or a negative number if error. See vrt_read_if_context() for error codes.
+ *
+ * \note The GPS ASCII and context association list pointers point into buf. ASCII characters are in transmission
+ *       order as they should be, but the context association list words are left in network byte order. Use
+ *       vrt_byte_swap() if they are needed in host order.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_read_if_context_be(const void*            buf,
+                               int32_t                words_buf,
+                               struct vrt_if_context* if_context,
+                               enum vrt_validation    validate);
+
+/**
+ * Same as vrt_read_if_context(), but only fields present in buf are overwritten. Fields not present keep their earlier
+ * values and indicators, so if_context can be persistent per-stream state that context packets with only the changed
+ * fields are merged into. The context field change indicator is always overwritten.
+ *
+ * \param buf        Buffer to read from.
+ * \param words_buf  Size of buf in 32-bit words.
+ * \param if_context IF context struct to merge into. Initialize it with vrt_init_if_context() before the first merge.
+ * \param validate   Level of validation. If VRT_VALIDATION_NONE, only buffer size is validated.
+ *
+ * \return Number of read 32-bit words, or a negative number if error. See vrt_read_if_context() for error codes.
+ *
+ * \warning If error, if_context may be partially merged.
+ * \warning GPS ASCII and context association list pointers from an earlier merge keep pointing into that earlier
+ *          buffer, if not present in buf.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_merge_if_context(const void*            buf,
+                             int32_t                words_buf,
+                             struct vrt_if_context* if_context,
+                             enum vrt_validation    validate);
+
+/**
+ * Same as vrt_merge_if_context(), but buf is in network byte order (big endian) regardless of platform endianess.
+ *
+ * \param buf        Buffer to read from, in network byte order.
+ * \param words_buf  Size of buf in 32-bit words.
+ * \param if_context IF context struct to merge into.
+ * \param validate   Level of validation. If VRT_VALIDATION_NONE, only buffer size is validated.
+ *
+ * \return Number of read 32-bit words, or a negative number if error. See vrt_read_if_context() for error codes.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_merge_if_context_be(const void*            buf,
+                                int32_t                words_buf,
+                                struct vrt_if_context* if_context,
+                                enum vrt_validation    validate);
 
 /**
  * Higher-level function that reads a full VRT packet.
@@ -121,7 +231,7 @@ int32_t vrt_read_if_context(const void* buf, int32_t words_buf, struct vrt_if_co
  * \param buf        Buffer to read from.
  * \param words_buf  Size of buf in 32-bit words.
  * \param packet     Packet to read into.
- * \param validate   True if validation shall be done. If false, only buffer size is validated.
+ * \param validate   Level of validation. If VRT_VALIDATION_NONE, only buffer size is validated.
  *
  * \return Number of read 32-bit words, or a negative number if error.
  * \retval VRT_ERR_BUFFER_SIZE                          Buffer is too small.
@@ -158,7 +268,88 @@ int32_t vrt_read_if_context(const void* buf, int32_t words_buf, struct vrt_if_co
  *          sample_rate, may in rare cases lose precision since double only has 53 bits of precision.
  */
 VRT_WARN_UNUSED
-int32_t vrt_read_packet(void* buf, int32_t words_buf, struct vrt_packet* packet, bool validate);
+int32_t vrt_read_packet(void* buf, int32_t words_buf, struct vrt_packet* packet, enum vrt_validation validate);
+
+/**
+ * Same as vrt_read_packet(), but buf is in network byte order (big endian) regardless of platform endianess. Header,
+ * fields, IF context and trailer words are byte swapped as they are decoded, so a packet straight from the wire can be
+ * read without first swapping the whole buffer.
+ *
+ * \param buf        Buffer to read from, in network byte order.
+ * \param words_buf  Size of buf in 32-bit words.
+ * \param packet     Packet to read into.
+ * \param validate   Level of validation. If VRT_VALIDATION_NONE, only buffer size is validated.
+ *
+ * \return Number of read 32-bit words, or a negative number if error. See vrt_read_packet() for error codes.
+ *
+ * \warning The packet body pointer will point into buf, which is why buf isn't const. The body words are left in
+ *          network byte order. Use vrt_byte_swap() to convert them, possibly in place, if required.
+ * \warning The context association list pointers are left in network byte order as well, see
+ *          vrt_read_if_context_be().
+ */
+VRT_WARN_UNUSED
+int32_t vrt_read_packet_be(void* buf, int32_t words_buf, struct vrt_packet* packet, enum vrt_validation validate);
+
+/**
+ * Walk a buffer of back-to-back packets, using the header packet size to find the next one, and describe each of them.
+ * This is cheaper than repeated vrt_read_packet() calls, since the IF context section isn't decoded. Reading stops when
+ * all descriptors are filled, at end of buffer, or at a packet which is cut off by the end of buffer.
+ *
+ * \param buf         Buffer to read from.
+ * \param words_buf   Size of buf in 32-bit words.
+ * \param descriptors Descriptors to read into.
+ * \param n           Number of descriptors.
+ * \param words_read  Number of 32-bit words in buf taken up by the read packets, i.e. the offset where reading should
+ *                    continue. On error, this is the offset of the erroneous packet instead.
+ * \param validate    Level of validation. If VRT_VALIDATION_NONE, only buffer and packet sizes are validated.
+ *
+ * \return Number of read packets, or a negative number if error.
+ * \retval VRT_ERR_RESERVED             One or multiple reserved bits are set.
+ * \retval VRT_ERR_INVALID_PACKET_TYPE  Packet type is an invalid value.
+ * \retval VRT_ERR_TRAILER_IN_CONTEXT   Context packet has trailer bit set.
+ * \retval VRT_ERR_TSM_IN_DATA          Data packet has TSM bit set.
+ * \retval VRT_ERR_BOUNDS_REAL_TIME     TSF is VRT_TSF_REAL_TIME but fractional timestamp is outside valid bounds
+ *                                      (> 999999999999 ps).
+ * \retval VRT_ERR_MISMATCH_PACKET_SIZE Packet size in header is too small to fit header, fields, and trailer.
+ *
+ * \note A partial packet at the end of buffer is not an error. It is simply left for the next call, once more data
+ *       has arrived.
+ * \note On error, the descriptors of all packets before the erroneous one are still filled in.
+ * \note For context packets, body points to the context section. Use vrt_read_if_context() to decode it.
+ *
+ * \warning The descriptor body pointers will point into buf, which is why buf isn't const.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_read_packets(void*                         buf,
+                         int32_t                       words_buf,
+                         struct vrt_packet_descriptor* descriptors,
+                         int32_t                       n,
+                         int32_t*                      words_read,
+                         enum vrt_validation           validate);
+
+/**
+ * Same as vrt_read_packets(), but buf is in network byte order (big endian) regardless of platform endianess.
+ *
+ * \param buf         Buffer to read from, in network byte order.
+ * \param words_buf   Size of buf in 32-bit words.
+ * \param descriptors Descriptors to read into.
+ * \param n           Number of descriptors.
+ * \param words_read  Number of 32-bit words in buf taken up by the read packets. On error, this is the offset of the
+ *                    erroneous packet instead.
+ * \param validate    Level of validation. If VRT_VALIDATION_NONE, only buffer and packet sizes are validated.
+ *
+ * \return Number of read packets, or a negative number if error. See vrt_read_packets() for error codes.
+ *
+ * \warning Body words are left in network byte order. Use vrt_read_if_context_be() to decode the context section of
+ *          context packets.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_read_packets_be(void*                         buf,
+                            int32_t                       words_buf,
+                            struct vrt_packet_descriptor* descriptors,
+                            int32_t                       n,
+                            int32_t*                      words_read,
+                            enum vrt_validation           validate);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,368 @@
+#ifndef INCLUDE_VRT_VRT_READ_INLINE_H_
+#define INCLUDE_VRT_VRT_READ_INLINE_H_
+
+/*
+ * Header-only versions of vrt_read_header(), vrt_read_fields(), and vrt_read_trailer(). The library functions are
+ * built from the same definitions, so results are identical. Include this instead of calling the library when decoding
+ * in a tight per-packet loop, to let the compiler inline the calls and fold constant arguments, such as the validation
+ * level or a header that is known in advance.
+ */
+
+#include "detail/vrt_internal.h"
+#include "vrt_bits.h"
+#include "vrt_error_code.h"
+#include "vrt_util.h"
+#include "vrt_words.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Read uint64 from uint32 buffer by interpreting the first word as most significant.
+ *
+ * \param b    Buffer to read from.
+ * \param swap True if the words shall be byte swapped.
+ *
+ * \return uint64.
+ */
+static VRT_INTERNAL_FORCE_INLINE uint64_t vrt_internal_read_uint64(const uint32_t* b, bool swap) {
+    return VRT_STATIC_CAST(uint64_t, vrt_internal_load(b, swap)) << 32U |
+           VRT_STATIC_CAST(uint64_t, vrt_internal_load(b + 1, swap));
+}
+
+/**
+ * Read VRT header section, with optional byte swapping of words.
+ *
+ * \param buf       Buffer to read from.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param header    Header to read into.
+ * \param validate  Level of validation.
+ * \param swap      True if words shall be byte swapped.
+ *
+ * \return Number of read words (always 1), or a negative number if error.
+ */
+static VRT_INTERNAL_FORCE_INLINE int32_t vrt_internal_read_header_swap(const void*         buf,
+                                                                       int32_t             words_buf,
+                                                                       struct vrt_header*  header,
+                                                                       enum vrt_validation validate,
+                                                                       bool                swap) {
+    /* Note that it makes sense to have words_buf as signed, to avoid overflow for words_buf - offset */
+
+    /* Size is always 1 */
+    const int32_t words = 1;
+
+    /* Check if buf size is sufficient */
+    if (words_buf < words) {
+        return VRT_ERR_BUFFER_SIZE;
+    }
+
+    /* Word in header section */
+    uint32_t b = vrt_internal_load(VRT_STATIC_CAST(const uint32_t*, buf), swap);
+
+    /* Enum fields are checked as integers, since a value outside the enum may not be loaded from the enum type */
+    const uint32_t packet_type = vrt_mskr(b, VRT_BITS_HEADER_PACKET_TYPE);
+    const uint32_t tsm         = vrt_mskr(b, VRT_BITS_HEADER_TSM);
+
+    /* Decode in order from msb to lsb */
+    header->packet_type  = VRT_STATIC_CAST(enum vrt_packet_type, packet_type);
+    header->has.class_id = vrt_internal_u2b(vrt_mskr(b, VRT_BITS_HEADER_HAS_CLASS_ID));
+    header->has.trailer  = vrt_internal_u2b(vrt_mskr(b, VRT_BITS_HEADER_HAS_TRAILER));
+    header->tsm          = VRT_STATIC_CAST(enum vrt_tsm, tsm);
+    header->tsi          = VRT_STATIC_CAST(enum vrt_tsi, vrt_mskr(b, VRT_BITS_HEADER_TSI));
+    header->tsf          = VRT_STATIC_CAST(enum vrt_tsf, vrt_mskr(b, VRT_BITS_HEADER_TSF));
+    header->packet_count = VRT_STATIC_CAST(uint8_t, vrt_mskr(b, VRT_BITS_HEADER_PACKET_COUNT));
+    header->packet_size  = VRT_STATIC_CAST(uint16_t, vrt_mskr(b, VRT_BITS_HEADER_PACKET_SIZE));
+
+    if (vrt_internal_validate_structure(validate)) {
+        if (packet_type > VRT_PT_EXT_CONTEXT) {
+            return VRT_ERR_INVALID_PACKET_TYPE;
+        }
+        if ((packet_type & 0x4U) != 0) {
+            if (header->has.trailer) {
+                return VRT_ERR_TRAILER_IN_CONTEXT;
+            }
+        } else {
+            if (tsm != VRT_TSM_FINE) {
+                return VRT_ERR_TSM_IN_DATA;
+            }
+        }
+        if (vrt_mskr(b, VRT_BITS_HEADER_RESERVED) != 0) {
+            return VRT_ERR_RESERVED;
+        }
+    }
+
+    return words;
+}
+
+/**
+ * Read VRT fields section, with optional byte swapping of words.
+ *
+ * \param header    Header.
+ * \param buf       Buffer to read from.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param fields    Fields to read into.
+ * \param validate  Level of validation.
+ * \param swap      True if words shall be byte swapped.
+ *
+ * \return Number of read words, or a negative number if error.
+ */
+static VRT_INTERNAL_FORCE_INLINE int32_t vrt_internal_read_fields_swap(const struct vrt_header* header,
+                                                                       const void*              buf,
+                                                                       int32_t                  words_buf,
+                                                                       struct vrt_fields*       fields,
+                                                                       enum vrt_validation      validate,
+                                                                       bool                     swap) {
+    const int32_t words = vrt_words_fields(header);
+
+    /* Check if buf size is sufficient */
+    if (words_buf < words) {
+        return VRT_ERR_BUFFER_SIZE;
+    }
+
+    const uint32_t* b = VRT_STATIC_CAST(const uint32_t*, buf);
+
+    if (vrt_has_stream_id(header)) {
+        fields->stream_id = vrt_internal_load(b, swap);
+        b += 1;
+    } else {
+        /* Zero Stream ID here, just to be sure */
+        fields->stream_id = 0;
+    }
+
+    if (header->has.class_id) {
+        fields->class_id.oui                    = vrt_mskr(vrt_internal_load(b, swap), 0, 24);
+        fields->class_id.information_class_code =
+            VRT_STATIC_CAST(uint16_t, vrt_mskr(vrt_internal_load(b + 1, swap), 16, 16));
+        fields->class_id.packet_class_code      = VRT_STATIC_CAST(uint16_t, vrt_internal_load(b + 1, swap));
+
+        if (vrt_internal_validate_structure(validate)) {
+            if ((vrt_internal_load(b, swap) & 0xFF000000U) != 0) {
+                return VRT_ERR_RESERVED;
+            }
+        }
+
+        b += 2;
+    } else {
+        /* Zero Class ID here, just to be sure */
+        fields->class_id.oui                    = 0;
+        fields->class_id.information_class_code = 0;
+        fields->class_id.packet_class_code      = 0;
+    }
+
+    if (header->tsi == VRT_TSI_NONE) {
+        /* Zero integer timestamp here, just to be sure */
+        fields->integer_seconds_timestamp = 0;
+    } else {
+        fields->integer_seconds_timestamp = vrt_internal_load(b, swap);
+        b += 1;
+    }
+
+    if (vrt_internal_has_fractional_timestamp(header->tsf)) {
+        fields->fractional_seconds_timestamp = vrt_internal_read_uint64(b, swap);
+
+        if (vrt_internal_validate_content(validate)) {
+            if (header->tsf == VRT_TSF_REAL_TIME && fields->fractional_seconds_timestamp >= 1000000000000U) {
+                return VRT_ERR_BOUNDS_REAL_TIME;
+            }
+        }
+
+        /* No point in increasing b pointer here, since we're finished */
+    } else {
+        /* Zero fractional timestamp here, just to be sure */
+        fields->fractional_seconds_timestamp = 0;
+    }
+
+    return words;
+}
+
+/**
+ * Read VRT trailer section, with optional byte swapping of words.
+ *
+ * \param buf       Buffer to read from.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param trailer   Trailer to read into.
+ * \param swap      True if words shall be byte swapped.
+ *
+ * \return Number of read words (always 1), or a negative number if error.
+ */
+static VRT_INTERNAL_FORCE_INLINE int32_t vrt_internal_read_trailer_swap(const void*         buf,
+                                                                        int32_t             words_buf,
+                                                                        struct vrt_trailer* trailer,
+                                                                        bool                swap) {
+    /* Number of words are always 1 */
+    const int32_t words = 1;
+
+    /* Check if buf size is sufficient */
+    if (words_buf < words) {
+        return VRT_ERR_BUFFER_SIZE;
+    }
+
+    uint32_t b = vrt_internal_load(VRT_STATIC_CAST(const uint32_t*, buf), swap);
+
+    /*
+     * Each enable bit sits 12 positions above its indicator bit, so AND-ing the word with itself shifted down by 12
+     * leaves only the indicators that are present. Fields that are not present are zeroed this way, without branches.
+     */
+    const uint32_t v = b & (b >> 12U);
+
+    /* Go from msb to lsb */
+    trailer->has.calibrated_time    = vrt_mskr(b, VRT_BITS_TRAILER_HAS_CALIBRATED_TIME);
+    trailer->has.valid_data         = vrt_mskr(b, VRT_BITS_TRAILER_HAS_VALID_DATA);
+    trailer->has.reference_lock     = vrt_mskr(b, VRT_BITS_TRAILER_HAS_REFERENCE_LOCK);
+    trailer->has.agc_or_mgc         = vrt_mskr(b, VRT_BITS_TRAILER_HAS_AGC_OR_MGC);
+    trailer->has.detected_signal    = vrt_mskr(b, VRT_BITS_TRAILER_HAS_DETECTED_SIGNAL);
+    trailer->has.spectral_inversion = vrt_mskr(b, VRT_BITS_TRAILER_HAS_SPECTRAL_INVERSION);
+    trailer->has.over_range         = vrt_mskr(b, VRT_BITS_TRAILER_HAS_OVER_RANGE);
+    trailer->has.sample_loss        = vrt_mskr(b, VRT_BITS_TRAILER_HAS_SAMPLE_LOSS);
+    trailer->has.user_defined11     = vrt_mskr(b, VRT_BITS_TRAILER_HAS_USER_DEFINED11);
+    trailer->has.user_defined10     = vrt_mskr(b, VRT_BITS_TRAILER_HAS_USER_DEFINED10);
+    trailer->has.user_defined9      = vrt_mskr(b, VRT_BITS_TRAILER_HAS_USER_DEFINED9);
+    trailer->has.user_defined8      = vrt_mskr(b, VRT_BITS_TRAILER_HAS_USER_DEFINED8);
+
+    trailer->calibrated_time    = vrt_mskr(v, VRT_BITS_TRAILER_CALIBRATED_TIME);
+    trailer->valid_data         = vrt_mskr(v, VRT_BITS_TRAILER_VALID_DATA);
+    trailer->reference_lock     = vrt_mskr(v, VRT_BITS_TRAILER_REFERENCE_LOCK);
+    trailer->agc_or_mgc         = VRT_STATIC_CAST(enum vrt_agc_or_mgc, vrt_mskr(v, VRT_BITS_TRAILER_AGC_OR_MGC));
+    trailer->detected_signal    = vrt_mskr(v, VRT_BITS_TRAILER_DETECTED_SIGNAL);
+    trailer->spectral_inversion = vrt_mskr(v, VRT_BITS_TRAILER_SPECTRAL_INVERSION);
+    trailer->over_range         = vrt_mskr(v, VRT_BITS_TRAILER_OVER_RANGE);
+    trailer->sample_loss        = vrt_mskr(v, VRT_BITS_TRAILER_SAMPLE_LOSS);
+    trailer->user_defined11     = vrt_mskr(v, VRT_BITS_TRAILER_USER_DEFINED11);
+    trailer->user_defined10     = vrt_mskr(v, VRT_BITS_TRAILER_USER_DEFINED10);
+    trailer->user_defined9      = vrt_mskr(v, VRT_BITS_TRAILER_USER_DEFINED9);
+    trailer->user_defined8      = vrt_mskr(v, VRT_BITS_TRAILER_USER_DEFINED8);
+
+    /* The count is 7 bits wide, so mask it with the enable bit spread to all bits instead */
+    const uint32_t has_count = vrt_mskr(b, VRT_BITS_TRAILER_HAS_ASSOCIATED_CONTEXT_PACKET_COUNT);
+    trailer->has.associated_context_packet_count = has_count;
+    trailer->associated_context_packet_count =
+        VRT_STATIC_CAST(uint8_t, vrt_mskr(b, VRT_BITS_TRAILER_ASSOCIATED_CONTEXT_PACKET_COUNT) & (0U - has_count));
+
+    /*
+     * Due to Recommendation 6.1.7-1: All unused trailer bits should be set to zero, there is not much to validate here.
+     */
+
+    return words;
+}
+
+/**
+ * Same as vrt_read_header(), but inlined.
+ *
+ * \param buf       Buffer to read from.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param header    Header to read into.
+ * \param validate  Level of validation. If VRT_VALIDATION_NONE, only buffer size is validated.
+ *
+ * \return Number of read 32-bit words, or a negative number if error. See vrt_read_header() for error codes.
+ */
+VRT_WARN_UNUSED
+static VRT_INTERNAL_FORCE_INLINE int32_t vrt_read_header_inline(const void*         buf,
+                                                                int32_t             words_buf,
+                                                                struct vrt_header*  header,
+                                                                enum vrt_validation validate) {
+    return vrt_internal_read_header_swap(buf, words_buf, header, validate, false);
+}
+
+/**
+ * Same as vrt_read_header_be(), but inlined.
+ *
+ * \param buf       Buffer to read from, in network byte order.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param header    Header to read into.
+ * \param validate  Level of validation. If VRT_VALIDATION_NONE, only buffer size is validated.
+ *
+ * \return Number of read 32-bit words, or a negative number if error. See vrt_read_header() for error codes.
+ */
+VRT_WARN_UNUSED
+static VRT_INTERNAL_FORCE_INLINE int32_t vrt_read_header_be_inline(const void*         buf,
+                                                                   int32_t             words_buf,
+                                                                   struct vrt_header*  header,
+                                                                   enum vrt_validation validate) {
+    return vrt_internal_read_header_swap(buf, words_buf, header, validate, VRT_INTERNAL_NETWORK_ORDER_SWAP);
+}
+
+/**
+ * Same as vrt_read_fields(), but inlined.
+ *
+ * \param header    Header.
+ * \param buf       Buffer to read from. This must point to the first field in the sequence, i.e. directly following the
+ *                  header word.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param fields    Fields section to read into.
+ * \param validate  Level of validation. If VRT_VALIDATION_NONE, only buffer size is validated.
+ *
+ * \return Number of read 32-bit words, or a negative number if error. See vrt_read_fields() for error codes.
+ */
+VRT_WARN_UNUSED
+static VRT_INTERNAL_FORCE_INLINE int32_t vrt_read_fields_inline(const struct vrt_header* header,
+                                                                const void*              buf,
+                                                                int32_t                  words_buf,
+                                                                struct vrt_fields*       fields,
+                                                                enum vrt_validation      validate) {
+    return vrt_internal_read_fields_swap(header, buf, words_buf, fields, validate, false);
+}
+
+/**
+ * Same as vrt_read_fields_be(), but inlined.
+ *
+ * \param header    Header.
+ * \param buf       Buffer to read from, in network byte order. This must point to the first field in the sequence, i.e.
+ *                  directly following the header word.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param fields    Fields section to read into.
+ * \param validate  Level of validation. If VRT_VALIDATION_NONE, only buffer size is validated.
+ *
+ * \return Number of read 32-bit words, or a negative number if error. See vrt_read_fields() for error codes.
+ */
+VRT_WARN_UNUSED
+static VRT_INTERNAL_FORCE_INLINE int32_t vrt_read_fields_be_inline(const struct vrt_header* header,
+                                                                   const void*              buf,
+                                                                   int32_t                  words_buf,
+                                                                   struct vrt_fields*       fields,
+                                                                   enum vrt_validation      validate) {
+    return vrt_internal_read_fields_swap(header, buf, words_buf, fields, validate, VRT_INTERNAL_NETWORK_ORDER_SWAP);
+}
+
+/**
+ * Same as vrt_read_trailer(), but inlined.
+ *
+ * \param buf       Buffer to read from. This must point to the position of the trailer word, i.e. the last word in the
+ *                  packet.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param trailer   Trailer to read into.
+ *
+ * \return Number of read 32-bit words, i.e. 1, or a negative number if error. See vrt_read_trailer() for error codes.
+ */
+VRT_WARN_UNUSED
+static VRT_INTERNAL_FORCE_INLINE int32_t vrt_read_trailer_inline(const void*         buf,
+                                                                 int32_t             words_buf,
+                                                                 struct vrt_trailer* trailer) {
+    return vrt_internal_read_trailer_swap(buf, words_buf, trailer, false);
+}
+
+/**
+ * Same as vrt_read_trailer_be(), but inlined.
+ *
+ * \param buf       Buffer to read from, in network byte order. This must point to the position of the trailer word,
+ *                  i.e. the last word in the packet.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param trailer   Trailer to read into.
+ *
+ * \return Number of read 32-bit words, i.e. 1, or a negative number if error. See vrt_read_trailer() for error codes.
+ */
+VRT_WARN_UNUSED
+static VRT_INTERNAL_FORCE_INLINE int32_t vrt_read_trailer_be_inline(const void*         buf,
+                                                                    int32_t             words_buf,
+                                                                    struct vrt_trailer* trailer) {
+    return vrt_internal_read_trailer_swap(buf, words_buf, trailer, VRT_INTERNAL_NETWORK_ORDER_SWAP);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
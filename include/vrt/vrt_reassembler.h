@@ -0,0 +1,137 @@
+#ifndef INCLUDE_VRT_VRT_REASSEMBLER_H_
+#define INCLUDE_VRT_VRT_REASSEMBLER_H_
+
+#include "vrt_util.h"
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct vrt_data_packet_payload_format;
+struct vrt_fields;
+struct vrt_header;
+struct vrt_packet_descriptor;
+struct vrt_reassembler;
+struct vrt_reassembly_span;
+
+/**
+ * Initialize reassembler of a stream, which concatenates the bodies of its data packets into a contiguous ring of
+ * float items, the inverse of vrt_packetize_float(). Context packets are skipped.
+ *
+ * Continuity is checked with timestamps if packets have a sample count or real-time fractional timestamp together with
+ * an integer seconds timestamp, and the sample rate is known, or a free running count fractional timestamp. Packets
+ * earlier than the expected next sample are dropped as late. Otherwise, the packet count is used, where a packet count
+ * up to 8 steps behind the last one is dropped as late, and lost packets are assumed to be as large as the last one.
+ * Since the packet count wraps every 16 packets, the stream resuming after a loss of 8 or more packets also looks late.
+ * If two consecutive packets are dropped, and neither was skipped before, the stream is resynchronized to the second
+ * one, and the packets since the last one are reported as a gap.
+ *
+ * \param reassembler Reassembler to initialize.
+ * \param format      Payload format.
+ * \param scale       Factor each item is multiplied with, e.g. 1.0F / 32768 to map 16-bit signed items to [-1, 1).
+ * \param sample_rate Sample rate [Hz], or 0 if unknown. Truncated to an integer.
+ * \param ring        Ring of capacity + overhang items, which must outlive the reassembler. May be NULL if only
+ *                    vrt_reassemble_spans() is used.
+ * \param capacity    Number of items in ring. Must be a power of two, or 0 if ring is NULL.
+ * \param overhang    Number of items after capacity in ring, that bodies are converted into before being wrapped to the
+ *                    start of ring. Must be at least the number of items in the largest body.
+ *
+ * \return 0, or a negative number if error.
+ * \retval VRT_ERR_UNSUPPORTED_FORMAT Payload format is not supported. See vrt_init_converter().
+ * \retval VRT_ERR_INVALID_CAPACITY   Capacity is not a power of two.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_init_reassembler(struct vrt_reassembler*                      reassembler,
+                             const struct vrt_data_packet_payload_format* format,
+                             float                                        scale,
+                             double                                       sample_rate,
+                             float*                                       ring,
+                             int32_t                                      capacity,
+                             int32_t                                      overhang);
+
+/**
+ * Convert the body of the next packet of the stream into the ring, after zero-filling any gap before it. The items
+ * are written from index head & mask, and head is then advanced past them. Items of a trailing partial sample are not
+ * counted.
+ *
+ * A gap larger than the ring capacity isn't zero-filled. It is still reported, and the stream continues right after
+ * the last written item.
+ *
+ * \param reassembler Reassembler.
+ * \param header      Header of packet.
+ * \param fields      Fields of packet.
+ * \param body        Body of packet.
+ * \param words_body  Number of 32-bit words in body.
+ *
+ * \return Number of missing items before the packet, i.e. 0 if it is continuous and also if it is dropped as late,
+ *         saturated at INT32_MAX, or a negative number if error. State is left as is if error.
+ * \retval VRT_ERR_BUFFER_SIZE Ring has too little free space, or the overhang is too small for the body. Consume items
+ *                             with vrt_consume_reassembler() and try again.
+ *
+ * \note Requires body words to be byte swapped if platform endianess isn't big endian (network order). See
+ *       vrt_reassemble_be() for an alternative.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_reassemble(struct vrt_reassembler*  reassembler,
+                       const struct vrt_header* header,
+                       const struct vrt_fields* fields,
+                       const void*              body,
+                       int32_t                  words_body);
+
+/**
+ * Same as vrt_reassemble(), but body is in network byte order (big endian) regardless of platform endianess.
+ *
+ * \param reassembler Reassembler.
+ * \param header      Header of packet.
+ * \param fields      Fields of packet.
+ * \param body        Body of packet, in network byte order.
+ * \param words_body  Number of 32-bit words in body.
+ *
+ * \return Number of missing items before the packet, or a negative number if error. See vrt_reassemble() for error
+ *         codes.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_reassemble_be(struct vrt_reassembler*  reassembler,
+                          const struct vrt_header* header,
+                          const struct vrt_fields* fields,
+                          const void*              body,
+                          int32_t                  words_body);
+
+/**
+ * Mark items of the ring as consumed, so that their space can be written again. Items from index tail & mask up to
+ * head are available.
+ *
+ * \param reassembler Reassembler.
+ * \param n           Number of items. Clamped to the number of available items.
+ */
+void vrt_consume_reassembler(struct vrt_reassembler* reassembler, int32_t n);
+
+/**
+ * Reassemble the bodies of consecutive packets without copying them. Bodies that directly follow each other in memory,
+ * e.g. when received with scatter/gather I/O into one buffer, are merged into a single span, as long as there is no
+ * gap between them. The ring isn't used. Reading stops when all spans are filled and a packet would need another one.
+ *
+ * \param reassembler  Reassembler.
+ * \param descriptors  Packets of the stream, e.g. from vrt_read_packets().
+ * \param n            Number of packets.
+ * \param spans        Spans to write.
+ * \param n_spans      Number of spans.
+ * \param packets_read Number of packets in descriptors that were reassembled, dropped, or skipped, i.e. where reading
+ *                     should continue.
+ *
+ * \return Number of written spans.
+ */
+int32_t vrt_reassemble_spans(struct vrt_reassembler*             reassembler,
+                             const struct vrt_packet_descriptor* descriptors,
+                             int32_t                             n,
+                             struct vrt_reassembly_span*         spans,
+                             int32_t                             n_spans,
+                             int32_t*                            packets_read);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
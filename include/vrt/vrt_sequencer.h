@@ -0,0 +1,112 @@
+#ifndef INCLUDE_VRT_VRT_SEQUENCER_H_
+#define INCLUDE_VRT_VRT_SEQUENCER_H_
+
+#include "vrt_util.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct vrt_fields;
+struct vrt_header;
+struct vrt_sequencer;
+struct vrt_trailer;
+
+/**
+ * Initialize a sequencer, which writes the packets of a stream and advances packet count and timestamps between them.
+ * Timestamps are advanced with integer arithmetic only, by samples_per_packet samples per packet:
+ * - VRT_TSF_SAMPLE_COUNT: Fractional timestamp is increased, and rolls over into integer seconds at sample rate.
+ * - VRT_TSF_REAL_TIME: Fractional timestamp is increased by the exact number of picoseconds, where the sub-picosecond
+ *   remainder is accumulated, and rolls over into integer seconds at 1 s.
+ * - VRT_TSF_FREE_RUNNING_COUNT: Fractional timestamp is increased. Integer seconds timestamp is left as is.
+ * - VRT_TSF_NONE: Integer seconds timestamp is increased every sample rate samples, counted from the first packet.
+ *
+ * \param header             Header of first packet. Packet size is ignored.
+ * \param fields             Fields of first packet.
+ * \param trailer            Trailer. Only used if header has a trailer, and may otherwise be NULL.
+ * \param sample_rate        Sample rate [Hz]. Truncated to an integer. Ignored if TSF is VRT_TSF_FREE_RUNNING_COUNT,
+ *                           or if both TSI and TSF are none.
+ * \param samples_per_packet Number of samples in each packet.
+ * \param seq                Sequencer to initialize.
+ * \param validate           Level of validation.
+ *
+ * \return Number of 32-bit words each packet adds to its body, i.e. header, fields, and trailer words, or a negative
+ *         number if error. See vrt_compile_packet_template() for more error codes.
+ * \retval VRT_ERR_MISSING_SAMPLE_RATE Sample rate is required but is not provided (< 1).
+ * \retval VRT_ERR_BOUNDS_REAL_TIME    TSF is VRT_TSF_REAL_TIME and fractional timestamp is outside valid bounds
+ *                                     (> 999999999999 ps).
+ * \retval VRT_ERR_BOUNDS_SAMPLE_COUNT TSF is VRT_TSF_SAMPLE_COUNT and fractional timestamp is outside valid bounds
+ *                                     (>= sample rate).
+ */
+VRT_WARN_UNUSED
+int32_t vrt_init_sequencer(const struct vrt_header*  header,
+                           const struct vrt_fields*  fields,
+                           const struct vrt_trailer* trailer,
+                           double                    sample_rate,
+                           uint32_t                  samples_per_packet,
+                           struct vrt_sequencer*     seq,
+                           enum vrt_validation       validate);
+
+/**
+ * Same as vrt_init_sequencer(), but packets are written in network byte order (big endian) regardless of platform
+ * endianess.
+ *
+ * \param header             Header of first packet. Packet size is ignored.
+ * \param fields             Fields of first packet.
+ * \param trailer            Trailer. Only used if header has a trailer, and may otherwise be NULL.
+ * \param sample_rate        Sample rate [Hz]. Truncated to an integer.
+ * \param samples_per_packet Number of samples in each packet.
+ * \param seq                Sequencer to initialize.
+ * \param validate           Level of validation.
+ *
+ * \return Number of 32-bit words each packet adds to its body, or a negative number if error. See
+ *         vrt_init_sequencer() for error codes.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_init_sequencer_be(const struct vrt_header*  header,
+                              const struct vrt_fields*  fields,
+                              const struct vrt_trailer* trailer,
+                              double                    sample_rate,
+                              uint32_t                  samples_per_packet,
+                              struct vrt_sequencer*     seq,
+                              enum vrt_validation       validate);
+
+/**
+ * Write the next packet of a stream, and advance packet count and timestamps. They are left as is if error.
+ *
+ * \param seq        Sequencer.
+ * \param body       Body to copy, as is. May be NULL, in which case the body words in buf are left untouched.
+ * \param words_body Number of 32-bit words in body.
+ * \param buf        Buffer to write to.
+ * \param words_buf  Size of buf in 32-bit words.
+ *
+ * \return Number of written 32-bit words, or a negative number if error.
+ * \retval VRT_ERR_BUFFER_SIZE        Buffer is too small.
+ * \retval VRT_ERR_BOUNDS_PACKET_SIZE Body size is negative, or packet is too large to fit in packet size field.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_write_sequenced_packet(struct vrt_sequencer* seq,
+                                   const void*           body,
+                                   int32_t               words_body,
+                                   void*                 buf,
+                                   int32_t               words_buf);
+
+/**
+ * Advance timestamps by a number of samples, without writing a packet. E.g. after writing a shorter last packet of a
+ * burst with vrt_write_packet_template() and the template of the sequencer, or to skip samples that are not sent.
+ *
+ * \param seq     Sequencer.
+ * \param samples Number of samples.
+ *
+ * \note Uses integer division, unless samples is the number of samples in each packet.
+ */
+void vrt_advance_sequencer(struct vrt_sequencer* seq, uint32_t samples);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
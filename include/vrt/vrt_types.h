@@ -2,6 +2,7 @@
 #define INCLUDE_VRT_VRT_TYPES_H_
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -720,6 +721,458 @@ struct vrt_packet {
     struct vrt_if_context if_context; /**< IF context. */
 };
 
+/**
+ * Level of validation when reading or writing packets. Each level is compiled into a separate path, so that a cheaper
+ * level doesn't pay for the checks of a more expensive one.
+ *
+ * \note NONE and FULL have the same values as false and true, so C code passing a bool keeps its behaviour.
+ */
+enum vrt_validation {
+    /** No validation. Only buffer sizes are checked. */
+    VRT_VALIDATION_NONE = 0,
+    /** Structural validation, plus field bounds and consistency between fields. */
+    VRT_VALIDATION_FULL = 1,
+    /** Packet type, header, packet size, and reserved bits, i.e. what is needed to trust the packet layout. */
+    VRT_VALIDATION_STRUCTURAL = 2
+};
+
+/**
+ * Compact description of a packet located in a larger buffer. Unlike struct vrt_packet, the IF context section isn't
+ * decoded, which keeps this small enough to fill by the hundreds.
+ */
+struct vrt_packet_descriptor {
+    int32_t            offset;     /**< Offset of the packet header from start of buffer, in 32-bit words. */
+    int32_t            words;      /**< Number of 32-bit words in packet, i.e. header packet size. */
+    struct vrt_header  header;     /**< Header. */
+    struct vrt_fields  fields;     /**< Fields. */
+    void*              body;       /**< Payload for data packets, or the context section for context packets. */
+    int32_t            words_body; /**< Number of 32-bit words used for body. */
+    struct vrt_trailer trailer;    /**< Trailer. Initialized to default if there is none. */
+};
+
+/**
+ * Lazily decoded view of an IF context section. Only the indicator field is decoded up front, together with the
+ * position of every present field. Individual fields are then decoded on demand.
+ */
+struct vrt_if_context_view {
+    /** IF context section, starting with the indicator field. */
+    const uint32_t* buf;
+    /** Context indicator field (CIF0), in host byte order. */
+    uint32_t indicator;
+    /** True if words in buf must be byte swapped when decoded. */
+    bool swap;
+    /** Offset of each field from buf in 32-bit words, indexed by its indicator bit position. 0 if not present. */
+    uint16_t offsets[32];
+};
+
+/**
+ * Precompiled header, fields, and trailer words of a packet stream, where only packet count, timestamps, packet size,
+ * and body change from packet to packet.
+ */
+struct vrt_packet_template {
+    /** Encoded header and fields section words, in host order. */
+    uint32_t words[7];
+    /** Number of 32-bit words used in words. */
+    int32_t words_prefix;
+    /** Offset of integer seconds timestamp in words, or 0 if there is none. */
+    int32_t offset_integer_seconds_timestamp;
+    /** Offset of fractional seconds timestamp in words, or 0 if there is none. */
+    int32_t offset_fractional_seconds_timestamp;
+    /** Encoded trailer word, in host order. */
+    uint32_t trailer;
+    /** True if packets have a trailer. */
+    bool has_trailer;
+    /** True if words shall be byte swapped when written. */
+    bool swap;
+    /** Packet count of the next written packet. */
+    uint8_t packet_count;
+};
+
+/**
+ * Packet template of a stream, along with the timestamps of the next packet and how to advance them.
+ */
+struct vrt_sequencer {
+    /** Template packets are written from. */
+    struct vrt_packet_template tmpl;
+    /** Integer seconds timestamp of next packet. */
+    uint32_t integer_seconds_timestamp;
+    /** Fractional seconds timestamp of next packet, in TSF units. Sample count within second if TSF is none. */
+    uint64_t fractional_seconds_timestamp;
+    /** Accumulated remainder of the fractional timestamp step, in units of 1/step_denominator. */
+    uint64_t remainder;
+    /** Whole part of fractional timestamp step per packet, in TSF units. */
+    uint64_t step;
+    /** Numerator of the fractional part of the step per packet. */
+    uint64_t step_remainder;
+    /** Denominator of the fractional part of the step per packet. */
+    uint64_t step_denominator;
+    /** Fractional timestamp units per second, or 0 if integer seconds timestamp shall not be advanced. */
+    uint64_t units_per_second;
+    /** Sample rate [Hz] if TSF is VRT_TSF_REAL_TIME, or 0 if a sample is one TSF unit. */
+    uint64_t real_time_rate;
+    /** Number of samples in each packet, i.e. that step is computed for. */
+    uint32_t samples_per_packet;
+};
+
+/**
+ * Called for each packet routed by a demultiplexer.
+ *
+ * \param descriptor Packet.
+ * \param user       User data of stream.
+ */
+typedef void (*vrt_demux_callback)(const struct vrt_packet_descriptor* descriptor, void* user);
+
+/**
+ * Stream entry in a demultiplexer hash table.
+ */
+struct vrt_demux_entry {
+    /** Stream ID. */
+    uint32_t stream_id;
+    /** True if entry is in use. */
+    bool used;
+    /** Called for each packet in stream. */
+    vrt_demux_callback callback;
+    /** User data, e.g. per-stream state, passed to callback. */
+    void* user;
+};
+
+/**
+ * Demultiplexer, routing packets to per-stream callbacks by stream ID. Uses an open addressing hash table with linear
+ * probing, in storage owned by the caller.
+ */
+struct vrt_demux {
+    /** Hash table. */
+    struct vrt_demux_entry* entries;
+    /** Number of entries in hash table minus one. */
+    uint32_t mask;
+    /** Number of used entries. */
+    int32_t size;
+    /** Entry of last routed packet, or NULL. */
+    struct vrt_demux_entry* last;
+    /** Called for packets without stream ID or with an unknown stream ID. May be NULL. */
+    vrt_demux_callback fallback;
+    /** User data passed to fallback. */
+    void* fallback_user;
+};
+
+/**
+ * Reader of a recording file with back-to-back packets. The file is memory mapped and packets are handed out in place,
+ * without copying. Mapping is done in windows that slide along with the read position, so recordings larger than the
+ * address space can be read as well.
+ */
+struct vrt_file_reader {
+    /** File descriptor, or -1 if not open. */
+    int fd;
+    /** File size in bytes. */
+    uint64_t size;
+    /** Maximum number of bytes mapped at a time. Multiple of page size. */
+    uint64_t window;
+    /** Current mapping, or NULL if nothing is mapped. */
+    void* map;
+    /** File offset of current mapping in bytes. Multiple of page size. */
+    uint64_t map_offset;
+    /** Number of bytes in current mapping. */
+    uint64_t map_size;
+    /** File offset of next packet to read in bytes. */
+    uint64_t offset;
+};
+
+/**
+ * Packet in a recording index. Stored as is in index files, so the layout must not change without bumping the index
+ * format version.
+ */
+struct vrt_index_entry {
+    /** Offset of packet from start of recording, in bytes. */
+    uint64_t offset;
+    /** Fractional seconds timestamp. 0 if not present. */
+    uint64_t fractional_seconds_timestamp;
+    /** Integer seconds timestamp. 0 if not present. */
+    uint32_t integer_seconds_timestamp;
+    /** Stream ID. 0 if not present. */
+    uint32_t stream_id;
+    /** Packet type, i.e. enum vrt_packet_type. */
+    uint8_t packet_type;
+    /** Packet count. */
+    uint8_t packet_count;
+    /** TSI, i.e. enum vrt_tsi. */
+    uint8_t tsi;
+    /** TSF, i.e. enum vrt_tsf. */
+    uint8_t tsf;
+    /** Number of 32-bit words in packet. */
+    uint16_t words;
+    /** Reserved, always 0. */
+    uint16_t reserved;
+};
+
+/**
+ * Packet of a stream in a recording index. These are sorted by stream ID, and then by packet number.
+ */
+struct vrt_index_stream_entry {
+    /** Stream ID. */
+    uint32_t stream_id;
+    /** Reserved, always 0. */
+    uint32_t reserved;
+    /** Packet number, i.e. position in the recording and index of its struct vrt_index_entry. */
+    uint64_t packet;
+};
+
+/**
+ * Recording index loaded from an index file. Packets can be looked up by number in constant time, and by stream in
+ * logarithmic time.
+ */
+struct vrt_index {
+    /** Mapping of index file, or NULL if not open. */
+    void* map;
+    /** Number of bytes in mapping. */
+    uint64_t map_size;
+    /** Packets, in recording order. */
+    const struct vrt_index_entry* entries;
+    /** Number of packets. */
+    uint64_t n;
+    /** Packets with stream ID, sorted by stream ID and then packet number. */
+    const struct vrt_index_stream_entry* streams;
+    /** Number of packets with stream ID. */
+    uint64_t n_streams;
+};
+
+/**
+ * Timestamp of the first packet in a block of a sparse time index. Unlike struct vrt_time, seconds are unsigned 64-bit,
+ * to fit integer seconds timestamps as well as free running counts divided by sample rate.
+ */
+struct vrt_time_index_block {
+    uint64_t s;  /**< Seconds. */
+    uint64_t ps; /**< Picoseconds [0, 999999999999]. */
+};
+
+/**
+ * Sparse time index of one stream in a recording index, with the time of every stride-th packet. Seeking binary
+ * searches the blocks, and then scans the packets of a single block linearly.
+ */
+struct vrt_time_index {
+    /** Recording index. */
+    const struct vrt_index* index;
+    /** Packets of stream. */
+    const struct vrt_index_stream_entry* packets;
+    /** Number of packets in stream. */
+    uint64_t n;
+    /** Number of packets per block. */
+    uint64_t stride;
+    /** Time of first packet in each block, in storage owned by the caller. */
+    struct vrt_time_index_block* blocks;
+    /** Number of blocks. */
+    uint64_t n_blocks;
+    /** Sample rate [Hz], for sample count and free running count timestamps. */
+    double sample_rate;
+};
+
+/**
+ * Converter of data packet bodies to and from float, for a single payload format. The kernels are chosen once, from the
+ * payload format and the instruction sets supported by the CPU.
+ */
+struct vrt_converter {
+    /** Conversion kernel, which converts n items. Byte swaps words first if swap is true. */
+    void (*kernel)(const struct vrt_converter* converter, const uint8_t* src, float* dst, int32_t n, bool swap);
+    /** Packing kernel, which packs n items and pads the last word. Byte swaps words last if swap is true. */
+    void (*pack_kernel)(const struct vrt_converter* converter, const float* src, uint8_t* dst, int32_t n, bool swap);
+    /** Factor each item is multiplied with. */
+    float scale;
+    /** Factor each float is multiplied with when packing, i.e. the reciprocal of scale. */
+    float inverse_scale;
+    /** True if link-efficient packing is used, i.e. item packing fields may span word boundaries. */
+    bool link_efficient;
+    /** True if items are signed. */
+    bool is_signed;
+    /** Item packing field size in bits [1, 64]. */
+    int32_t field_size;
+    /** Data item size in bits [1, 64]. */
+    int32_t item_size;
+    /** Event tag size in bits [0, 7]. */
+    int32_t event_tag_size;
+    /** Channel tag size in bits [0, 15]. */
+    int32_t channel_tag_size;
+};
+
+/**
+ * Buffer of scatter/gather I/O. Has the same members as struct iovec on POSIX platforms, so that arrays of it can be
+ * passed to e.g. writev() or sendmsg().
+ */
+struct vrt_iovec {
+    /** Start of buffer. */
+    void* iov_base;
+    /** Size of buffer in bytes. */
+    size_t iov_len;
+};
+
+/**
+ * Splits sample buffers into consecutive data packets of a stream, which are as large as the maximum packet size
+ * allows.
+ */
+struct vrt_packetizer {
+    /** Sequencer, which holds the packet template and timestamps of the next packet. */
+    struct vrt_sequencer seq;
+    /** Converter of the payload format. */
+    struct vrt_converter converter;
+    /** Number of items in each sample, i.e. 1 if real and 2 if complex. */
+    int32_t items_per_sample;
+    /** Number of samples in each packet, except possibly the last of a burst. */
+    int32_t samples_per_packet;
+    /** Number of body words in each packet, except possibly the last of a burst. */
+    int32_t words_body;
+    /** Number of header, fields, and trailer words in each packet. */
+    int32_t words_overhead;
+};
+
+/**
+ * Reassembler of the bodies of a stream into a contiguous ring of float items, where gaps are zero-filled.
+ */
+struct vrt_reassembler {
+    /** Converter of the payload format. */
+    struct vrt_converter converter;
+    /** Ring of capacity + overhang items, or NULL if only spans are reassembled. */
+    float* ring;
+    /** Capacity of ring minus 1, i.e. mask of item indices. */
+    uint32_t mask;
+    /** Number of items past the capacity of ring that bodies may be converted into before being wrapped. */
+    int32_t overhang;
+    /** Number of items written to ring, including zero-filled ones. Next item is written at index head & mask. */
+    uint64_t head;
+    /** Number of items consumed from ring. */
+    uint64_t tail;
+    /** Number of items in each sample, i.e. 1 if real and 2 if complex. */
+    int32_t items_per_sample;
+    /** Sample rate [Hz], or 0 if unknown. */
+    uint64_t sample_rate;
+    /** Position of the next expected sample, in samples. */
+    uint64_t position;
+    /** Number of samples in last packet. */
+    uint32_t samples;
+    /** Packet count of last packet. */
+    uint8_t packet_count;
+    /** Bitmap of the 8 packet counts before the last one that were skipped, where bit 0 is the one just before. */
+    uint8_t skipped_packets;
+    /** Packet count of last dropped packet that wasn't one of the skipped ones. */
+    uint8_t stray_packet_count;
+    /** True if the last packet was dropped without being one of the skipped ones. */
+    bool last_stray;
+    /** True if at least one packet has been reassembled. */
+    bool started;
+    /** Number of reassembled packets. */
+    uint64_t packets;
+    /** Number of gaps. */
+    uint64_t gaps;
+    /** Number of missing items in all gaps. */
+    uint64_t gap_items;
+    /** Number of dropped packets, which were late or duplicated. */
+    uint64_t late;
+    /** Number of packets where timestamps are continuous but packet count isn't. */
+    uint64_t count_mismatches;
+};
+
+/**
+ * Contiguous run of body words of consecutive packets, in the buffer they were received into.
+ */
+struct vrt_reassembly_span {
+    /** First body word. */
+    const void* body;
+    /** Number of 32-bit words. */
+    int32_t words;
+    /** Number of items, counting only whole samples. */
+    int32_t items;
+    /** Number of items missing right before the span, which should be zero-filled. */
+    uint64_t gap;
+};
+
+/**
+ * Packet loss, duplication, and reordering statistics of a stream, from packet count and timestamps.
+ */
+struct vrt_loss_tracker {
+    /** Number of received packets. */
+    uint64_t received;
+    /** Number of lost packets. Decreased again if a packet counted as lost arrives late. */
+    uint64_t lost;
+    /** Number of duplicated packets, including late packets that weren't counted as lost. */
+    uint64_t duplicated;
+    /** Number of packets counted as lost that arrived late. */
+    uint64_t reordered;
+    /** Nominal duration of a packet in fractional timestamp units, or 0 if timestamps aren't used. */
+    int64_t step;
+    /** Fractional timestamp units per second, or 0 if integer seconds timestamp isn't used. */
+    int64_t units_per_second;
+    /** Sample rate [Hz], or 0 if unknown. */
+    uint64_t sample_rate;
+    /** Number of samples per packet, or 0 if unknown. */
+    uint32_t samples_per_packet;
+    /** Integer seconds timestamp of last packet in order. */
+    uint32_t integer_seconds_timestamp;
+    /** Fractional seconds timestamp of last packet in order. */
+    uint64_t fractional_seconds_timestamp;
+    /** Packet count of last packet in order. */
+    uint8_t packet_count;
+    /**
+     * Packets counted as lost, within 8 packets before the last one in order. Bit k is set if the packet k + 1 packets
+     * before it is lost.
+     */
+    uint8_t lost_packets;
+    /** True if at least one packet has been received. */
+    bool started;
+};
+
+/**
+ * Stream entry in a context cache.
+ */
+struct vrt_context_cache_entry {
+    /** Stream ID. */
+    uint32_t stream_id;
+    /** True if entry is in use. */
+    bool used;
+    /** True if cached words are in network byte order. */
+    bool swap;
+    /** Number of cached IF context section words, or -1 if nothing is cached. */
+    int32_t words;
+    /** Number of words read when decoding the cached words. */
+    int32_t words_read;
+    /** Decoded IF context section. Pointers in it refer to the cached words. */
+    struct vrt_if_context if_context;
+};
+
+/**
+ * Cache of the last decoded IF context section of each stream, to skip decoding when it is unchanged. Uses an open
+ * addressing hash table with linear probing, in storage owned by the caller.
+ */
+struct vrt_context_cache {
+    /** Hash table. */
+    struct vrt_context_cache_entry* entries;
+    /** Storage of cached words, words_per_entry for each entry. */
+    uint32_t* words;
+    /** Number of words per entry in words. */
+    int32_t words_per_entry;
+    /** Number of entries in hash table minus one. */
+    uint32_t mask;
+    /** Number of used entries. */
+    int32_t size;
+    /** Number of reads that skipped decoding. */
+    uint64_t hits;
+    /** Number of reads that decoded. */
+    uint64_t misses;
+};
+
+/**
+ * State of a delta IF context encoder, which remembers the last emitted context of a stream.
+ */
+struct vrt_context_encoder {
+    /** Last emitted context. */
+    struct vrt_if_context last;
+    /**
+     * Encoded words of the fixed size fields in last, in host byte order. GPS ASCII and context association lists are
+     * never cached. The largest such section is 75 words.
+     */
+    uint32_t words[75];
+    /** True if last holds an emitted context. */
+    bool has_last;
+    /** True if words holds the encoding of last. */
+    bool words_valid;
+};
+
 /**
  * Timestamp in whole and fractional seconds.
  *
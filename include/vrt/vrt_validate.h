@@ -0,0 +1,73 @@
+#ifndef INCLUDE_VRT_VRT_VALIDATE_H_
+#define INCLUDE_VRT_VRT_VALIDATE_H_
+
+#include "vrt_util.h"
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Validate packet directly on its words, without decoding it into structs. Does the same checks as vrt_read_packet()
+ * with validation, and returns the same error code for the same packet.
+ *
+ * \param buf       Buffer with packet.
+ * \param words_buf Size of buf in 32-bit words.
+ *
+ * \return Number of 32-bit words in packet, or a negative number if error. See vrt_read_packet() for error codes.
+ *
+ * \note Requires input buffer data to be byte swapped if platform endianess isn't big endian (network order). See
+ *       vrt_validate_packet_be() for an alternative.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_validate_packet(const void* buf, int32_t words_buf);
+
+/**
+ * Same as vrt_validate_packet(), but buf is in network byte order (big endian) regardless of platform endianess.
+ *
+ * \param buf       Buffer with packet, in network byte order.
+ * \param words_buf Size of buf in 32-bit words.
+ *
+ * \return Number of 32-bit words in packet, or a negative number if error. See vrt_read_packet() for error codes.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_validate_packet_be(const void* buf, int32_t words_buf);
+
+/**
+ * Validate a buffer of back-to-back packets, using the header packet size to find the next one. Stops at end of buffer,
+ * or at a packet which is cut off by the end of buffer.
+ *
+ * \param buf        Buffer with packets.
+ * \param words_buf  Size of buf in 32-bit words.
+ * \param words_read Number of 32-bit words in buf taken up by the valid packets, i.e. the offset where validation
+ *                   should continue. On error, this is the offset of the erroneous packet instead.
+ *
+ * \return Number of valid packets, or a negative number if error. See vrt_read_packet() for error codes.
+ * \retval VRT_ERR_MISMATCH_PACKET_SIZE Packet size in header doesn't match the contents of the packet.
+ *
+ * \note A partial packet at the end of buffer is not an error. It is simply left for the next call, once more data
+ *       has arrived.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_validate_packets(const void* buf, int32_t words_buf, int32_t* words_read);
+
+/**
+ * Same as vrt_validate_packets(), but buf is in network byte order (big endian) regardless of platform endianess.
+ *
+ * \param buf        Buffer with packets, in network byte order.
+ * \param words_buf  Size of buf in 32-bit words.
+ * \param words_read Number of 32-bit words in buf taken up by the valid packets. On error, this is the offset of the
+ *                   erroneous packet instead.
+ *
+ * \return Number of valid packets, or a negative number if error. See vrt_validate_packets() for error codes.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_validate_packets_be(const void* buf, int32_t words_buf, int32_t* words_read);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -1,16 +1,14 @@
 #ifndef INCLUDE_VRT_VRT_WORDS_H_
 #define INCLUDE_VRT_VRT_WORDS_H_
 
+#include "vrt_util.h"
+
 #include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-struct vrt_header;
-struct vrt_if_context;
-struct vrt_packet;
-
 /* There is no point in adding max sizes for e.g. data body and IF/Ext context, since they can be UINT16_MAX - 1. */
 
 /**
@@ -37,7 +35,22 @@ static const uint16_t VRT_WORDS_MAX_PACKET = UINT16_MAX;
  *
  * \return Number of 32-bit words the fields section consists of.
  */
-int32_t vrt_words_fields(const struct vrt_header* header);
+inline int32_t vrt_words_fields(const struct vrt_header* header) {
+    int32_t words = 0;
+    if (vrt_has_stream_id(header)) {
+        words += 1;
+    }
+    if (header->has.class_id) {
+        words += 2;
+    }
+    if (header->tsi != VRT_TSI_NONE) {
+        words += 1;
+    }
+    if (header->tsf != VRT_TSF_NONE) {
+        words += 2;
+    }
+    return words;
+}
 
 /**
  * Calculate size of trailer in 32-bit words.
@@ -22,7 +22,7 @@ struct vrt_trailer;
  * \param header    Header to write.
  * \param buf       Buffer to write to.
  * \param words_buf Size of buf in 32-bit words.
- * \param validate  True if validation shall be done. If false, only buffer size is validated.
+ * \param validate  Level of validation. If VRT_VALIDATION_NONE, only buffer size is validated.
  *
  * \return Number of written 32-bit words (always 1), or a negative number if error.
  * \retval VRT_ERR_BUFFER_SIZE          Buffer is too small.
@@ -36,7 +36,24 @@ struct vrt_trailer;
  * \note May require output buffer data to be byte swapped if platform endianess isn't big endian (network order).
  */
 VRT_WARN_UNUSED
-int32_t vrt_write_header(const struct vrt_header* header, void* buf, int32_t words_buf, bool validate);
+int32_t vrt_write_header(const struct vrt_header* header, void* buf, int32_t words_buf, enum vrt_validation validate);
+
+/**
+ * Same as vrt_write_header(), but buf is written in network byte order (big endian) regardless of platform endianess.
+ *
+ * \param header    Header to write.
+ * \param buf       Buffer to write to.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param validate  Level of validation. If VRT_VALIDATION_NONE, only buffer size is validated.
+ *
+ * \return Number of written 32-bit words (always 1), or a negative number if error. See vrt_write_header() for error
+ *         codes.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_write_header_be(const struct vrt_header* header,
+                            void*                    buf,
+                            int32_t                  words_buf,
+                            enum vrt_validation      validate);
 
 /**
  * Low-level function that writes VRT fields section.
@@ -46,7 +63,7 @@ int32_t vrt_write_header(const struct vrt_header* header, void* buf, int32_t wor
  * \param buf       Buffer to write to. This must point to the start of the fields section, i.e. directly following the
  *                  header word.
  * \param words_buf Size of buf in 32-bit words.
- * \param validate  True if validation shall be done. If false, only buffer size is validated.
+ * \param validate  Level of validation. If VRT_VALIDATION_NONE, only buffer size is validated.
  *
  * \return Number of written 32-bit words, or a negative number if error.
  * \retval VRT_ERR_BUFFER_SIZE      Buffer is too small.
@@ -59,7 +76,26 @@ int32_t vrt_write_fields(const struct vrt_header* header,
                          const struct vrt_fields* fields,
                          void*                    buf,
                          int32_t                  words_buf,
-                         bool                     validate);
+                         enum vrt_validation      validate);
+
+/**
+ * Same as vrt_write_fields(), but buf is written in network byte order (big endian) regardless of platform endianess.
+ *
+ * \param header    Header.
+ * \param fields    Fields to write.
+ * \param buf       Buffer to write to. This must point to the start of the fields section, i.e. directly following the
+ *                  header word.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param validate  Level of validation. If VRT_VALIDATION_NONE, only buffer size is validated.
+ *
+ * \return Number of written 32-bit words, or a negative number if error. See vrt_write_fields() for error codes.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_write_fields_be(const struct vrt_header* header,
+                            const struct vrt_fields* fields,
+                            void*                    buf,
+                            int32_t                  words_buf,
+                            enum vrt_validation      validate);
 
 /**
  * Low-level function that writes VRT trailer section.
@@ -68,7 +104,7 @@ int32_t vrt_write_fields(const struct vrt_header* header,
  * \param buf        Buffer to write to. This must point to the position of the trailer word, i.e. the last word in the
  *                   packet.
  * \param words_buf  Size of buf in 32-bit words.
- * \param validate   True if validation shall be done. If false, only buffer size is validated.
+ * \param validate   Level of validation. If VRT_VALIDATION_NONE, only buffer size is validated.
  *
  * \return Number of written 32-bit words, or a negative number if error.
  * \retval VRT_ERR_BUFFER_SIZE                              Buffer is too small.
@@ -76,7 +112,27 @@ int32_t vrt_write_fields(const struct vrt_header* header,
  *                                                          (>0x7F).
  */
 VRT_WARN_UNUSED
-int32_t vrt_write_trailer(const struct vrt_trailer* trailer, void* buf, int32_t words_buf, bool validate);
+int32_t vrt_write_trailer(const struct vrt_trailer* trailer,
+                          void*                     buf,
+                          int32_t                   words_buf,
+                          enum vrt_validation       validate);
+
+/**
+ * Same as vrt_write_trailer(), but buf is written in network byte order (big endian) regardless of platform endianess.
+ *
+ * \param trailer    Trailer to write.
+ * \param buf        Buffer to write to. This must point to the position of the trailer word, i.e. the last word in the
+ *                   packet.
+ * \param words_buf  Size of buf in 32-bit words.
+ * \param validate   Level of validation. If VRT_VALIDATION_NONE, only buffer size is validated.
+ *
+ * \return Number of written 32-bit words, or a negative number if error. See vrt_write_trailer() for error codes.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_write_trailer_be(const struct vrt_trailer* trailer,
+                             void*                     buf,
+                             int32_t                   words_buf,
+                             enum vrt_validation       validate);
 
 /**
  * Low-level function that writes VRT IF context section.
@@ -85,7 +141,7 @@ int32_t vrt_write_trailer(const struct vrt_trailer* trailer, void* buf, int32_t
  * \param buf        Buffer to write to. This must point to the first context section word in the packet, i.e. directly
  *                   following the fields section.
  * \param words_buf  Size of buf in 32-bit words.
- * \param validate   True if validation shall be done. If false, only buffer size is validated.
+ * \param validate   Level of validation. If VRT_VALIDATION_NONE, only buffer size is validated.
  *
  * \return Number of written 32-bit words, or a negative number if error.
  * \retval VRT_ERR_BUFFER_SIZE                          Buffer is too small.
@@ -146,7 +202,30 @@ int32_t vrt_write_trailer(const struct vrt_trailer* trailer, void* buf, int32_t
  *          sample_rate, may in rare cases lose precision since double only has 53 bits of precision.
  */
 VRT_WARN_UNUSED
-int32_t vrt_write_if_context(const struct vrt_if_context* if_context, void* buf, int32_t words_buf, bool validate);
+int32_t vrt_write_if_context(const struct vrt_if_context* if_context,
+                             void*                        buf,
+                             int32_t                      words_buf,
+                             enum vrt_validation          validate);
+
+/**
+ * Same as vrt_write_if_context(), but buf is written in network byte order (big endian) regardless of platform
+ * endianess.
+ *
+ * \param if_context IF context to write.
+ * \param buf        Buffer to write to.
+ * \param words_buf  Size of buf in 32-bit words.
+ * \param validate   Level of validation. If VRT_VALIDATION_NONE, only buffer size is validated.
+ *
+ * \return Number of written 32-bit words, or a negative number if error. See vrt_write_if_context() for error codes.
+ *
+ * \note GPS ASCII characters and context association list words are copied as is, i.e. the lists must already be in
+ *       network byte order. This mirrors vrt_read_if_context_be().
+ */
+VRT_WARN_UNUSED
+int32_t vrt_write_if_context_be(const struct vrt_if_context* if_context,
+                                void*                        buf,
+                                int32_t                      words_buf,
+                                enum vrt_validation          validate);
 
 /**
  * Higher-level function that writes a full VRT packet.
@@ -154,7 +233,7 @@ int32_t vrt_write_if_context(const struct vrt_if_context* if_context, void* buf,
  * \param packet     Packet to write.
  * \param buf        Buffer to write to.
  * \param words_buf  Size of buf in 32-bit words.
- * \param validate   True if validation shall be done. If false, only buffer size is validated.
+ * \param validate   Level of validation. If VRT_VALIDATION_NONE, only buffer size is validated.
  *
  * \return Number of written 32-bit words, or a negative number if error.
  * \retval VRT_ERR_BUFFER_SIZE                            Buffer is too small.
@@ -228,7 +307,27 @@ int32_t vrt_write_if_context(const struct vrt_if_context* if_context, void* buf,
  * \note Will copy body data. For a zero-copy write, use the low-level routines.
  */
 VRT_WARN_UNUSED
-int32_t vrt_write_packet(const struct vrt_packet* packet, void* buf, int32_t words_buf, bool validate);
+int32_t vrt_write_packet(const struct vrt_packet* packet, void* buf, int32_t words_buf, enum vrt_validation validate);
+
+/**
+ * Same as vrt_write_packet(), but buf is written in network byte order (big endian) regardless of platform endianess.
+ * Header, fields, IF context and trailer words are byte swapped as they are encoded.
+ *
+ * \param packet     Packet to write.
+ * \param buf        Buffer to write to.
+ * \param words_buf  Size of buf in 32-bit words.
+ * \param validate   Level of validation. If VRT_VALIDATION_NONE, only buffer size is validated.
+ *
+ * \return Number of written 32-bit words, or a negative number if error. See vrt_write_packet() for error codes.
+ *
+ * \note Body words are copied as is, i.e. they must already be in network byte order. Use vrt_byte_swap() to convert
+ *       them if required.
+ */
+VRT_WARN_UNUSED
+int32_t vrt_write_packet_be(const struct vrt_packet* packet,
+                            void*                    buf,
+                            int32_t                  words_buf,
+                            enum vrt_validation      validate);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,374 @@
+#ifndef INCLUDE_VRT_VRT_WRITE_INLINE_H_
+#define INCLUDE_VRT_VRT_WRITE_INLINE_H_
+
+/*
+ * Header-only versions of vrt_write_header(), vrt_write_fields(), and vrt_write_trailer(). The library functions are
+ * built from the same definitions, so results are identical. Include this instead of calling the library when encoding
+ * in a tight per-packet loop, to let the compiler inline the calls and fold constant arguments, such as the validation
+ * level or a header that is known in advance.
+ */
+
+#include "detail/vrt_internal.h"
+#include "vrt_bits.h"
+#include "vrt_error_code.h"
+#include "vrt_util.h"
+#include "vrt_words.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Write uint64 to uint32 buffer by interpreting the first word as most significant.
+ *
+ * \param val  Value to write.
+ * \param b    Buffer to write to.
+ * \param swap True if the words shall be byte swapped.
+ */
+static VRT_INTERNAL_FORCE_INLINE void vrt_internal_write_uint64(uint64_t val, uint32_t* b, bool swap) {
+    vrt_internal_store(VRT_STATIC_CAST(uint32_t, val >> 32U), b, swap);
+    vrt_internal_store(VRT_STATIC_CAST(uint32_t, val), b + 1, swap);
+}
+
+/**
+ * Write VRT header section, with optional byte swapping of words.
+ *
+ * \param header    Header to write.
+ * \param buf       Buffer to write to.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param validate  Level of validation.
+ * \param swap      True if words shall be byte swapped.
+ *
+ * \return Number of written words (always 1), or a negative number if error.
+ */
+static VRT_INTERNAL_FORCE_INLINE int32_t vrt_internal_write_header_swap(const struct vrt_header* header,
+                                                                        void*                    buf,
+                                                                        int32_t                  words_buf,
+                                                                        enum vrt_validation      validate,
+                                                                        bool                     swap) {
+    /* Note that it makes sense to have words_buf as signed, to avoid overflow for words_buf - offset */
+
+    /* Number of words are always 1 */
+    const int32_t words = 1;
+
+    /* Check if buf size is sufficient */
+    if (words_buf < words) {
+        return VRT_ERR_BUFFER_SIZE;
+    }
+
+    /* Enum fields are loaded once and checked as integers, since they may hold values outside the enum */
+    const uint32_t packet_type = VRT_STATIC_CAST(uint32_t, header->packet_type);
+    const uint32_t tsm         = VRT_STATIC_CAST(uint32_t, header->tsm);
+    const uint32_t tsi         = VRT_STATIC_CAST(uint32_t, header->tsi);
+    const uint32_t tsf         = VRT_STATIC_CAST(uint32_t, header->tsf);
+
+    if (vrt_internal_validate_structure(validate)) {
+        if (packet_type > VRT_PT_EXT_CONTEXT) {
+            return VRT_ERR_INVALID_PACKET_TYPE;
+        }
+        if (tsm > VRT_TSM_COARSE) {
+            return VRT_ERR_INVALID_TSM;
+        }
+        if ((packet_type & 0x4U) != 0) {
+            if (header->has.trailer) {
+                return VRT_ERR_TRAILER_IN_CONTEXT;
+            }
+        } else {
+            if (tsm != VRT_TSM_FINE) {
+                return VRT_ERR_TSM_IN_DATA;
+            }
+        }
+        if (tsi > VRT_TSI_OTHER) {
+            return VRT_ERR_INVALID_TSI;
+        }
+        if (tsf > VRT_TSF_FREE_RUNNING_COUNT) {
+            return VRT_ERR_INVALID_TSF;
+        }
+        if (header->packet_count > 0x0F) {
+            return VRT_ERR_BOUNDS_PACKET_COUNT;
+        }
+    }
+
+    /* Word in header section. Rule 6.1.1-6: The reserved bits shall be set to 0. */
+    uint32_t b = 0;
+
+    b |= vrt_mskw(packet_type, VRT_BITS_HEADER_PACKET_TYPE);
+    b |= vrt_mskw(vrt_internal_b2u(header->has.class_id), VRT_BITS_HEADER_HAS_CLASS_ID);
+    b |= vrt_mskw(vrt_internal_b2u(header->has.trailer), VRT_BITS_HEADER_HAS_TRAILER);
+    b |= vrt_mskw(tsm, VRT_BITS_HEADER_TSM);
+    b |= vrt_mskw(tsi, VRT_BITS_HEADER_TSI);
+    b |= vrt_mskw(tsf, VRT_BITS_HEADER_TSF);
+    b |= vrt_mskw(header->packet_count, VRT_BITS_HEADER_PACKET_COUNT);
+    b |= vrt_mskw(header->packet_size, VRT_BITS_HEADER_PACKET_SIZE);
+
+    vrt_internal_store(b, VRT_STATIC_CAST(uint32_t*, buf), swap);
+
+    return words;
+}
+
+/**
+ * Write VRT fields section, with optional byte swapping of words.
+ *
+ * \param header    Header.
+ * \param fields    Fields to write.
+ * \param buf       Buffer to write to.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param validate  Level of validation.
+ * \param swap      True if words shall be byte swapped.
+ *
+ * \return Number of written words, or a negative number if error.
+ */
+static VRT_INTERNAL_FORCE_INLINE int32_t vrt_internal_write_fields_swap(const struct vrt_header* header,
+                                                                        const struct vrt_fields* fields,
+                                                                        void*                    buf,
+                                                                        int32_t                  words_buf,
+                                                                        enum vrt_validation      validate,
+                                                                        bool                     swap) {
+    const int32_t words = vrt_words_fields(header);
+
+    /* Check if buf size is sufficient */
+    if (words_buf < words) {
+        return VRT_ERR_BUFFER_SIZE;
+    }
+
+    uint32_t* b = VRT_STATIC_CAST(uint32_t*, buf);
+
+    if (vrt_has_stream_id(header)) {
+        vrt_internal_store(fields->stream_id, b, swap);
+        b += 1;
+    }
+    if (header->has.class_id) {
+        if (vrt_internal_validate_content(validate)) {
+            if (fields->class_id.oui > 0x00FFFFFFU) {
+                return VRT_ERR_BOUNDS_OUI;
+            }
+        }
+
+        vrt_internal_store(vrt_mskw(fields->class_id.oui, 0, 24), b, swap);
+        vrt_internal_store(
+            vrt_mskw(fields->class_id.information_class_code, 16, 16) | fields->class_id.packet_class_code, b + 1,
+            swap);
+        b += 2;
+    }
+    if (header->tsi != VRT_TSI_NONE) {
+        vrt_internal_store(fields->integer_seconds_timestamp, b, swap);
+        b += 1;
+    }
+    if (vrt_internal_has_fractional_timestamp(header->tsf)) {
+        if (vrt_internal_validate_content(validate)) {
+            if (header->tsf == VRT_TSF_REAL_TIME && fields->fractional_seconds_timestamp >= 1000000000000) {
+                return VRT_ERR_BOUNDS_REAL_TIME;
+            }
+        }
+
+        vrt_internal_write_uint64(fields->fractional_seconds_timestamp, b, swap);
+        /* No point in increasing b pointer here */
+    }
+
+    return words;
+}
+
+/**
+ * Write VRT trailer section, with optional byte swapping of words.
+ *
+ * \param trailer   Trailer to write.
+ * \param buf       Buffer to write to.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param validate  Level of validation.
+ * \param swap      True if words shall be byte swapped.
+ *
+ * \return Number of written words (always 1), or a negative number if error.
+ */
+static VRT_INTERNAL_FORCE_INLINE int32_t vrt_internal_write_trailer_swap(const struct vrt_trailer* trailer,
+                                                                         void*                     buf,
+                                                                         int32_t                   words_buf,
+                                                                         enum vrt_validation       validate,
+                                                                         bool                      swap) {
+    /* Number of words are always 1 */
+    const int32_t words = 1;
+
+    /* Check if buf size is sufficient */
+    if (words_buf < words) {
+        return VRT_ERR_BUFFER_SIZE;
+    }
+
+    const uint32_t has_count = vrt_internal_b2u(trailer->has.associated_context_packet_count);
+    if (vrt_internal_validate_content(validate)) {
+        if (has_count != 0 && trailer->associated_context_packet_count > 0x7F) {
+            return VRT_ERR_BOUNDS_ASSOCIATED_CONTEXT_PACKET_COUNT;
+        }
+    }
+
+    /* Enable bits, from msb to lsb */
+    uint32_t e = 0;
+    e |= vrt_mskw(vrt_internal_b2u(trailer->has.calibrated_time), VRT_BITS_TRAILER_HAS_CALIBRATED_TIME);
+    e |= vrt_mskw(vrt_internal_b2u(trailer->has.valid_data), VRT_BITS_TRAILER_HAS_VALID_DATA);
+    e |= vrt_mskw(vrt_internal_b2u(trailer->has.reference_lock), VRT_BITS_TRAILER_HAS_REFERENCE_LOCK);
+    e |= vrt_mskw(vrt_internal_b2u(trailer->has.agc_or_mgc), VRT_BITS_TRAILER_HAS_AGC_OR_MGC);
+    e |= vrt_mskw(vrt_internal_b2u(trailer->has.detected_signal), VRT_BITS_TRAILER_HAS_DETECTED_SIGNAL);
+    e |= vrt_mskw(vrt_internal_b2u(trailer->has.spectral_inversion), VRT_BITS_TRAILER_HAS_SPECTRAL_INVERSION);
+    e |= vrt_mskw(vrt_internal_b2u(trailer->has.over_range), VRT_BITS_TRAILER_HAS_OVER_RANGE);
+    e |= vrt_mskw(vrt_internal_b2u(trailer->has.sample_loss), VRT_BITS_TRAILER_HAS_SAMPLE_LOSS);
+    e |= vrt_mskw(vrt_internal_b2u(trailer->has.user_defined11), VRT_BITS_TRAILER_HAS_USER_DEFINED11);
+    e |= vrt_mskw(vrt_internal_b2u(trailer->has.user_defined10), VRT_BITS_TRAILER_HAS_USER_DEFINED10);
+    e |= vrt_mskw(vrt_internal_b2u(trailer->has.user_defined9), VRT_BITS_TRAILER_HAS_USER_DEFINED9);
+    e |= vrt_mskw(vrt_internal_b2u(trailer->has.user_defined8), VRT_BITS_TRAILER_HAS_USER_DEFINED8);
+
+    /* Indicator bits, from msb to lsb */
+    uint32_t v = 0;
+    v |= vrt_mskw(vrt_internal_b2u(trailer->calibrated_time), VRT_BITS_TRAILER_CALIBRATED_TIME);
+    v |= vrt_mskw(vrt_internal_b2u(trailer->valid_data), VRT_BITS_TRAILER_VALID_DATA);
+    v |= vrt_mskw(vrt_internal_b2u(trailer->reference_lock), VRT_BITS_TRAILER_REFERENCE_LOCK);
+    v |= vrt_mskw(trailer->agc_or_mgc, VRT_BITS_TRAILER_AGC_OR_MGC);
+    v |= vrt_mskw(vrt_internal_b2u(trailer->detected_signal), VRT_BITS_TRAILER_DETECTED_SIGNAL);
+    v |= vrt_mskw(vrt_internal_b2u(trailer->spectral_inversion), VRT_BITS_TRAILER_SPECTRAL_INVERSION);
+    v |= vrt_mskw(vrt_internal_b2u(trailer->over_range), VRT_BITS_TRAILER_OVER_RANGE);
+    v |= vrt_mskw(vrt_internal_b2u(trailer->sample_loss), VRT_BITS_TRAILER_SAMPLE_LOSS);
+    v |= vrt_mskw(vrt_internal_b2u(trailer->user_defined11), VRT_BITS_TRAILER_USER_DEFINED11);
+    v |= vrt_mskw(vrt_internal_b2u(trailer->user_defined10), VRT_BITS_TRAILER_USER_DEFINED10);
+    v |= vrt_mskw(vrt_internal_b2u(trailer->user_defined9), VRT_BITS_TRAILER_USER_DEFINED9);
+    v |= vrt_mskw(vrt_internal_b2u(trailer->user_defined8), VRT_BITS_TRAILER_USER_DEFINED8);
+
+    /*
+     * Each indicator bit sits 12 positions below its enable bit, so AND-ing with the enables shifted down by 12 clears
+     * the indicators that are not present, without branches. Recommendation 6.1.7-1: All unused trailer bits should be
+     * set to zero.
+     */
+    uint32_t b = e | (v & (e >> 12U));
+
+    /* The count is 7 bits wide, so mask it with the enable bit spread to all bits instead */
+    b |= vrt_mskw(has_count, VRT_BITS_TRAILER_HAS_ASSOCIATED_CONTEXT_PACKET_COUNT);
+    b |= vrt_mskw(trailer->associated_context_packet_count, VRT_BITS_TRAILER_ASSOCIATED_CONTEXT_PACKET_COUNT) &
+         (0U - has_count);
+
+    vrt_internal_store(b, VRT_STATIC_CAST(uint32_t*, buf), swap);
+
+    return words;
+}
+
+/**
+ * Same as vrt_write_header(), but inlined.
+ *
+ * \param header    Header to write.
+ * \param buf       Buffer to write to.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param validate  Level of validation. If VRT_VALIDATION_NONE, only buffer size is validated.
+ *
+ * \return Number of written 32-bit words (always 1), or a negative number if error. See vrt_write_header() for error
+ *         codes.
+ */
+VRT_WARN_UNUSED
+static VRT_INTERNAL_FORCE_INLINE int32_t vrt_write_header_inline(const struct vrt_header* header,
+                                                                 void*                    buf,
+                                                                 int32_t                  words_buf,
+                                                                 enum vrt_validation      validate) {
+    return vrt_internal_write_header_swap(header, buf, words_buf, validate, false);
+}
+
+/**
+ * Same as vrt_write_header_be(), but inlined.
+ *
+ * \param header    Header to write.
+ * \param buf       Buffer to write to, in network byte order.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param validate  Level of validation. If VRT_VALIDATION_NONE, only buffer size is validated.
+ *
+ * \return Number of written 32-bit words (always 1), or a negative number if error. See vrt_write_header() for error
+ *         codes.
+ */
+VRT_WARN_UNUSED
+static VRT_INTERNAL_FORCE_INLINE int32_t vrt_write_header_be_inline(const struct vrt_header* header,
+                                                                    void*                    buf,
+                                                                    int32_t                  words_buf,
+                                                                    enum vrt_validation      validate) {
+    return vrt_internal_write_header_swap(header, buf, words_buf, validate, VRT_INTERNAL_NETWORK_ORDER_SWAP);
+}
+
+/**
+ * Same as vrt_write_fields(), but inlined.
+ *
+ * \param header    Header.
+ * \param fields    Fields to write.
+ * \param buf       Buffer to write to. This must point to the start of the fields section, i.e. directly following the
+ *                  header word.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param validate  Level of validation. If VRT_VALIDATION_NONE, only buffer size is validated.
+ *
+ * \return Number of written 32-bit words, or a negative number if error. See vrt_write_fields() for error codes.
+ */
+VRT_WARN_UNUSED
+static VRT_INTERNAL_FORCE_INLINE int32_t vrt_write_fields_inline(const struct vrt_header* header,
+                                                                 const struct vrt_fields* fields,
+                                                                 void*                    buf,
+                                                                 int32_t                  words_buf,
+                                                                 enum vrt_validation      validate) {
+    return vrt_internal_write_fields_swap(header, fields, buf, words_buf, validate, false);
+}
+
+/**
+ * Same as vrt_write_fields_be(), but inlined.
+ *
+ * \param header    Header.
+ * \param fields    Fields to write.
+ * \param buf       Buffer to write to, in network byte order. This must point to the start of the fields section, i.e.
+ *                  directly following the header word.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param validate  Level of validation. If VRT_VALIDATION_NONE, only buffer size is validated.
+ *
+ * \return Number of written 32-bit words, or a negative number if error. See vrt_write_fields() for error codes.
+ */
+VRT_WARN_UNUSED
+static VRT_INTERNAL_FORCE_INLINE int32_t vrt_write_fields_be_inline(const struct vrt_header* header,
+                                                                    const struct vrt_fields* fields,
+                                                                    void*                    buf,
+                                                                    int32_t                  words_buf,
+                                                                    enum vrt_validation      validate) {
+    return vrt_internal_write_fields_swap(header, fields, buf, words_buf, validate, VRT_INTERNAL_NETWORK_ORDER_SWAP);
+}
+
+/**
+ * Same as vrt_write_trailer(), but inlined.
+ *
+ * \param trailer   Trailer to write.
+ * \param buf       Buffer to write to. This must point to the position of the trailer word, i.e. the last word in the
+ *                  packet.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param validate  Level of validation. If VRT_VALIDATION_NONE, only buffer size is validated.
+ *
+ * \return Number of written 32-bit words, or a negative number if error. See vrt_write_trailer() for error codes.
+ */
+VRT_WARN_UNUSED
+static VRT_INTERNAL_FORCE_INLINE int32_t vrt_write_trailer_inline(const struct vrt_trailer* trailer,
+                                                                  void*                     buf,
+                                                                  int32_t                   words_buf,
+                                                                  enum vrt_validation       validate) {
+    return vrt_internal_write_trailer_swap(trailer, buf, words_buf, validate, false);
+}
+
+/**
+ * Same as vrt_write_trailer_be(), but inlined.
+ *
+ * \param trailer   Trailer to write.
+ * \param buf       Buffer to write to, in network byte order. This must point to the position of the trailer word,
+ *                  i.e. the last word in the packet.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param validate  Level of validation. If VRT_VALIDATION_NONE, only buffer size is validated.
+ *
+ * \return Number of written 32-bit words, or a negative number if error. See vrt_write_trailer() for error codes.
+ */
+VRT_WARN_UNUSED
+static VRT_INTERNAL_FORCE_INLINE int32_t vrt_write_trailer_be_inline(const struct vrt_trailer* trailer,
+                                                                     void*                     buf,
+                                                                     int32_t                   words_buf,
+                                                                     enum vrt_validation       validate) {
+    return vrt_internal_write_trailer_swap(trailer, buf, words_buf, validate, VRT_INTERNAL_NETWORK_ORDER_SWAP);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
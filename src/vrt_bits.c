@@ -0,0 +1,7 @@
+#include "vrt/vrt_bits.h"
+
+/* Defined inline in header */
+extern uint32_t vrt_mskr(uint32_t val, uint32_t pos, uint32_t n);
+extern uint32_t vrt_mskw(uint32_t val, uint32_t pos, uint32_t n);
+extern uint32_t vrt_get_bits(uint32_t word, uint32_t pos, uint32_t n);
+extern uint32_t vrt_set_bits(uint32_t word, uint32_t pos, uint32_t n, uint32_t val);
@@ -0,0 +1,97 @@
+#include "vrt/vrt_byte_swap.h"
+
+#include "vrt_cpu.h"
+#include "vrt_util_internal.h"
+
+#include <string.h>
+
+#if VRT_X86_DISPATCH
+#include <immintrin.h>
+#endif
+
+/**
+ * Swap bytes of words one at a time. Also used for the tails of the SIMD kernels.
+ *
+ * \param src   Buffer to read from.
+ * \param dst   Buffer to write to.
+ * \param words Number of words to swap.
+ */
+static void byte_swap_scalar(const uint8_t* src, uint8_t* dst, int32_t words) {
+    for (int32_t i = 0; i < words; ++i) {
+        uint32_t u;
+        /* memcpy to avoid alignment requirements. It compiles to a plain load/store. */
+        memcpy(&u, src + sizeof(uint32_t) * i, sizeof(uint32_t));
+        u = vrt_internal_bswap32(u);
+        memcpy(dst + sizeof(uint32_t) * i, &u, sizeof(uint32_t));
+    }
+}
+
+#if VRT_X86_DISPATCH
+/**
+ * Swap bytes of words with SSSE3, 4 words at a time.
+ *
+ * \param src   Buffer to read from.
+ * \param dst   Buffer to write to.
+ * \param words Number of words to swap.
+ */
+VRT_TARGET("ssse3") static void byte_swap_ssse3(const uint8_t* src, uint8_t* dst, int32_t words) {
+    const __m128i shuffle = _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+
+    int32_t i = 0;
+    for (; i + 4 <= words; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(src + sizeof(uint32_t) * i));
+        _mm_storeu_si128((__m128i*)(dst + sizeof(uint32_t) * i), _mm_shuffle_epi8(v, shuffle));
+    }
+    byte_swap_scalar(src + sizeof(uint32_t) * i, dst + sizeof(uint32_t) * i, words - i);
+}
+
+/**
+ * Swap bytes of words with AVX2, 16 words at a time in the main loop.
+ *
+ * \param src   Buffer to read from.
+ * \param dst   Buffer to write to.
+ * \param words Number of words to swap.
+ */
+VRT_TARGET("avx2") static void byte_swap_avx2(const uint8_t* src, uint8_t* dst, int32_t words) {
+    /* The shuffle operates within each 128-bit lane, so the same pattern is repeated twice */
+    const __m256i shuffle = _mm256_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3, 12, 13, 14, 15, 8, 9,
+                                            10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+
+    int32_t i = 0;
+    /* Two vectors per iteration to hide load latency */
+    for (; i + 16 <= words; i += 16) {
+        __m256i v0 = _mm256_loadu_si256((const __m256i*)(src + sizeof(uint32_t) * i));
+        __m256i v1 = _mm256_loadu_si256((const __m256i*)(src + sizeof(uint32_t) * (i + 8)));
+        _mm256_storeu_si256((__m256i*)(dst + sizeof(uint32_t) * i), _mm256_shuffle_epi8(v0, shuffle));
+        _mm256_storeu_si256((__m256i*)(dst + sizeof(uint32_t) * (i + 8)), _mm256_shuffle_epi8(v1, shuffle));
+    }
+    for (; i + 8 <= words; i += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(src + sizeof(uint32_t) * i));
+        _mm256_storeu_si256((__m256i*)(dst + sizeof(uint32_t) * i), _mm256_shuffle_epi8(v, shuffle));
+    }
+    byte_swap_scalar(src + sizeof(uint32_t) * i, dst + sizeof(uint32_t) * i, words - i);
+}
+#endif
+
+void vrt_byte_swap(const void* src, void* dst, int32_t words) {
+    if (words <= 0) {
+        return;
+    }
+
+    const uint8_t* s = (const uint8_t*)src;
+    uint8_t*       d = (uint8_t*)dst;
+
+#if VRT_X86_DISPATCH
+    /* Not worth dispatching for a few words, such as a single header */
+    if (words >= 8 && vrt_cpu_has_avx2()) {
+        byte_swap_avx2(s, d, words);
+        return;
+    }
+    if (words >= 4 && vrt_cpu_has_ssse3()) {
+        byte_swap_ssse3(s, d, words);
+        return;
+    }
+#endif
+
+    byte_swap_scalar(s, d, words);
+}
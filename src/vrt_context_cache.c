@@ -0,0 +1,144 @@
+#include "vrt/vrt_context_cache.h"
+
+#include "vrt/vrt_bits.h"
+#include "vrt/vrt_error_code.h"
+#include "vrt/vrt_read.h"
+#include "vrt/vrt_types.h"
+
+#include "vrt_util_internal.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+int32_t vrt_init_context_cache(struct vrt_context_cache*       cache,
+                               struct vrt_context_cache_entry* entries,
+                               int32_t                         capacity,
+                               uint32_t*                       words,
+                               int32_t                         words_per_entry) {
+    if (capacity <= 0 || (capacity & (capacity - 1)) != 0) {
+        return VRT_ERR_INVALID_CAPACITY;
+    }
+
+    for (int32_t i = 0; i < capacity; ++i) {
+        entries[i].used = false;
+    }
+
+    cache->entries         = entries;
+    cache->words           = words;
+    cache->words_per_entry = words_per_entry;
+    cache->mask            = (uint32_t)capacity - 1;
+    cache->size            = 0;
+    cache->hits            = 0;
+    cache->misses          = 0;
+
+    return 0;
+}
+
+/**
+ * Find entry of stream, or add it if it doesn't exist.
+ *
+ * \param cache     Cache.
+ * \param stream_id Stream ID.
+ *
+ * \return Entry, or NULL if there are no free entries.
+ */
+static inline struct vrt_context_cache_entry* find_or_add(struct vrt_context_cache* cache, uint32_t stream_id) {
+    /* There is always at least one unused entry, so this terminates */
+    uint32_t i = vrt_hash_stream_id(stream_id) & cache->mask;
+    while (cache->entries[i].used && cache->entries[i].stream_id != stream_id) {
+        i = (i + 1) & cache->mask;
+    }
+
+    struct vrt_context_cache_entry* e = &cache->entries[i];
+    if (!e->used) {
+        /* Keep load factor at most 3/4 */
+        int64_t capacity = (int64_t)cache->mask + 1;
+        if (4 * ((int64_t)cache->size + 1) > 3 * capacity) {
+            return NULL;
+        }
+        e->used      = true;
+        e->stream_id = stream_id;
+        e->words     = -1;
+        cache->size += 1;
+    }
+
+    return e;
+}
+
+/**
+ * Read IF context section through cache, with optional byte swapping of words.
+ *
+ * \param cache      Cache.
+ * \param stream_id  Stream ID.
+ * \param buf        IF context section.
+ * \param words_buf  Size of IF context section in 32-bit words.
+ * \param if_context Set to the decoded context.
+ * \param validate   Level of validation.
+ * \param swap       True if words shall be byte swapped.
+ *
+ * \return Number of read words, or a negative number if error.
+ */
+static VRT_INTERNAL_FORCE_INLINE int32_t read_if_context_cached(struct vrt_context_cache*     cache,
+                                                                uint32_t                      stream_id,
+                                                                const void*                   buf,
+                                                                int32_t                       words_buf,
+                                                                const struct vrt_if_context** if_context,
+                                                                enum vrt_validation           validate,
+                                                                bool                          swap) {
+    if (words_buf > cache->words_per_entry) {
+        return VRT_ERR_BUFFER_SIZE;
+    }
+    struct vrt_context_cache_entry* e = find_or_add(cache, stream_id);
+    if (e == NULL) {
+        return VRT_ERR_STREAMS_FULL;
+    }
+    uint32_t* cached = cache->words + (size_t)(e - cache->entries) * (size_t)cache->words_per_entry;
+
+    /* The change indicator is set when any field has changed, so then comparing is pointless */
+    const uint32_t* b       = (const uint32_t*)buf;
+    const bool      changed =
+        words_buf < 1 || vrt_mskr(vrt_internal_load(b, swap), VRT_BITS_CIF0_CONTEXT_FIELD_CHANGE_INDICATOR) != 0;
+    if (!changed && e->words == words_buf && e->swap == swap &&
+        memcmp(cached, b, (size_t)words_buf * sizeof(uint32_t)) == 0) {
+        cache->hits += 1;
+        *if_context = &e->if_context;
+        return e->words_read;
+    }
+
+    cache->misses += 1;
+    if (words_buf > 0) {
+        memcpy(cached, b, (size_t)words_buf * sizeof(uint32_t));
+    }
+    int32_t rv = swap ? vrt_read_if_context_be(cached, words_buf, &e->if_context, validate)
+                      : vrt_read_if_context(cached, words_buf, &e->if_context, validate);
+    if (rv < 0) {
+        e->words = -1;
+        return rv;
+    }
+    e->words      = words_buf;
+    e->words_read = rv;
+    e->swap       = swap;
+    *if_context   = &e->if_context;
+
+    return rv;
+}
+
+int32_t vrt_read_if_context_cached(struct vrt_context_cache*     cache,
+                                   uint32_t                      stream_id,
+                                   const void*                   buf,
+                                   int32_t                       words_buf,
+                                   const struct vrt_if_context** if_context,
+                                   enum vrt_validation           validate) {
+    return read_if_context_cached(cache, stream_id, buf, words_buf, if_context, validate, false);
+}
+
+int32_t vrt_read_if_context_cached_be(struct vrt_context_cache*     cache,
+                                      uint32_t                      stream_id,
+                                      const void*                   buf,
+                                      int32_t                       words_buf,
+                                      const struct vrt_if_context** if_context,
+                                      enum vrt_validation           validate) {
+    return read_if_context_cached(cache, stream_id, buf, words_buf, if_context, validate,
+                                  VRT_INTERNAL_NETWORK_ORDER_SWAP);
+}
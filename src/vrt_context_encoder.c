@@ -0,0 +1,378 @@
+#include "vrt/vrt_context_encoder.h"
+
+#include "vrt/vrt_bits.h"
+#include "vrt/vrt_error_code.h"
+#include "vrt/vrt_init.h"
+#include "vrt/vrt_types.h"
+#include "vrt/vrt_write.h"
+
+#include "vrt_util_internal.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * Context indicator field bits of fields with fixed size.
+ */
+static const uint32_t FIXED_FIELDS = VRT_CIF0_WORDS_FIXED;
+
+/**
+ * Context indicator field bits of fields with variable size, i.e. GPS ASCII and Context association lists.
+ */
+static const uint32_t VARIABLE_FIELDS =
+    VRT_BITS_MASK(VRT_BITS_CIF0_GPS_ASCII) | VRT_BITS_MASK(VRT_BITS_CIF0_CONTEXT_ASSOCIATION_LISTS);
+
+/**
+ * Context indicator field bit of the Over-range count field, which isn't persistent.
+ */
+static const uint32_t OVER_RANGE_COUNT = VRT_BITS_MASK(VRT_BITS_CIF0_OVER_RANGE_COUNT);
+
+/**
+ * Largest encoding of the fixed size fields in 32-bit words, including the context indicator field.
+ */
+static const int32_t WORDS_FIXED_MAX = 75;
+
+void vrt_init_context_encoder(struct vrt_context_encoder* encoder) {
+    vrt_init_if_context(&encoder->last);
+    encoder->has_last    = false;
+    encoder->words_valid = false;
+}
+
+/**
+ * Check if two state and event indicator fields are equal.
+ *
+ * \param a First field.
+ * \param b Second field.
+ *
+ * \return True if equal.
+ */
+static bool equal_state_and_event(const struct vrt_state_and_event* a, const struct vrt_state_and_event* b) {
+    return a->has.calibrated_time == b->has.calibrated_time && a->has.valid_data == b->has.valid_data &&
+           a->has.reference_lock == b->has.reference_lock && a->has.agc_or_mgc == b->has.agc_or_mgc &&
+           a->has.detected_signal == b->has.detected_signal &&
+           a->has.spectral_inversion == b->has.spectral_inversion && a->has.over_range == b->has.over_range &&
+           a->has.sample_loss == b->has.sample_loss &&
+           (!a->has.calibrated_time || a->calibrated_time == b->calibrated_time) &&
+           (!a->has.valid_data || a->valid_data == b->valid_data) &&
+           (!a->has.reference_lock || a->reference_lock == b->reference_lock) &&
+           (!a->has.agc_or_mgc || a->agc_or_mgc == b->agc_or_mgc) &&
+           (!a->has.detected_signal || a->detected_signal == b->detected_signal) &&
+           (!a->has.spectral_inversion || a->spectral_inversion == b->spectral_inversion) &&
+           (!a->has.over_range || a->over_range == b->over_range) &&
+           (!a->has.sample_loss || a->sample_loss == b->sample_loss) && a->user_defined == b->user_defined;
+}
+
+/**
+ * Check if two data packet payload format fields are equal.
+ *
+ * \param a First field.
+ * \param b Second field.
+ *
+ * \return True if equal.
+ */
+static bool equal_payload_format(const struct vrt_data_packet_payload_format* a,
+                                 const struct vrt_data_packet_payload_format* b) {
+    return a->packing_method == b->packing_method && a->real_or_complex == b->real_or_complex &&
+           a->data_item_format == b->data_item_format && a->sample_component_repeat == b->sample_component_repeat &&
+           a->event_tag_size == b->event_tag_size && a->channel_tag_size == b->channel_tag_size &&
+           a->item_packing_field_size == b->item_packing_field_size && a->data_item_size == b->data_item_size &&
+           a->repeat_count == b->repeat_count && a->vector_size == b->vector_size;
+}
+
+/**
+ * Check if two formatted geolocation fields are equal.
+ *
+ * \param a First field.
+ * \param b Second field.
+ *
+ * \return True if equal.
+ */
+static bool equal_geolocation(const struct vrt_formatted_geolocation* a, const struct vrt_formatted_geolocation* b) {
+    return a->tsi == b->tsi && a->tsf == b->tsf && a->oui == b->oui &&
+           a->integer_second_timestamp == b->integer_second_timestamp &&
+           a->fractional_second_timestamp == b->fractional_second_timestamp && a->has.latitude == b->has.latitude &&
+           a->has.longitude == b->has.longitude && a->has.altitude == b->has.altitude &&
+           a->has.speed_over_ground == b->has.speed_over_ground && a->has.heading_angle == b->has.heading_angle &&
+           a->has.track_angle == b->has.track_angle && a->has.magnetic_variation == b->has.magnetic_variation &&
+           (!a->has.latitude || a->latitude == b->latitude) && (!a->has.longitude || a->longitude == b->longitude) &&
+           (!a->has.altitude || a->altitude == b->altitude) &&
+           (!a->has.speed_over_ground || a->speed_over_ground == b->speed_over_ground) &&
+           (!a->has.heading_angle || a->heading_angle == b->heading_angle) &&
+           (!a->has.track_angle || a->track_angle == b->track_angle) &&
+           (!a->has.magnetic_variation || a->magnetic_variation == b->magnetic_variation);
+}
+
+/**
+ * Check if two ephemeris fields are equal.
+ *
+ * \param a First field.
+ * \param b Second field.
+ *
+ * \return True if equal.
+ */
+static bool equal_ephemeris(const struct vrt_ephemeris* a, const struct vrt_ephemeris* b) {
+    return a->tsi == b->tsi && a->tsf == b->tsf && a->oui == b->oui &&
+           a->integer_second_timestamp == b->integer_second_timestamp &&
+           a->fractional_second_timestamp == b->fractional_second_timestamp &&
+           a->has.position_x == b->has.position_x && a->has.position_y == b->has.position_y &&
+           a->has.position_z == b->has.position_z && a->has.attitude_alpha == b->has.attitude_alpha &&
+           a->has.attitude_beta == b->has.attitude_beta && a->has.attitude_phi == b->has.attitude_phi &&
+           a->has.velocity_dx == b->has.velocity_dx && a->has.velocity_dy == b->has.velocity_dy &&
+           a->has.velocity_dz == b->has.velocity_dz && (!a->has.position_x || a->position_x == b->position_x) &&
+           (!a->has.position_y || a->position_y == b->position_y) &&
+           (!a->has.position_z || a->position_z == b->position_z) &&
+           (!a->has.attitude_alpha || a->attitude_alpha == b->attitude_alpha) &&
+           (!a->has.attitude_beta || a->attitude_beta == b->attitude_beta) &&
+           (!a->has.attitude_phi || a->attitude_phi == b->attitude_phi) &&
+           (!a->has.velocity_dx || a->velocity_dx == b->velocity_dx) &&
+           (!a->has.velocity_dy || a->velocity_dy == b->velocity_dy) &&
+           (!a->has.velocity_dz || a->velocity_dz == b->velocity_dz);
+}
+
+/**
+ * Compare values of the fixed size fields of two contexts, regardless of presence.
+ *
+ * \param a First context.
+ * \param b Second context.
+ *
+ * \return Context indicator field bits of fields that differ.
+ */
+static uint32_t changed_fields(const struct vrt_if_context* a, const struct vrt_if_context* b) {
+    struct vrt_context_indicators d;
+    d.reference_point_identifier    = a->reference_point_identifier != b->reference_point_identifier;
+    d.bandwidth                     = a->bandwidth != b->bandwidth;
+    d.if_reference_frequency        = a->if_reference_frequency != b->if_reference_frequency;
+    d.rf_reference_frequency        = a->rf_reference_frequency != b->rf_reference_frequency;
+    d.rf_reference_frequency_offset = a->rf_reference_frequency_offset != b->rf_reference_frequency_offset;
+    d.if_band_offset                = a->if_band_offset != b->if_band_offset;
+    d.reference_level               = a->reference_level != b->reference_level;
+    d.gain                          = a->gain.stage1 != b->gain.stage1 || a->gain.stage2 != b->gain.stage2;
+    d.over_range_count              = a->over_range_count != b->over_range_count;
+    d.sample_rate                   = a->sample_rate != b->sample_rate;
+    d.timestamp_adjustment          = a->timestamp_adjustment != b->timestamp_adjustment;
+    d.timestamp_calibration_time    = a->timestamp_calibration_time != b->timestamp_calibration_time;
+    d.temperature                   = a->temperature != b->temperature;
+    d.device_identifier             = a->device_identifier.oui != b->device_identifier.oui ||
+                                      a->device_identifier.device_code != b->device_identifier.device_code;
+
+    d.state_and_event_indicators =
+        !equal_state_and_event(&a->state_and_event_indicators, &b->state_and_event_indicators);
+    d.data_packet_payload_format =
+        !equal_payload_format(&a->data_packet_payload_format, &b->data_packet_payload_format);
+
+    d.formatted_gps_geolocation      = !equal_geolocation(&a->formatted_gps_geolocation, &b->formatted_gps_geolocation);
+    d.formatted_ins_geolocation      = !equal_geolocation(&a->formatted_ins_geolocation, &b->formatted_ins_geolocation);
+    d.ecef_ephemeris                 = !equal_ephemeris(&a->ecef_ephemeris, &b->ecef_ephemeris);
+    d.relative_ephemeris             = !equal_ephemeris(&a->relative_ephemeris, &b->relative_ephemeris);
+    d.ephemeris_reference_identifier = a->ephemeris_reference_identifier != b->ephemeris_reference_identifier;
+    d.gps_ascii                      = false;
+    d.context_association_lists      = false;
+
+    return vrt_if_context_indicator_word(&d);
+}
+
+/**
+ * Clear presence indicators of fields not in a context indicator field.
+ *
+ * \param has       Presence indicators.
+ * \param indicator Context indicator field bits of fields to keep.
+ */
+static void keep_indicators(struct vrt_context_indicators* has, uint32_t indicator) {
+    vrt_if_context_indicators_from_word(vrt_if_context_indicator_word(has) & indicator, has);
+}
+
+/**
+ * Copy encoded fixed size fields from one IF context section into another, which already contains them.
+ *
+ * \param dst           Section to copy into, in host byte order.
+ * \param dst_indicator Context indicator field of dst.
+ * \param src           Section to copy from.
+ * \param src_indicator Context indicator field bits of fields to copy, which are all present in src.
+ * \param swap          True if words in src shall be byte swapped.
+ */
+static void splice(uint32_t* dst, uint32_t dst_indicator, const uint32_t* src, uint32_t src_indicator, bool swap) {
+    for (uint32_t bit = VRT_BITS_POS(VRT_BITS_CIF0_EPHEMERIS_REFERENCE_IDENTIFIER);
+         bit <= VRT_BITS_POS(VRT_BITS_CIF0_REFERENCE_POINT_IDENTIFIER); ++bit) {
+        if ((src_indicator & (1U << bit)) == 0) {
+            continue;
+        }
+        int32_t offset_src = vrt_if_context_offset(src_indicator, bit);
+        int32_t offset_dst = vrt_if_context_offset(dst_indicator, bit);
+        int32_t words      = vrt_if_context_offset(src_indicator, bit - 1) - offset_src;
+        for (int32_t i = 0; i < words; ++i) {
+            dst[offset_dst + i] = vrt_internal_load(src + offset_src + i, swap);
+        }
+    }
+}
+
+/**
+ * Write IF context section.
+ *
+ * \param if_context IF context.
+ * \param buf        Buffer to write to.
+ * \param words_buf  Size of buf in 32-bit words.
+ * \param validate   Level of validation.
+ * \param swap       True if words shall be byte swapped.
+ *
+ * \return Number of written words, or a negative number if error.
+ */
+static inline int32_t write_if_context(const struct vrt_if_context* if_context,
+                                       void*                        buf,
+                                       int32_t                      words_buf,
+                                       enum vrt_validation          validate,
+                                       bool                         swap) {
+    return swap ? vrt_write_if_context_be(if_context, buf, words_buf, validate)
+                : vrt_write_if_context(if_context, buf, words_buf, validate);
+}
+
+/**
+ * Write IF context section through encoder, with optional byte swapping of words.
+ *
+ * \param encoder    Encoder.
+ * \param if_context IF context.
+ * \param full       True if a full section shall be written.
+ * \param buf        Buffer to write to.
+ * \param words_buf  Size of buf in 32-bit words.
+ * \param validate   Level of validation.
+ * \param swap       True if words shall be byte swapped.
+ *
+ * \return Number of written words, or a negative number if error.
+ */
+static VRT_INTERNAL_FORCE_INLINE int32_t write_if_context_delta(struct vrt_context_encoder*  encoder,
+                                                                const struct vrt_if_context* if_context,
+                                                                bool                         full,
+                                                                void*                        buf,
+                                                                int32_t                      words_buf,
+                                                                enum vrt_validation          validate,
+                                                                bool                         swap) {
+    uint32_t*      b         = (uint32_t*)buf;
+    const uint32_t indicator = vrt_if_context_indicator_word(&if_context->has);
+    const uint32_t fixed     = indicator & FIXED_FIELDS;
+    const uint32_t variable  = indicator & VARIABLE_FIELDS;
+
+    uint32_t last_indicator = 0;
+    uint32_t changed        = fixed;
+    if (encoder->has_last) {
+        last_indicator = vrt_if_context_indicator_word(&encoder->last.has);
+        /* Fields present in both that differ, and added fields */
+        changed = fixed & ~last_indicator;
+        if ((fixed & last_indicator) != 0) {
+            changed |= changed_fields(&encoder->last, if_context) & fixed & last_indicator;
+        }
+    }
+    const uint32_t removed = last_indicator & ~indicator;
+    const bool     change  = !encoder->has_last || (changed & ~OVER_RANGE_COUNT) != 0 || removed != 0 ||
+                             (indicator & ~last_indicator & VARIABLE_FIELDS) != 0;
+    const bool     cached  = encoder->words_valid && (last_indicator & FIXED_FIELDS) == fixed;
+
+    if (!full && encoder->has_last && removed == 0) {
+        /* Contents of variable size fields aren't compared, so they are written whenever present */
+        if (changed == 0 && variable == 0) {
+            return 0;
+        }
+
+        /* Change-only section, which also updates the cache in place if it holds the same fields */
+        struct vrt_if_context delta = *if_context;
+        keep_indicators(&delta.has, changed | VARIABLE_FIELDS);
+        delta.context_field_change_indicator = change;
+        int32_t rv                           = write_if_context(&delta, b, words_buf, validate, swap);
+        if (rv < 0) {
+            return rv;
+        }
+        if (cached) {
+            splice(encoder->words, fixed, b, changed, swap);
+        } else {
+            encoder->words_valid = false;
+        }
+        encoder->last = *if_context;
+
+        return rv;
+    }
+
+    /* Full section. Only fields that changed are encoded, unless the set of fields changed. */
+    const int32_t   words_fixed = vrt_if_context_offset(fixed, VRT_CIF0_BIT_GPS_ASCII);
+    const uint32_t* words       = encoder->words;
+    uint32_t        words_new[WORDS_FIXED_MAX];
+    if (!cached) {
+        struct vrt_if_context c = *if_context;
+        keep_indicators(&c.has, FIXED_FIELDS);
+        c.context_field_change_indicator = false;
+        int32_t rv                       = vrt_write_if_context(&c, words_new, WORDS_FIXED_MAX, validate);
+        if (rv < 0) {
+            return rv;
+        }
+        words = words_new;
+    } else if (changed != 0) {
+        uint32_t              words_delta[WORDS_FIXED_MAX];
+        struct vrt_if_context delta = *if_context;
+        keep_indicators(&delta.has, changed);
+        delta.context_field_change_indicator = false;
+        int32_t rv = vrt_write_if_context(&delta, words_delta, WORDS_FIXED_MAX, validate);
+        if (rv < 0) {
+            return rv;
+        }
+        memcpy(words_new, encoder->words, (size_t)words_fixed * sizeof(uint32_t));
+        splice(words_new, fixed, words_delta, changed, false);
+        words = words_new;
+    }
+
+    if (words_buf < words_fixed) {
+        return VRT_ERR_BUFFER_SIZE;
+    }
+    int32_t words_total = words_fixed;
+
+    /* Variable size fields are written after the fixed ones, starting with a context indicator field that is then
+     * overwritten */
+    if (variable != 0) {
+        struct vrt_if_context c;
+        memset(&c.has, 0, sizeof(c.has));
+        c.context_field_change_indicator = false;
+        c.has.gps_ascii                  = if_context->has.gps_ascii;
+        c.has.context_association_lists  = if_context->has.context_association_lists;
+        c.gps_ascii                      = if_context->gps_ascii;
+        c.context_association_lists      = if_context->context_association_lists;
+        int32_t rv = write_if_context(&c, b + words_fixed - 1, words_buf - words_fixed + 1, validate, swap);
+        if (rv < 0) {
+            return rv;
+        }
+        words_total += rv - 1;
+    }
+
+    const uint32_t cif0 =
+        words[0] | variable | vrt_mskw(vrt_internal_b2u(change), VRT_BITS_CIF0_CONTEXT_FIELD_CHANGE_INDICATOR);
+    vrt_internal_store(cif0, b, swap);
+    for (int32_t i = 1; i < words_fixed; ++i) {
+        vrt_internal_store(words[i], b + i, swap);
+    }
+
+    /* Nothing to remember when no field was added, removed, or changed */
+    if (words != encoder->words) {
+        memcpy(encoder->words, words, (size_t)words_fixed * sizeof(uint32_t));
+    }
+    if (!encoder->has_last || changed != 0 || indicator != last_indicator) {
+        encoder->last = *if_context;
+    }
+    encoder->has_last    = true;
+    encoder->words_valid = true;
+
+    return words_total;
+}
+
+int32_t vrt_write_if_context_delta(struct vrt_context_encoder*  encoder,
+                                   const struct vrt_if_context* if_context,
+                                   bool                         full,
+                                   void*                        buf,
+                                   int32_t                      words_buf,
+                                   enum vrt_validation          validate) {
+    return write_if_context_delta(encoder, if_context, full, buf, words_buf, validate, false);
+}
+
+int32_t vrt_write_if_context_delta_be(struct vrt_context_encoder*  encoder,
+                                      const struct vrt_if_context* if_context,
+                                      bool                         full,
+                                      void*                        buf,
+                                      int32_t                      words_buf,
+                                      enum vrt_validation          validate) {
+    return write_if_context_delta(encoder, if_context, full, buf, words_buf, validate, VRT_INTERNAL_NETWORK_ORDER_SWAP);
+}
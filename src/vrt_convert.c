@@ -0,0 +1,1607 @@
+#include "vrt/vrt_convert.h"
+
+#include "vrt/vrt_error_code.h"
+#include "vrt/vrt_types.h"
+#include "vrt/vrt_util.h"
+
+#include "vrt_cpu.h"
+#include "vrt_util_internal.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#if VRT_X86_DISPATCH
+#include <immintrin.h>
+#endif
+
+/**
+ * Conversion kernel.
+ */
+typedef void (*kernel)(const struct vrt_converter* converter, const uint8_t* src, float* dst, int32_t n, bool swap);
+
+/**
+ * Convert words one at a time. Also used for the tails of the SIMD kernels. Items are packed from the most significant
+ * bit of each host order word.
+ *
+ * \param src       Buffer to read from.
+ * \param dst       Buffer to write to.
+ * \param words     Number of words to convert.
+ * \param scale     Factor each item is multiplied with.
+ * \param swap      True if words must be byte swapped to host order.
+ * \param bits      Item size in bits. 8, 16, or 32.
+ * \param is_signed True if items are signed.
+ */
+static inline void convert_scalar(const uint8_t* src,
+                                  float*         dst,
+                                  int32_t        words,
+                                  float          scale,
+                                  bool           swap,
+                                  int32_t        bits,
+                                  bool           is_signed) {
+    const int32_t n = 32 / bits;
+    for (int32_t i = 0; i < words; ++i) {
+        uint32_t w;
+        /* memcpy to avoid alignment requirements. It compiles to a plain load. */
+        memcpy(&w, src + sizeof(uint32_t) * i, sizeof(uint32_t));
+        w = vrt_internal_load(&w, swap);
+        for (int32_t k = 0; k < n; ++k) {
+            /* Shift item to the top, and then back down, to sign extend */
+            const uint32_t u = w << (uint32_t)(bits * k);
+            const float    f = is_signed ? (float)((int32_t)u >> (32 - bits)) : (float)(u >> (uint32_t)(32 - bits));
+            dst[n * i + k]   = f * scale;
+        }
+    }
+}
+
+static void convert_s8_scalar(const struct vrt_converter* converter,
+                              const uint8_t*              src,
+                              float*                      dst,
+                              int32_t                     n,
+                              bool                        swap) {
+    convert_scalar(src, dst, n / 4, converter->scale, swap, 8, true);
+}
+
+static void convert_u8_scalar(const struct vrt_converter* converter,
+                              const uint8_t*              src,
+                              float*                      dst,
+                              int32_t                     n,
+                              bool                        swap) {
+    convert_scalar(src, dst, n / 4, converter->scale, swap, 8, false);
+}
+
+static void convert_s16_scalar(const struct vrt_converter* converter,
+                               const uint8_t*              src,
+                               float*                      dst,
+                               int32_t                     n,
+                               bool                        swap) {
+    convert_scalar(src, dst, n / 2, converter->scale, swap, 16, true);
+}
+
+static void convert_u16_scalar(const struct vrt_converter* converter,
+                               const uint8_t*              src,
+                               float*                      dst,
+                               int32_t                     n,
+                               bool                        swap) {
+    convert_scalar(src, dst, n / 2, converter->scale, swap, 16, false);
+}
+
+static void convert_s32_scalar(const struct vrt_converter* converter,
+                               const uint8_t*              src,
+                               float*                      dst,
+                               int32_t                     n,
+                               bool                        swap) {
+    convert_scalar(src, dst, n / 1, converter->scale, swap, 32, true);
+}
+
+static void convert_u32_scalar(const struct vrt_converter* converter,
+                               const uint8_t*              src,
+                               float*                      dst,
+                               int32_t                     n,
+                               bool                        swap) {
+    convert_scalar(src, dst, n / 1, converter->scale, swap, 32, false);
+}
+
+/**
+ * Reader of consecutive bit fields, from the most significant bit of each host order word.
+ */
+struct bit_reader {
+    /** Next word to read. */
+    const uint8_t* src;
+    /** Read but not yet consumed bits, in the n least significant bits. */
+    uint64_t acc;
+    /** Number of bits in acc. */
+    int32_t n;
+    /** True if words must be byte swapped to host order. */
+    bool swap;
+};
+
+/**
+ * Read bit field of at most 32 bits.
+ *
+ * \param r    Reader.
+ * \param bits Field size in bits [1, 32].
+ *
+ * \return Field, in the least significant bits.
+ */
+static inline uint64_t read_bits(struct bit_reader* r, int32_t bits) {
+    if (r->n < bits) {
+        uint32_t w;
+        memcpy(&w, r->src, sizeof(uint32_t));
+        r->src += sizeof(uint32_t);
+        /* Fewer than 32 bits are left, so nothing is shifted out */
+        r->acc = (r->acc << 32U) | vrt_internal_load(&w, r->swap);
+        r->n += 32;
+    }
+    r->n -= bits;
+    return (r->acc >> (uint32_t)r->n) & ((UINT64_C(1) << (uint32_t)bits) - 1);
+}
+
+/**
+ * Read bit field of at most 64 bits.
+ *
+ * \param r    Reader.
+ * \param bits Field size in bits [1, 64].
+ *
+ * \return Field, in the least significant bits.
+ */
+static inline uint64_t read_field(struct bit_reader* r, int32_t bits) {
+    if (bits <= 32) {
+        return read_bits(r, bits);
+    }
+    const uint64_t hi = read_bits(r, bits - 32);
+    return (hi << 32U) | read_bits(r, 32);
+}
+
+/**
+ * Unpack items one field at a time, for any payload format. Processing-efficient fields are read from 32-bit
+ * containers, or 64-bit containers if fields are larger than 32 bits, and the unused bits at the end of each container
+ * are skipped.
+ *
+ * \param c            Converter.
+ * \param src          Buffer to read from.
+ * \param n            Number of items to unpack.
+ * \param swap         True if words must be byte swapped to host order.
+ * \param dst          Buffer to write scaled items to, or NULL.
+ * \param items        Buffer to write items to, or NULL.
+ * \param event_tags   Buffer to write event tags to, or NULL.
+ * \param channel_tags Buffer to write channel tags to, or NULL.
+ * \param link         True if link-efficient packing is used. Known at compile time.
+ * \param wide         True if fields are larger than 32 bits. Known at compile time.
+ */
+static inline void unpack_fields_as(const struct vrt_converter* c,
+                                    const uint8_t*              src,
+                                    int32_t                     n,
+                                    bool                        swap,
+                                    float*                      dst,
+                                    int64_t*                    items,
+                                    uint8_t*                    event_tags,
+                                    uint16_t*                   channel_tags,
+                                    bool                        link,
+                                    bool                        wide) {
+    struct bit_reader r = {src, 0, 0, swap};
+
+    /* Local copies, since the compiler can't tell that the stores below don't alias the converter */
+    const int32_t  field_size    = c->field_size;
+    const bool     is_signed     = c->is_signed;
+    const float    scale         = c->scale;
+    const int32_t  per_container = link ? n : (wide ? 64 : 32) / field_size;
+    const uint32_t item_shift    = (uint32_t)(field_size - c->item_size);
+    const uint64_t sign_bit      = is_signed ? UINT64_C(1) << (uint32_t)(c->item_size - 1) : 0;
+    const uint32_t event_shift   = (uint32_t)c->channel_tag_size;
+    const uint64_t event_mask    = (UINT64_C(1) << (uint32_t)c->event_tag_size) - 1;
+    const uint64_t channel_mask  = (UINT64_C(1) << (uint32_t)c->channel_tag_size) - 1;
+
+    for (int32_t i = 0; i < n;) {
+        /* Skip unused bits, which are the rest of the previous container */
+        r.n               = 0;
+        const int32_t end = n - i < per_container ? n : i + per_container;
+        for (; i < end; ++i) {
+            const uint64_t f = wide ? read_field(&r, field_size) : read_bits(&r, field_size);
+            const uint64_t u = f >> item_shift;
+            /* Flip the sign bit, and subtract it back to sign extend. Does nothing if unsigned. */
+            const int64_t v = (int64_t)((u ^ sign_bit) - sign_bit);
+            if (dst != NULL) {
+                dst[i] = (is_signed ? (float)v : (float)u) * scale;
+            }
+            if (items != NULL) {
+                items[i] = v;
+            }
+            if (event_tags != NULL) {
+                event_tags[i] = (uint8_t)((f >> event_shift) & event_mask);
+            }
+            if (channel_tags != NULL) {
+                channel_tags[i] = (uint16_t)(f & channel_mask);
+            }
+        }
+    }
+}
+
+/**
+ * Unpack items one field at a time, for any payload format.
+ *
+ * \param c            Converter.
+ * \param src          Buffer to read from.
+ * \param n            Number of items to unpack.
+ * \param swap         True if words must be byte swapped to host order.
+ * \param dst          Buffer to write scaled items to, or NULL.
+ * \param items        Buffer to write items to, or NULL.
+ * \param event_tags   Buffer to write event tags to, or NULL.
+ * \param channel_tags Buffer to write channel tags to, or NULL.
+ */
+static void unpack_fields(const struct vrt_converter* c,
+                          const uint8_t*              src,
+                          int32_t                     n,
+                          bool                        swap,
+                          float*                      dst,
+                          int64_t*                    items,
+                          uint8_t*                    event_tags,
+                          uint16_t*                   channel_tags) {
+    const bool wide = c->field_size > 32;
+    if (c->link_efficient) {
+        if (wide) {
+            unpack_fields_as(c, src, n, swap, dst, items, event_tags, channel_tags, true, true);
+        } else {
+            unpack_fields_as(c, src, n, swap, dst, items, event_tags, channel_tags, true, false);
+        }
+    } else {
+        if (wide) {
+            unpack_fields_as(c, src, n, swap, dst, items, event_tags, channel_tags, false, true);
+        } else {
+            unpack_fields_as(c, src, n, swap, dst, items, event_tags, channel_tags, false, false);
+        }
+    }
+}
+
+static void convert_fields(const struct vrt_converter* converter,
+                           const uint8_t*              src,
+                           float*                      dst,
+                           int32_t                     n,
+                           bool                        swap) {
+    unpack_fields(converter, src, n, swap, dst, NULL, NULL, NULL);
+}
+
+/**
+ * Convert link-efficient items without tags, with the item size known at compile time. Also used for the tails of the
+ * SIMD kernels.
+ *
+ * \param src       Buffer to read from.
+ * \param dst       Buffer to write to.
+ * \param n         Number of items to convert.
+ * \param scale     Factor each item is multiplied with.
+ * \param swap      True if words must be byte swapped to host order.
+ * \param bits      Item size in bits [1, 32].
+ * \param is_signed True if items are signed.
+ */
+static inline void convert_link_scalar(const uint8_t* src,
+                                       float*         dst,
+                                       int32_t        n,
+                                       float          scale,
+                                       bool           swap,
+                                       int32_t        bits,
+                                       bool           is_signed) {
+    struct bit_reader r = {src, 0, 0, swap};
+    for (int32_t i = 0; i < n; ++i) {
+        const uint32_t u = (uint32_t)read_bits(&r, bits) << (uint32_t)(32 - bits);
+        const float    f = is_signed ? (float)((int32_t)u >> (32 - bits)) : (float)(u >> (uint32_t)(32 - bits));
+        dst[i]           = f * scale;
+    }
+}
+
+static void convert_s12_link_scalar(const struct vrt_converter* converter,
+                                    const uint8_t*              src,
+                                    float*                      dst,
+                                    int32_t                     n,
+                                    bool                        swap) {
+    convert_link_scalar(src, dst, n, converter->scale, swap, 12, true);
+}
+
+static void convert_u12_link_scalar(const struct vrt_converter* converter,
+                                    const uint8_t*              src,
+                                    float*                      dst,
+                                    int32_t                     n,
+                                    bool                        swap) {
+    convert_link_scalar(src, dst, n, converter->scale, swap, 12, false);
+}
+
+static void convert_s14_link_scalar(const struct vrt_converter* converter,
+                                    const uint8_t*              src,
+                                    float*                      dst,
+                                    int32_t                     n,
+                                    bool                        swap) {
+    convert_link_scalar(src, dst, n, converter->scale, swap, 14, true);
+}
+
+static void convert_u14_link_scalar(const struct vrt_converter* converter,
+                                    const uint8_t*              src,
+                                    float*                      dst,
+                                    int32_t                     n,
+                                    bool                        swap) {
+    convert_link_scalar(src, dst, n, converter->scale, swap, 14, false);
+}
+
+static void convert_s24_link_scalar(const struct vrt_converter* converter,
+                                    const uint8_t*              src,
+                                    float*                      dst,
+                                    int32_t                     n,
+                                    bool                        swap) {
+    convert_link_scalar(src, dst, n, converter->scale, swap, 24, true);
+}
+
+static void convert_u24_link_scalar(const struct vrt_converter* converter,
+                                    const uint8_t*              src,
+                                    float*                      dst,
+                                    int32_t                     n,
+                                    bool                        swap) {
+    convert_link_scalar(src, dst, n, converter->scale, swap, 24, false);
+}
+
+#if VRT_X86_DISPATCH
+/*
+ * Byte shuffles that put the items of little endian words in order, as little endian items. Indexed by item size (8,
+ * 16, 32 bits) and by swap. Without swap, items are reversed within each word, since the first item is in the most
+ * significant bits. With swap, items are already in order but bytes are reversed within each item.
+ */
+static const uint8_t ORDER[3][2][16] = {
+    {{3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12}, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15}},
+    {{2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13}, {1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14}},
+    {{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15}, {3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12}}};
+
+/*
+ * Byte shuffles that gather the 4 bytes each link-efficient item starts in into a 32-bit lane, in big endian order.
+ * Indexed by item size (12, 14, 24 bits), by swap, and by group of 4 items within a period that ends on a word
+ * boundary. Each group is loaded from the word its first item starts in. Unused groups are zero.
+ */
+static const uint8_t LINK_ORDER[3][2][4][16] = {
+    {{{0, 1, 2, 3, 7, 0, 1, 2, 5, 6, 7, 0, 4, 5, 6, 7},
+      {6, 7, 0, 1, 5, 6, 7, 0, 11, 4, 5, 6, 10, 11, 4, 5},
+      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}},
+     {{3, 2, 1, 0, 4, 3, 2, 1, 6, 5, 4, 3, 7, 6, 5, 4},
+      {5, 4, 3, 2, 6, 5, 4, 3, 8, 7, 6, 5, 9, 8, 7, 6},
+      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}},
+    {{{0, 1, 2, 3, 7, 0, 1, 2, 5, 6, 7, 0, 11, 4, 5, 6},
+      {5, 6, 7, 0, 4, 5, 6, 7, 10, 11, 4, 5, 8, 9, 10, 11},
+      {6, 7, 0, 1, 5, 6, 7, 0, 11, 4, 5, 6, 9, 10, 11, 4},
+      {7, 0, 1, 2, 6, 7, 0, 1, 4, 5, 6, 7, 10, 11, 4, 5}},
+     {{3, 2, 1, 0, 4, 3, 2, 1, 6, 5, 4, 3, 8, 7, 6, 5},
+      {6, 5, 4, 3, 7, 6, 5, 4, 9, 8, 7, 6, 11, 10, 9, 8},
+      {5, 4, 3, 2, 6, 5, 4, 3, 8, 7, 6, 5, 10, 9, 8, 7},
+      {4, 3, 2, 1, 5, 4, 3, 2, 7, 6, 5, 4, 9, 8, 7, 6}}},
+    {{{0, 1, 2, 3, 5, 6, 7, 0, 10, 11, 4, 5, 15, 8, 9, 10},
+      {0, 1, 2, 3, 5, 6, 7, 0, 10, 11, 4, 5, 15, 8, 9, 10},
+      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}},
+     {{3, 2, 1, 0, 6, 5, 4, 3, 9, 8, 7, 6, 12, 11, 10, 9},
+      {3, 2, 1, 0, 6, 5, 4, 3, 9, 8, 7, 6, 12, 11, 10, 9},
+      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}}};
+
+/**
+ * Convert 8-bit items with SSSE3, 4 words at a time.
+ *
+ * \param src       Buffer to read from.
+ * \param dst       Buffer to write to.
+ * \param words     Number of words to convert.
+ * \param scale     Factor each item is multiplied with.
+ * \param swap      True if words must be byte swapped to host order.
+ * \param is_signed True if items are signed.
+ */
+VRT_TARGET("ssse3")
+static inline void convert_8_ssse3(const uint8_t* src,
+                                   float*         dst,
+                                   int32_t        words,
+                                   float          scale,
+                                   bool           swap,
+                                   bool           is_signed) {
+    const __m128i order = _mm_loadu_si128((const __m128i*)ORDER[0][swap]);
+    const __m128  s     = _mm_set1_ps(scale);
+    const __m128i zero  = _mm_setzero_si128();
+
+    int32_t i = 0;
+    for (; i + 4 <= words; i += 4) {
+        __m128i v = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src + sizeof(uint32_t) * i)), order);
+        __m128i d[4];
+        if (is_signed) {
+            /* Duplicate each byte into all bytes of its 32-bit lane, and shift it back down to sign extend */
+            __m128i lo = _mm_unpacklo_epi8(v, v);
+            __m128i hi = _mm_unpackhi_epi8(v, v);
+            d[0]       = _mm_srai_epi32(_mm_unpacklo_epi16(lo, lo), 24);
+            d[1]       = _mm_srai_epi32(_mm_unpackhi_epi16(lo, lo), 24);
+            d[2]       = _mm_srai_epi32(_mm_unpacklo_epi16(hi, hi), 24);
+            d[3]       = _mm_srai_epi32(_mm_unpackhi_epi16(hi, hi), 24);
+        } else {
+            __m128i lo = _mm_unpacklo_epi8(v, zero);
+            __m128i hi = _mm_unpackhi_epi8(v, zero);
+            d[0]       = _mm_unpacklo_epi16(lo, zero);
+            d[1]       = _mm_unpackhi_epi16(lo, zero);
+            d[2]       = _mm_unpacklo_epi16(hi, zero);
+            d[3]       = _mm_unpackhi_epi16(hi, zero);
+        }
+        for (int32_t j = 0; j < 4; ++j) {
+            _mm_storeu_ps(dst + 4 * (i + j), _mm_mul_ps(_mm_cvtepi32_ps(d[j]), s));
+        }
+    }
+    convert_scalar(src + sizeof(uint32_t) * i, dst + 4 * i, words - i, scale, swap, 8, is_signed);
+}
+
+/**
+ * Convert 16-bit items with SSSE3, 4 words at a time.
+ *
+ * \param src       Buffer to read from.
+ * \param dst       Buffer to write to.
+ * \param words     Number of words to convert.
+ * \param scale     Factor each item is multiplied with.
+ * \param swap      True if words must be byte swapped to host order.
+ * \param is_signed True if items are signed.
+ */
+VRT_TARGET("ssse3")
+static inline void convert_16_ssse3(const uint8_t* src,
+                                    float*         dst,
+                                    int32_t        words,
+                                    float          scale,
+                                    bool           swap,
+                                    bool           is_signed) {
+    const __m128i order = _mm_loadu_si128((const __m128i*)ORDER[1][swap]);
+    const __m128  s     = _mm_set1_ps(scale);
+    const __m128i zero  = _mm_setzero_si128();
+
+    int32_t i = 0;
+    for (; i + 4 <= words; i += 4) {
+        __m128i v = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src + sizeof(uint32_t) * i)), order);
+        __m128i lo;
+        __m128i hi;
+        if (is_signed) {
+            lo = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+            hi = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+        } else {
+            lo = _mm_unpacklo_epi16(v, zero);
+            hi = _mm_unpackhi_epi16(v, zero);
+        }
+        _mm_storeu_ps(dst + 2 * i, _mm_mul_ps(_mm_cvtepi32_ps(lo), s));
+        _mm_storeu_ps(dst + 2 * i + 4, _mm_mul_ps(_mm_cvtepi32_ps(hi), s));
+    }
+    convert_scalar(src + sizeof(uint32_t) * i, dst + 2 * i, words - i, scale, swap, 16, is_signed);
+}
+
+/**
+ * Convert 32-bit items with SSSE3, 4 words at a time.
+ *
+ * \param src       Buffer to read from.
+ * \param dst       Buffer to write to.
+ * \param words     Number of words to convert.
+ * \param scale     Factor each item is multiplied with.
+ * \param swap      True if words must be byte swapped to host order.
+ * \param is_signed True if items are signed.
+ */
+VRT_TARGET("ssse3")
+static inline void convert_32_ssse3(const uint8_t* src,
+                                    float*         dst,
+                                    int32_t        words,
+                                    float          scale,
+                                    bool           swap,
+                                    bool           is_signed) {
+    const __m128i order = _mm_loadu_si128((const __m128i*)ORDER[2][swap]);
+    const __m128  s     = _mm_set1_ps(scale);
+    const __m128i low   = _mm_set1_epi32(0xFFFF);
+    const __m128  k     = _mm_set1_ps(65536.0F);
+
+    int32_t i = 0;
+    for (; i + 4 <= words; i += 4) {
+        __m128i v = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src + sizeof(uint32_t) * i)), order);
+        __m128  f;
+        if (is_signed) {
+            f = _mm_cvtepi32_ps(v);
+        } else {
+            /* There is no unsigned conversion, so convert halves. Both are exact, so the sum is rounded only once. */
+            f = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(v, 16)), k),
+                           _mm_cvtepi32_ps(_mm_and_si128(v, low)));
+        }
+        _mm_storeu_ps(dst + i, _mm_mul_ps(f, s));
+    }
+    convert_scalar(src + sizeof(uint32_t) * i, dst + i, words - i, scale, swap, 32, is_signed);
+}
+
+VRT_TARGET("ssse3")
+static void convert_s8_ssse3(const struct vrt_converter* converter,
+                             const uint8_t*              src,
+                             float*                      dst,
+                             int32_t                     n,
+                             bool                        swap) {
+    convert_8_ssse3(src, dst, n / 4, converter->scale, swap, true);
+}
+
+VRT_TARGET("ssse3")
+static void convert_u8_ssse3(const struct vrt_converter* converter,
+                             const uint8_t*              src,
+                             float*                      dst,
+                             int32_t                     n,
+                             bool                        swap) {
+    convert_8_ssse3(src, dst, n / 4, converter->scale, swap, false);
+}
+
+VRT_TARGET("ssse3")
+static void convert_s16_ssse3(const struct vrt_converter* converter,
+                              const uint8_t*              src,
+                              float*                      dst,
+                              int32_t                     n,
+                              bool                        swap) {
+    convert_16_ssse3(src, dst, n / 2, converter->scale, swap, true);
+}
+
+VRT_TARGET("ssse3")
+static void convert_u16_ssse3(const struct vrt_converter* converter,
+                              const uint8_t*              src,
+                              float*                      dst,
+                              int32_t                     n,
+                              bool                        swap) {
+    convert_16_ssse3(src, dst, n / 2, converter->scale, swap, false);
+}
+
+VRT_TARGET("ssse3")
+static void convert_s32_ssse3(const struct vrt_converter* converter,
+                              const uint8_t*              src,
+                              float*                      dst,
+                              int32_t                     n,
+                              bool                        swap) {
+    convert_32_ssse3(src, dst, n / 1, converter->scale, swap, true);
+}
+
+VRT_TARGET("ssse3")
+static void convert_u32_ssse3(const struct vrt_converter* converter,
+                              const uint8_t*              src,
+                              float*                      dst,
+                              int32_t                     n,
+                              bool                        swap) {
+    convert_32_ssse3(src, dst, n / 1, converter->scale, swap, false);
+}
+
+/**
+ * Convert 8-bit items with AVX2, 4 words at a time.
+ *
+ * \param src       Buffer to read from.
+ * \param dst       Buffer to write to.
+ * \param words     Number of words to convert.
+ * \param scale     Factor each item is multiplied with.
+ * \param swap      True if words must be byte swapped to host order.
+ * \param is_signed True if items are signed.
+ */
+VRT_TARGET("avx2")
+static inline void convert_8_avx2(const uint8_t* src,
+                                  float*         dst,
+                                  int32_t        words,
+                                  float          scale,
+                                  bool           swap,
+                                  bool           is_signed) {
+    const __m128i order = _mm_loadu_si128((const __m128i*)ORDER[0][swap]);
+    const __m256  s     = _mm256_set1_ps(scale);
+
+    int32_t i = 0;
+    for (; i + 4 <= words; i += 4) {
+        __m128i v  = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src + sizeof(uint32_t) * i)), order);
+        __m128i v1 = _mm_srli_si128(v, 8);
+        __m256i d0 = is_signed ? _mm256_cvtepi8_epi32(v) : _mm256_cvtepu8_epi32(v);
+        __m256i d1 = is_signed ? _mm256_cvtepi8_epi32(v1) : _mm256_cvtepu8_epi32(v1);
+        _mm256_storeu_ps(dst + 4 * i, _mm256_mul_ps(_mm256_cvtepi32_ps(d0), s));
+        _mm256_storeu_ps(dst + 4 * i + 8, _mm256_mul_ps(_mm256_cvtepi32_ps(d1), s));
+    }
+    convert_scalar(src + sizeof(uint32_t) * i, dst + 4 * i, words - i, scale, swap, 8, is_signed);
+}
+
+/**
+ * Convert 16-bit items with AVX2, 8 words at a time.
+ *
+ * \param src       Buffer to read from.
+ * \param dst       Buffer to write to.
+ * \param words     Number of words to convert.
+ * \param scale     Factor each item is multiplied with.
+ * \param swap      True if words must be byte swapped to host order.
+ * \param is_signed True if items are signed.
+ */
+VRT_TARGET("avx2")
+static inline void convert_16_avx2(const uint8_t* src,
+                                   float*         dst,
+                                   int32_t        words,
+                                   float          scale,
+                                   bool           swap,
+                                   bool           is_signed) {
+    const __m128i order = _mm_loadu_si128((const __m128i*)ORDER[1][swap]);
+    const __m256  s     = _mm256_set1_ps(scale);
+
+    int32_t i = 0;
+    /* Two vectors per iteration to hide load latency */
+    for (; i + 8 <= words; i += 8) {
+        __m128i v0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src + sizeof(uint32_t) * i)), order);
+        __m128i v1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src + sizeof(uint32_t) * (i + 4))), order);
+        __m256i d0 = is_signed ? _mm256_cvtepi16_epi32(v0) : _mm256_cvtepu16_epi32(v0);
+        __m256i d1 = is_signed ? _mm256_cvtepi16_epi32(v1) : _mm256_cvtepu16_epi32(v1);
+        _mm256_storeu_ps(dst + 2 * i, _mm256_mul_ps(_mm256_cvtepi32_ps(d0), s));
+        _mm256_storeu_ps(dst + 2 * i + 8, _mm256_mul_ps(_mm256_cvtepi32_ps(d1), s));
+    }
+    convert_scalar(src + sizeof(uint32_t) * i, dst + 2 * i, words - i, scale, swap, 16, is_signed);
+}
+
+/**
+ * Convert 32-bit items with AVX2, 8 words at a time.
+ *
+ * \param src       Buffer to read from.
+ * \param dst       Buffer to write to.
+ * \param words     Number of words to convert.
+ * \param scale     Factor each item is multiplied with.
+ * \param swap      True if words must be byte swapped to host order.
+ * \param is_signed True if items are signed.
+ */
+VRT_TARGET("avx2")
+static inline void convert_32_avx2(const uint8_t* src,
+                                   float*         dst,
+                                   int32_t        words,
+                                   float          scale,
+                                   bool           swap,
+                                   bool           is_signed) {
+    /* The shuffle operates within each 128-bit lane, so the same pattern is repeated twice */
+    const __m256i order = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)ORDER[2][swap]));
+    const __m256  s     = _mm256_set1_ps(scale);
+    const __m256i low   = _mm256_set1_epi32(0xFFFF);
+    const __m256  k     = _mm256_set1_ps(65536.0F);
+
+    int32_t i = 0;
+    for (; i + 8 <= words; i += 8) {
+        __m256i v = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(src + sizeof(uint32_t) * i)), order);
+        __m256  f;
+        if (is_signed) {
+            f = _mm256_cvtepi32_ps(v);
+        } else {
+            /* There is no unsigned conversion, so convert halves. Both are exact, so the sum is rounded only once. */
+            f = _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(v, 16)), k),
+                              _mm256_cvtepi32_ps(_mm256_and_si256(v, low)));
+        }
+        _mm256_storeu_ps(dst + i, _mm256_mul_ps(f, s));
+    }
+    convert_scalar(src + sizeof(uint32_t) * i, dst + i, words - i, scale, swap, 32, is_signed);
+}
+
+VRT_TARGET("avx2")
+static void convert_s8_avx2(const struct vrt_converter* converter,
+                            const uint8_t*              src,
+                            float*                      dst,
+                            int32_t                     n,
+                            bool                        swap) {
+    convert_8_avx2(src, dst, n / 4, converter->scale, swap, true);
+}
+
+VRT_TARGET("avx2")
+static void convert_u8_avx2(const struct vrt_converter* converter,
+                            const uint8_t*              src,
+                            float*                      dst,
+                            int32_t                     n,
+                            bool                        swap) {
+    convert_8_avx2(src, dst, n / 4, converter->scale, swap, false);
+}
+
+VRT_TARGET("avx2")
+static void convert_s16_avx2(const struct vrt_converter* converter,
+                             const uint8_t*              src,
+                             float*                      dst,
+                             int32_t                     n,
+                             bool                        swap) {
+    convert_16_avx2(src, dst, n / 2, converter->scale, swap, true);
+}
+
+VRT_TARGET("avx2")
+static void convert_u16_avx2(const struct vrt_converter* converter,
+                             const uint8_t*              src,
+                             float*                      dst,
+                             int32_t                     n,
+                             bool                        swap) {
+    convert_16_avx2(src, dst, n / 2, converter->scale, swap, false);
+}
+
+VRT_TARGET("avx2")
+static void convert_s32_avx2(const struct vrt_converter* converter,
+                             const uint8_t*              src,
+                             float*                      dst,
+                             int32_t                     n,
+                             bool                        swap) {
+    convert_32_avx2(src, dst, n / 1, converter->scale, swap, true);
+}
+
+VRT_TARGET("avx2")
+static void convert_u32_avx2(const struct vrt_converter* converter,
+                             const uint8_t*              src,
+                             float*                      dst,
+                             int32_t                     n,
+                             bool                        swap) {
+    convert_32_avx2(src, dst, n / 1, converter->scale, swap, false);
+}
+
+/**
+ * Convert link-efficient items without tags with AVX2, a period of 8 or 16 items at a time. Each item is gathered into
+ * a 32-bit lane, shifted up to the top of the lane by its bit offset, and shifted back down to sign extend.
+ *
+ * \param src       Buffer to read from.
+ * \param dst       Buffer to write to.
+ * \param n         Number of items to convert.
+ * \param scale     Factor each item is multiplied with.
+ * \param swap      True if words must be byte swapped to host order.
+ * \param bits      Item size in bits. 12, 14, or 24.
+ * \param is_signed True if items are signed.
+ */
+VRT_TARGET("avx2")
+static inline void convert_link_avx2(const uint8_t* src,
+                                     float*         dst,
+                                     int32_t        n,
+                                     float          scale,
+                                     bool           swap,
+                                     int32_t        bits,
+                                     bool           is_signed) {
+    const int32_t size_index   = bits == 12 ? 0 : bits == 14 ? 1 : 2;
+    const int32_t groups       = bits == 14 ? 4 : 2;
+    const int32_t period_bytes = groups * bits / 2;
+    const __m256i order[2]     = {_mm256_loadu_si256((const __m256i*)LINK_ORDER[size_index][swap][0]),
+                                  _mm256_loadu_si256((const __m256i*)LINK_ORDER[size_index][swap][2])};
+    const __m256i shift = _mm256_setr_epi32(0, bits & 7, (2 * bits) & 7, (3 * bits) & 7, 0, bits & 7, (2 * bits) & 7,
+                                            (3 * bits) & 7);
+    const __m256  s     = _mm256_set1_ps(scale);
+
+    /* Stop before the loads of the last group would read past the items */
+    const int64_t bytes  = (int64_t)n * bits / 8;
+    const int64_t last   = (((groups - 1) * bits / 2) & ~3) + 16;
+    int64_t       offset = 0;
+    int32_t       i      = 0;
+    for (; offset + last <= bytes; offset += period_bytes, i += 4 * groups) {
+        for (int32_t g = 0; g < groups; g += 2) {
+            const __m128i lo = _mm_loadu_si128((const __m128i*)(src + offset + ((g * bits / 2) & ~3)));
+            const __m128i hi = _mm_loadu_si128((const __m128i*)(src + offset + (((g + 1) * bits / 2) & ~3)));
+            __m256i       v  = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+            v                = _mm256_sllv_epi32(_mm256_shuffle_epi8(v, order[g / 2]), shift);
+            v = is_signed ? _mm256_srai_epi32(v, 32 - bits) : _mm256_srli_epi32(v, 32 - bits);
+            _mm256_storeu_ps(dst + i + 4 * g, _mm256_mul_ps(_mm256_cvtepi32_ps(v), s));
+        }
+    }
+    convert_link_scalar(src + offset, dst + i, n - i, scale, swap, bits, is_signed);
+}
+
+VRT_TARGET("avx2")
+static void convert_s12_link_avx2(const struct vrt_converter* converter,
+                                  const uint8_t*              src,
+                                  float*                      dst,
+                                  int32_t                     n,
+                                  bool                        swap) {
+    convert_link_avx2(src, dst, n, converter->scale, swap, 12, true);
+}
+
+VRT_TARGET("avx2")
+static void convert_u12_link_avx2(const struct vrt_converter* converter,
+                                  const uint8_t*              src,
+                                  float*                      dst,
+                                  int32_t                     n,
+                                  bool                        swap) {
+    convert_link_avx2(src, dst, n, converter->scale, swap, 12, false);
+}
+
+VRT_TARGET("avx2")
+static void convert_s14_link_avx2(const struct vrt_converter* converter,
+                                  const uint8_t*              src,
+                                  float*                      dst,
+                                  int32_t                     n,
+                                  bool                        swap) {
+    convert_link_avx2(src, dst, n, converter->scale, swap, 14, true);
+}
+
+VRT_TARGET("avx2")
+static void convert_u14_link_avx2(const struct vrt_converter* converter,
+                                  const uint8_t*              src,
+                                  float*                      dst,
+                                  int32_t                     n,
+                                  bool                        swap) {
+    convert_link_avx2(src, dst, n, converter->scale, swap, 14, false);
+}
+
+VRT_TARGET("avx2")
+static void convert_s24_link_avx2(const struct vrt_converter* converter,
+                                  const uint8_t*              src,
+                                  float*                      dst,
+                                  int32_t                     n,
+                                  bool                        swap) {
+    convert_link_avx2(src, dst, n, converter->scale, swap, 24, true);
+}
+
+VRT_TARGET("avx2")
+static void convert_u24_link_avx2(const struct vrt_converter* converter,
+                                  const uint8_t*              src,
+                                  float*                      dst,
+                                  int32_t                     n,
+                                  bool                        swap) {
+    convert_link_avx2(src, dst, n, converter->scale, swap, 24, false);
+}
+#endif
+
+/**
+ * Packing kernel.
+ */
+typedef void (*pack_kernel)(const struct vrt_converter* converter,
+                            const float*                src,
+                            uint8_t*                    dst,
+                            int32_t                     n,
+                            bool                        swap);
+
+/**
+ * Round to nearest integer, with ties to even, without depending on the math library. Gives the same result as the SIMD
+ * conversions in the default rounding mode.
+ *
+ * \param x Number.
+ *
+ * \return Rounded number.
+ */
+static inline float round_even(float x) {
+    /* Adding and subtracting 2^23 rounds away the fraction. Larger numbers are already integers. */
+    const float k = 8388608.0F;
+    if (x >= 0.0F) {
+        return x >= k ? x : (x + k) - k;
+    }
+    return x <= -k ? x : (x - k) + k;
+}
+
+/**
+ * Round float to nearest integer, with ties to even, and saturate it to item range.
+ *
+ * \param x         Number.
+ * \param bits      Item size in bits [1, 64].
+ * \param is_signed True if items are signed.
+ *
+ * \return Item, as two's complement in the least significant bits.
+ */
+static inline uint64_t saturate_float(float x, int32_t bits, bool is_signed) {
+    const uint64_t half = UINT64_C(1) << (uint32_t)(bits - 1);
+    const uint64_t mask = half - 1 + half;
+    if (bits <= 22) {
+        /*
+         * Without branches, since samples are often close to the limits. Limits are exact as float, and clamping before
+         * rounding gives the same result since they are integers. NaN is clamped to the minimum. Adding and subtracting
+         * 1.5 * 2^23 then rounds away the fraction of numbers below 2^22 in magnitude.
+         */
+        const float lo = is_signed ? -(float)half : 0.0F;
+        const float hi = is_signed ? (float)half - 1.0F : (float)mask;
+        const float c  = x > lo ? (x < hi ? x : hi) : lo;
+        const float r  = (c + 12582912.0F) - 12582912.0F;
+        return (uint64_t)(int64_t)(int32_t)r & mask;
+    }
+
+    /* All limits are powers of two, which doubles represent exactly */
+    const double top = is_signed ? (double)half : 2.0 * (double)half;
+    const double d   = round_even(x);
+    if (!(d >= (is_signed ? -top : 0.0))) {
+        /* Also NaN */
+        return is_signed ? half : 0;
+    }
+    if (d >= top) {
+        return is_signed ? half - 1 : mask;
+    }
+    return (is_signed ? (uint64_t)(int64_t)d : (uint64_t)d) & mask;
+}
+
+/**
+ * Saturate integer to item range.
+ *
+ * \param v         Integer. Taken as unsigned if items are unsigned and 64 bits.
+ * \param bits      Item size in bits [1, 64].
+ * \param is_signed True if items are signed.
+ *
+ * \return Item, as two's complement in the least significant bits.
+ */
+static inline uint64_t saturate_int(int64_t v, int32_t bits, bool is_signed) {
+    if (bits == 64) {
+        return (uint64_t)v;
+    }
+    const int64_t  half = INT64_C(1) << (uint32_t)(bits - 1);
+    const uint64_t mask = (UINT64_C(1) << (uint32_t)bits) - 1;
+    const int64_t  lo   = is_signed ? -half : 0;
+    const int64_t  hi   = is_signed ? half - 1 : (int64_t)mask;
+    return (uint64_t)(v < lo ? lo : v > hi ? hi : v) & mask;
+}
+
+/**
+ * Writer of consecutive bit fields, from the most significant bit of each host order word.
+ */
+struct bit_writer {
+    /** Next word to write. */
+    uint8_t* dst;
+    /** Written but not yet stored bits, in the n least significant bits. */
+    uint64_t acc;
+    /** Number of bits in acc. */
+    int32_t n;
+    /** True if words must be byte swapped from host order. */
+    bool swap;
+};
+
+/**
+ * Write bit field of at most 32 bits.
+ *
+ * \param w    Writer.
+ * \param v    Field, with no bits set above the field size.
+ * \param bits Field size in bits [1, 32].
+ */
+static inline void write_bits(struct bit_writer* w, uint64_t v, int32_t bits) {
+    /* Fewer than 32 bits are held, so nothing is shifted out */
+    w->acc = (w->acc << (uint32_t)bits) | v;
+    w->n += bits;
+    if (w->n >= 32) {
+        w->n -= 32;
+        uint32_t u;
+        vrt_internal_store((uint32_t)(w->acc >> (uint32_t)w->n), &u, w->swap);
+        memcpy(w->dst, &u, sizeof(uint32_t));
+        w->dst += sizeof(uint32_t);
+    }
+}
+
+/**
+ * Pad with zeros to the next word boundary.
+ *
+ * \param w Writer.
+ */
+static inline void pad_to_word(struct bit_writer* w) {
+    if (w->n > 0) {
+        write_bits(w, 0, 32 - w->n);
+    }
+}
+
+/**
+ * Pack items one field at a time, for any payload format. Processing-efficient fields are written to 32-bit
+ * containers, or 64-bit containers if fields are larger than 32 bits, and the unused bits at the end of each container
+ * are zeroed.
+ *
+ * \param c            Converter.
+ * \param src          Floats to pack, or NULL to pack items.
+ * \param items        Items to pack, if src is NULL.
+ * \param event_tags   Event tags to pack, or NULL.
+ * \param channel_tags Channel tags to pack, or NULL.
+ * \param n            Number of items.
+ * \param swap         True if words must be byte swapped from host order.
+ * \param dst          Buffer to write to.
+ * \param link         True if link-efficient packing is used. Known at compile time.
+ * \param wide         True if fields are larger than 32 bits. Known at compile time.
+ */
+static inline void pack_fields_as(const struct vrt_converter* c,
+                                  const float*                src,
+                                  const int64_t*              items,
+                                  const uint8_t*              event_tags,
+                                  const uint16_t*             channel_tags,
+                                  int32_t                     n,
+                                  bool                        swap,
+                                  uint8_t*                    dst,
+                                  bool                        link,
+                                  bool                        wide) {
+    struct bit_writer w = {dst, 0, 0, swap};
+
+    /* Local copies, since the compiler can't tell that the stores below don't alias the converter */
+    const int32_t  field_size    = c->field_size;
+    const int32_t  item_size     = c->item_size;
+    const bool     is_signed     = c->is_signed;
+    const float    inverse_scale = c->inverse_scale;
+    const int32_t  per_container = link ? n : (wide ? 64 : 32) / field_size;
+    const uint32_t item_shift    = (uint32_t)(field_size - item_size);
+    const uint32_t event_shift   = (uint32_t)c->channel_tag_size;
+    const uint64_t event_mask    = (UINT64_C(1) << (uint32_t)c->event_tag_size) - 1;
+    const uint64_t channel_mask  = (UINT64_C(1) << (uint32_t)c->channel_tag_size) - 1;
+
+    for (int32_t i = 0; i < n;) {
+        const int32_t end = n - i < per_container ? n : i + per_container;
+        for (; i < end; ++i) {
+            const uint64_t item = src != NULL ? saturate_float(src[i] * inverse_scale, item_size, is_signed)
+                                              : saturate_int(items[i], item_size, is_signed);
+            uint64_t       f    = item << item_shift;
+            if (event_tags != NULL) {
+                f |= (event_tags[i] & event_mask) << event_shift;
+            }
+            if (channel_tags != NULL) {
+                f |= channel_tags[i] & channel_mask;
+            }
+            if (wide) {
+                write_bits(&w, f >> 32U, field_size - 32);
+                write_bits(&w, f & UINT32_MAX, 32);
+            } else {
+                write_bits(&w, f, field_size);
+            }
+        }
+        /* Zero unused bits, which are the rest of the container */
+        pad_to_word(&w);
+    }
+}
+
+/**
+ * Pack items one field at a time, for any payload format.
+ *
+ * \param c            Converter.
+ * \param src          Floats to pack, or NULL to pack items.
+ * \param items        Items to pack, if src is NULL.
+ * \param event_tags   Event tags to pack, or NULL.
+ * \param channel_tags Channel tags to pack, or NULL.
+ * \param n            Number of items.
+ * \param swap         True if words must be byte swapped from host order.
+ * \param dst          Buffer to write to.
+ */
+static void pack_fields(const struct vrt_converter* c,
+                        const float*                src,
+                        const int64_t*              items,
+                        const uint8_t*              event_tags,
+                        const uint16_t*             channel_tags,
+                        int32_t                     n,
+                        bool                        swap,
+                        uint8_t*                    dst) {
+    const bool wide = c->field_size > 32;
+    if (c->link_efficient) {
+        if (wide) {
+            pack_fields_as(c, src, items, event_tags, channel_tags, n, swap, dst, true, true);
+        } else {
+            pack_fields_as(c, src, items, event_tags, channel_tags, n, swap, dst, true, false);
+        }
+    } else {
+        if (wide) {
+            pack_fields_as(c, src, items, event_tags, channel_tags, n, swap, dst, false, true);
+        } else {
+            pack_fields_as(c, src, items, event_tags, channel_tags, n, swap, dst, false, false);
+        }
+    }
+}
+
+static void pack_floats(const struct vrt_converter* converter,
+                        const float*                src,
+                        uint8_t*                    dst,
+                        int32_t                     n,
+                        bool                        swap) {
+    pack_fields(converter, src, NULL, NULL, NULL, n, swap, dst);
+}
+
+/**
+ * Pack floats into words one at a time, for items of 8, 16, or 32 bits without tags. Also used for the tails of the
+ * SIMD kernels.
+ *
+ * \param src           Floats to pack.
+ * \param dst           Buffer to write to.
+ * \param n             Number of floats.
+ * \param inverse_scale Factor each float is multiplied with.
+ * \param swap          True if words must be byte swapped from host order.
+ * \param bits          Item size in bits. 8, 16, or 32.
+ * \param is_signed     True if items are signed.
+ */
+static inline void pack_scalar(const float* src,
+                               uint8_t*     dst,
+                               int32_t      n,
+                               float        inverse_scale,
+                               bool         swap,
+                               int32_t      bits,
+                               bool         is_signed) {
+    const int32_t per_word = 32 / bits;
+    for (int32_t i = 0; i < n; i += per_word) {
+        uint32_t w = 0;
+        for (int32_t k = 0; k < per_word; ++k) {
+            /* Pad the last word with zeros */
+            const uint32_t item =
+                i + k < n ? (uint32_t)saturate_float(src[i + k] * inverse_scale, bits, is_signed) : 0;
+            w = bits == 32 ? item : (w << (uint32_t)bits) | item;
+        }
+        uint32_t u;
+        vrt_internal_store(w, &u, swap);
+        memcpy(dst + sizeof(uint32_t) * (i / per_word), &u, sizeof(uint32_t));
+    }
+}
+
+static void pack_s8_scalar(const struct vrt_converter* converter,
+                           const float*                src,
+                           uint8_t*                    dst,
+                           int32_t                     n,
+                           bool                        swap) {
+    pack_scalar(src, dst, n, converter->inverse_scale, swap, 8, true);
+}
+
+static void pack_u8_scalar(const struct vrt_converter* converter,
+                           const float*                src,
+                           uint8_t*                    dst,
+                           int32_t                     n,
+                           bool                        swap) {
+    pack_scalar(src, dst, n, converter->inverse_scale, swap, 8, false);
+}
+
+static void pack_s16_scalar(const struct vrt_converter* converter,
+                            const float*                src,
+                            uint8_t*                    dst,
+                            int32_t                     n,
+                            bool                        swap) {
+    pack_scalar(src, dst, n, converter->inverse_scale, swap, 16, true);
+}
+
+static void pack_u16_scalar(const struct vrt_converter* converter,
+                            const float*                src,
+                            uint8_t*                    dst,
+                            int32_t                     n,
+                            bool                        swap) {
+    pack_scalar(src, dst, n, converter->inverse_scale, swap, 16, false);
+}
+
+static void pack_s32_scalar(const struct vrt_converter* converter,
+                            const float*                src,
+                            uint8_t*                    dst,
+                            int32_t                     n,
+                            bool                        swap) {
+    pack_scalar(src, dst, n, converter->inverse_scale, swap, 32, true);
+}
+
+static void pack_u32_scalar(const struct vrt_converter* converter,
+                            const float*                src,
+                            uint8_t*                    dst,
+                            int32_t                     n,
+                            bool                        swap) {
+    pack_scalar(src, dst, n, converter->inverse_scale, swap, 32, false);
+}
+
+#if VRT_X86_DISPATCH
+/*
+ * Byte shuffles that move the low bytes of 32-bit lanes into place in 4 words, for 8, 16, and 32-bit items. Indexed by
+ * item size, by swap, and by vector of 4 items. The shuffled vectors are or:ed together, so bytes of other vectors are
+ * zeroed (0x80). Unused vectors are all zero.
+ */
+static const uint8_t PACK_ORDER[3][2][4][16] = {
+    {{{12, 8, 4, 0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+      {0x80, 0x80, 0x80, 0x80, 12, 8, 4, 0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+      {0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 12, 8, 4, 0, 0x80, 0x80, 0x80, 0x80},
+      {0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 12, 8, 4, 0}},
+     {{0, 4, 8, 12, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+      {0x80, 0x80, 0x80, 0x80, 0, 4, 8, 12, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+      {0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0, 4, 8, 12, 0x80, 0x80, 0x80, 0x80},
+      {0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0, 4, 8, 12}}},
+    {{{4, 5, 0, 1, 12, 13, 8, 9, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+      {0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 4, 5, 0, 1, 12, 13, 8, 9},
+      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}},
+     {{1, 0, 5, 4, 9, 8, 13, 12, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+      {0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 1, 0, 5, 4, 9, 8, 13, 12},
+      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}},
+    {{{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}},
+     {{3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12},
+      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+      {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}}};
+
+/**
+ * Pack floats with SSSE3, 4 words at a time, for items of 8, 16, or 32 bits without tags. Floats are clamped to the
+ * item range before conversion, except for the upper bound of 32-bit items, which isn't exact as float. There,
+ * conversions that overflow to 0x80000000 are flipped to 0x7FFFFFFF instead.
+ *
+ * \param src           Floats to pack.
+ * \param dst           Buffer to write to.
+ * \param n             Number of floats.
+ * \param inverse_scale Factor each float is multiplied with.
+ * \param swap          True if words must be byte swapped from host order.
+ * \param bits          Item size in bits. 8, 16, or 32.
+ * \param is_signed     True if items are signed.
+ */
+VRT_TARGET("ssse3")
+static inline void pack_ssse3(const float* src,
+                              uint8_t*     dst,
+                              int32_t      n,
+                              float        inverse_scale,
+                              bool         swap,
+                              int32_t      bits,
+                              bool         is_signed) {
+    const int32_t size_index = bits == 8 ? 0 : bits == 16 ? 1 : 2;
+    const int32_t vectors    = 32 / bits;
+    const __m128  s          = _mm_set1_ps(inverse_scale);
+    const float   half       = (float)(UINT32_C(1) << (uint32_t)(bits - 1));
+    const __m128  lo         = _mm_set1_ps(is_signed ? -half : 0.0F);
+    const __m128  hi         = _mm_set1_ps(bits == 32 ? (is_signed ? half : 2.0F * half)
+                                                      : (is_signed ? half - 1.0F : 2.0F * half - 1.0F));
+    /* Unsigned 32-bit items at or above 2^31 are converted with 2^31 subtracted, and the top bit set afterwards */
+    const __m128  top        = _mm_set1_ps(2147483648.0F);
+    const __m128i top_bit    = _mm_set1_epi32(INT32_MIN);
+    __m128i       order[4];
+    for (int32_t k = 0; k < 4; ++k) {
+        order[k] = _mm_loadu_si128((const __m128i*)PACK_ORDER[size_index][swap][k]);
+    }
+
+    int32_t i = 0;
+    for (; i + 4 * vectors <= n; i += 4 * vectors) {
+        __m128i out = _mm_setzero_si128();
+        for (int32_t k = 0; k < vectors; ++k) {
+            /* max() returns its second operand if either is NaN, so NaN becomes the minimum */
+            __m128 x = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(src + i + 4 * k), s), lo), hi);
+            __m128i v;
+            if (bits == 32 && !is_signed) {
+                const __m128 upper = _mm_cmpge_ps(x, top);
+                x                  = _mm_sub_ps(x, _mm_and_ps(upper, top));
+                v                  = _mm_xor_si128(_mm_cvtps_epi32(x), _mm_castps_si128(_mm_cmpge_ps(x, top)));
+                v                  = _mm_xor_si128(v, _mm_and_si128(_mm_castps_si128(upper), top_bit));
+            } else if (bits == 32) {
+                v = _mm_xor_si128(_mm_cvtps_epi32(x), _mm_castps_si128(_mm_cmpge_ps(x, top)));
+            } else {
+                v = _mm_cvtps_epi32(x);
+            }
+            out = _mm_or_si128(out, _mm_shuffle_epi8(v, order[k]));
+        }
+        _mm_storeu_si128((__m128i*)(dst + i * bits / 8), out);
+    }
+    pack_scalar(src + i, dst + i * bits / 8, n - i, inverse_scale, swap, bits, is_signed);
+}
+
+VRT_TARGET("ssse3")
+static void pack_s8_ssse3(const struct vrt_converter* converter,
+                          const float*                src,
+                          uint8_t*                    dst,
+                          int32_t                     n,
+                          bool                        swap) {
+    pack_ssse3(src, dst, n, converter->inverse_scale, swap, 8, true);
+}
+
+VRT_TARGET("ssse3")
+static void pack_u8_ssse3(const struct vrt_converter* converter,
+                          const float*                src,
+                          uint8_t*                    dst,
+                          int32_t                     n,
+                          bool                        swap) {
+    pack_ssse3(src, dst, n, converter->inverse_scale, swap, 8, false);
+}
+
+VRT_TARGET("ssse3")
+static void pack_s16_ssse3(const struct vrt_converter* converter,
+                           const float*                src,
+                           uint8_t*                    dst,
+                           int32_t                     n,
+                           bool                        swap) {
+    pack_ssse3(src, dst, n, converter->inverse_scale, swap, 16, true);
+}
+
+VRT_TARGET("ssse3")
+static void pack_u16_ssse3(const struct vrt_converter* converter,
+                           const float*                src,
+                           uint8_t*                    dst,
+                           int32_t                     n,
+                           bool                        swap) {
+    pack_ssse3(src, dst, n, converter->inverse_scale, swap, 16, false);
+}
+
+VRT_TARGET("ssse3")
+static void pack_s32_ssse3(const struct vrt_converter* converter,
+                           const float*                src,
+                           uint8_t*                    dst,
+                           int32_t                     n,
+                           bool                        swap) {
+    pack_ssse3(src, dst, n, converter->inverse_scale, swap, 32, true);
+}
+
+VRT_TARGET("ssse3")
+static void pack_u32_ssse3(const struct vrt_converter* converter,
+                           const float*                src,
+                           uint8_t*                    dst,
+                           int32_t                     n,
+                           bool                        swap) {
+    pack_ssse3(src, dst, n, converter->inverse_scale, swap, 32, false);
+}
+#endif
+
+int32_t vrt_init_converter(struct vrt_converter*                        converter,
+                           const struct vrt_data_packet_payload_format* format,
+                           float                                        scale) {
+    const int32_t field_size       = format->item_packing_field_size + 1;
+    const int32_t item_size        = format->data_item_size + 1;
+    const int32_t event_tag_size   = format->event_tag_size & 0x07;
+    const int32_t channel_tag_size = format->channel_tag_size & 0x0F;
+    if (field_size > 64 || item_size + event_tag_size + channel_tag_size > field_size ||
+        format->real_or_complex > VRT_ROC_COMPLEX_POLAR ||
+        (format->data_item_format != VRT_DIF_SIGNED_FIXED_POINT &&
+         format->data_item_format != VRT_DIF_UNSIGNED_FIXED_POINT)) {
+        return VRT_ERR_UNSUPPORTED_FORMAT;
+    }
+
+    converter->kernel           = convert_fields;
+    converter->pack_kernel      = pack_floats;
+    converter->scale            = scale;
+    converter->inverse_scale    = 1.0F / scale;
+    converter->link_efficient   = format->packing_method == VRT_PM_LINK_EFFICIENT;
+    converter->is_signed        = format->data_item_format == VRT_DIF_SIGNED_FIXED_POINT;
+    converter->field_size       = field_size;
+    converter->item_size        = item_size;
+    converter->event_tag_size   = event_tag_size;
+    converter->channel_tag_size = channel_tag_size;
+
+    if (field_size != item_size) {
+        /* Tags or unused bits in each field */
+        return 0;
+    }
+
+    /* Indexed by item size and signedness */
+    static const kernel SCALAR[3][2]      = {{convert_u8_scalar, convert_s8_scalar},
+                                             {convert_u16_scalar, convert_s16_scalar},
+                                             {convert_u32_scalar, convert_s32_scalar}};
+    static const kernel LINK_SCALAR[3][2] = {{convert_u12_link_scalar, convert_s12_link_scalar},
+                                             {convert_u14_link_scalar, convert_s14_link_scalar},
+                                             {convert_u24_link_scalar, convert_s24_link_scalar}};
+
+    /* Items of 8, 16, and 32 bits never span words, so link-efficient and processing-efficient packing are the same */
+    const bool    aligned    = item_size == 8 || item_size == 16 || item_size == 32;
+    const bool    link       = converter->link_efficient && (item_size == 12 || item_size == 14 || item_size == 24);
+    const int32_t size_index = (item_size == 8 || item_size == 12) ? 0 : (item_size == 16 || item_size == 14) ? 1 : 2;
+    const bool    is_signed  = converter->is_signed;
+    static const pack_kernel PACK_SCALAR[3][2] = {{pack_u8_scalar, pack_s8_scalar},
+                                                  {pack_u16_scalar, pack_s16_scalar},
+                                                  {pack_u32_scalar, pack_s32_scalar}};
+    if (aligned) {
+        converter->kernel      = SCALAR[size_index][is_signed];
+        converter->pack_kernel = PACK_SCALAR[size_index][is_signed];
+    } else if (link) {
+        converter->kernel = LINK_SCALAR[size_index][is_signed];
+    }
+
+#if VRT_X86_DISPATCH
+    static const kernel AVX2[3][2]      = {{convert_u8_avx2, convert_s8_avx2},
+                                           {convert_u16_avx2, convert_s16_avx2},
+                                           {convert_u32_avx2, convert_s32_avx2}};
+    static const kernel LINK_AVX2[3][2] = {{convert_u12_link_avx2, convert_s12_link_avx2},
+                                           {convert_u14_link_avx2, convert_s14_link_avx2},
+                                           {convert_u24_link_avx2, convert_s24_link_avx2}};
+    static const kernel SSSE3[3][2]     = {{convert_u8_ssse3, convert_s8_ssse3},
+                                           {convert_u16_ssse3, convert_s16_ssse3},
+                                           {convert_u32_ssse3, convert_s32_ssse3}};
+    static const pack_kernel PACK_SSSE3[3][2] = {{pack_u8_ssse3, pack_s8_ssse3},
+                                                 {pack_u16_ssse3, pack_s16_ssse3},
+                                                 {pack_u32_ssse3, pack_s32_ssse3}};
+    if (vrt_cpu_has_ssse3() && aligned) {
+        /* Packing is bound by the byte shuffles, which AVX2 can't do across 128-bit lanes */
+        converter->pack_kernel = PACK_SSSE3[size_index][is_signed];
+    }
+    if (vrt_cpu_has_avx2()) {
+        if (aligned) {
+            converter->kernel = AVX2[size_index][is_signed];
+        } else if (link) {
+            converter->kernel = LINK_AVX2[size_index][is_signed];
+        }
+    } else if (vrt_cpu_has_ssse3() && aligned) {
+        /* SSSE3 has no per-lane shifts, so link-efficient items stay scalar */
+        converter->kernel = SSSE3[size_index][is_signed];
+    }
+#endif
+
+    return 0;
+}
+
+/**
+ * Count whole item packing fields in data packet body.
+ *
+ * \param converter  Converter.
+ * \param words_body Number of 32-bit words in body.
+ *
+ * \return Number of items.
+ */
+static int64_t count_items(const struct vrt_converter* converter, int32_t words_body) {
+    const int64_t bits = (int64_t)words_body * 32;
+    if (converter->link_efficient) {
+        return bits / converter->field_size;
+    }
+    const int32_t container = converter->field_size <= 32 ? 32 : 64;
+    return bits / container * (container / converter->field_size);
+}
+
+/**
+ * Convert data packet body to float.
+ *
+ * \param converter  Converter.
+ * \param body       Body words.
+ * \param words_body Number of 32-bit words in body.
+ * \param dst        Buffer to convert into.
+ * \param n_dst      Number of floats in dst.
+ * \param swap       True if words must be byte swapped to host order.
+ *
+ * \return Number of floats written, or a negative number if error.
+ */
+static int32_t convert_to_float(const struct vrt_converter* converter,
+                                const void*                 body,
+                                int32_t                     words_body,
+                                float*                      dst,
+                                int32_t                     n_dst,
+                                bool                        swap) {
+    if (words_body <= 0) {
+        return 0;
+    }
+    const int64_t n = count_items(converter, words_body);
+    if (n > n_dst) {
+        return VRT_ERR_BUFFER_SIZE;
+    }
+
+    converter->kernel(converter, (const uint8_t*)body, dst, (int32_t)n, swap);
+
+    return (int32_t)n;
+}
+
+int32_t vrt_convert_to_float(const struct vrt_converter* converter,
+                             const void*                 body,
+                             int32_t                     words_body,
+                             float*                      dst,
+                             int32_t                     n_dst) {
+    return convert_to_float(converter, body, words_body, dst, n_dst, false);
+}
+
+int32_t vrt_convert_to_float_be(const struct vrt_converter* converter,
+                                const void*                 body,
+                                int32_t                     words_body,
+                                float*                      dst,
+                                int32_t                     n_dst) {
+    return convert_to_float(converter, body, words_body, dst, n_dst, VRT_INTERNAL_NETWORK_ORDER_SWAP);
+}
+
+/**
+ * Unpack data packet body into integer items, and event and channel tags.
+ *
+ * \param converter    Converter.
+ * \param body         Body words.
+ * \param words_body   Number of 32-bit words in body.
+ * \param items        Buffer to unpack items into.
+ * \param event_tags   Buffer to unpack event tags into, or NULL.
+ * \param channel_tags Buffer to unpack channel tags into, or NULL.
+ * \param n            Number of elements in each buffer.
+ * \param swap         True if words must be byte swapped to host order.
+ *
+ * \return Number of items unpacked, or a negative number if error.
+ */
+static int32_t unpack_items(const struct vrt_converter* converter,
+                            const void*                 body,
+                            int32_t                     words_body,
+                            int64_t*                    items,
+                            uint8_t*                    event_tags,
+                            uint16_t*                   channel_tags,
+                            int32_t                     n,
+                            bool                        swap) {
+    if (words_body <= 0) {
+        return 0;
+    }
+    const int64_t n_items = count_items(converter, words_body);
+    if (n_items > n) {
+        return VRT_ERR_BUFFER_SIZE;
+    }
+
+    unpack_fields(converter, (const uint8_t*)body, (int32_t)n_items, swap, NULL, items, event_tags, channel_tags);
+
+    return (int32_t)n_items;
+}
+
+int32_t vrt_unpack_items(const struct vrt_converter* converter,
+                         const void*                 body,
+                         int32_t                     words_body,
+                         int64_t*                    items,
+                         uint8_t*                    event_tags,
+                         uint16_t*                   channel_tags,
+                         int32_t                     n) {
+    return unpack_items(converter, body, words_body, items, event_tags, channel_tags, n, false);
+}
+
+int32_t vrt_unpack_items_be(const struct vrt_converter* converter,
+                            const void*                 body,
+                            int32_t                     words_body,
+                            int64_t*                    items,
+                            uint8_t*                    event_tags,
+                            uint16_t*                   channel_tags,
+                            int32_t                     n) {
+    return unpack_items(converter, body, words_body, items, event_tags, channel_tags, n,
+                        VRT_INTERNAL_NETWORK_ORDER_SWAP);
+}
+
+/**
+ * Count words needed for items.
+ *
+ * \param converter Converter.
+ * \param n         Number of items.
+ *
+ * \return Number of words.
+ */
+static int64_t count_words(const struct vrt_converter* converter, int32_t n) {
+    if (converter->link_efficient) {
+        return ((int64_t)n * converter->field_size + 31) / 32;
+    }
+    const int32_t container = converter->field_size <= 32 ? 32 : 64;
+    const int32_t per       = container / converter->field_size;
+    return ((int64_t)n + per - 1) / per * (container / 32);
+}
+
+/**
+ * Pack floats into data packet body.
+ *
+ * \param converter  Converter.
+ * \param src        Floats to pack.
+ * \param n          Number of floats.
+ * \param body       Body to write to.
+ * \param words_body Number of 32-bit words in body buffer.
+ * \param swap       True if words must be byte swapped from host order.
+ *
+ * \return Number of words written, or a negative number if error.
+ */
+static int32_t convert_from_float(const struct vrt_converter* converter,
+                                  const float*                src,
+                                  int32_t                     n,
+                                  void*                       body,
+                                  int32_t                     words_body,
+                                  bool                        swap) {
+    if (n <= 0) {
+        return 0;
+    }
+    const int64_t words = count_words(converter, n);
+    if (words > words_body) {
+        return VRT_ERR_BUFFER_SIZE;
+    }
+
+    converter->pack_kernel(converter, src, (uint8_t*)body, n, swap);
+
+    return (int32_t)words;
+}
+
+int32_t vrt_convert_from_float(const struct vrt_converter* converter,
+                               const float*                src,
+                               int32_t                     n,
+                               void*                       body,
+                               int32_t                     words_body) {
+    return convert_from_float(converter, src, n, body, words_body, false);
+}
+
+int32_t vrt_convert_from_float_be(const struct vrt_converter* converter,
+                                  const float*                src,
+                                  int32_t                     n,
+                                  void*                       body,
+                                  int32_t                     words_body) {
+    return convert_from_float(converter, src, n, body, words_body, VRT_INTERNAL_NETWORK_ORDER_SWAP);
+}
+
+/**
+ * Pack integer items, and event and channel tags, into data packet body.
+ *
+ * \param converter    Converter.
+ * \param items        Items to pack.
+ * \param event_tags   Event tags to pack, or NULL.
+ * \param channel_tags Channel tags to pack, or NULL.
+ * \param n            Number of items.
+ * \param body         Body to write to.
+ * \param words_body   Number of 32-bit words in body buffer.
+ * \param swap         True if words must be byte swapped from host order.
+ *
+ * \return Number of words written, or a negative number if error.
+ */
+static int32_t pack_items(const struct vrt_converter* converter,
+                          const int64_t*              items,
+                          const uint8_t*              event_tags,
+                          const uint16_t*             channel_tags,
+                          int32_t                     n,
+                          void*                       body,
+                          int32_t                     words_body,
+                          bool                        swap) {
+    if (n <= 0) {
+        return 0;
+    }
+    const int64_t words = count_words(converter, n);
+    if (words > words_body) {
+        return VRT_ERR_BUFFER_SIZE;
+    }
+
+    pack_fields(converter, NULL, items, event_tags, channel_tags, n, swap, (uint8_t*)body);
+
+    return (int32_t)words;
+}
+
+int32_t vrt_pack_items(const struct vrt_converter* converter,
+                       const int64_t*              items,
+                       const uint8_t*              event_tags,
+                       const uint16_t*             channel_tags,
+                       int32_t                     n,
+                       void*                       body,
+                       int32_t                     words_body) {
+    return pack_items(converter, items, event_tags, channel_tags, n, body, words_body, false);
+}
+
+int32_t vrt_pack_items_be(const struct vrt_converter* converter,
+                          const int64_t*              items,
+                          const uint8_t*              event_tags,
+                          const uint16_t*             channel_tags,
+                          int32_t                     n,
+                          void*                       body,
+                          int32_t                     words_body) {
+    return pack_items(converter, items, event_tags, channel_tags, n, body, words_body, VRT_INTERNAL_NETWORK_ORDER_SWAP);
+}
@@ -0,0 +1,7 @@
+#include "vrt_cpu.h"
+
+enum vrt_cpu_level vrt_cpu_max_level = VRT_CPU_LEVEL_AVX2;
+
+/* Defined inline in header */
+extern bool vrt_cpu_has_ssse3(void);
+extern bool vrt_cpu_has_avx2(void);
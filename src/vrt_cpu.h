@@ -0,0 +1,64 @@
+#ifndef SRC_VRT_CPU_H_
+#define SRC_VRT_CPU_H_
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Runtime CPU feature dispatch. SIMD kernels are compiled with per-function target attributes, so the library itself
+ * can be built for a baseline instruction set and still make use of wider instructions where available.
+ */
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define VRT_X86_DISPATCH 1
+#define VRT_TARGET(t)    __attribute__((target(t)))
+#else
+#define VRT_X86_DISPATCH 0
+#define VRT_TARGET(t)
+#endif
+
+/**
+ * Instruction set levels of runtime dispatch, from narrowest to widest.
+ */
+enum vrt_cpu_level { VRT_CPU_LEVEL_SCALAR = 0, VRT_CPU_LEVEL_SSSE3 = 1, VRT_CPU_LEVEL_AVX2 = 2 };
+
+/**
+ * Widest instruction set level runtime dispatch may pick, VRT_CPU_LEVEL_AVX2 by default. Tests lower it to run the
+ * narrower kernels on CPUs that also support wider ones. It is read when dispatching, so converters keep the kernels
+ * they were initialized with. Not thread safe.
+ */
+extern enum vrt_cpu_level vrt_cpu_max_level;
+
+/**
+ * Check if CPU supports SSSE3 instructions, and dispatching to them is allowed.
+ *
+ * \return True if supported.
+ */
+inline bool vrt_cpu_has_ssse3(void) {
+#if VRT_X86_DISPATCH
+    return vrt_cpu_max_level >= VRT_CPU_LEVEL_SSSE3 && __builtin_cpu_supports("ssse3");
+#else
+    return false;
+#endif
+}
+
+/**
+ * Check if CPU supports AVX2 instructions, and dispatching to them is allowed.
+ *
+ * \return True if supported.
+ */
+inline bool vrt_cpu_has_avx2(void) {
+#if VRT_X86_DISPATCH
+    return vrt_cpu_max_level >= VRT_CPU_LEVEL_AVX2 && __builtin_cpu_supports("avx2");
+#else
+    return false;
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,131 @@
+#include "vrt/vrt_demux.h"
+
+#include "vrt/vrt_error_code.h"
+#include "vrt/vrt_types.h"
+#include "vrt/vrt_util.h"
+
+#include "vrt_util_internal.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Find entry of stream, or the empty entry where it would be inserted.
+ *
+ * \param demux     Demultiplexer.
+ * \param stream_id Stream ID.
+ *
+ * \return Entry.
+ */
+static inline struct vrt_demux_entry* probe(const struct vrt_demux* demux, uint32_t stream_id) {
+    /* There is always at least one unused entry, so this terminates */
+    uint32_t i = vrt_hash_stream_id(stream_id) & demux->mask;
+    while (demux->entries[i].used && demux->entries[i].stream_id != stream_id) {
+        i = (i + 1) & demux->mask;
+    }
+    return &demux->entries[i];
+}
+
+int32_t vrt_init_demux(struct vrt_demux*       demux,
+                       struct vrt_demux_entry* entries,
+                       int32_t                 capacity,
+                       vrt_demux_callback      fallback,
+                       void*                   fallback_user) {
+    if (capacity <= 0 || (capacity & (capacity - 1)) != 0) {
+        return VRT_ERR_INVALID_CAPACITY;
+    }
+
+    for (int32_t i = 0; i < capacity; ++i) {
+        entries[i].used = false;
+    }
+
+    demux->entries       = entries;
+    demux->mask          = (uint32_t)capacity - 1;
+    demux->size          = 0;
+    demux->last          = NULL;
+    demux->fallback      = fallback;
+    demux->fallback_user = fallback_user;
+
+    return 0;
+}
+
+int32_t vrt_demux_add(struct vrt_demux* demux, uint32_t stream_id, vrt_demux_callback callback, void* user) {
+    struct vrt_demux_entry* e = probe(demux, stream_id);
+    if (!e->used) {
+        /* Keep load factor at most 3/4 */
+        int64_t capacity = (int64_t)demux->mask + 1;
+        if (4 * ((int64_t)demux->size + 1) > 3 * capacity) {
+            return VRT_ERR_STREAMS_FULL;
+        }
+        e->used      = true;
+        e->stream_id = stream_id;
+        demux->size += 1;
+    }
+    e->callback = callback;
+    e->user     = user;
+
+    return 0;
+}
+
+bool vrt_demux_remove(struct vrt_demux* demux, uint32_t stream_id) {
+    struct vrt_demux_entry* e = probe(demux, stream_id);
+    if (!e->used) {
+        return false;
+    }
+
+    /* Backward shift deletion, i.e. move later entries in the probe sequence into the hole, instead of tombstones */
+    uint32_t i = (uint32_t)(e - demux->entries);
+    uint32_t j = i;
+    for (;;) {
+        j = (j + 1) & demux->mask;
+        if (!demux->entries[j].used) {
+            break;
+        }
+        uint32_t home = vrt_hash_stream_id(demux->entries[j].stream_id) & demux->mask;
+        /* Entry can be moved to the hole at i if its home isn't cyclically in (i, j] */
+        if (((j - home) & demux->mask) >= ((j - i) & demux->mask)) {
+            demux->entries[i] = demux->entries[j];
+            i                 = j;
+        }
+    }
+    demux->entries[i].used = false;
+    demux->size -= 1;
+
+    /* Entries may have moved */
+    demux->last = NULL;
+
+    return true;
+}
+
+struct vrt_demux_entry* vrt_demux_find(struct vrt_demux* demux, uint32_t stream_id) {
+    struct vrt_demux_entry* e = probe(demux, stream_id);
+    return e->used ? e : NULL;
+}
+
+int32_t vrt_demux_dispatch(struct vrt_demux* demux, const struct vrt_packet_descriptor* descriptors, int32_t n) {
+    int32_t                 routed = 0;
+    struct vrt_demux_entry* last   = demux->last;
+    for (int32_t i = 0; i < n; ++i) {
+        const struct vrt_packet_descriptor* d = &descriptors[i];
+        if (vrt_has_stream_id(&d->header)) {
+            const uint32_t id = d->fields.stream_id;
+            if (last == NULL || last->stream_id != id) {
+                struct vrt_demux_entry* e = probe(demux, id);
+                if (e->used) {
+                    last = e;
+                }
+            }
+            if (last != NULL && last->stream_id == id) {
+                last->callback(d, last->user);
+                routed += 1;
+                continue;
+            }
+        }
+        if (demux->fallback != NULL) {
+            demux->fallback(d, demux->fallback_user);
+        }
+    }
+    demux->last = last;
+
+    return routed;
+}
@@ -0,0 +1,211 @@
+/* Use 64-bit file offsets on 32-bit platforms as well */
+#define _FILE_OFFSET_BITS 64
+
+#include "vrt/vrt_file.h"
+
+#include "vrt/vrt_error_code.h"
+#include "vrt/vrt_read.h"
+#include "vrt/vrt_types.h"
+
+#include "vrt_mmap.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Size of largest possible packet in bytes */
+#define MAX_PACKET_BYTES ((uint64_t)0xFFFF * sizeof(uint32_t))
+
+/* Default window size on platforms where a large file may not fit in the address space */
+#define DEFAULT_WINDOW_32 ((uint64_t)256 << 20U)
+
+#if VRT_HAS_MMAP
+/**
+ * Get page size, which mapping offsets must be a multiple of.
+ *
+ * \return Page size in bytes.
+ */
+static uint64_t page_size(void) {
+    long p = sysconf(_SC_PAGESIZE);
+    return p > 0 ? (uint64_t)p : 4096;
+}
+
+/**
+ * Unmap current window, if any.
+ *
+ * \param reader Reader.
+ */
+static void unmap_window(struct vrt_file_reader* reader) {
+    if (reader->map != NULL) {
+        (void)munmap(reader->map, (size_t)reader->map_size);
+        reader->map      = NULL;
+        reader->map_size = 0;
+    }
+}
+
+/**
+ * Map window that starts at the page containing a file offset.
+ *
+ * \param reader Reader.
+ * \param offset File offset in bytes.
+ *
+ * \return 0, or a negative number if error.
+ * \retval VRT_ERR_FILE File could not be memory mapped.
+ */
+static int32_t map_window(struct vrt_file_reader* reader, uint64_t offset) {
+    unmap_window(reader);
+
+    const uint64_t start = offset - offset % page_size();
+    uint64_t       size  = reader->size - start;
+    if (size > reader->window) {
+        size = reader->window;
+    }
+
+    void* map = mmap(NULL, (size_t)size, PROT_READ, MAP_SHARED, reader->fd, (off_t)start);
+    if (map == MAP_FAILED) {
+        return VRT_ERR_FILE;
+    }
+
+    /* Hints only, so failure is harmless */
+    (void)madvise(map, (size_t)size, MADV_SEQUENTIAL);
+#ifdef MADV_HUGEPAGE
+    (void)madvise(map, (size_t)size, MADV_HUGEPAGE);
+#endif
+
+    reader->map        = map;
+    reader->map_offset = start;
+    reader->map_size   = size;
+
+    return 0;
+}
+#endif
+
+int32_t vrt_open_file_reader(struct vrt_file_reader* reader, const char* path, uint64_t window) {
+    reader->fd         = -1;
+    reader->size       = 0;
+    reader->window     = 0;
+    reader->map        = NULL;
+    reader->map_offset = 0;
+    reader->map_size   = 0;
+    reader->offset     = 0;
+
+#if VRT_HAS_MMAP
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return VRT_ERR_FILE;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < 0) {
+        (void)close(fd);
+        return VRT_ERR_FILE;
+    }
+
+    const uint64_t page = page_size();
+    if (window == 0) {
+        window = SIZE_MAX > UINT32_MAX ? (uint64_t)st.st_size : DEFAULT_WINDOW_32;
+    }
+    /* A packet starting anywhere in the first page of a window must fit in it */
+    if (window < MAX_PACKET_BYTES + page) {
+        window = MAX_PACKET_BYTES + page;
+    }
+    window = (window + page - 1) / page * page;
+
+    reader->fd     = fd;
+    reader->size   = (uint64_t)st.st_size;
+    reader->window = window;
+
+    return 0;
+#else
+    (void)path;
+    (void)window;
+    return VRT_ERR_FILE;
+#endif
+}
+
+void vrt_close_file_reader(struct vrt_file_reader* reader) {
+#if VRT_HAS_MMAP
+    unmap_window(reader);
+    if (reader->fd >= 0) {
+        (void)close(reader->fd);
+    }
+#endif
+    reader->fd = -1;
+}
+
+void vrt_seek_file_reader(struct vrt_file_reader* reader, uint64_t offset) {
+    reader->offset = offset;
+}
+
+/**
+ * Read next packets in recording file.
+ *
+ * \param reader      Reader.
+ * \param descriptors Descriptors to read into.
+ * \param n           Number of descriptors.
+ * \param validate    Level of validation.
+ * \param be          True if file is in network byte order.
+ *
+ * \return Number of read packets, 0 at end of file, or a negative number if error.
+ */
+static int32_t read_file_packets(struct vrt_file_reader*       reader,
+                                 struct vrt_packet_descriptor* descriptors,
+                                 int32_t                       n,
+                                 enum vrt_validation           validate,
+                                 bool                          be) {
+#if VRT_HAS_MMAP
+    if (reader->offset >= reader->size) {
+        return 0;
+    }
+
+    /*
+     * Slide window ahead of time when the next packet may not fit in it, so that reading never stops at the end of a
+     * window, only at the end of the file.
+     */
+    const uint64_t end = reader->map_offset + reader->map_size;
+    if (reader->map == NULL || reader->offset < reader->map_offset || reader->offset >= end ||
+        (end < reader->size && end - reader->offset < MAX_PACKET_BYTES)) {
+        int32_t rv = map_window(reader, reader->offset);
+        if (rv < 0) {
+            return rv;
+        }
+    }
+
+    uint64_t words_left = (reader->map_offset + reader->map_size - reader->offset) / sizeof(uint32_t);
+    if (words_left > INT32_MAX) {
+        words_left = INT32_MAX;
+    }
+    uint32_t* buf = (uint32_t*)reader->map + (reader->offset - reader->map_offset) / sizeof(uint32_t);
+
+    int32_t words_read = 0;
+    int32_t rv         = be ? vrt_read_packets_be(buf, (int32_t)words_left, descriptors, n, &words_read, validate)
+                            : vrt_read_packets(buf, (int32_t)words_left, descriptors, n, &words_read, validate);
+    reader->offset += (uint64_t)words_read * sizeof(uint32_t);
+    if (rv == 0 && n > 0) {
+        /* The window always fits the next packet, so it must be cut off by end of file */
+        return VRT_ERR_BUFFER_SIZE;
+    }
+
+    return rv;
+#else
+    (void)reader;
+    (void)descriptors;
+    (void)n;
+    (void)validate;
+    (void)be;
+    return VRT_ERR_FILE;
+#endif
+}
+
+int32_t vrt_read_file_packets(struct vrt_file_reader*       reader,
+                              struct vrt_packet_descriptor* descriptors,
+                              int32_t                       n,
+                              enum vrt_validation           validate) {
+    return read_file_packets(reader, descriptors, n, validate, false);
+}
+
+int32_t vrt_read_file_packets_be(struct vrt_file_reader*       reader,
+                                 struct vrt_packet_descriptor* descriptors,
+                                 int32_t                       n,
+                                 enum vrt_validation           validate) {
+    return read_file_packets(reader, descriptors, n, validate, true);
+}
@@ -0,0 +1,274 @@
+#include "vrt/vrt_if_context_view.h"
+
+#include "vrt/vrt_bits.h"
+#include "vrt/vrt_error_code.h"
+#include "vrt/vrt_types.h"
+
+#include "vrt_fixed_point.h"
+#include "vrt_util_internal.h"
+
+#include <stddef.h>
+
+/**
+ * Set up IF context view, with optional byte swapping of words.
+ *
+ * \param buf       Buffer to read from.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param view      View to set up.
+ * \param validate  Level of validation.
+ * \param swap      True if words shall be byte swapped.
+ *
+ * \return Number of words in IF context section, or a negative number if error.
+ */
+static VRT_INTERNAL_FORCE_INLINE int32_t
+read_if_context_view(const void*                 buf,
+                     int32_t                     words_buf,
+                     struct vrt_if_context_view* view,
+                     enum vrt_validation         validate,
+                     bool                        swap) {
+    if (words_buf < 1) {
+        return VRT_ERR_BUFFER_SIZE;
+    }
+
+    const uint32_t* b = (const uint32_t*)buf;
+
+    view->buf       = b;
+    view->indicator = vrt_internal_load(b, swap);
+    view->swap      = swap;
+
+    if (vrt_internal_validate_structure(validate)) {
+        if (vrt_mskr(view->indicator, VRT_BITS_CIF0_RESERVED) != 0) {
+            return VRT_ERR_RESERVED;
+        }
+    }
+
+    /*
+     * Fixed size fields, in a single pass from the most significant indicator bit while summing up the sizes of the
+     * present fields. Bit 31 is the change indicator, which has no field.
+     */
+    view->offsets[31] = 0;
+    uint32_t offset   = 1;
+    for (uint32_t i = 30; i > VRT_CIF0_BIT_GPS_ASCII; --i) {
+        const uint32_t present = (view->indicator >> i) & 1U;
+        const uint32_t size    = ((VRT_CIF0_WORDS_1 >> i) & 1U) + 2 * ((VRT_CIF0_WORDS_2 >> i) & 1U) +
+                                 11 * ((VRT_CIF0_WORDS_11 >> i) & 1U) + 13 * ((VRT_CIF0_WORDS_13 >> i) & 1U);
+        view->offsets[i] = (uint16_t)(present * offset);
+        offset += present * size;
+    }
+    int32_t words = (int32_t)offset;
+    if (words_buf < words) {
+        return VRT_ERR_BUFFER_SIZE;
+    }
+
+    /* Variable size fields, where the size is found inside the field itself */
+    if ((view->indicator & VRT_BITS_MASK(VRT_BITS_CIF0_GPS_ASCII)) != 0) {
+        if (words_buf < words + 2) {
+            return VRT_ERR_BUFFER_SIZE;
+        }
+        uint32_t number_of_words = vrt_internal_load(b + words + 1, swap);
+        if (number_of_words > (uint32_t)(words_buf - words - 2)) {
+            return VRT_ERR_BUFFER_SIZE;
+        }
+        view->offsets[VRT_BITS_POS(VRT_BITS_CIF0_GPS_ASCII)] = (uint16_t)words;
+        words += 2 + (int32_t)number_of_words;
+    } else {
+        view->offsets[VRT_BITS_POS(VRT_BITS_CIF0_GPS_ASCII)] = 0;
+    }
+    if ((view->indicator & VRT_BITS_MASK(VRT_BITS_CIF0_CONTEXT_ASSOCIATION_LISTS)) != 0) {
+        if (words_buf < words + 2) {
+            return VRT_ERR_BUFFER_SIZE;
+        }
+        uint32_t w0 = vrt_internal_load(b + words, swap);
+        uint32_t w1 = vrt_internal_load(b + words + 1, swap);
+        uint32_t n  = ((w0 >> 16U) & 0x01FFU) + (w0 & 0x01FFU) + (w1 >> 16U);
+        uint32_t n4 = w1 & 0x7FFFU;
+        n += (w1 & 0x8000U) != 0 ? 2 * n4 : n4;
+        if (n > (uint32_t)(words_buf - words - 2)) {
+            return VRT_ERR_BUFFER_SIZE;
+        }
+        view->offsets[VRT_BITS_POS(VRT_BITS_CIF0_CONTEXT_ASSOCIATION_LISTS)] = (uint16_t)words;
+        words += 2 + (int32_t)n;
+    } else {
+        view->offsets[VRT_BITS_POS(VRT_BITS_CIF0_CONTEXT_ASSOCIATION_LISTS)] = 0;
+    }
+    for (int32_t i = 0; i < VRT_BITS_POS(VRT_BITS_CIF0_CONTEXT_ASSOCIATION_LISTS); ++i) {
+        view->offsets[i] = 0;
+    }
+
+    return words;
+}
+
+int32_t vrt_read_if_context_view(const void*                 buf,
+                                 int32_t                     words_buf,
+                                 struct vrt_if_context_view* view,
+                                 enum vrt_validation         validate) {
+    return read_if_context_view(buf, words_buf, view, validate, false);
+}
+
+int32_t vrt_read_if_context_view_be(const void*                 buf,
+                                    int32_t                     words_buf,
+                                    struct vrt_if_context_view* view,
+                                    enum vrt_validation         validate) {
+    return read_if_context_view(buf, words_buf, view, validate, VRT_INTERNAL_NETWORK_ORDER_SWAP);
+}
+
+/**
+ * Get pointer to a field.
+ *
+ * \param view View.
+ * \param bit  Indicator bit position of field.
+ *
+ * \return Pointer to first word of field, or NULL if it isn't present.
+ */
+static inline const uint32_t* field(const struct vrt_if_context_view* view, uint32_t bit) {
+    uint16_t offset = view->offsets[bit];
+    return offset == 0 ? NULL : view->buf + offset;
+}
+
+/**
+ * Decode a one word field.
+ *
+ * \param view View.
+ * \param bit  Indicator bit position of field.
+ * \param val  Value to write to, if present.
+ *
+ * \return True if the field is present.
+ */
+static inline bool read_u32(const struct vrt_if_context_view* view, uint32_t bit, uint32_t* val) {
+    const uint32_t* b = field(view, bit);
+    if (b == NULL) {
+        return false;
+    }
+    *val = vrt_internal_load(b, view->swap);
+    return true;
+}
+
+/**
+ * Decode a two word field, where the first word is most significant.
+ *
+ * \param view View.
+ * \param bit  Indicator bit position of field.
+ * \param val  Value to write to, if present.
+ *
+ * \return True if the field is present.
+ */
+static inline bool read_u64(const struct vrt_if_context_view* view, uint32_t bit, uint64_t* val) {
+    const uint32_t* b = field(view, bit);
+    if (b == NULL) {
+        return false;
+    }
+    *val = (uint64_t)vrt_internal_load(b, view->swap) << 32U | (uint64_t)vrt_internal_load(b + 1, view->swap);
+    return true;
+}
+
+/**
+ * Decode a two word frequency field.
+ *
+ * \param view View.
+ * \param bit  Indicator bit position of field.
+ * \param val  Value to write to, if present.
+ *
+ * \return True if the field is present.
+ */
+static inline bool read_frequency(const struct vrt_if_context_view* view, uint32_t bit, double* val) {
+    uint64_t u = 0;
+    if (!read_u64(view, bit, &u)) {
+        return false;
+    }
+    *val = vrt_fixed_point_i64_to_double((int64_t)u, VRT_RADIX_FREQUENCY);
+    return true;
+}
+
+bool vrt_if_context_view_reference_point_identifier(const struct vrt_if_context_view* view,
+                                                    uint32_t*                         reference_point_identifier) {
+    return read_u32(view, VRT_BITS_POS(VRT_BITS_CIF0_REFERENCE_POINT_IDENTIFIER), reference_point_identifier);
+}
+
+bool vrt_if_context_view_bandwidth(const struct vrt_if_context_view* view, double* bandwidth) {
+    return read_frequency(view, VRT_BITS_POS(VRT_BITS_CIF0_BANDWIDTH), bandwidth);
+}
+
+bool vrt_if_context_view_if_reference_frequency(const struct vrt_if_context_view* view,
+                                                double*                           if_reference_frequency) {
+    return read_frequency(view, VRT_BITS_POS(VRT_BITS_CIF0_IF_REFERENCE_FREQUENCY), if_reference_frequency);
+}
+
+bool vrt_if_context_view_rf_reference_frequency(const struct vrt_if_context_view* view,
+                                                double*                           rf_reference_frequency) {
+    return read_frequency(view, VRT_BITS_POS(VRT_BITS_CIF0_RF_REFERENCE_FREQUENCY), rf_reference_frequency);
+}
+
+bool vrt_if_context_view_rf_reference_frequency_offset(
+    const struct vrt_if_context_view* view,
+    double*                           rf_reference_frequency_offset) {
+    return read_frequency(view, VRT_BITS_POS(VRT_BITS_CIF0_RF_REFERENCE_FREQUENCY_OFFSET),
+                          rf_reference_frequency_offset);
+}
+
+bool vrt_if_context_view_if_band_offset(const struct vrt_if_context_view* view, double* if_band_offset) {
+    return read_frequency(view, VRT_BITS_POS(VRT_BITS_CIF0_IF_BAND_OFFSET), if_band_offset);
+}
+
+bool vrt_if_context_view_reference_level(const struct vrt_if_context_view* view, float* reference_level) {
+    uint32_t u = 0;
+    if (!read_u32(view, VRT_BITS_POS(VRT_BITS_CIF0_REFERENCE_LEVEL), &u)) {
+        return false;
+    }
+    *reference_level = vrt_fixed_point_i16_to_float((int16_t)(u & 0x0000FFFFU), VRT_RADIX_REFERENCE_LEVEL);
+    return true;
+}
+
+bool vrt_if_context_view_gain(const struct vrt_if_context_view* view, struct vrt_gain* gain) {
+    uint32_t u = 0;
+    if (!read_u32(view, VRT_BITS_POS(VRT_BITS_CIF0_GAIN), &u)) {
+        return false;
+    }
+    gain->stage1 = vrt_fixed_point_i16_to_float((int16_t)(u & 0x0000FFFFU), VRT_RADIX_GAIN);
+    gain->stage2 = vrt_fixed_point_i16_to_float((int16_t)((u >> 16U) & 0x0000FFFFU), VRT_RADIX_GAIN);
+    return true;
+}
+
+bool vrt_if_context_view_over_range_count(const struct vrt_if_context_view* view, uint32_t* over_range_count) {
+    return read_u32(view, VRT_BITS_POS(VRT_BITS_CIF0_OVER_RANGE_COUNT), over_range_count);
+}
+
+bool vrt_if_context_view_sample_rate(const struct vrt_if_context_view* view, double* sample_rate) {
+    return read_frequency(view, VRT_BITS_POS(VRT_BITS_CIF0_SAMPLE_RATE), sample_rate);
+}
+
+bool vrt_if_context_view_timestamp_adjustment(const struct vrt_if_context_view* view,
+                                              uint64_t*                         timestamp_adjustment) {
+    return read_u64(view, VRT_BITS_POS(VRT_BITS_CIF0_TIMESTAMP_ADJUSTMENT), timestamp_adjustment);
+}
+
+bool vrt_if_context_view_timestamp_calibration_time(const struct vrt_if_context_view* view,
+                                                    uint32_t*                         timestamp_calibration_time) {
+    return read_u32(view, VRT_BITS_POS(VRT_BITS_CIF0_TIMESTAMP_CALIBRATION_TIME), timestamp_calibration_time);
+}
+
+bool vrt_if_context_view_temperature(const struct vrt_if_context_view* view, float* temperature) {
+    uint32_t u = 0;
+    if (!read_u32(view, VRT_BITS_POS(VRT_BITS_CIF0_TEMPERATURE), &u)) {
+        return false;
+    }
+    *temperature = vrt_fixed_point_i16_to_float((int16_t)(u & 0x0000FFFFU), VRT_RADIX_TEMPERATURE);
+    return true;
+}
+
+bool vrt_if_context_view_device_identifier(const struct vrt_if_context_view* view,
+                                           struct vrt_device_identifier*     device_identifier) {
+    uint64_t u = 0;
+    if (!read_u64(view, VRT_BITS_POS(VRT_BITS_CIF0_DEVICE_IDENTIFIER), &u)) {
+        return false;
+    }
+    device_identifier->oui         = (uint32_t)(u >> 32U) & 0x00FFFFFFU;
+    device_identifier->device_code = (uint16_t)(u & 0x0000FFFFU);
+    return true;
+}
+
+bool vrt_if_context_view_ephemeris_reference_identifier(
+    const struct vrt_if_context_view* view,
+    uint32_t*                         ephemeris_reference_identifier) {
+    return read_u32(view, VRT_BITS_POS(VRT_BITS_CIF0_EPHEMERIS_REFERENCE_IDENTIFIER),
+                    ephemeris_reference_identifier);
+}
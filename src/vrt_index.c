@@ -0,0 +1,511 @@
+/* Use 64-bit file offsets on 32-bit platforms as well */
+#define _FILE_OFFSET_BITS 64
+
+#include "vrt/vrt_index.h"
+
+#include "vrt/vrt_error_code.h"
+#include "vrt/vrt_file.h"
+#include "vrt/vrt_types.h"
+#include "vrt/vrt_util.h"
+
+#include "vrt_mmap.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Number of packets described per read while building */
+#define BATCH 256
+
+/**
+ * Number of picoseconds in a second.
+ */
+static const uint64_t PS_IN_S = 1000000000000;
+
+/**
+ * Index file header.
+ */
+struct index_header {
+    char     magic[8];   /* "VRTINDEX" */
+    uint32_t version;    /* VRT_INDEX_VERSION */
+    uint32_t byte_order; /* BYTE_ORDER_MARK, as written by the platform */
+    uint64_t n;          /* Number of packets */
+    uint64_t n_streams;  /* Number of packets with stream ID */
+};
+
+#if VRT_HAS_MMAP
+static const char     MAGIC[8]        = {'V', 'R', 'T', 'I', 'N', 'D', 'E', 'X'};
+static const uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+/**
+ * Compare stream entries by stream ID, and then by packet number.
+ *
+ * \param a Stream entry.
+ * \param b Stream entry.
+ *
+ * \return Negative, zero, or positive if a is less than, equal to, or greater than b.
+ */
+static int compare_stream_entries(const void* a, const void* b) {
+    const struct vrt_index_stream_entry* sa = (const struct vrt_index_stream_entry*)a;
+    const struct vrt_index_stream_entry* sb = (const struct vrt_index_stream_entry*)b;
+    if (sa->stream_id != sb->stream_id) {
+        return sa->stream_id < sb->stream_id ? -1 : 1;
+    }
+    if (sa->packet != sb->packet) {
+        return sa->packet < sb->packet ? -1 : 1;
+    }
+    return 0;
+}
+
+/**
+ * Check if indexed packet has stream ID.
+ *
+ * \param entry Packet.
+ *
+ * \return True if it has.
+ */
+static bool entry_has_stream_id(const struct vrt_index_entry* entry) {
+    struct vrt_header header;
+    header.packet_type = (enum vrt_packet_type)entry->packet_type;
+    return vrt_has_stream_id(&header);
+}
+
+/**
+ * Write whole buffer to file, retrying partial writes.
+ *
+ * \param fd    File descriptor.
+ * \param buf   Buffer.
+ * \param bytes Number of bytes in buffer.
+ *
+ * \return True on success.
+ */
+static bool write_all(int fd, const void* buf, size_t bytes) {
+    const char* p = (const char*)buf;
+    while (bytes > 0) {
+        ssize_t rv = write(fd, p, bytes);
+        if (rv <= 0) {
+            return false;
+        }
+        p += rv;
+        bytes -= (size_t)rv;
+    }
+    return true;
+}
+
+/**
+ * Write packet entries of recording to file, right after a placeholder header.
+ *
+ * \param reader    Reader of recording.
+ * \param fd        File descriptor of index file.
+ * \param be        True if recording is in network byte order.
+ * \param n         Set to number of packets.
+ * \param n_streams Set to number of packets with stream ID.
+ *
+ * \return 0, or a negative number if error.
+ */
+static int32_t write_entries(struct vrt_file_reader* reader, int fd, bool be, uint64_t* n, uint64_t* n_streams) {
+    struct index_header header;
+    memset(&header, 0, sizeof(header));
+    if (!write_all(fd, &header, sizeof(header))) {
+        return VRT_ERR_FILE;
+    }
+
+    struct vrt_packet_descriptor descriptors[BATCH];
+    struct vrt_index_entry       entries[BATCH];
+    *n         = 0;
+    *n_streams = 0;
+    for (;;) {
+        const uint64_t offset = reader->offset;
+        int32_t        rv     = be ? vrt_read_file_packets_be(reader, descriptors, BATCH, VRT_VALIDATION_STRUCTURAL)
+                                   : vrt_read_file_packets(reader, descriptors, BATCH, VRT_VALIDATION_STRUCTURAL);
+        if (rv < 0) {
+            return rv;
+        }
+        if (rv == 0) {
+            return 0;
+        }
+        for (int32_t i = 0; i < rv; ++i) {
+            const struct vrt_packet_descriptor* d = &descriptors[i];
+            struct vrt_index_entry*             e = &entries[i];
+            const bool                          s = vrt_has_stream_id(&d->header);
+
+            e->offset                       = offset + (uint64_t)d->offset * sizeof(uint32_t);
+            e->fractional_seconds_timestamp = d->fields.fractional_seconds_timestamp;
+            e->integer_seconds_timestamp    = d->fields.integer_seconds_timestamp;
+            e->stream_id                    = s ? d->fields.stream_id : 0;
+            e->packet_type                  = (uint8_t)d->header.packet_type;
+            e->packet_count                 = d->header.packet_count;
+            e->tsi                          = (uint8_t)d->header.tsi;
+            e->tsf                          = (uint8_t)d->header.tsf;
+            e->words                        = d->header.packet_size;
+            e->reserved                     = 0;
+            if (s) {
+                *n_streams += 1;
+            }
+        }
+        if (!write_all(fd, entries, (size_t)rv * sizeof(struct vrt_index_entry))) {
+            return VRT_ERR_FILE;
+        }
+        *n += (uint64_t)rv;
+    }
+}
+
+/**
+ * Append sorted stream table to index file, and write final header.
+ *
+ * \param fd        File descriptor of index file, with placeholder header and packet entries.
+ * \param n         Number of packets.
+ * \param n_streams Number of packets with stream ID.
+ *
+ * \return 0, or a negative number if error.
+ */
+static int32_t write_streams(int fd, uint64_t n, uint64_t n_streams) {
+    const uint64_t offset_streams = sizeof(struct index_header) + n * sizeof(struct vrt_index_entry);
+    const uint64_t size           = offset_streams + n_streams * sizeof(struct vrt_index_stream_entry);
+    if (size > SIZE_MAX || ftruncate(fd, (off_t)size) != 0) {
+        return VRT_ERR_FILE;
+    }
+
+    /* Sort in the mapping, so the table doesn't have to fit in memory at once */
+    void* map = mmap(NULL, (size_t)size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (map == MAP_FAILED) {
+        return VRT_ERR_FILE;
+    }
+    const struct vrt_index_entry* entries =
+        (const struct vrt_index_entry*)((const char*)map + sizeof(struct index_header));
+    struct vrt_index_stream_entry* streams = (struct vrt_index_stream_entry*)((char*)map + offset_streams);
+    uint64_t                       j       = 0;
+    for (uint64_t i = 0; i < n; ++i) {
+        if (entry_has_stream_id(&entries[i])) {
+            streams[j].stream_id = entries[i].stream_id;
+            streams[j].reserved  = 0;
+            streams[j].packet    = i;
+            j += 1;
+        }
+    }
+    qsort(streams, (size_t)n_streams, sizeof(struct vrt_index_stream_entry), compare_stream_entries);
+
+    struct index_header* header = (struct index_header*)map;
+    memcpy(header->magic, MAGIC, sizeof(MAGIC));
+    header->version    = VRT_INDEX_VERSION;
+    header->byte_order = BYTE_ORDER_MARK;
+    header->n          = n;
+    header->n_streams  = n_streams;
+
+    return munmap(map, (size_t)size) == 0 ? 0 : VRT_ERR_FILE;
+}
+#endif
+
+/**
+ * Scan recording file and write an index file for it.
+ *
+ * \param recording_path Path of recording file.
+ * \param index_path     Path of index file to write.
+ * \param be             True if recording is in network byte order.
+ *
+ * \return 0, or a negative number if error.
+ */
+static int32_t build_index(const char* recording_path, const char* index_path, bool be) {
+#if VRT_HAS_MMAP
+    struct vrt_file_reader reader;
+    int32_t                rv = vrt_open_file_reader(&reader, recording_path, 0);
+    if (rv < 0) {
+        return rv;
+    }
+    int fd = open(index_path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        vrt_close_file_reader(&reader);
+        return VRT_ERR_FILE;
+    }
+
+    uint64_t n         = 0;
+    uint64_t n_streams = 0;
+    rv                 = write_entries(&reader, fd, be, &n, &n_streams);
+    vrt_close_file_reader(&reader);
+    if (rv >= 0) {
+        rv = write_streams(fd, n, n_streams);
+    }
+    if (close(fd) != 0 && rv >= 0) {
+        rv = VRT_ERR_FILE;
+    }
+
+    return rv;
+#else
+    (void)recording_path;
+    (void)index_path;
+    (void)be;
+    return VRT_ERR_FILE;
+#endif
+}
+
+int32_t vrt_build_index(const char* recording_path, const char* index_path) {
+    return build_index(recording_path, index_path, false);
+}
+
+int32_t vrt_build_index_be(const char* recording_path, const char* index_path) {
+    return build_index(recording_path, index_path, true);
+}
+
+int32_t vrt_open_index(struct vrt_index* index, const char* path) {
+    index->map       = NULL;
+    index->map_size  = 0;
+    index->entries   = NULL;
+    index->n         = 0;
+    index->streams   = NULL;
+    index->n_streams = 0;
+
+#if VRT_HAS_MMAP
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return VRT_ERR_FILE;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        (void)close(fd);
+        return VRT_ERR_FILE;
+    }
+    const uint64_t size = (uint64_t)st.st_size;
+    if (size < sizeof(struct index_header)) {
+        (void)close(fd);
+        return VRT_ERR_INDEX_FORMAT;
+    }
+    if (size > SIZE_MAX) {
+        (void)close(fd);
+        return VRT_ERR_FILE;
+    }
+    void* map = mmap(NULL, (size_t)size, PROT_READ, MAP_SHARED, fd, 0);
+    /* Mapping stays valid after close */
+    (void)close(fd);
+    if (map == MAP_FAILED) {
+        return VRT_ERR_FILE;
+    }
+
+    const struct index_header* header = (const struct index_header*)map;
+    /* Sizes are checked by division, since the counts of a corrupt file may overflow when multiplied */
+    const uint64_t body = size - sizeof(struct index_header);
+    if (memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0 || header->version != VRT_INDEX_VERSION ||
+        header->byte_order != BYTE_ORDER_MARK || header->n > body / sizeof(struct vrt_index_entry) ||
+        header->n_streams > header->n ||
+        body - header->n * sizeof(struct vrt_index_entry) !=
+            header->n_streams * sizeof(struct vrt_index_stream_entry)) {
+        (void)munmap(map, (size_t)size);
+        return VRT_ERR_INDEX_FORMAT;
+    }
+
+    (void)madvise(map, (size_t)size, MADV_RANDOM);
+
+    index->map       = map;
+    index->map_size  = size;
+    index->entries   = (const struct vrt_index_entry*)((const char*)map + sizeof(struct index_header));
+    index->n         = header->n;
+    index->streams   = (const struct vrt_index_stream_entry*)(index->entries + header->n);
+    index->n_streams = header->n_streams;
+
+    return 0;
+#else
+    (void)path;
+    return VRT_ERR_FILE;
+#endif
+}
+
+void vrt_close_index(struct vrt_index* index) {
+#if VRT_HAS_MMAP
+    if (index->map != NULL) {
+        (void)munmap(index->map, (size_t)index->map_size);
+    }
+#endif
+    index->map       = NULL;
+    index->map_size  = 0;
+    index->entries   = NULL;
+    index->n         = 0;
+    index->streams   = NULL;
+    index->n_streams = 0;
+}
+
+const struct vrt_index_entry* vrt_index_packet(const struct vrt_index* index, uint64_t packet) {
+    return packet < index->n ? &index->entries[packet] : NULL;
+}
+
+uint64_t vrt_index_stream(const struct vrt_index*               index,
+                          uint32_t                              stream_id,
+                          const struct vrt_index_stream_entry** packets) {
+    /* Lower bound of stream ID */
+    uint64_t lo = 0;
+    uint64_t hi = index->n_streams;
+    while (lo < hi) {
+        uint64_t mid = lo + (hi - lo) / 2;
+        if (index->streams[mid].stream_id < stream_id) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    const uint64_t first = lo;
+
+    /* Upper bound of stream ID */
+    hi = index->n_streams;
+    while (lo < hi) {
+        uint64_t mid = lo + (hi - lo) / 2;
+        if (index->streams[mid].stream_id <= stream_id) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    *packets = lo > first ? &index->streams[first] : NULL;
+    return lo - first;
+}
+
+/**
+ * Convert timestamp of indexed packet to seconds and picoseconds.
+ *
+ * \param entry       Packet.
+ * \param sample_rate Sample rate [Hz]. Truncated to an integer.
+ * \param t           Time [out].
+ *
+ * \return 0, or a negative number if error.
+ */
+static int32_t entry_time(const struct vrt_index_entry* entry, double sample_rate, struct vrt_time_index_block* t) {
+    const uint64_t s  = entry->tsi != VRT_TSI_NONE ? entry->integer_seconds_timestamp : 0;
+    const uint64_t fs = entry->fractional_seconds_timestamp;
+    switch ((enum vrt_tsf)entry->tsf) {
+        case VRT_TSF_NONE: {
+            if (entry->tsi == VRT_TSI_NONE) {
+                return VRT_ERR_EXPECTED_FIELD;
+            }
+            t->s  = s;
+            t->ps = 0;
+            break;
+        }
+        case VRT_TSF_SAMPLE_COUNT: {
+            if (sample_rate < 1.0) {
+                return VRT_ERR_MISSING_SAMPLE_RATE;
+            }
+            const uint64_t rate = (uint64_t)sample_rate;
+            if (fs >= rate) {
+                return VRT_ERR_BOUNDS_SAMPLE_COUNT;
+            }
+            t->s  = s;
+            t->ps = (uint64_t)((double)fs / (double)rate * PS_IN_S);
+            break;
+        }
+        case VRT_TSF_REAL_TIME: {
+            if (fs >= PS_IN_S) {
+                return VRT_ERR_BOUNDS_REAL_TIME;
+            }
+            t->s  = s;
+            t->ps = fs;
+            break;
+        }
+        case VRT_TSF_FREE_RUNNING_COUNT: {
+            if (sample_rate < 1.0) {
+                return VRT_ERR_MISSING_SAMPLE_RATE;
+            }
+            /* Ignore integer timestamp here since it is less precise */
+            const uint64_t rate = (uint64_t)sample_rate;
+
+            t->s  = fs / rate;
+            t->ps = (uint64_t)((double)(fs % rate) / (double)rate * PS_IN_S);
+            break;
+        }
+        default: {
+            return VRT_ERR_INVALID_TSF;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * Check if a time is before another time.
+ *
+ * \param a Time.
+ * \param b Time.
+ *
+ * \return True if a is before b.
+ */
+static bool is_before(const struct vrt_time_index_block* a, const struct vrt_time_index_block* b) {
+    return a->s < b->s || (a->s == b->s && a->ps < b->ps);
+}
+
+int32_t vrt_init_time_index(struct vrt_time_index*       time_index,
+                            const struct vrt_index*      index,
+                            uint32_t                     stream_id,
+                            double                       sample_rate,
+                            struct vrt_time_index_block* blocks,
+                            uint64_t                     capacity) {
+    if (capacity == 0) {
+        return VRT_ERR_INVALID_CAPACITY;
+    }
+
+    time_index->index       = index;
+    time_index->n           = vrt_index_stream(index, stream_id, &time_index->packets);
+    time_index->stride      = (time_index->n + capacity - 1) / capacity;
+    time_index->blocks      = blocks;
+    time_index->n_blocks    = 0;
+    time_index->sample_rate = sample_rate;
+    if (time_index->stride == 0) {
+        time_index->stride = 1;
+    }
+
+    for (uint64_t i = 0; i < time_index->n; i += time_index->stride) {
+        const struct vrt_index_entry* e  = &index->entries[time_index->packets[i].packet];
+        int32_t                       rv = entry_time(e, sample_rate, &blocks[time_index->n_blocks]);
+        if (rv < 0) {
+            return rv;
+        }
+        time_index->n_blocks += 1;
+    }
+
+    return 0;
+}
+
+int32_t vrt_seek_time_index(const struct vrt_time_index* time_index, const struct vrt_time* t, uint64_t* packet) {
+    /* All packets are at or after a negative time */
+    if (t->s < 0) {
+        *packet = 0;
+        return 0;
+    }
+    const struct vrt_time_index_block target = {(uint64_t)t->s, t->ps};
+
+    /* First block that starts at or after target */
+    uint64_t lo = 0;
+    uint64_t hi = time_index->n_blocks;
+    while (lo < hi) {
+        uint64_t mid = lo + (hi - lo) / 2;
+        if (is_before(&time_index->blocks[mid], &target)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo == 0) {
+        *packet = 0;
+        return 0;
+    }
+
+    /* Packet is in the block before it, or it is the first packet of that block */
+    const uint64_t begin = (lo - 1) * time_index->stride;
+    uint64_t       end   = begin + time_index->stride;
+    if (end > time_index->n) {
+        end = time_index->n;
+    }
+    for (uint64_t i = begin + 1; i < end; ++i) {
+        const struct vrt_index_entry* e = &time_index->index->entries[time_index->packets[i].packet];
+        struct vrt_time_index_block   b;
+        int32_t                       rv = entry_time(e, time_index->sample_rate, &b);
+        if (rv < 0) {
+            return rv;
+        }
+        if (!is_before(&b, &target)) {
+            *packet = i;
+            return 0;
+        }
+    }
+    *packet = end;
+
+    return 0;
+}
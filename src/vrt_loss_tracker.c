@@ -0,0 +1,149 @@
+#include "vrt/vrt_loss_tracker.h"
+
+#include "vrt/vrt_types.h"
+
+#include "vrt_util_internal.h"
+
+#include <stdint.h>
+
+/**
+ * Number of picoseconds in a second.
+ */
+static const int64_t PS_IN_S = 1000000000000;
+
+void vrt_init_loss_tracker(struct vrt_loss_tracker* tracker, double sample_rate, uint32_t samples_per_packet) {
+    tracker->received                     = 0;
+    tracker->lost                         = 0;
+    tracker->duplicated                   = 0;
+    tracker->reordered                    = 0;
+    tracker->step                         = 0;
+    tracker->units_per_second             = 0;
+    tracker->sample_rate                  = sample_rate >= 1.0 ? (uint64_t)sample_rate : 0;
+    tracker->samples_per_packet           = samples_per_packet;
+    tracker->integer_seconds_timestamp    = 0;
+    tracker->fractional_seconds_timestamp = 0;
+    tracker->packet_count                 = 0;
+    tracker->lost_packets                 = 0;
+    tracker->started                      = false;
+}
+
+/**
+ * Set nominal packet duration from timestamp types of the first packet.
+ *
+ * \param tracker Tracker.
+ * \param header  Header of first packet.
+ */
+static void init_step(struct vrt_loss_tracker* tracker, const struct vrt_header* header) {
+    tracker->step             = 0;
+    tracker->units_per_second = 0;
+    if (tracker->samples_per_packet == 0) {
+        return;
+    }
+    switch (header->tsf) {
+        case VRT_TSF_SAMPLE_COUNT: {
+            if (header->tsi != VRT_TSI_NONE && tracker->sample_rate != 0) {
+                tracker->step             = tracker->samples_per_packet;
+                tracker->units_per_second = (int64_t)tracker->sample_rate;
+            }
+            break;
+        }
+        case VRT_TSF_REAL_TIME: {
+            if (header->tsi != VRT_TSI_NONE && tracker->sample_rate != 0) {
+                /* Rounding is fine, since the estimate is snapped to the packet count anyway */
+                const double ps_per_sample = (double)PS_IN_S / (double)tracker->sample_rate;
+                tracker->step              = (int64_t)(ps_per_sample * tracker->samples_per_packet);
+                tracker->units_per_second  = PS_IN_S;
+            }
+            break;
+        }
+        case VRT_TSF_FREE_RUNNING_COUNT: {
+            tracker->step = tracker->samples_per_packet;
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+}
+
+/**
+ * Save packet as the last one in order.
+ *
+ * \param tracker Tracker.
+ * \param header  Header of packet.
+ * \param fields  Fields of packet.
+ */
+static inline void save(struct vrt_loss_tracker* tracker,
+                        const struct vrt_header* header,
+                        const struct vrt_fields* fields) {
+    tracker->packet_count                 = header->packet_count & 0x0FU;
+    tracker->integer_seconds_timestamp    = fields->integer_seconds_timestamp;
+    tracker->fractional_seconds_timestamp = fields->fractional_seconds_timestamp;
+}
+
+void vrt_update_loss_tracker(struct vrt_loss_tracker* tracker,
+                             const struct vrt_header* header,
+                             const struct vrt_fields* fields) {
+    tracker->received += 1;
+    if (!tracker->started) {
+        tracker->started = true;
+        init_step(tracker, header);
+        save(tracker, header, fields);
+        return;
+    }
+
+    /* Number of packets since last one in order, modulo 16 */
+    const uint32_t d = vrt_packet_count_delta(header->packet_count, tracker->packet_count);
+
+    /* Number of packets since last one in order, or negative if out of order */
+    int64_t n = 0;
+    if (tracker->step != 0) {
+        int64_t dt = (int64_t)(fields->fractional_seconds_timestamp - tracker->fractional_seconds_timestamp);
+        if (tracker->units_per_second != 0) {
+            dt += (int64_t)(int32_t)(fields->integer_seconds_timestamp - tracker->integer_seconds_timestamp) *
+                  tracker->units_per_second;
+        }
+        if (dt < 0) {
+            n = -1;
+        } else {
+            /* Snap estimate from timestamps to the nearest number of packets that agrees with packet count */
+            const int64_t estimate = (dt + tracker->step / 2) / tracker->step;
+            const int64_t k        = estimate >= (int64_t)d ? (estimate - (int64_t)d + 8) / 16 : 0;
+            n                      = (int64_t)d + 16 * k;
+        }
+    } else {
+        n = vrt_packet_count_distance(header->packet_count, tracker->packet_count);
+    }
+
+    if (n < 0) {
+        /* Only a packet counted as lost may arrive late. Anything else has already been received. */
+        const uint32_t behind = vrt_packet_count_delta(tracker->packet_count, header->packet_count);
+        const uint32_t bit    = behind - 1;
+        if (behind != 0 && behind <= VRT_REORDER_WINDOW && (tracker->lost_packets & (1U << bit)) != 0) {
+            tracker->lost_packets &= (uint8_t)~(1U << bit);
+            tracker->lost -= 1;
+            tracker->reordered += 1;
+        } else {
+            tracker->duplicated += 1;
+        }
+        return;
+    }
+    if (n == 0) {
+        tracker->duplicated += 1;
+        return;
+    }
+    tracker->lost += (uint64_t)(n - 1);
+    /* Move the window, where the last packet in order is now n packets behind, and the n - 1 before it are lost */
+    tracker->lost_packets = n > (int64_t)VRT_REORDER_WINDOW
+                                ? 0xFFU
+                                : (uint8_t)(((uint32_t)tracker->lost_packets << n) | ((1U << (n - 1)) - 1));
+    save(tracker, header, fields);
+}
+
+void vrt_update_loss_tracker_packets(struct vrt_loss_tracker*            tracker,
+                                     const struct vrt_packet_descriptor* descriptors,
+                                     int32_t                             n) {
+    for (int32_t i = 0; i < n; ++i) {
+        vrt_update_loss_tracker(tracker, &descriptors[i].header, &descriptors[i].fields);
+    }
+}
@@ -0,0 +1,19 @@
+#ifndef SRC_VRT_MMAP_H_
+#define SRC_VRT_MMAP_H_
+
+/*
+ * Memory mapped file support, which is only available on POSIX platforms. Translation units should define
+ * _FILE_OFFSET_BITS to 64 before any include, so that large files work on 32-bit platforms as well.
+ */
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#define VRT_HAS_MMAP 1
+#else
+#define VRT_HAS_MMAP 0
+#endif
+
+#endif
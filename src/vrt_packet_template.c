@@ -0,0 +1,201 @@
+#include "vrt/vrt_packet_template.h"
+
+#include "vrt/vrt_bits.h"
+#include "vrt/vrt_error_code.h"
+#include "vrt/vrt_types.h"
+#include "vrt/vrt_util.h"
+#include "vrt/vrt_words.h"
+#include "vrt/vrt_write.h"
+
+#include "vrt_util_internal.h"
+
+#include <string.h>
+
+/**
+ * Compile packet template, with optional byte swapping of written words.
+ *
+ * \param header   Header.
+ * \param fields   Fields.
+ * \param trailer  Trailer.
+ * \param tmpl     Template to compile into.
+ * \param validate Level of validation.
+ * \param swap     True if words shall be byte swapped when written.
+ *
+ * \return Number of words the template adds to each packet, or a negative number if error.
+ */
+static VRT_INTERNAL_FORCE_INLINE int32_t compile_packet_template(const struct vrt_header*    header,
+                                                                 const struct vrt_fields*    fields,
+                                                                 const struct vrt_trailer*   trailer,
+                                                                 struct vrt_packet_template* tmpl,
+                                                                 enum vrt_validation         validate,
+                                                                 bool                        swap) {
+    /* Timestamps and packet size are patched in when writing, so don't let them affect validation */
+    struct vrt_header h = *header;
+    struct vrt_fields f = *fields;
+
+    h.packet_size                  = 0;
+    f.integer_seconds_timestamp    = 0;
+    f.fractional_seconds_timestamp = 0;
+
+    memset(tmpl->words, 0, sizeof(tmpl->words));
+    int32_t rv = vrt_write_header(&h, tmpl->words, 1, validate);
+    if (rv < 0) {
+        return rv;
+    }
+    /* Packets are patched as data packets when writing, and the type is only known to be in bounds from here */
+    if ((uint32_t)h.packet_type > VRT_PT_EXT_DATA_WITH_STREAM_ID) {
+        return VRT_ERR_EXPECTED_DATA_PACKET;
+    }
+
+    const int32_t words_fields = vrt_words_fields(&h);
+    rv = vrt_write_fields(&h, &f, tmpl->words + 1, words_fields, validate);
+    if (rv < 0) {
+        return rv;
+    }
+
+    tmpl->trailer     = 0;
+    tmpl->has_trailer = h.has.trailer;
+    if (tmpl->has_trailer) {
+        rv = vrt_write_trailer(trailer, &tmpl->trailer, 1, validate);
+        if (rv < 0) {
+            return rv;
+        }
+    }
+
+    /* Locate timestamps, which always are the last words of the fields section */
+    int32_t offset = 1 + words_fields;
+    if (vrt_internal_has_fractional_timestamp(h.tsf)) {
+        offset -= 2;
+        tmpl->offset_fractional_seconds_timestamp = offset;
+    } else {
+        tmpl->offset_fractional_seconds_timestamp = 0;
+    }
+    if (h.tsi != VRT_TSI_NONE) {
+        offset -= 1;
+        tmpl->offset_integer_seconds_timestamp = offset;
+    } else {
+        tmpl->offset_integer_seconds_timestamp = 0;
+    }
+
+    tmpl->words_prefix = 1 + words_fields;
+    tmpl->swap         = swap;
+    tmpl->packet_count = h.packet_count & 0x0FU;
+
+    return tmpl->words_prefix + vrt_words_trailer(&h);
+}
+
+int32_t vrt_compile_packet_template(const struct vrt_header*    header,
+                                    const struct vrt_fields*    fields,
+                                    const struct vrt_trailer*   trailer,
+                                    struct vrt_packet_template* tmpl,
+                                    enum vrt_validation         validate) {
+    return compile_packet_template(header, fields, trailer, tmpl, validate, false);
+}
+
+int32_t vrt_compile_packet_template_be(const struct vrt_header*    header,
+                                       const struct vrt_fields*    fields,
+                                       const struct vrt_trailer*   trailer,
+                                       struct vrt_packet_template* tmpl,
+                                       enum vrt_validation         validate) {
+    return compile_packet_template(header, fields, trailer, tmpl, validate, VRT_INTERNAL_NETWORK_ORDER_SWAP);
+}
+
+/**
+ * Write header, fields, and trailer words of a packet from a template, and increment its packet count.
+ *
+ * \param tmpl                         Template to write from.
+ * \param integer_seconds_timestamp    Integer seconds timestamp.
+ * \param fractional_seconds_timestamp Fractional seconds timestamp.
+ * \param words                        Number of 32-bit words in packet.
+ * \param prefix                       Buffer to write header and fields section to.
+ * \param trailer                      Buffer to write trailer to, if any.
+ */
+static void write_parts(struct vrt_packet_template* tmpl,
+                        uint32_t                    integer_seconds_timestamp,
+                        uint64_t                    fractional_seconds_timestamp,
+                        int32_t                     words,
+                        uint32_t*                   prefix,
+                        uint32_t*                   trailer) {
+    /* Patch a local copy, so the words can be stored with byte swapping in one pass */
+    uint32_t w[7];
+    memcpy(w, tmpl->words, sizeof(w));
+    w[0] = vrt_set_bits(w[0], VRT_BITS_HEADER_PACKET_COUNT, tmpl->packet_count);
+    w[0] = vrt_set_bits(w[0], VRT_BITS_HEADER_PACKET_SIZE, (uint32_t)words);
+    if (tmpl->offset_integer_seconds_timestamp != 0) {
+        w[tmpl->offset_integer_seconds_timestamp] = integer_seconds_timestamp;
+    }
+    if (tmpl->offset_fractional_seconds_timestamp != 0) {
+        w[tmpl->offset_fractional_seconds_timestamp]     = (uint32_t)(fractional_seconds_timestamp >> 32U);
+        w[tmpl->offset_fractional_seconds_timestamp + 1] = (uint32_t)fractional_seconds_timestamp;
+    }
+
+    for (int32_t i = 0; i < tmpl->words_prefix; ++i) {
+        vrt_internal_store(w[i], prefix + i, tmpl->swap);
+    }
+    if (tmpl->has_trailer) {
+        vrt_internal_store(tmpl->trailer, trailer, tmpl->swap);
+    }
+
+    tmpl->packet_count = (tmpl->packet_count + 1U) & 0x0FU;
+}
+
+/**
+ * Compute number of words in a packet from a template.
+ *
+ * \param tmpl       Template.
+ * \param words_body Number of 32-bit words in body.
+ *
+ * \return Number of 32-bit words in packet, or a negative number if error.
+ */
+static int32_t words_packet(const struct vrt_packet_template* tmpl, int32_t words_body) {
+    if (words_body < 0) {
+        return VRT_ERR_BOUNDS_PACKET_SIZE;
+    }
+    const int32_t words_trailer = tmpl->has_trailer ? 1 : 0;
+    const int32_t words         = tmpl->words_prefix + words_body + words_trailer;
+    if (words > 0xFFFF) {
+        return VRT_ERR_BOUNDS_PACKET_SIZE;
+    }
+    return words;
+}
+
+int32_t vrt_write_packet_template(struct vrt_packet_template* tmpl,
+                                  uint32_t                    integer_seconds_timestamp,
+                                  uint64_t                    fractional_seconds_timestamp,
+                                  const void*                 body,
+                                  int32_t                     words_body,
+                                  void*                       buf,
+                                  int32_t                     words_buf) {
+    const int32_t words = words_packet(tmpl, words_body);
+    if (words < 0) {
+        return words;
+    }
+    if (words_buf < words) {
+        return VRT_ERR_BUFFER_SIZE;
+    }
+
+    uint32_t* b = (uint32_t*)buf;
+    if (body != NULL) {
+        memcpy(b + tmpl->words_prefix, body, (size_t)words_body * sizeof(uint32_t));
+    }
+    write_parts(tmpl, integer_seconds_timestamp, fractional_seconds_timestamp, words, b,
+                b + tmpl->words_prefix + words_body);
+
+    return words;
+}
+
+int32_t vrt_write_packet_template_parts(struct vrt_packet_template* tmpl,
+                                        uint32_t                    integer_seconds_timestamp,
+                                        uint64_t                    fractional_seconds_timestamp,
+                                        int32_t                     words_body,
+                                        void*                       prefix,
+                                        void*                       trailer) {
+    const int32_t words = words_packet(tmpl, words_body);
+    if (words < 0) {
+        return words;
+    }
+    write_parts(tmpl, integer_seconds_timestamp, fractional_seconds_timestamp, words, (uint32_t*)prefix,
+                (uint32_t*)trailer);
+
+    return words;
+}
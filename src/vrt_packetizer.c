@@ -0,0 +1,296 @@
+#include "vrt/vrt_packetizer.h"
+
+#include "vrt/vrt_convert.h"
+#include "vrt/vrt_error_code.h"
+#include "vrt/vrt_packet_template.h"
+#include "vrt/vrt_sequencer.h"
+#include "vrt/vrt_types.h"
+#include "vrt/vrt_util.h"
+#include "vrt/vrt_words.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Greatest common divisor.
+ *
+ * \param a Positive number.
+ * \param b Positive number.
+ *
+ * \return Greatest common divisor.
+ */
+static int32_t gcd(int32_t a, int32_t b) {
+    while (b != 0) {
+        const int32_t t = a % b;
+        a               = b;
+        b               = t;
+    }
+    return a;
+}
+
+/**
+ * Compute number of words n packed items take up, including padding of the last word.
+ *
+ * \param c Converter.
+ * \param n Number of items.
+ *
+ * \return Number of words.
+ */
+static int32_t words_items(const struct vrt_converter* c, int32_t n) {
+    if (c->link_efficient) {
+        return (int32_t)(((int64_t)n * c->field_size + 31) / 32);
+    }
+    if (c->field_size > 32) {
+        return 2 * n;
+    }
+    const int32_t per_word = 32 / c->field_size;
+    return (n + per_word - 1) / per_word;
+}
+
+/**
+ * Initialize packetizer, with sequencer initialized in platform or network byte order.
+ *
+ * \param header       Header.
+ * \param fields       Fields.
+ * \param trailer      Trailer.
+ * \param format       Payload format.
+ * \param scale        Factor each item is multiplied with when read.
+ * \param sample_rate  Sample rate [Hz].
+ * \param words_packet Maximum number of 32-bit words in each packet.
+ * \param p            Packetizer.
+ * \param validate     Level of validation.
+ * \param be           True if packets shall be written in network byte order.
+ *
+ * \return Number of samples in each packet, or a negative number if error.
+ */
+static int32_t init_packetizer(const struct vrt_header*                     header,
+                               const struct vrt_fields*                     fields,
+                               const struct vrt_trailer*                    trailer,
+                               const struct vrt_data_packet_payload_format* format,
+                               float                                        scale,
+                               double                                       sample_rate,
+                               int32_t                                      words_packet,
+                               struct vrt_packetizer*                       p,
+                               enum vrt_validation                          validate,
+                               bool                                         be) {
+    int32_t rv = vrt_init_converter(&p->converter, format, scale);
+    if (rv < 0) {
+        return rv;
+    }
+    const struct vrt_converter* c = &p->converter;
+
+    /*
+     * Packets are made up of blocks, i.e. the fewest words that hold a whole number of samples without padding, so that
+     * a body packed in one go can be split anywhere between blocks.
+     */
+    const int32_t ips           = format->real_or_complex == VRT_ROC_REAL ? 1 : 2;
+    int32_t       block_words   = 0;
+    int32_t       block_samples = 0;
+    if (c->link_efficient) {
+        const int32_t bits = ips * c->field_size;
+        const int32_t g    = gcd(32, bits);
+        block_words        = bits / g;
+        block_samples      = 32 / g;
+    } else if (c->field_size > 32) {
+        block_words   = 2 * ips;
+        block_samples = 1;
+    } else {
+        const int32_t per_word     = 32 / c->field_size;
+        const int32_t fields_block = per_word / gcd(per_word, ips) * ips;
+        block_words                = fields_block / per_word;
+        block_samples              = fields_block / ips;
+    }
+
+    const int32_t words_overhead = 1 + vrt_words_fields(header) + vrt_words_trailer(header);
+    if (words_packet > 0xFFFF) {
+        words_packet = 0xFFFF;
+    }
+    const int32_t blocks = (words_packet - words_overhead) / block_words;
+    if (words_packet < words_overhead || blocks < 1) {
+        return VRT_ERR_BOUNDS_PACKET_SIZE;
+    }
+
+    p->items_per_sample   = ips;
+    p->samples_per_packet = blocks * block_samples;
+    p->words_body         = blocks * block_words;
+
+    if (be) {
+        rv = vrt_init_sequencer_be(header, fields, trailer, sample_rate, (uint32_t)p->samples_per_packet, &p->seq,
+                                   validate);
+    } else {
+        rv = vrt_init_sequencer(header, fields, trailer, sample_rate, (uint32_t)p->samples_per_packet, &p->seq,
+                                validate);
+    }
+    if (rv < 0) {
+        return rv;
+    }
+    p->words_overhead = rv;
+
+    return p->samples_per_packet;
+}
+
+int32_t vrt_init_packetizer(const struct vrt_header*                     header,
+                            const struct vrt_fields*                     fields,
+                            const struct vrt_trailer*                    trailer,
+                            const struct vrt_data_packet_payload_format* format,
+                            float                                        scale,
+                            double                                       sample_rate,
+                            int32_t                                      words_packet,
+                            struct vrt_packetizer*                       packetizer,
+                            enum vrt_validation                          validate) {
+    return init_packetizer(header, fields, trailer, format, scale, sample_rate, words_packet, packetizer, validate,
+                           false);
+}
+
+int32_t vrt_init_packetizer_be(const struct vrt_header*                     header,
+                               const struct vrt_fields*                     fields,
+                               const struct vrt_trailer*                    trailer,
+                               const struct vrt_data_packet_payload_format* format,
+                               float                                        scale,
+                               double                                       sample_rate,
+                               int32_t                                      words_packet,
+                               struct vrt_packetizer*                       packetizer,
+                               enum vrt_validation                          validate) {
+    return init_packetizer(header, fields, trailer, format, scale, sample_rate, words_packet, packetizer, validate,
+                           true);
+}
+
+/**
+ * Split a burst into packets.
+ *
+ * \param p          Packetizer.
+ * \param n          Number of items.
+ * \param full       Number of full packets.
+ * \param rest       Number of samples in the last, shorter, packet, or 0 if there is none.
+ * \param words_rest Number of body words in the last, shorter, packet.
+ *
+ * \return 0, or a negative number if error.
+ */
+static int32_t split(const struct vrt_packetizer* p, int32_t n, int32_t* full, int32_t* rest, int32_t* words_rest) {
+    if (n < 0 || n % p->items_per_sample != 0) {
+        return VRT_ERR_PARTIAL_SAMPLE;
+    }
+    const int32_t samples = n / p->items_per_sample;
+
+    *full       = samples / p->samples_per_packet;
+    *rest       = samples % p->samples_per_packet;
+    *words_rest = words_items(&p->converter, *rest * p->items_per_sample);
+    return 0;
+}
+
+int32_t vrt_packetize_float(struct vrt_packetizer* packetizer,
+                            const float*           src,
+                            int32_t                n,
+                            void*                  buf,
+                            int32_t                words_buf) {
+    int32_t full       = 0;
+    int32_t rest       = 0;
+    int32_t words_rest = 0;
+    int32_t rv         = split(packetizer, n, &full, &rest, &words_rest);
+    if (rv < 0) {
+        return rv;
+    }
+
+    /* Check size up front, so that nothing is written if it doesn't fit */
+    const int32_t words_full  = packetizer->words_overhead + packetizer->words_body;
+    const int64_t words_total = (int64_t)full * words_full + (rest != 0 ? packetizer->words_overhead + words_rest : 0);
+    if (words_total > words_buf) {
+        return VRT_ERR_BUFFER_SIZE;
+    }
+
+    struct vrt_sequencer* seq          = &packetizer->seq;
+    const int32_t         words_prefix = seq->tmpl.words_prefix;
+    const int32_t         items_full   = packetizer->samples_per_packet * packetizer->items_per_sample;
+    const bool            swap         = seq->tmpl.swap;
+
+    uint32_t* b = (uint32_t*)buf;
+    for (int32_t i = 0; i < full; ++i) {
+        /* Convert into place first, so the template only writes header, fields, and trailer around it */
+        rv = swap ? vrt_convert_from_float_be(&packetizer->converter, src, items_full, b + words_prefix,
+                                              packetizer->words_body)
+                  : vrt_convert_from_float(&packetizer->converter, src, items_full, b + words_prefix,
+                                           packetizer->words_body);
+        if (rv < 0) {
+            return rv;
+        }
+        rv = vrt_write_sequenced_packet(seq, NULL, packetizer->words_body, b, words_full);
+        if (rv < 0) {
+            return rv;
+        }
+        src += items_full;
+        b += words_full;
+    }
+
+    if (rest != 0) {
+        const int32_t items_rest = rest * packetizer->items_per_sample;
+        rv = swap ? vrt_convert_from_float_be(&packetizer->converter, src, items_rest, b + words_prefix, words_rest)
+                  : vrt_convert_from_float(&packetizer->converter, src, items_rest, b + words_prefix, words_rest);
+        if (rv < 0) {
+            return rv;
+        }
+        rv = vrt_write_packet_template(&seq->tmpl, seq->integer_seconds_timestamp, seq->fractional_seconds_timestamp,
+                                       NULL, words_rest, b, packetizer->words_overhead + words_rest);
+        if (rv < 0) {
+            return rv;
+        }
+        vrt_advance_sequencer(seq, (uint32_t)rest);
+    }
+
+    return (int32_t)words_total;
+}
+
+int32_t vrt_packetize_iov(struct vrt_packetizer* packetizer,
+                          const void*            body,
+                          int32_t                n,
+                          void*                  parts,
+                          int32_t                words_parts,
+                          struct vrt_iovec*      iov,
+                          int32_t                n_iov) {
+    int32_t full       = 0;
+    int32_t rest       = 0;
+    int32_t words_rest = 0;
+    int32_t rv         = split(packetizer, n, &full, &rest, &words_rest);
+    if (rv < 0) {
+        return rv;
+    }
+
+    struct vrt_sequencer* seq          = &packetizer->seq;
+    const int32_t         words_prefix = seq->tmpl.words_prefix;
+    const int32_t         iov_packet   = seq->tmpl.has_trailer ? 3 : 2;
+    const int64_t         packets      = (int64_t)full + (rest != 0 ? 1 : 0);
+    if (packets * packetizer->words_overhead > words_parts || packets * iov_packet > n_iov) {
+        return VRT_ERR_BUFFER_SIZE;
+    }
+
+    const uint32_t* src = (const uint32_t*)body;
+    uint32_t*       dst = (uint32_t*)parts;
+    for (int64_t i = 0; i < packets; ++i) {
+        const bool    last       = i == full;
+        const int32_t words_body = last ? words_rest : packetizer->words_body;
+
+        rv = vrt_write_packet_template_parts(&seq->tmpl, seq->integer_seconds_timestamp,
+                                             seq->fractional_seconds_timestamp, words_body, dst,
+                                             dst + words_prefix);
+        if (rv < 0) {
+            return rv;
+        }
+        vrt_advance_sequencer(seq, last ? (uint32_t)rest : (uint32_t)packetizer->samples_per_packet);
+
+        /* Body words are only read by the caller, so casting away const is fine */
+        iov[0].iov_base = dst;
+        iov[0].iov_len  = (size_t)words_prefix * sizeof(uint32_t);
+        iov[1].iov_base = (void*)(uintptr_t)src;
+        iov[1].iov_len  = (size_t)words_body * sizeof(uint32_t);
+        if (seq->tmpl.has_trailer) {
+            iov[2].iov_base = dst + words_prefix;
+            iov[2].iov_len  = sizeof(uint32_t);
+        }
+
+        src += words_body;
+        dst += packetizer->words_overhead;
+        iov += iov_packet;
+    }
+
+    return (int32_t)(packets * iov_packet);
+}
@@ -1,6 +1,9 @@
 #include "vrt/vrt_read.h"
 
+#include "vrt/vrt_bits.h"
 #include "vrt/vrt_error_code.h"
+#include "vrt/vrt_init.h"
+#include "vrt/vrt_read_inline.h"
 #include "vrt/vrt_types.h"
 #include "vrt/vrt_util.h"
 #include "vrt/vrt_words.h"
@@ -12,279 +15,93 @@
 #include <stddef.h>
 
 /**
- * Shift and mask a specified number of consecutive bits from a specified position in a word.
- *
- * \param val Word to read from.
- * \param pos Position of bits in word, starting from lsb.
- * \param n   Number of bits to mask.
- *
- * \return Value of shifted and masked bits.
+ * Same as vrt_internal_read_header_swap(), but compiled into a separate path for each validation level.
  */
-static inline uint32_t mskr(uint32_t val, uint32_t pos, uint32_t n) {
-    uint32_t mask = (1U << n) - 1;
-    return (val >> pos) & mask;
+static VRT_INTERNAL_FORCE_INLINE int32_t read_header_specialized(const void*         buf,
+                                                                 int32_t             words_buf,
+                                                                 struct vrt_header*  header,
+                                                                 enum vrt_validation validate,
+                                                                 bool                swap) {
+    switch (validate) {
+        case VRT_VALIDATION_NONE:
+            return vrt_internal_read_header_swap(buf, words_buf, header, VRT_VALIDATION_NONE, swap);
+        case VRT_VALIDATION_STRUCTURAL:
+            return vrt_internal_read_header_swap(buf, words_buf, header, VRT_VALIDATION_STRUCTURAL, swap);
+        default:
+            return vrt_internal_read_header_swap(buf, words_buf, header, VRT_VALIDATION_FULL, swap);
+    }
 }
 
-/**
- * Read uint64 from uint32 buffer by interpreting the first word as most significant.
- *
- * \param b Buffer to read from.
- *
- * \return uint64.
- */
-static inline uint64_t read_uint64(const uint32_t* b) {
-    return (uint64_t)b[0] << 32U | (uint64_t)b[1];
+int32_t vrt_read_header(const void* buf, int32_t words_buf, struct vrt_header* header, enum vrt_validation validate) {
+    return read_header_specialized(buf, words_buf, header, validate, false);
 }
 
-int32_t vrt_read_header(const void* buf, int32_t words_buf, struct vrt_header* header, bool validate) {
-    /* Note that it makes sense to have words_buf as signed, to avoid overflow for words_buf - offset */
-
-    /* Size is always 1 */
-    const int32_t words = 1;
-
-    /* Check if buf size is sufficient */
-    if (words_buf < words) {
-        return VRT_ERR_BUFFER_SIZE;
-    }
+int32_t vrt_read_header_be(const void*         buf,
+                           int32_t             words_buf,
+                           struct vrt_header*  header,
+                           enum vrt_validation validate) {
+    return read_header_specialized(buf, words_buf, header, validate, VRT_INTERNAL_NETWORK_ORDER_SWAP);
+}
 
-    /* Word in header section */
-    uint32_t b = *((const uint32_t*)buf);
-
-    /* Decode in order from msb to lsb */
-    header->packet_type  = (enum vrt_packet_type)mskr(b, 28, 4);
-    header->has.class_id = vrt_u2b(mskr(b, 27, 1));
-    header->has.trailer  = vrt_u2b(mskr(b, 26, 1));
-    header->tsm          = (enum vrt_tsm)mskr(b, 24, 1);
-    header->tsi          = (enum vrt_tsi)mskr(b, 22, 2);
-    header->tsf          = (enum vrt_tsf)mskr(b, 20, 2);
-    header->packet_count = (uint8_t)mskr(b, 16, 4);
-    header->packet_size  = (uint16_t)mskr(b, 0, 16);
-
-    if (validate) {
-        if (header->packet_type > VRT_PT_EXT_CONTEXT) {
-            return VRT_ERR_INVALID_PACKET_TYPE;
-        }
-        if (vrt_is_context(header)) {
-            if (header->has.trailer) {
-                return VRT_ERR_TRAILER_IN_CONTEXT;
-            }
-        } else {
-            if (header->tsm != VRT_TSM_FINE) {
-                return VRT_ERR_TSM_IN_DATA;
-            }
-        }
-        if ((b & 0x02000000U) != 0) {
-            return VRT_ERR_RESERVED;
-        }
+/**
+ * Same as vrt_internal_read_fields_swap(), but compiled into a separate path for each validation level.
+ */
+static VRT_INTERNAL_FORCE_INLINE int32_t read_fields_specialized(const struct vrt_header* header,
+                                                                 const void*              buf,
+                                                                 int32_t                  words_buf,
+                                                                 struct vrt_fields*       fields,
+                                                                 enum vrt_validation      validate,
+                                                                 bool                     swap) {
+    switch (validate) {
+        case VRT_VALIDATION_NONE:
+            return vrt_internal_read_fields_swap(header, buf, words_buf, fields, VRT_VALIDATION_NONE, swap);
+        case VRT_VALIDATION_STRUCTURAL:
+            return vrt_internal_read_fields_swap(header, buf, words_buf, fields, VRT_VALIDATION_STRUCTURAL, swap);
+        default:
+            return vrt_internal_read_fields_swap(header, buf, words_buf, fields, VRT_VALIDATION_FULL, swap);
     }
-
-    return words;
 }
 
 int32_t vrt_read_fields(const struct vrt_header* header,
                         const void*              buf,
                         int32_t                  words_buf,
                         struct vrt_fields*       fields,
-                        bool                     validate) {
-    const int32_t words = vrt_words_fields(header);
-
-    /* Check if buf size is sufficient */
-    if (words_buf < words) {
-        return VRT_ERR_BUFFER_SIZE;
-    }
-
-    const uint32_t* b = ((const uint32_t*)buf);
-
-    if (vrt_has_stream_id(header)) {
-        fields->stream_id = b[0];
-        b += 1;
-    } else {
-        /* Zero Stream ID here, just to be sure */
-        fields->stream_id = 0;
-    }
-
-    if (header->has.class_id) {
-        fields->class_id.oui                    = mskr(b[0], 0, 24);
-        fields->class_id.information_class_code = (uint16_t)mskr(b[1], 16, 16);
-        fields->class_id.packet_class_code      = (uint16_t)b[1];
-
-        if (validate) {
-            if ((b[0] & 0xFF000000U) != 0) {
-                return VRT_ERR_RESERVED;
-            }
-        }
-
-        b += 2;
-    } else {
-        /* Zero Class ID here, just to be sure */
-        fields->class_id.oui                    = 0;
-        fields->class_id.information_class_code = 0;
-        fields->class_id.packet_class_code      = 0;
-    }
-
-    if (header->tsi == VRT_TSI_NONE) {
-        /* Zero integer timestamp here, just to be sure */
-        fields->integer_seconds_timestamp = 0;
-    } else {
-        fields->integer_seconds_timestamp = b[0];
-        b += 1;
-    }
-
-    if (vrt_has_fractional_timestamp(header->tsf)) {
-        fields->fractional_seconds_timestamp = read_uint64(b);
-
-        if (validate) {
-            if (header->tsf == VRT_TSF_REAL_TIME && fields->fractional_seconds_timestamp >= (uint64_t)1000000000000) {
-                return VRT_ERR_BOUNDS_REAL_TIME;
-            }
-        }
-
-        /* No point in increasing b pointer here, since we're finished */
-    } else {
-        /* Zero fractional timestamp here, just to be sure */
-        fields->fractional_seconds_timestamp = 0;
-    }
+                        enum vrt_validation      validate) {
+    return read_fields_specialized(header, buf, words_buf, fields, validate, false);
+}
 
-    return words;
+int32_t vrt_read_fields_be(const struct vrt_header* header,
+                           const void*              buf,
+                           int32_t                  words_buf,
+                           struct vrt_fields*       fields,
+                           enum vrt_validation      validate) {
+    return read_fields_specialized(header, buf, words_buf, fields, validate, VRT_INTERNAL_NETWORK_ORDER_SWAP);
 }
 
 int32_t vrt_read_trailer(const void* buf, int32_t words_buf, struct vrt_trailer* trailer) {
-    /* Number of words are always 1 */
-    const int32_t words = 1;
-
-    /* Check if buf size is sufficient */
-    if (words_buf < words) {
-        return VRT_ERR_BUFFER_SIZE;
-    }
-
-    uint32_t b = *(const uint32_t*)buf;
-
-    /* Go from msb to lsb. Make sure to zero fields if not present, just to be sure. */
-    trailer->has.calibrated_time    = mskr(b, 31, 1);
-    trailer->has.valid_data         = mskr(b, 30, 1);
-    trailer->has.reference_lock     = mskr(b, 29, 1);
-    trailer->has.agc_or_mgc         = mskr(b, 28, 1);
-    trailer->has.detected_signal    = mskr(b, 27, 1);
-    trailer->has.spectral_inversion = mskr(b, 26, 1);
-    trailer->has.over_range         = mskr(b, 25, 1);
-    trailer->has.sample_loss        = mskr(b, 24, 1);
-    trailer->has.user_defined11     = mskr(b, 23, 1);
-    trailer->has.user_defined10     = mskr(b, 22, 1);
-    trailer->has.user_defined9      = mskr(b, 21, 1);
-    trailer->has.user_defined8      = mskr(b, 20, 1);
-
-    if (trailer->has.calibrated_time) {
-        trailer->calibrated_time = mskr(b, 19, 1);
-    } else {
-        trailer->calibrated_time = false;
-    }
-    if (trailer->has.valid_data) {
-        trailer->valid_data = mskr(b, 18, 1);
-    } else {
-        trailer->valid_data = false;
-    }
-    if (trailer->has.reference_lock) {
-        trailer->reference_lock = mskr(b, 17, 1);
-    } else {
-        trailer->reference_lock = false;
-    }
-    if (trailer->has.agc_or_mgc) {
-        trailer->agc_or_mgc = (enum vrt_agc_or_mgc)mskr(b, 16, 1);
-    } else {
-        trailer->agc_or_mgc = VRT_AOM_MGC;
-    }
-    if (trailer->has.detected_signal) {
-        trailer->detected_signal = mskr(b, 15, 1);
-    } else {
-        trailer->detected_signal = false;
-    }
-    if (trailer->has.spectral_inversion) {
-        trailer->spectral_inversion = mskr(b, 14, 1);
-    } else {
-        trailer->spectral_inversion = false;
-    }
-    if (trailer->has.over_range) {
-        trailer->over_range = mskr(b, 13, 1);
-    } else {
-        trailer->over_range = false;
-    }
-    if (trailer->has.sample_loss) {
-        trailer->sample_loss = mskr(b, 12, 1);
-    } else {
-        trailer->sample_loss = false;
-    }
-    if (trailer->has.user_defined11) {
-        trailer->user_defined11 = mskr(b, 11, 1);
-    } else {
-        trailer->user_defined11 = false;
-    }
-    if (trailer->has.user_defined10) {
-        trailer->user_defined10 = mskr(b, 10, 1);
-    } else {
-        trailer->user_defined10 = false;
-    }
-    if (trailer->has.user_defined9) {
-        trailer->user_defined9 = mskr(b, 9, 1);
-    } else {
-        trailer->user_defined9 = false;
-    }
-    if (trailer->has.user_defined8) {
-        trailer->user_defined8 = mskr(b, 8, 1);
-    } else {
-        trailer->user_defined8 = false;
-    }
-
-    trailer->has.associated_context_packet_count = vrt_u2b(mskr(b, 7, 1));
-    if (trailer->has.associated_context_packet_count) {
-        trailer->associated_context_packet_count = (uint8_t)mskr(b, 0, 7);
-    } else {
-        trailer->associated_context_packet_count = 0;
-    }
-
-    /*
-     * Due to Recommendation 6.1.7-1: All unused trailer bits should be set to zero, there is not much to validate here.
-     */
+    return vrt_internal_read_trailer_swap(buf, words_buf, trailer, false);
+}
 
-    return words;
+int32_t vrt_read_trailer_be(const void* buf, int32_t words_buf, struct vrt_trailer* trailer) {
+    return vrt_internal_read_trailer_swap(buf, words_buf, trailer, VRT_INTERNAL_NETWORK_ORDER_SWAP);
 }
 
 /**
  * Read IF context indicator field into its struct.
  *
  * \param b        Word to read from.
- * \param c        IF context to read into.
- * \param validate True if data shall be validated.
+ * \param has      Indicators to read into.
+ * \param validate Level of validation.
  *
  * \return Number of read words, or a negative number if error.
  */
-static int32_t if_context_read_indicator_field(uint32_t b, struct vrt_if_context* c, bool validate) {
-    c->context_field_change_indicator     = vrt_u2b(mskr(b, 31, 1));
-    c->has.reference_point_identifier     = vrt_u2b(mskr(b, 30, 1));
-    c->has.bandwidth                      = vrt_u2b(mskr(b, 29, 1));
-    c->has.if_reference_frequency         = vrt_u2b(mskr(b, 28, 1));
-    c->has.rf_reference_frequency         = vrt_u2b(mskr(b, 27, 1));
-    c->has.rf_reference_frequency_offset  = vrt_u2b(mskr(b, 26, 1));
-    c->has.if_band_offset                 = vrt_u2b(mskr(b, 25, 1));
-    c->has.reference_level                = vrt_u2b(mskr(b, 24, 1));
-    c->has.gain                           = vrt_u2b(mskr(b, 23, 1));
-    c->has.over_range_count               = vrt_u2b(mskr(b, 22, 1));
-    c->has.sample_rate                    = vrt_u2b(mskr(b, 21, 1));
-    c->has.timestamp_adjustment           = vrt_u2b(mskr(b, 20, 1));
-    c->has.timestamp_calibration_time     = vrt_u2b(mskr(b, 19, 1));
-    c->has.temperature                    = vrt_u2b(mskr(b, 18, 1));
-    c->has.device_identifier              = vrt_u2b(mskr(b, 17, 1));
-    c->has.state_and_event_indicators     = vrt_u2b(mskr(b, 16, 1));
-    c->has.data_packet_payload_format     = vrt_u2b(mskr(b, 15, 1));
-    c->has.formatted_gps_geolocation      = vrt_u2b(mskr(b, 14, 1));
-    c->has.formatted_ins_geolocation      = vrt_u2b(mskr(b, 13, 1));
-    c->has.ecef_ephemeris                 = vrt_u2b(mskr(b, 12, 1));
-    c->has.relative_ephemeris             = vrt_u2b(mskr(b, 11, 1));
-    c->has.ephemeris_reference_identifier = vrt_u2b(mskr(b, 10, 1));
-    c->has.gps_ascii                      = vrt_u2b(mskr(b, 9, 1));
-    c->has.context_association_lists      = vrt_u2b(mskr(b, 8, 1));
-
-    if (validate) {
-        if ((b & 0x000000FFU) != 0) {
+static int32_t if_context_read_indicator_field(uint32_t                       b,
+                                               struct vrt_context_indicators* has,
+                                               enum vrt_validation            validate) {
+    vrt_if_context_indicators_from_word(b, has);
+
+    if (vrt_internal_validate_structure(validate)) {
+        if (vrt_mskr(b, VRT_BITS_CIF0_RESERVED) != 0) {
             return VRT_ERR_RESERVED;
         }
     }
@@ -298,69 +115,70 @@ static int32_t if_context_read_indicator_field(uint32_t b, struct vrt_if_context
  * \param has      True if it is included.
  * \param b        Word to read from.
  * \param s        State and event field struct to read into.
- * \param validate True if data shall be validated.
+ * \param validate Level of validation.
  *
  * \return Number of read words, or a negative number if error.
  */
 static int32_t if_context_read_state_and_event_indicators(bool                        has,
                                                           uint32_t                    b,
                                                           struct vrt_state_and_event* s,
-                                                          bool                        validate) {
+                                                          enum vrt_validation         validate) {
     if (has) {
-        s->has.calibrated_time    = vrt_u2b(mskr(b, 31, 1));
-        s->has.valid_data         = vrt_u2b(mskr(b, 30, 1));
-        s->has.reference_lock     = vrt_u2b(mskr(b, 29, 1));
-        s->has.agc_or_mgc         = vrt_u2b(mskr(b, 28, 1));
-        s->has.detected_signal    = vrt_u2b(mskr(b, 27, 1));
-        s->has.spectral_inversion = vrt_u2b(mskr(b, 26, 1));
-        s->has.over_range         = vrt_u2b(mskr(b, 25, 1));
-        s->has.sample_loss        = vrt_u2b(mskr(b, 24, 1));
+        s->has.calibrated_time    = vrt_internal_u2b(vrt_mskr(b, VRT_BITS_STATE_AND_EVENT_HAS_CALIBRATED_TIME));
+        s->has.valid_data         = vrt_internal_u2b(vrt_mskr(b, VRT_BITS_STATE_AND_EVENT_HAS_VALID_DATA));
+        s->has.reference_lock     = vrt_internal_u2b(vrt_mskr(b, VRT_BITS_STATE_AND_EVENT_HAS_REFERENCE_LOCK));
+        s->has.agc_or_mgc         = vrt_internal_u2b(vrt_mskr(b, VRT_BITS_STATE_AND_EVENT_HAS_AGC_OR_MGC));
+        s->has.detected_signal    = vrt_internal_u2b(vrt_mskr(b, VRT_BITS_STATE_AND_EVENT_HAS_DETECTED_SIGNAL));
+        s->has.spectral_inversion = vrt_internal_u2b(vrt_mskr(b, VRT_BITS_STATE_AND_EVENT_HAS_SPECTRAL_INVERSION));
+        s->has.over_range         = vrt_internal_u2b(vrt_mskr(b, VRT_BITS_STATE_AND_EVENT_HAS_OVER_RANGE));
+        s->has.sample_loss        = vrt_internal_u2b(vrt_mskr(b, VRT_BITS_STATE_AND_EVENT_HAS_SAMPLE_LOSS));
 
         if (s->has.calibrated_time) {
-            s->calibrated_time = vrt_u2b(mskr(b, 19, 1));
+            s->calibrated_time = vrt_internal_u2b(vrt_mskr(b, VRT_BITS_STATE_AND_EVENT_CALIBRATED_TIME));
         } else {
             s->calibrated_time = 0;
         }
         if (s->has.valid_data) {
-            s->valid_data = vrt_u2b(mskr(b, 18, 1));
+            s->valid_data = vrt_internal_u2b(vrt_mskr(b, VRT_BITS_STATE_AND_EVENT_VALID_DATA));
         } else {
             s->valid_data = 0;
         }
         if (s->has.reference_lock) {
-            s->reference_lock = vrt_u2b(mskr(b, 17, 1));
+            s->reference_lock = vrt_internal_u2b(vrt_mskr(b, VRT_BITS_STATE_AND_EVENT_REFERENCE_LOCK));
         } else {
             s->reference_lock = 0;
         }
         if (s->has.agc_or_mgc) {
-            s->agc_or_mgc = (enum vrt_agc_or_mgc)mskr(b, 16, 1);
+            s->agc_or_mgc = (enum vrt_agc_or_mgc)vrt_mskr(b, VRT_BITS_STATE_AND_EVENT_AGC_OR_MGC);
         } else {
             s->agc_or_mgc = VRT_AOM_MGC;
         }
         if (s->has.detected_signal) {
-            s->detected_signal = vrt_u2b(mskr(b, 15, 1));
+            s->detected_signal = vrt_internal_u2b(vrt_mskr(b, VRT_BITS_STATE_AND_EVENT_DETECTED_SIGNAL));
         } else {
             s->detected_signal = 0;
         }
         if (s->has.spectral_inversion) {
-            s->spectral_inversion = vrt_u2b(mskr(b, 14, 1));
+            s->spectral_inversion = vrt_internal_u2b(vrt_mskr(b, VRT_BITS_STATE_AND_EVENT_SPECTRAL_INVERSION));
         } else {
             s->spectral_inversion = 0;
         }
         if (s->has.over_range) {
-            s->over_range = vrt_u2b(mskr(b, 13, 1));
+            s->over_range = vrt_internal_u2b(vrt_mskr(b, VRT_BITS_STATE_AND_EVENT_OVER_RANGE));
         } else {
             s->over_range = 0;
         }
         if (s->has.sample_loss) {
-            s->sample_loss = vrt_u2b(mskr(b, 12, 1));
+            s->sample_loss = vrt_internal_u2b(vrt_mskr(b, VRT_BITS_STATE_AND_EVENT_SAMPLE_LOSS));
         } else {
             s->sample_loss = 0;
         }
 
-        s->user_defined = (uint8_t)mskr(b, 0, 8);
+        s->user_defined = (uint8_t)vrt_mskr(b, VRT_BITS_STATE_AND_EVENT_USER_DEFINED);
 
-        if (validate) {
-            if ((b & 0x00F00F00U) != 0) {
+        if (vrt_internal_validate_structure(validate)) {
+            if (vrt_mskr(b, VRT_BITS_STATE_AND_EVENT_RESERVED_HIGH) != 0 ||
+                vrt_mskr(b, VRT_BITS_STATE_AND_EVENT_RESERVED_LOW) != 0) {
                 return VRT_ERR_RESERVED;
             }
         }
@@ -395,28 +213,34 @@ static int32_t if_context_read_state_and_event_indicators(bool
  * \param has      True if it is included.
  * \param b        Buffer to read from.
  * \param f        Data packet payload format struct to read into.
- * \param validate True if data shall be validated.
+ * \param validate Level of validation.
+ * \param swap     True if words shall be byte swapped.
  *
  * \return Number of read words, or a negative number if error.
  */
-static int32_t if_context_read_data_packet_payload_format(bool                                   has,
-                                                          const uint32_t*                        b,
-                                                          struct vrt_data_packet_payload_format* f,
-                                                          bool                                   validate) {
+static VRT_INTERNAL_FORCE_INLINE int32_t
+if_context_read_data_packet_payload_format(bool                                   has,
+                                           const uint32_t*                        b,
+                                           struct vrt_data_packet_payload_format* f,
+                                           enum vrt_validation                    validate,
+                                           bool                                   swap) {
     if (has) {
-        f->packing_method          = (enum vrt_packing_method)mskr(b[0], 31, 1);
-        f->real_or_complex         = (enum vrt_real_complex)mskr(b[0], 29, 2);
-        f->data_item_format        = (enum vrt_data_item_format)mskr(b[0], 24, 5);
-        f->sample_component_repeat = vrt_u2b(mskr(b[0], 23, 1));
-        f->event_tag_size          = (uint8_t)mskr(b[0], 20, 3);
-        f->channel_tag_size        = (uint8_t)mskr(b[0], 16, 4);
-        f->item_packing_field_size = (uint8_t)mskr(b[0], 6, 6);
-        f->data_item_size          = (uint8_t)mskr(b[0], 0, 6);
-
-        f->repeat_count = (uint16_t)mskr(b[1], 16, 16);
-        f->vector_size  = (uint16_t)mskr(b[1], 0, 16);
-
-        if (validate) {
+        uint32_t w0 = vrt_internal_load(b, swap);
+        uint32_t w1 = vrt_internal_load(b + 1, swap);
+
+        f->packing_method          = (enum vrt_packing_method)vrt_mskr(w0, 31, 1);
+        f->real_or_complex         = (enum vrt_real_complex)vrt_mskr(w0, 29, 2);
+        f->data_item_format        = (enum vrt_data_item_format)vrt_mskr(w0, 24, 5);
+        f->sample_component_repeat = vrt_internal_u2b(vrt_mskr(w0, 23, 1));
+        f->event_tag_size          = (uint8_t)vrt_mskr(w0, 20, 3);
+        f->channel_tag_size        = (uint8_t)vrt_mskr(w0, 16, 4);
+        f->item_packing_field_size = (uint8_t)vrt_mskr(w0, 6, 6);
+        f->data_item_size          = (uint8_t)vrt_mskr(w0, 0, 6);
+
+        f->repeat_count = (uint16_t)vrt_mskr(w1, 16, 16);
+        f->vector_size  = (uint16_t)vrt_mskr(w1, 0, 16);
+
+        if (vrt_internal_validate_content(validate)) {
             if (f->real_or_complex > VRT_ROC_COMPLEX_POLAR) {
                 return VRT_ERR_INVALID_REAL_OR_COMPLEX;
             }
@@ -425,8 +249,9 @@ static int32_t if_context_read_data_packet_payload_format(bool
                 f->data_item_format > VRT_DIF_UNSIGNED_VRT_6_BIT_EXPONENT) {
                 return VRT_ERR_INVALID_DATA_ITEM_FORMAT;
             }
-
-            if ((b[0] & 0x0000F000U) != 0) {
+        }
+        if (vrt_internal_validate_structure(validate)) {
+            if ((w0 & 0x0000F000U) != 0) {
                 return VRT_ERR_RESERVED;
             }
         }
@@ -454,40 +279,51 @@ static int32_t if_context_read_data_packet_payload_format(bool
  * \param has      True if it is included.
  * \param b        Buffer to read from.
  * \param g        Formatted GPS/INS geolocation struct to read into.
- * \param validate True if data shall be validated.
+ * \param validate Level of validation.
+ * \param swap     True if words shall be byte swapped.
  *
  * \return Number of read words, or a negative number if error.
  */
-static int32_t if_context_read_formatted_geolocation(bool                              has,
-                                                     const uint32_t*                   b,
-                                                     struct vrt_formatted_geolocation* g,
-                                                     bool                              validate) {
+static VRT_INTERNAL_FORCE_INLINE int32_t
+if_context_read_formatted_geolocation(bool                              has,
+                                      const uint32_t*                   b,
+                                      struct vrt_formatted_geolocation* g,
+                                      enum vrt_validation               validate,
+                                      bool                              swap) {
     if (has) {
-        g->tsi                         = (enum vrt_tsi)mskr(b[0], 26, 2);
-        g->tsf                         = (enum vrt_tsf)mskr(b[0], 24, 2);
-        g->oui                         = mskr(b[0], 0, 24);
-        g->integer_second_timestamp    = b[1];
-        g->fractional_second_timestamp = read_uint64(b + 2);
-        g->has.latitude                = (b[4] != VRT_UNSPECIFIED_FIXED_POINT);
-        g->latitude                    = vrt_fixed_point_i32_to_double((int32_t)b[4], VRT_RADIX_ANGLE);
-        g->has.longitude               = (b[5] != VRT_UNSPECIFIED_FIXED_POINT);
-        g->longitude                   = vrt_fixed_point_i32_to_double((int32_t)b[5], VRT_RADIX_ANGLE);
-        g->has.altitude                = (b[6] != VRT_UNSPECIFIED_FIXED_POINT);
-        g->altitude                    = vrt_fixed_point_i32_to_double((int32_t)b[6], VRT_RADIX_ALTITUDE);
-        g->has.speed_over_ground       = (b[7] != VRT_UNSPECIFIED_FIXED_POINT);
-        g->speed_over_ground           = vrt_fixed_point_u32_to_double(b[7], VRT_RADIX_SPEED_VELOCITY);
-        g->has.heading_angle           = (b[8] != VRT_UNSPECIFIED_FIXED_POINT);
-        g->heading_angle               = vrt_fixed_point_i32_to_double((int32_t)b[8], VRT_RADIX_ANGLE);
-        g->has.track_angle             = (b[9] != VRT_UNSPECIFIED_FIXED_POINT);
-        g->track_angle                 = vrt_fixed_point_i32_to_double((int32_t)b[9], VRT_RADIX_ANGLE);
-        g->has.magnetic_variation      = (b[10] != VRT_UNSPECIFIED_FIXED_POINT);
+        /* Load all words at once, since they are used multiple times */
+        uint32_t w[11];
+        for (int32_t i = 0; i < 11; ++i) {
+            w[i] = vrt_internal_load(b + i, swap);
+        }
+
+        g->tsi                         = (enum vrt_tsi)vrt_mskr(w[0], 26, 2);
+        g->tsf                         = (enum vrt_tsf)vrt_mskr(w[0], 24, 2);
+        g->oui                         = vrt_mskr(w[0], 0, 24);
+        g->integer_second_timestamp    = w[1];
+        g->fractional_second_timestamp = vrt_internal_read_uint64(w + 2, false);
+        g->has.latitude                = (w[4] != VRT_UNSPECIFIED_FIXED_POINT);
+        g->latitude                    = vrt_fixed_point_i32_to_double((int32_t)w[4], VRT_RADIX_ANGLE);
+        g->has.longitude               = (w[5] != VRT_UNSPECIFIED_FIXED_POINT);
+        g->longitude                   = vrt_fixed_point_i32_to_double((int32_t)w[5], VRT_RADIX_ANGLE);
+        g->has.altitude                = (w[6] != VRT_UNSPECIFIED_FIXED_POINT);
+        g->altitude                    = vrt_fixed_point_i32_to_double((int32_t)w[6], VRT_RADIX_ALTITUDE);
+        g->has.speed_over_ground       = (w[7] != VRT_UNSPECIFIED_FIXED_POINT);
+        g->speed_over_ground           = vrt_fixed_point_u32_to_double(w[7], VRT_RADIX_SPEED_VELOCITY);
+        g->has.heading_angle           = (w[8] != VRT_UNSPECIFIED_FIXED_POINT);
+        g->heading_angle               = vrt_fixed_point_i32_to_double((int32_t)w[8], VRT_RADIX_ANGLE);
+        g->has.track_angle             = (w[9] != VRT_UNSPECIFIED_FIXED_POINT);
+        g->track_angle                 = vrt_fixed_point_i32_to_double((int32_t)w[9], VRT_RADIX_ANGLE);
+        g->has.magnetic_variation      = (w[10] != VRT_UNSPECIFIED_FIXED_POINT);
         /* There seems to be an error in Rule 7.1.5.19-13. A correction seems to be 6.2.5.15-2 -> 7.1.5.19-2.*/
-        g->magnetic_variation = vrt_fixed_point_i32_to_double((int32_t)b[10], VRT_RADIX_ANGLE);
+        g->magnetic_variation = vrt_fixed_point_i32_to_double((int32_t)w[10], VRT_RADIX_ANGLE);
 
-        if (validate) {
-            if ((b[0] & 0xF0000000U) != 0) {
+        if (vrt_internal_validate_structure(validate)) {
+            if ((w[0] & 0xF0000000U) != 0) {
                 return VRT_ERR_RESERVED;
             }
+        }
+        if (vrt_internal_validate_content(validate)) {
             if (g->tsi == VRT_TSI_UNDEFINED && g->integer_second_timestamp != VRT_UNSPECIFIED_TSI) {
                 return VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP;
             }
@@ -552,41 +388,54 @@ static int32_t if_context_read_formatted_geolocation(bool
  * \param has      True if it is included.
  * \param b        Buffer to read from [0] or [13].
  * \param e        Ephemeris struct to read into.
- * \param validate True if data shall be validated.
+ * \param validate Level of validation.
+ * \param swap     True if words shall be byte swapped.
  *
  * \return Number of read words, or a negative number if error.
  */
-static int32_t if_context_read_ephemeris(bool has, const uint32_t* b, struct vrt_ephemeris* e, bool validate) {
+static VRT_INTERNAL_FORCE_INLINE int32_t if_context_read_ephemeris(bool                  has,
+                                                                   const uint32_t*       b,
+                                                                   struct vrt_ephemeris* e,
+                                                                   enum vrt_validation   validate,
+                                                                   bool                  swap) {
     if (has) {
-        e->tsi                         = (enum vrt_tsi)mskr(b[0], 26, 2);
-        e->tsf                         = (enum vrt_tsf)mskr(b[0], 24, 2);
-        e->oui                         = mskr(b[0], 0, 24);
-        e->integer_second_timestamp    = b[1];
-        e->fractional_second_timestamp = read_uint64(b + 2);
-
-        e->has.position_x     = (b[4] != VRT_UNSPECIFIED_FIXED_POINT);
-        e->position_x         = vrt_fixed_point_i32_to_double((int32_t)b[4], VRT_RADIX_POSITION);
-        e->has.position_y     = (b[5] != VRT_UNSPECIFIED_FIXED_POINT);
-        e->position_y         = vrt_fixed_point_i32_to_double((int32_t)b[5], VRT_RADIX_POSITION);
-        e->has.position_z     = (b[6] != VRT_UNSPECIFIED_FIXED_POINT);
-        e->position_z         = vrt_fixed_point_i32_to_double((int32_t)b[6], VRT_RADIX_POSITION);
-        e->has.attitude_alpha = (b[7] != VRT_UNSPECIFIED_FIXED_POINT);
-        e->attitude_alpha     = vrt_fixed_point_i32_to_double((int32_t)b[7], VRT_RADIX_ANGLE);
-        e->has.attitude_beta  = (b[8] != VRT_UNSPECIFIED_FIXED_POINT);
-        e->attitude_beta      = vrt_fixed_point_i32_to_double((int32_t)b[8], VRT_RADIX_ANGLE);
-        e->has.attitude_phi   = (b[9] != VRT_UNSPECIFIED_FIXED_POINT);
-        e->attitude_phi       = vrt_fixed_point_i32_to_double((int32_t)b[9], VRT_RADIX_ANGLE);
-        e->has.velocity_dx    = (b[10] != VRT_UNSPECIFIED_FIXED_POINT);
-        e->velocity_dx        = vrt_fixed_point_i32_to_double((int32_t)b[10], VRT_RADIX_SPEED_VELOCITY);
-        e->has.velocity_dy    = (b[11] != VRT_UNSPECIFIED_FIXED_POINT);
-        e->velocity_dy        = vrt_fixed_point_i32_to_double((int32_t)b[11], VRT_RADIX_SPEED_VELOCITY);
-        e->has.velocity_dz    = (b[12] != VRT_UNSPECIFIED_FIXED_POINT);
-        e->velocity_dz        = vrt_fixed_point_i32_to_double((int32_t)b[12], VRT_RADIX_SPEED_VELOCITY);
-
-        if (validate) {
-            if ((b[0] & 0xF0000000U) != 0) {
+        /* Load all words at once, since they are used multiple times */
+        uint32_t w[13];
+        for (int32_t i = 0; i < 13; ++i) {
+            w[i] = vrt_internal_load(b + i, swap);
+        }
+
+        e->tsi                         = (enum vrt_tsi)vrt_mskr(w[0], 26, 2);
+        e->tsf                         = (enum vrt_tsf)vrt_mskr(w[0], 24, 2);
+        e->oui                         = vrt_mskr(w[0], 0, 24);
+        e->integer_second_timestamp    = w[1];
+        e->fractional_second_timestamp = vrt_internal_read_uint64(w + 2, false);
+
+        e->has.position_x     = (w[4] != VRT_UNSPECIFIED_FIXED_POINT);
+        e->position_x         = vrt_fixed_point_i32_to_double((int32_t)w[4], VRT_RADIX_POSITION);
+        e->has.position_y     = (w[5] != VRT_UNSPECIFIED_FIXED_POINT);
+        e->position_y         = vrt_fixed_point_i32_to_double((int32_t)w[5], VRT_RADIX_POSITION);
+        e->has.position_z     = (w[6] != VRT_UNSPECIFIED_FIXED_POINT);
+        e->position_z         = vrt_fixed_point_i32_to_double((int32_t)w[6], VRT_RADIX_POSITION);
+        e->has.attitude_alpha = (w[7] != VRT_UNSPECIFIED_FIXED_POINT);
+        e->attitude_alpha     = vrt_fixed_point_i32_to_double((int32_t)w[7], VRT_RADIX_ANGLE);
+        e->has.attitude_beta  = (w[8] != VRT_UNSPECIFIED_FIXED_POINT);
+        e->attitude_beta      = vrt_fixed_point_i32_to_double((int32_t)w[8], VRT_RADIX_ANGLE);
+        e->has.attitude_phi   = (w[9] != VRT_UNSPECIFIED_FIXED_POINT);
+        e->attitude_phi       = vrt_fixed_point_i32_to_double((int32_t)w[9], VRT_RADIX_ANGLE);
+        e->has.velocity_dx    = (w[10] != VRT_UNSPECIFIED_FIXED_POINT);
+        e->velocity_dx        = vrt_fixed_point_i32_to_double((int32_t)w[10], VRT_RADIX_SPEED_VELOCITY);
+        e->has.velocity_dy    = (w[11] != VRT_UNSPECIFIED_FIXED_POINT);
+        e->velocity_dy        = vrt_fixed_point_i32_to_double((int32_t)w[11], VRT_RADIX_SPEED_VELOCITY);
+        e->has.velocity_dz    = (w[12] != VRT_UNSPECIFIED_FIXED_POINT);
+        e->velocity_dz        = vrt_fixed_point_i32_to_double((int32_t)w[12], VRT_RADIX_SPEED_VELOCITY);
+
+        if (vrt_internal_validate_structure(validate)) {
+            if ((w[0] & 0xF0000000U) != 0) {
                 return VRT_ERR_RESERVED;
             }
+        }
+        if (vrt_internal_validate_content(validate)) {
             if (e->tsi == VRT_TSI_UNDEFINED && e->integer_second_timestamp != VRT_UNSPECIFIED_TSI) {
                 return VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP;
             }
@@ -640,22 +489,27 @@ static int32_t if_context_read_ephemeris(bool has, const uint32_t* b, struct vrt
  * \param has      True if it is included.
  * \param b        Buffer to read from.
  * \param g        GPS ASCII struct to read into.
- * \param validate True if data shall be validated.
+ * \param validate Level of validation.
+ * \param swap     True if words shall be byte swapped. Note that the ASCII characters themselves are never swapped.
  *
  * \return Number of read words, or a negative number if error.
  */
-static int32_t if_context_read_gps_ascii(bool has, const uint32_t* b, struct vrt_gps_ascii* g, bool validate) {
+static VRT_INTERNAL_FORCE_INLINE int32_t if_context_read_gps_ascii(bool                  has,
+                                                                   const uint32_t*       b,
+                                                                   struct vrt_gps_ascii* g,
+                                                                   enum vrt_validation   validate,
+                                                                   bool                  swap) {
     if (has) {
-        g->oui             = mskr(b[0], 0, 24);
-        g->number_of_words = b[1];
+        g->oui             = vrt_mskr(vrt_internal_load(b, swap), 0, 24);
+        g->number_of_words = vrt_internal_load(b + 1, swap);
         if (g->number_of_words == 0) {
             g->ascii = NULL;
         } else {
             g->ascii = (const char*)(b + 2);
         }
 
-        if (validate) {
-            if ((b[0] & 0xFF000000U) != 0) {
+        if (vrt_internal_validate_structure(validate)) {
+            if ((vrt_internal_load(b, swap) & 0xFF000000U) != 0) {
                 return VRT_ERR_RESERVED;
             }
         }
@@ -673,19 +527,23 @@ static int32_t if_context_read_gps_ascii(bool has, const uint32_t* b, struct vrt
 /**
  * Read IF context association lists field into its struct.
  *
- * \param has True if it is included.
- * \param b   Buffer to read from.
- * \param l   Association lists struct to read into.
+ * \param has  True if it is included.
+ * \param b    Buffer to read from.
+ * \param l    Association lists struct to read into.
+ * \param swap True if the list size words shall be byte swapped. Note that the lists themselves are pointed to as is.
  *
  * \return Number of read words.
  */
-static int32_t if_context_read_association_lists(bool has, const uint32_t* b, struct vrt_context_association_lists* l) {
+static VRT_INTERNAL_FORCE_INLINE int32_t if_context_read_association_lists(bool                                  has,
+                                                                           const uint32_t*                       b,
+                                                                           struct vrt_context_association_lists* l,
+                                                                           bool                                  swap) {
     if (has) {
-        l->source_list_size                  = (uint16_t)mskr(b[0], 16, 9);
-        l->system_list_size                  = (uint16_t)mskr(b[0], 0, 9);
-        l->vector_component_list_size        = (uint16_t)mskr(b[1], 16, 16);
-        l->has.asynchronous_channel_tag_list = vrt_u2b(mskr(b[1], 15, 1));
-        l->asynchronous_channel_list_size    = (uint16_t)mskr(b[1], 0, 15);
+        l->source_list_size                  = (uint16_t)vrt_mskr(vrt_internal_load(b, swap), 16, 9);
+        l->system_list_size                  = (uint16_t)vrt_mskr(vrt_internal_load(b, swap), 0, 9);
+        l->vector_component_list_size        = (uint16_t)vrt_mskr(vrt_internal_load(b + 1, swap), 16, 16);
+        l->has.asynchronous_channel_tag_list = vrt_internal_u2b(vrt_mskr(vrt_internal_load(b + 1, swap), 15, 1));
+        l->asynchronous_channel_list_size    = (uint16_t)vrt_mskr(vrt_internal_load(b + 1, swap), 0, 15);
 
         int32_t words = 2;
         if (l->source_list_size == 0) {
@@ -738,7 +596,24 @@ static int32_t if_context_read_association_lists(bool has, const uint32_t* b, st
     return 0;
 }
 
-int32_t vrt_read_if_context(const void* buf, int32_t words_buf, struct vrt_if_context* if_context, bool validate) {
+/**
+ * Read IF context section, with optional byte swapping of words.
+ *
+ * \param buf        Buffer to read from.
+ * \param words_buf  Size of buf in 32-bit words.
+ * \param if_context IF context to read into.
+ * \param validate   Level of validation.
+ * \param merge      True if fields not present shall be left as is, instead of being zeroed.
+ * \param swap       True if words shall be byte swapped.
+ *
+ * \return Number of read words, or a negative number if error.
+ */
+static VRT_INTERNAL_FORCE_INLINE int32_t read_if_context(const void*            buf,
+                                                         int32_t                words_buf,
+                                                         struct vrt_if_context* if_context,
+                                                         enum vrt_validation    validate,
+                                                         bool                   merge,
+                                                         bool                   swap) {
     /* Cannot count words here since the IF context section hasn't been read yet */
 
     int32_t words = 1;
@@ -749,86 +624,90 @@ int32_t vrt_read_if_context(const void* buf, int32_t words_buf, struct vrt_if_co
 
     const uint32_t* b = (const uint32_t*)buf;
 
-    /* Go from msb to lsb. Make sure to zero fields if not present, just to be sure. */
-    int32_t rv = if_context_read_indicator_field(b[0], if_context, validate);
+    /* Go from msb to lsb. Make sure to zero fields if not present and not merging, just to be sure. */
+    const uint32_t                indicator = vrt_internal_load(b, swap);
+    struct vrt_context_indicators has;
+    int32_t                       rv        = if_context_read_indicator_field(indicator, &has, validate);
     if (rv < 0) {
         return rv;
     }
     b += rv;
 
     /* Replace context_words here instead of increasing it */
-    words = vrt_words_if_context_indicator(&if_context->has);
+    words = vrt_if_context_offset(indicator, VRT_CIF0_BIT_GPS_ASCII);
     if (words_buf < words) {
         return VRT_ERR_BUFFER_SIZE;
     }
 
-    if (if_context->has.reference_point_identifier) {
-        if_context->reference_point_identifier = b[0];
+    if (has.reference_point_identifier) {
+        if_context->reference_point_identifier = vrt_internal_load(b, swap);
         b += 1;
-    } else {
+    } else if (!merge) {
         if_context->reference_point_identifier = 0;
     }
-    if (if_context->has.bandwidth) {
-        if_context->bandwidth = vrt_fixed_point_i64_to_double((int64_t)read_uint64(b), VRT_RADIX_FREQUENCY);
+    if (has.bandwidth) {
+        if_context->bandwidth =
+            vrt_fixed_point_i64_to_double((int64_t)vrt_internal_read_uint64(b, swap), VRT_RADIX_FREQUENCY);
 
-        if (validate) {
+        if (vrt_internal_validate_content(validate)) {
             if (if_context->bandwidth < 0.0) {
                 return VRT_ERR_BOUNDS_BANDWIDTH;
             }
         }
 
         b += 2;
-    } else {
+    } else if (!merge) {
         if_context->bandwidth = 0.0;
     }
-    if (if_context->has.if_reference_frequency) {
+    if (has.if_reference_frequency) {
         if_context->if_reference_frequency =
-            vrt_fixed_point_i64_to_double((int64_t)read_uint64(b), VRT_RADIX_FREQUENCY);
+            vrt_fixed_point_i64_to_double((int64_t)vrt_internal_read_uint64(b, swap), VRT_RADIX_FREQUENCY);
         b += 2;
-    } else {
+    } else if (!merge) {
         if_context->if_reference_frequency = 0.0;
     }
-    if (if_context->has.rf_reference_frequency) {
+    if (has.rf_reference_frequency) {
         if_context->rf_reference_frequency =
-            vrt_fixed_point_i64_to_double((int64_t)read_uint64(b), VRT_RADIX_FREQUENCY);
+            vrt_fixed_point_i64_to_double((int64_t)vrt_internal_read_uint64(b, swap), VRT_RADIX_FREQUENCY);
         b += 2;
-    } else {
+    } else if (!merge) {
         if_context->rf_reference_frequency = 0.0;
     }
-    if (if_context->has.rf_reference_frequency_offset) {
+    if (has.rf_reference_frequency_offset) {
         if_context->rf_reference_frequency_offset =
-            vrt_fixed_point_i64_to_double((int64_t)read_uint64(b), VRT_RADIX_FREQUENCY);
+            vrt_fixed_point_i64_to_double((int64_t)vrt_internal_read_uint64(b, swap), VRT_RADIX_FREQUENCY);
         b += 2;
-    } else {
+    } else if (!merge) {
         if_context->rf_reference_frequency_offset = 0.0;
     }
-    if (if_context->has.if_band_offset) {
-        if_context->if_band_offset = vrt_fixed_point_i64_to_double((int64_t)read_uint64(b), VRT_RADIX_FREQUENCY);
+    if (has.if_band_offset) {
+        if_context->if_band_offset =
+            vrt_fixed_point_i64_to_double((int64_t)vrt_internal_read_uint64(b, swap), VRT_RADIX_FREQUENCY);
         b += 2;
-    } else {
+    } else if (!merge) {
         if_context->if_band_offset = 0.0;
     }
-    if (if_context->has.reference_level) {
-        if_context->reference_level =
-            vrt_fixed_point_i16_to_float((int16_t)(b[0] & 0x0000FFFFU), VRT_RADIX_REFERENCE_LEVEL);
+    if (has.reference_level) {
+        if_context->reference_level = vrt_fixed_point_i16_to_float((int16_t)(vrt_internal_load(b, swap) & 0x0000FFFFU),
+                                                                   VRT_RADIX_REFERENCE_LEVEL);
 
-        if (validate) {
-            if ((b[0] & 0xFFFF0000U) != 0) {
+        if (vrt_internal_validate_structure(validate)) {
+            if ((vrt_internal_load(b, swap) & 0xFFFF0000U) != 0) {
                 return VRT_ERR_RESERVED;
             }
         }
 
         b += 1;
-    } else {
+    } else if (!merge) {
         if_context->reference_level = 0.0F;
     }
-    if (if_context->has.gain) {
-        int16_t fp1             = b[0] & 0x0000FFFFU;
-        int16_t fp2             = (b[0] >> 16U) & 0x0000FFFFU;
+    if (has.gain) {
+        int16_t fp1             = vrt_internal_load(b, swap) & 0x0000FFFFU;
+        int16_t fp2             = (vrt_internal_load(b, swap) >> 16U) & 0x0000FFFFU;
         if_context->gain.stage1 = vrt_fixed_point_i16_to_float(fp1, VRT_RADIX_GAIN);
         if_context->gain.stage2 = vrt_fixed_point_i16_to_float(fp2, VRT_RADIX_GAIN);
 
-        if (validate) {
+        if (vrt_internal_validate_content(validate)) {
             /* Rule 7.1.5.10-6: Equipment whose gain can be described with a single number shall use the Stage 1 Gain
              * subfield. The Stage 2 Gain subfield shall be set to zero. */
             if (if_context->gain.stage2 != 0.0F && if_context->gain.stage1 == 0.0F) {
@@ -837,144 +716,249 @@ int32_t vrt_read_if_context(const void* buf, int32_t words_buf, struct vrt_if_co
         }
 
         b += 1;
-    } else {
+    } else if (!merge) {
         if_context->gain.stage1 = 0.0F;
         if_context->gain.stage2 = 0.0F;
     }
-    if (if_context->has.over_range_count) {
-        if_context->over_range_count = b[0];
+    if (has.over_range_count) {
+        if_context->over_range_count = vrt_internal_load(b, swap);
         b += 1;
-    } else {
+    } else if (!merge) {
         if_context->over_range_count = 0;
     }
-    if (if_context->has.sample_rate) {
-        if_context->sample_rate = vrt_fixed_point_i64_to_double((int64_t)read_uint64(b), VRT_RADIX_FREQUENCY);
+    if (has.sample_rate) {
+        if_context->sample_rate =
+            vrt_fixed_point_i64_to_double((int64_t)vrt_internal_read_uint64(b, swap), VRT_RADIX_FREQUENCY);
 
-        if (validate) {
+        if (vrt_internal_validate_content(validate)) {
             if (if_context->sample_rate < VRT_MIN_SAMPLE_RATE) {
                 return VRT_ERR_BOUNDS_SAMPLE_RATE;
             }
         }
 
         b += 2;
-    } else {
+    } else if (!merge) {
         if_context->sample_rate = 0.0;
     }
-    if (if_context->has.timestamp_adjustment) {
-        if_context->timestamp_adjustment = read_uint64(b);
+    if (has.timestamp_adjustment) {
+        if_context->timestamp_adjustment = vrt_internal_read_uint64(b, swap);
         b += 2;
-    } else {
+    } else if (!merge) {
         if_context->timestamp_adjustment = 0;
     }
-    if (if_context->has.timestamp_calibration_time) {
-        if_context->timestamp_calibration_time = b[0];
+    if (has.timestamp_calibration_time) {
+        if_context->timestamp_calibration_time = vrt_internal_load(b, swap);
         b += 1;
-    } else {
+    } else if (!merge) {
         if_context->timestamp_calibration_time = 0;
     }
-    if (if_context->has.temperature) {
-        if_context->temperature = vrt_fixed_point_i16_to_float(b[0] & 0x0000FFFFU, VRT_RADIX_TEMPERATURE);
+    if (has.temperature) {
+        if_context->temperature =
+            vrt_fixed_point_i16_to_float(vrt_internal_load(b, swap) & 0x0000FFFFU, VRT_RADIX_TEMPERATURE);
 
-        if (validate) {
+        if (vrt_internal_validate_content(validate)) {
             if (if_context->temperature < VRT_MIN_TEMPERATURE) {
                 return VRT_ERR_BOUNDS_TEMPERATURE;
             }
-            if ((b[0] & 0xFFFF0000U) != 0) {
+        }
+        if (vrt_internal_validate_structure(validate)) {
+            if ((vrt_internal_load(b, swap) & 0xFFFF0000U) != 0) {
                 return VRT_ERR_RESERVED;
             }
         }
 
         b += 1;
-    } else {
+    } else if (!merge) {
         if_context->temperature = 0.0F;
     }
-    if (if_context->has.device_identifier) {
-        if_context->device_identifier.oui         = mskr(b[0], 0, 24);
-        if_context->device_identifier.device_code = (uint16_t)mskr(b[1], 0, 16);
+    if (has.device_identifier) {
+        if_context->device_identifier.oui         = vrt_mskr(vrt_internal_load(b, swap), 0, 24);
+        if_context->device_identifier.device_code = (uint16_t)vrt_mskr(vrt_internal_load(b + 1, swap), 0, 16);
 
-        if (validate) {
-            if ((b[0] & 0xFF000000U) != 0 || (b[1] & 0xFFFF0000U) != 0) {
+        if (vrt_internal_validate_structure(validate)) {
+            if ((vrt_internal_load(b, swap) & 0xFF000000U) != 0 ||
+                (vrt_internal_load(b + 1, swap) & 0xFFFF0000U) != 0) {
                 return VRT_ERR_RESERVED;
             }
         }
 
         b += 2;
-    } else {
+    } else if (!merge) {
         if_context->device_identifier.oui         = 0;
         if_context->device_identifier.device_code = 0;
     }
-    rv = if_context_read_state_and_event_indicators(if_context->has.state_and_event_indicators, b[0],
-                                                    &if_context->state_and_event_indicators, validate);
-    if (rv < 0) {
-        return rv;
+    /* When merging, skip absent fields entirely, since the functions zero them */
+    if (has.state_and_event_indicators || !merge) {
+        rv = if_context_read_state_and_event_indicators(has.state_and_event_indicators, vrt_internal_load(b, swap),
+                                                        &if_context->state_and_event_indicators, validate);
+        if (rv < 0) {
+            return rv;
+        }
+        b += rv;
     }
-    b += rv;
-    rv = if_context_read_data_packet_payload_format(if_context->has.data_packet_payload_format, b,
-                                                    &if_context->data_packet_payload_format, validate);
-    if (rv < 0) {
-        return rv;
+    if (has.data_packet_payload_format || !merge) {
+        rv = if_context_read_data_packet_payload_format(has.data_packet_payload_format, b,
+                                                        &if_context->data_packet_payload_format, validate, swap);
+        if (rv < 0) {
+            return rv;
+        }
+        b += rv;
     }
-    b += rv;
-    rv = if_context_read_formatted_geolocation(if_context->has.formatted_gps_geolocation, b,
-                                               &if_context->formatted_gps_geolocation, validate);
-    if (rv < 0) {
-        return rv;
+    if (has.formatted_gps_geolocation || !merge) {
+        rv = if_context_read_formatted_geolocation(has.formatted_gps_geolocation, b,
+                                                   &if_context->formatted_gps_geolocation, validate, swap);
+        if (rv < 0) {
+            return rv;
+        }
+        b += rv;
     }
-    b += rv;
-    rv = if_context_read_formatted_geolocation(if_context->has.formatted_ins_geolocation, b,
-                                               &if_context->formatted_ins_geolocation, validate);
-    if (rv < 0) {
-        return rv;
+    if (has.formatted_ins_geolocation || !merge) {
+        rv = if_context_read_formatted_geolocation(has.formatted_ins_geolocation, b,
+                                                   &if_context->formatted_ins_geolocation, validate, swap);
+        if (rv < 0) {
+            return rv;
+        }
+        b += rv;
     }
-    b += rv;
-    rv = if_context_read_ephemeris(if_context->has.ecef_ephemeris, b, &if_context->ecef_ephemeris, validate);
-    if (rv < 0) {
-        return rv;
+    if (has.ecef_ephemeris || !merge) {
+        rv = if_context_read_ephemeris(has.ecef_ephemeris, b, &if_context->ecef_ephemeris, validate, swap);
+        if (rv < 0) {
+            return rv;
+        }
+        b += rv;
     }
-    b += rv;
-    rv = if_context_read_ephemeris(if_context->has.relative_ephemeris, b, &if_context->relative_ephemeris, validate);
-    if (rv < 0) {
-        return rv;
+    if (has.relative_ephemeris || !merge) {
+        rv = if_context_read_ephemeris(has.relative_ephemeris, b, &if_context->relative_ephemeris, validate, swap);
+        if (rv < 0) {
+            return rv;
+        }
+        b += rv;
     }
-    b += rv;
-    if (if_context->has.ephemeris_reference_identifier) {
-        if_context->ephemeris_reference_identifier = b[0];
+    if (has.ephemeris_reference_identifier) {
+        if_context->ephemeris_reference_identifier = vrt_internal_load(b, swap);
         b += 1;
-    } else {
+    } else if (!merge) {
         if_context->ephemeris_reference_identifier = 0;
     }
 
-    rv = if_context_read_gps_ascii(if_context->has.gps_ascii, b, &if_context->gps_ascii, validate);
-    if (rv < 0) {
-        return rv;
+    /* Variable size fields, where the size is found inside the field itself, must also fit in the buffer */
+    if (has.gps_ascii) {
+        if (words_buf < words + 2 || vrt_internal_load(b + 1, swap) > (uint32_t)(words_buf - words - 2)) {
+            return VRT_ERR_BUFFER_SIZE;
+        }
+    }
+    if (has.gps_ascii || !merge) {
+        rv = if_context_read_gps_ascii(has.gps_ascii, b, &if_context->gps_ascii, validate, swap);
+        if (rv < 0) {
+            return rv;
+        }
+        b += rv;
+        words += rv;
     }
-    b += rv;
-    words += rv;
 
     /* No need to increase b here since it is last */
-    rv = if_context_read_association_lists(if_context->has.context_association_lists, b,
-                                           &if_context->context_association_lists);
-    if (rv < 0) {
-        return rv;
+    if (has.context_association_lists) {
+        if (words_buf < words + 2) {
+            return VRT_ERR_BUFFER_SIZE;
+        }
+    }
+    if (has.context_association_lists || !merge) {
+        rv = if_context_read_association_lists(has.context_association_lists, b,
+                                               &if_context->context_association_lists, swap);
+        if (rv < 0) {
+            return rv;
+        }
+        words += rv;
+        if (words > words_buf) {
+            return VRT_ERR_BUFFER_SIZE;
+        }
+    }
+
+    /* Fields present earlier stay present when merging */
+    if_context->context_field_change_indicator =
+        vrt_internal_u2b(vrt_mskr(indicator, VRT_BITS_CIF0_CONTEXT_FIELD_CHANGE_INDICATOR));
+    if (merge) {
+        const uint32_t merged = indicator | vrt_if_context_indicator_word(&if_context->has);
+        (void)if_context_read_indicator_field(merged, &if_context->has, VRT_VALIDATION_NONE);
+    } else {
+        if_context->has = has;
     }
-    words += rv;
 
     return words;
 }
 
-int32_t vrt_read_packet(void* buf, int32_t words_buf, struct vrt_packet* packet, bool validate) {
+/**
+ * Same as read_if_context(), but compiled into a separate path for each validation level.
+ */
+static VRT_INTERNAL_FORCE_INLINE int32_t read_if_context_specialized(const void*            buf,
+                                                                     int32_t                words_buf,
+                                                                     struct vrt_if_context* if_context,
+                                                                     enum vrt_validation    validate,
+                                                                     bool                   merge,
+                                                                     bool                   swap) {
+    switch (validate) {
+        case VRT_VALIDATION_NONE:
+            return read_if_context(buf, words_buf, if_context, VRT_VALIDATION_NONE, merge, swap);
+        case VRT_VALIDATION_STRUCTURAL:
+            return read_if_context(buf, words_buf, if_context, VRT_VALIDATION_STRUCTURAL, merge, swap);
+        default:
+            return read_if_context(buf, words_buf, if_context, VRT_VALIDATION_FULL, merge, swap);
+    }
+}
+
+int32_t vrt_read_if_context(const void*            buf,
+                            int32_t                words_buf,
+                            struct vrt_if_context* if_context,
+                            enum vrt_validation    validate) {
+    return read_if_context_specialized(buf, words_buf, if_context, validate, false, false);
+}
+
+int32_t vrt_read_if_context_be(const void*            buf,
+                               int32_t                words_buf,
+                               struct vrt_if_context* if_context,
+                               enum vrt_validation    validate) {
+    return read_if_context_specialized(buf, words_buf, if_context, validate, false, VRT_INTERNAL_NETWORK_ORDER_SWAP);
+}
+
+int32_t vrt_merge_if_context(const void*            buf,
+                             int32_t                words_buf,
+                             struct vrt_if_context* if_context,
+                             enum vrt_validation    validate) {
+    return read_if_context_specialized(buf, words_buf, if_context, validate, true, false);
+}
+
+int32_t vrt_merge_if_context_be(const void*            buf,
+                                int32_t                words_buf,
+                                struct vrt_if_context* if_context,
+                                enum vrt_validation    validate) {
+    return read_if_context_specialized(buf, words_buf, if_context, validate, true, VRT_INTERNAL_NETWORK_ORDER_SWAP);
+}
+
+/**
+ * Read packet, with optional byte swapping of words.
+ *
+ * \param buf       Buffer to read from.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param packet    Packet to read into.
+ * \param validate  Level of validation.
+ * \param swap      True if words shall be byte swapped.
+ *
+ * \return Number of read words, or a negative number if error.
+ */
+static VRT_INTERNAL_FORCE_INLINE int32_t
+read_packet(void* buf, int32_t words_buf, struct vrt_packet* packet, enum vrt_validation validate, bool swap) {
     uint32_t* b = (uint32_t*)buf;
 
     /* Header */
-    int32_t words_header = vrt_read_header(b, words_buf, &packet->header, validate);
+    int32_t words_header = vrt_internal_read_header_swap(b, words_buf, &packet->header, validate, swap);
     if (words_header < 0) {
         return words_header;
     }
     int32_t words_total = words_header;
 
     /* Fields */
-    int32_t words_fields =
-        vrt_read_fields(&packet->header, b + words_total, words_buf - words_total, &packet->fields, validate);
+    int32_t words_fields = vrt_internal_read_fields_swap(
+        &packet->header, b + words_total, words_buf - words_total, &packet->fields, validate, swap);
     if (words_fields < 0) {
         return words_fields;
     }
@@ -992,7 +976,7 @@ int32_t vrt_read_packet(void* buf, int32_t words_buf, struct vrt_packet* packet,
             packet->words_body = packet->header.packet_size - words_total - (has_trailer ? 1 : 0);
 
             /* Body is actually optional */
-            if (validate) {
+            if (vrt_internal_validate_structure(validate)) {
                 if (packet->words_body < 0) {
                     return VRT_ERR_MISMATCH_PACKET_SIZE;
                 }
@@ -1011,7 +995,7 @@ int32_t vrt_read_packet(void* buf, int32_t words_buf, struct vrt_packet* packet,
         case VRT_PT_IF_CONTEXT: {
             /* IF context */
             int32_t words_if_context =
-                vrt_read_if_context(b + words_total, words_buf - words_total, &packet->if_context, validate);
+                read_if_context(b + words_total, words_buf - words_total, &packet->if_context, validate, false, swap);
             if (words_if_context < 0) {
                 return words_if_context;
             }
@@ -1024,14 +1008,15 @@ int32_t vrt_read_packet(void* buf, int32_t words_buf, struct vrt_packet* packet,
             break;
         }
         default: {
-            /* Do nothing here. Note that validation must be false to end up here. */
+            /* Do nothing here. Note that validation must be VRT_VALIDATION_NONE to end up here. */
             break;
         }
     }
 
     /* Trailer */
     if (has_trailer) {
-        int32_t words_trailer = vrt_read_trailer(b + words_total, words_buf - words_total, &packet->trailer);
+        int32_t words_trailer =
+            vrt_internal_read_trailer_swap(b + words_total, words_buf - words_total, &packet->trailer, swap);
         if (words_trailer < 0) {
             return words_trailer;
         }
@@ -1039,9 +1024,157 @@ int32_t vrt_read_packet(void* buf, int32_t words_buf, struct vrt_packet* packet,
     }
 
     /* Sanity checks */
-    if (validate && packet->header.packet_size != words_total) {
+    if (vrt_internal_validate_structure(validate) && packet->header.packet_size != words_total) {
         return VRT_ERR_MISMATCH_PACKET_SIZE;
     }
 
     return words_total;
 }
+
+/**
+ * Same as read_packet(), but compiled into a separate path for each validation level.
+ */
+static VRT_INTERNAL_FORCE_INLINE int32_t read_packet_specialized(void*               buf,
+                                                                 int32_t             words_buf,
+                                                                 struct vrt_packet*  packet,
+                                                                 enum vrt_validation validate,
+                                                                 bool                swap) {
+    switch (validate) {
+        case VRT_VALIDATION_NONE:
+            return read_packet(buf, words_buf, packet, VRT_VALIDATION_NONE, swap);
+        case VRT_VALIDATION_STRUCTURAL:
+            return read_packet(buf, words_buf, packet, VRT_VALIDATION_STRUCTURAL, swap);
+        default:
+            return read_packet(buf, words_buf, packet, VRT_VALIDATION_FULL, swap);
+    }
+}
+
+int32_t vrt_read_packet(void* buf, int32_t words_buf, struct vrt_packet* packet, enum vrt_validation validate) {
+    return read_packet_specialized(buf, words_buf, packet, validate, false);
+}
+
+int32_t vrt_read_packet_be(void* buf, int32_t words_buf, struct vrt_packet* packet, enum vrt_validation validate) {
+    return read_packet_specialized(buf, words_buf, packet, validate, VRT_INTERNAL_NETWORK_ORDER_SWAP);
+}
+
+/**
+ * Read consecutive packets into descriptors, with optional byte swapping of words.
+ *
+ * \param buf         Buffer to read from.
+ * \param words_buf   Size of buf in 32-bit words.
+ * \param descriptors Descriptors to read into.
+ * \param n           Number of descriptors.
+ * \param words_read  Number of 32-bit words consumed by complete packets, or offset of the erroneous packet.
+ * \param validate    Level of validation.
+ * \param swap        True if words shall be byte swapped.
+ *
+ * \return Number of read packets, or a negative number if error.
+ */
+static VRT_INTERNAL_FORCE_INLINE int32_t read_packets(void*                         buf,
+                                                      int32_t                       words_buf,
+                                                      struct vrt_packet_descriptor* descriptors,
+                                                      int32_t                       n,
+                                                      int32_t*                      words_read,
+                                                      enum vrt_validation           validate,
+                                                      bool                          swap) {
+    uint32_t* b      = (uint32_t*)buf;
+    int32_t   offset = 0;
+    int32_t   i      = 0;
+
+    *words_read = 0;
+
+    for (; i < n && offset < words_buf; ++i) {
+        struct vrt_packet_descriptor* d = descriptors + i;
+        uint32_t*                     p = b + offset;
+
+        /* Header. There is always room for it here. */
+        int32_t words_header = vrt_internal_read_header_swap(p, words_buf - offset, &d->header, validate, swap);
+        if (words_header < 0) {
+            *words_read = offset;
+            return words_header;
+        }
+
+        /* Stop cleanly at a packet that is cut off by end of buffer */
+        int32_t words_packet = d->header.packet_size;
+        if (words_packet > words_buf - offset) {
+            break;
+        }
+
+        /* Get the next header on its way while the current packet is decoded */
+        VRT_PREFETCH(p + words_packet);
+
+        /* Fields. Everything must fit inside the packet size, or it would be impossible to find the next packet. */
+        int32_t words_fields = vrt_internal_read_fields_swap(&d->header, p + words_header, words_packet - words_header,
+                                                             &d->fields, validate, swap);
+        if (words_fields < 0) {
+            *words_read = offset;
+            return words_fields == VRT_ERR_BUFFER_SIZE ? VRT_ERR_MISMATCH_PACKET_SIZE : words_fields;
+        }
+
+        bool    has_trailer = !vrt_is_context(&d->header) && d->header.has.trailer;
+        int32_t words_total = words_header + words_fields;
+
+        /* Body */
+        d->words_body = words_packet - words_total - (has_trailer ? 1 : 0);
+        if (d->words_body < 0) {
+            *words_read = offset;
+            return VRT_ERR_MISMATCH_PACKET_SIZE;
+        }
+        d->body = d->words_body > 0 ? p + words_total : NULL;
+
+        /* Trailer */
+        if (has_trailer) {
+            /* Cannot fail, since there is room for at least one word */
+            (void)vrt_internal_read_trailer_swap(p + words_packet - 1, 1, &d->trailer, swap);
+        } else {
+            vrt_init_trailer(&d->trailer);
+        }
+
+        d->offset = offset;
+        d->words  = words_packet;
+        offset += words_packet;
+    }
+
+    *words_read = offset;
+
+    return i;
+}
+
+/**
+ * Same as read_packets(), but compiled into a separate path for each validation level.
+ */
+static VRT_INTERNAL_FORCE_INLINE int32_t read_packets_specialized(void*                         buf,
+                                                                  int32_t                       words_buf,
+                                                                  struct vrt_packet_descriptor* descriptors,
+                                                                  int32_t                       n,
+                                                                  int32_t*                      words_read,
+                                                                  enum vrt_validation           validate,
+                                                                  bool                          swap) {
+    switch (validate) {
+        case VRT_VALIDATION_NONE:
+            return read_packets(buf, words_buf, descriptors, n, words_read, VRT_VALIDATION_NONE, swap);
+        case VRT_VALIDATION_STRUCTURAL:
+            return read_packets(buf, words_buf, descriptors, n, words_read, VRT_VALIDATION_STRUCTURAL, swap);
+        default:
+            return read_packets(buf, words_buf, descriptors, n, words_read, VRT_VALIDATION_FULL, swap);
+    }
+}
+
+int32_t vrt_read_packets(void*                         buf,
+                         int32_t                       words_buf,
+                         struct vrt_packet_descriptor* descriptors,
+                         int32_t                       n,
+                         int32_t*                      words_read,
+                         enum vrt_validation           validate) {
+    return read_packets_specialized(buf, words_buf, descriptors, n, words_read, validate, false);
+}
+
+int32_t vrt_read_packets_be(void*                         buf,
+                            int32_t                       words_buf,
+                            struct vrt_packet_descriptor* descriptors,
+                            int32_t                       n,
+                            int32_t*                      words_read,
+                            enum vrt_validation           validate) {
+    return read_packets_specialized(buf, words_buf, descriptors, n, words_read, validate,
+                                    VRT_INTERNAL_NETWORK_ORDER_SWAP);
+}
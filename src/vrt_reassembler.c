@@ -0,0 +1,373 @@
+#include "vrt/vrt_reassembler.h"
+
+#include "vrt/vrt_convert.h"
+#include "vrt/vrt_error_code.h"
+#include "vrt/vrt_types.h"
+#include "vrt/vrt_util.h"
+
+#include "vrt_util_internal.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * Square root of number of picoseconds in a second.
+ */
+static const uint64_t SQRT_PS_IN_S = 1000000;
+
+int32_t vrt_init_reassembler(struct vrt_reassembler*                      reassembler,
+                             const struct vrt_data_packet_payload_format* format,
+                             float                                        scale,
+                             double                                       sample_rate,
+                             float*                                       ring,
+                             int32_t                                      capacity,
+                             int32_t                                      overhang) {
+    if (ring != NULL ? capacity <= 0 || (capacity & (capacity - 1)) != 0 : capacity != 0) {
+        return VRT_ERR_INVALID_CAPACITY;
+    }
+    int32_t rv = vrt_init_converter(&reassembler->converter, format, scale);
+    if (rv < 0) {
+        return rv;
+    }
+
+    reassembler->ring               = ring;
+    reassembler->mask               = (uint32_t)capacity - 1;
+    reassembler->overhang           = overhang;
+    reassembler->head               = 0;
+    reassembler->tail               = 0;
+    reassembler->items_per_sample   = format->real_or_complex == VRT_ROC_REAL ? 1 : 2;
+    reassembler->sample_rate        = sample_rate >= 1.0 ? (uint64_t)sample_rate : 0;
+    reassembler->position           = 0;
+    reassembler->samples            = 0;
+    reassembler->packet_count       = 0;
+    reassembler->skipped_packets    = 0;
+    reassembler->stray_packet_count = 0;
+    reassembler->last_stray         = false;
+    reassembler->started            = false;
+    reassembler->packets            = 0;
+    reassembler->gaps               = 0;
+    reassembler->gap_items          = 0;
+    reassembler->late               = 0;
+    reassembler->count_mismatches   = 0;
+
+    return 0;
+}
+
+/**
+ * Compute number of item packing fields in a body, as the converter would, i.e. including a trailing partial sample.
+ *
+ * \param c          Converter.
+ * \param words_body Number of 32-bit words in body.
+ *
+ * \return Number of fields.
+ */
+static int64_t count_fields(const struct vrt_converter* c, int32_t words_body) {
+    if (c->link_efficient) {
+        return (int64_t)words_body * 32 / c->field_size;
+    }
+    if (c->field_size > 32) {
+        return words_body / 2;
+    }
+    return (int64_t)words_body * (32 / c->field_size);
+}
+
+/**
+ * Compute stream position of the first sample of a packet from its timestamps, if they are precise enough.
+ *
+ * \param r        Reassembler.
+ * \param header   Header of packet.
+ * \param fields   Fields of packet.
+ * \param position Position in samples, modulo 2^64.
+ *
+ * \return True if packet has a usable position.
+ */
+static bool timestamp_position(const struct vrt_reassembler* r,
+                               const struct vrt_header*      header,
+                               const struct vrt_fields*      fields,
+                               uint64_t*                     position) {
+    const uint64_t rate = r->sample_rate;
+    switch (header->tsf) {
+        case VRT_TSF_FREE_RUNNING_COUNT: {
+            *position = fields->fractional_seconds_timestamp;
+            return true;
+        }
+        case VRT_TSF_SAMPLE_COUNT: {
+            if (header->tsi == VRT_TSI_NONE || rate == 0) {
+                return false;
+            }
+            *position = fields->integer_seconds_timestamp * rate + fields->fractional_seconds_timestamp;
+            return true;
+        }
+        case VRT_TSF_REAL_TIME: {
+            if (header->tsi == VRT_TSI_NONE || rate == 0) {
+                return false;
+            }
+            /*
+             * Round ps * rate / 10^12 to nearest sample, in two steps of 10^6 to not overflow for high sample rates.
+             * Senders truncating the timestamp of a sample are off by less than a ps, so rounding recovers it.
+             */
+            const uint64_t ps = fields->fractional_seconds_timestamp;
+            const uint64_t us = (ps / SQRT_PS_IN_S) * rate + ((ps % SQRT_PS_IN_S) * rate) / SQRT_PS_IN_S;
+            *position         = fields->integer_seconds_timestamp * rate + (us + SQRT_PS_IN_S / 2) / SQRT_PS_IN_S;
+            return true;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+/**
+ * Check if a packet count is one of those skipped before the last packet, i.e. if a packet with it may be late.
+ *
+ * \param r     Reassembler.
+ * \param count Packet count.
+ *
+ * \return True if skipped.
+ */
+static bool skipped(const struct vrt_reassembler* r, uint32_t count) {
+    const uint32_t behind = vrt_packet_count_delta(r->packet_count, count);
+    return behind != 0 && behind <= VRT_REORDER_WINDOW && (r->skipped_packets & (1U << (behind - 1))) != 0;
+}
+
+/**
+ * Compute number of missing samples before a packet.
+ *
+ * \param r        Reassembler.
+ * \param header   Header of packet.
+ * \param fields   Fields of packet.
+ * \param position Position of the first sample of the packet.
+ *
+ * \return Number of missing samples, or -1 if packet is late or duplicated.
+ */
+static int64_t missing_samples(const struct vrt_reassembler* r,
+                               const struct vrt_header*      header,
+                               const struct vrt_fields*      fields,
+                               uint64_t*                     position) {
+    if (timestamp_position(r, header, fields, position)) {
+        if (!r->started) {
+            return 0;
+        }
+        const int64_t d = (int64_t)(*position - r->position);
+        return d < 0 ? -1 : d;
+    }
+
+    *position = r->position;
+    if (!r->started) {
+        return 0;
+    }
+    const uint32_t count = header->packet_count & 0x0FU;
+    int32_t        n     = vrt_packet_count_distance(count, r->packet_count);
+    if (n <= 0) {
+        /*
+         * Stream resuming after a loss of 16 - VRT_REORDER_WINDOW packets or more also looks late. Two consecutive
+         * packets that weren't skipped before are unlikely to both be late, so resynchronize to the second one.
+         */
+        if (skipped(r, count) || !r->last_stray || count != ((r->stray_packet_count + 1U) & 0x0FU)) {
+            return -1;
+        }
+        n += 16;
+    }
+    const int64_t missing = (int64_t)(n - 1) * r->samples;
+    *position += (uint64_t)missing;
+    return missing;
+}
+
+/**
+ * Save packet as the last one, and count its gap.
+ *
+ * \param r        Reassembler.
+ * \param header   Header of packet.
+ * \param missing  Number of missing samples before packet.
+ * \param position Position of the first sample of the packet.
+ * \param samples  Number of samples in packet.
+ */
+static void save(struct vrt_reassembler*  r,
+                 const struct vrt_header* header,
+                 int64_t                  missing,
+                 uint64_t                 position,
+                 uint32_t                 samples) {
+    const uint8_t packet_count = header->packet_count & 0x0FU;
+    if (r->started && missing == 0 && packet_count != ((r->packet_count + 1U) & 0x0FU)) {
+        r->count_mismatches += 1;
+    }
+    if (missing > 0) {
+        r->gaps += 1;
+        r->gap_items += (uint64_t)missing * (uint64_t)r->items_per_sample;
+    }
+    r->packets += 1;
+
+    /* Move the window, where the last packet is now d packets behind, and the d - 1 before it are skipped */
+    if (r->started) {
+        const uint32_t d = vrt_packet_count_delta(packet_count, r->packet_count);
+        r->skipped_packets = d == 0 || d > VRT_REORDER_WINDOW
+                                 ? 0xFFU
+                                 : (uint8_t)(((uint32_t)r->skipped_packets << d) | ((1U << (d - 1)) - 1));
+    }
+
+    r->position     = position + samples;
+    r->samples      = samples;
+    r->packet_count = packet_count;
+    r->last_stray   = false;
+    r->started      = true;
+}
+
+/**
+ * Drop packet as late or duplicated.
+ *
+ * \param r      Reassembler.
+ * \param header Header of packet.
+ */
+static void drop(struct vrt_reassembler* r, const struct vrt_header* header) {
+    const uint32_t count = header->packet_count & 0x0FU;
+    if (skipped(r, count)) {
+        /* Late packet arrived, so another one with the same packet count would be a duplicate */
+        r->skipped_packets &= (uint8_t)~(1U << (vrt_packet_count_delta(r->packet_count, count) - 1));
+        r->last_stray = false;
+    } else {
+        r->stray_packet_count = (uint8_t)count;
+        r->last_stray         = true;
+    }
+    r->late += 1;
+}
+
+/**
+ * Reassemble packet into ring, with optional byte swapping of body words.
+ *
+ * \param r          Reassembler.
+ * \param header     Header of packet.
+ * \param fields     Fields of packet.
+ * \param body       Body of packet.
+ * \param words_body Number of 32-bit words in body.
+ * \param be         True if body is in network byte order.
+ *
+ * \return Number of missing items before the packet, or a negative number if error.
+ */
+static int32_t reassemble(struct vrt_reassembler*  r,
+                          const struct vrt_header* header,
+                          const struct vrt_fields* fields,
+                          const void*              body,
+                          int32_t                  words_body,
+                          bool                     be) {
+    if (vrt_is_context(header)) {
+        return 0;
+    }
+
+    uint64_t      position = 0;
+    const int64_t missing  = missing_samples(r, header, fields, &position);
+    if (missing < 0) {
+        drop(r, header);
+        return 0;
+    }
+
+    /* Check all sizes up front, so nothing is written if the packet doesn't fit */
+    const uint64_t capacity = (uint64_t)r->mask + 1;
+    const uint64_t gap      = (uint64_t)missing * (uint64_t)r->items_per_sample;
+    const uint64_t fill     = gap <= capacity ? gap : 0;
+    /* The converter also writes a trailing partial sample, which isn't counted */
+    const int64_t  n_fields = count_fields(&r->converter, words_body);
+    const int64_t  items    = n_fields - n_fields % r->items_per_sample;
+    const uint64_t room     = capacity - (r->head - r->tail);
+    const uint64_t index    = (r->head + fill) & r->mask;
+    const uint64_t end      = index + (uint64_t)n_fields;
+    if (r->ring == NULL || fill + (uint64_t)n_fields > room || end > capacity + (uint64_t)r->overhang) {
+        return VRT_ERR_BUFFER_SIZE;
+    }
+
+    /* Zero-fill gap, which may wrap */
+    const uint64_t start = r->head & r->mask;
+    const uint64_t first = fill < capacity - start ? fill : capacity - start;
+    memset(r->ring + start, 0, (size_t)first * sizeof(float));
+    memset(r->ring, 0, (size_t)(fill - first) * sizeof(float));
+
+    /* Convert into place, and move what ended up in the overhang to the start of ring */
+    const int32_t n_dst = (int32_t)(capacity + (uint64_t)r->overhang - index);
+    const int32_t rv    = be ? vrt_convert_to_float_be(&r->converter, body, words_body, r->ring + index, n_dst)
+                             : vrt_convert_to_float(&r->converter, body, words_body, r->ring + index, n_dst);
+    if (rv < 0) {
+        return rv;
+    }
+    if (index + (uint64_t)items > capacity) {
+        memcpy(r->ring, r->ring + capacity, (size_t)(index + (uint64_t)items - capacity) * sizeof(float));
+    }
+
+    r->head += fill + (uint64_t)items;
+    save(r, header, missing, position, (uint32_t)(items / r->items_per_sample));
+
+    return gap <= INT32_MAX ? (int32_t)gap : INT32_MAX;
+}
+
+int32_t vrt_reassemble(struct vrt_reassembler*  reassembler,
+                       const struct vrt_header* header,
+                       const struct vrt_fields* fields,
+                       const void*              body,
+                       int32_t                  words_body) {
+    return reassemble(reassembler, header, fields, body, words_body, false);
+}
+
+int32_t vrt_reassemble_be(struct vrt_reassembler*  reassembler,
+                          const struct vrt_header* header,
+                          const struct vrt_fields* fields,
+                          const void*              body,
+                          int32_t                  words_body) {
+    return reassemble(reassembler, header, fields, body, words_body, VRT_INTERNAL_NETWORK_ORDER_SWAP);
+}
+
+void vrt_consume_reassembler(struct vrt_reassembler* reassembler, int32_t n) {
+    const uint64_t available = reassembler->head - reassembler->tail;
+    reassembler->tail += n <= 0 ? 0 : (uint64_t)n < available ? (uint64_t)n : available;
+}
+
+int32_t vrt_reassemble_spans(struct vrt_reassembler*             reassembler,
+                             const struct vrt_packet_descriptor* descriptors,
+                             int32_t                             n,
+                             struct vrt_reassembly_span*         spans,
+                             int32_t                             n_spans,
+                             int32_t*                            packets_read) {
+    const struct vrt_converter* c = &reassembler->converter;
+
+    int32_t                     n_written = 0;
+    struct vrt_reassembly_span* last      = NULL;
+    /* True if the last span ends on a word boundary without padding, so that the next body may be appended */
+    bool open = false;
+
+    int32_t i = 0;
+    for (; i < n; ++i) {
+        const struct vrt_packet_descriptor* d = &descriptors[i];
+        if (vrt_is_context(&d->header)) {
+            continue;
+        }
+
+        uint64_t      position = 0;
+        const int64_t missing  = missing_samples(reassembler, &d->header, &d->fields, &position);
+        if (missing < 0) {
+            drop(reassembler, &d->header);
+            continue;
+        }
+
+        const int64_t n_fields = count_fields(c, d->words_body);
+        const int64_t items    = n_fields - n_fields % reassembler->items_per_sample;
+        if (open && missing == 0 && (const uint32_t*)last->body + last->words == (const uint32_t*)d->body) {
+            last->words += d->words_body;
+            last->items += (int32_t)items;
+        } else {
+            if (n_written == n_spans) {
+                break;
+            }
+            last        = &spans[n_written++];
+            last->body  = d->body;
+            last->words = d->words_body;
+            last->items = (int32_t)items;
+            last->gap   = (uint64_t)missing * (uint64_t)reassembler->items_per_sample;
+        }
+        /* Padding bits in the last word, or a partial sample, would end up in the middle of the merged span */
+        open = items == n_fields && (!c->link_efficient || ((int64_t)d->words_body * 32) % c->field_size == 0);
+
+        save(reassembler, &d->header, missing, position, (uint32_t)(items / reassembler->items_per_sample));
+    }
+
+    *packets_read = i;
+    return n_written;
+}
@@ -0,0 +1,186 @@
+#include "vrt/vrt_sequencer.h"
+
+#include "vrt/vrt_error_code.h"
+#include "vrt/vrt_packet_template.h"
+#include "vrt/vrt_types.h"
+
+#include "vrt_util_internal.h"
+
+#include <stdint.h>
+
+/**
+ * Square root of number of picoseconds in a second.
+ */
+static const uint64_t SQRT_PS_IN_S = 1000000;
+
+/**
+ * Compute the fractional timestamp step of a number of samples, for TSF VRT_TSF_REAL_TIME. The step is
+ * samples * 10^12 / rate ps. It is computed in two steps of 10^6, to not overflow for high sample rates.
+ *
+ * \param samples        Number of samples.
+ * \param rate           Sample rate [Hz].
+ * \param step           Whole part of step [ps].
+ * \param step_remainder Numerator of the fractional part of the step, with rate as denominator.
+ */
+static void real_time_step(uint64_t samples, uint64_t rate, uint64_t* step, uint64_t* step_remainder) {
+    const uint64_t s  = samples / rate;
+    const uint64_t r0 = samples % rate;
+    const uint64_t q1 = r0 * SQRT_PS_IN_S / rate;
+    const uint64_t r1 = r0 * SQRT_PS_IN_S % rate;
+
+    *step           = s * SQRT_PS_IN_S * SQRT_PS_IN_S + q1 * SQRT_PS_IN_S + r1 * SQRT_PS_IN_S / rate;
+    *step_remainder = r1 * SQRT_PS_IN_S % rate;
+}
+
+/**
+ * Set how timestamps advance per packet.
+ *
+ * \param header             Header.
+ * \param fields             Fields.
+ * \param sample_rate        Sample rate [Hz].
+ * \param samples_per_packet Number of samples in each packet.
+ * \param seq                Sequencer.
+ * \param validate           Level of validation.
+ *
+ * \return 0, or a negative number if error.
+ */
+static int32_t init_steps(const struct vrt_header* header,
+                          const struct vrt_fields* fields,
+                          double                   sample_rate,
+                          uint32_t                 samples_per_packet,
+                          struct vrt_sequencer*    seq,
+                          enum vrt_validation      validate) {
+    seq->integer_seconds_timestamp    = fields->integer_seconds_timestamp;
+    seq->fractional_seconds_timestamp = fields->fractional_seconds_timestamp;
+    seq->remainder                    = 0;
+    seq->step                         = samples_per_packet;
+    seq->step_remainder               = 0;
+    seq->step_denominator             = 1;
+    seq->units_per_second             = 0;
+    seq->real_time_rate               = 0;
+    seq->samples_per_packet           = samples_per_packet;
+
+    const bool needs_rate = header->tsf == VRT_TSF_SAMPLE_COUNT || header->tsf == VRT_TSF_REAL_TIME ||
+                            (header->tsf == VRT_TSF_NONE && header->tsi != VRT_TSI_NONE);
+    if (!needs_rate) {
+        return 0;
+    }
+    if (sample_rate < 1.0) {
+        return VRT_ERR_MISSING_SAMPLE_RATE;
+    }
+    const uint64_t rate = (uint64_t)sample_rate;
+
+    switch (header->tsf) {
+        case VRT_TSF_SAMPLE_COUNT: {
+            if (vrt_internal_validate_content(validate) && seq->fractional_seconds_timestamp >= rate) {
+                return VRT_ERR_BOUNDS_SAMPLE_COUNT;
+            }
+            seq->units_per_second = rate;
+            break;
+        }
+        case VRT_TSF_REAL_TIME: {
+            if (vrt_internal_validate_content(validate) &&
+                seq->fractional_seconds_timestamp >= SQRT_PS_IN_S * SQRT_PS_IN_S) {
+                return VRT_ERR_BOUNDS_REAL_TIME;
+            }
+            real_time_step(samples_per_packet, rate, &seq->step, &seq->step_remainder);
+            seq->step_denominator = rate;
+            seq->units_per_second = SQRT_PS_IN_S * SQRT_PS_IN_S;
+            seq->real_time_rate   = rate;
+            break;
+        }
+        default: {
+            /* No fractional timestamp, so count samples within the second internally, starting from 0 */
+            seq->fractional_seconds_timestamp = 0;
+            seq->units_per_second             = rate;
+            break;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * Advance timestamps by a step.
+ *
+ * \param seq            Sequencer.
+ * \param step           Whole part of step, in TSF units.
+ * \param step_remainder Numerator of the fractional part of the step.
+ */
+static void advance(struct vrt_sequencer* seq, uint64_t step, uint64_t step_remainder) {
+    seq->fractional_seconds_timestamp += step;
+    seq->remainder += step_remainder;
+    if (seq->remainder >= seq->step_denominator) {
+        seq->remainder -= seq->step_denominator;
+        seq->fractional_seconds_timestamp += 1;
+    }
+    if (seq->units_per_second != 0 && seq->fractional_seconds_timestamp >= seq->units_per_second) {
+        /* Rarely more than one second per packet, so avoid division in the common case */
+        if (seq->fractional_seconds_timestamp < 2 * seq->units_per_second) {
+            seq->fractional_seconds_timestamp -= seq->units_per_second;
+            seq->integer_seconds_timestamp += 1;
+        } else {
+            seq->integer_seconds_timestamp += (uint32_t)(seq->fractional_seconds_timestamp / seq->units_per_second);
+            seq->fractional_seconds_timestamp %= seq->units_per_second;
+        }
+    }
+}
+
+int32_t vrt_init_sequencer(const struct vrt_header*  header,
+                           const struct vrt_fields*  fields,
+                           const struct vrt_trailer* trailer,
+                           double                    sample_rate,
+                           uint32_t                  samples_per_packet,
+                           struct vrt_sequencer*     seq,
+                           enum vrt_validation       validate) {
+    int32_t words = vrt_compile_packet_template(header, fields, trailer, &seq->tmpl, validate);
+    if (words < 0) {
+        return words;
+    }
+    int32_t rv = init_steps(header, fields, sample_rate, samples_per_packet, seq, validate);
+    return rv < 0 ? rv : words;
+}
+
+int32_t vrt_init_sequencer_be(const struct vrt_header*  header,
+                              const struct vrt_fields*  fields,
+                              const struct vrt_trailer* trailer,
+                              double                    sample_rate,
+                              uint32_t                  samples_per_packet,
+                              struct vrt_sequencer*     seq,
+                              enum vrt_validation       validate) {
+    int32_t words = vrt_compile_packet_template_be(header, fields, trailer, &seq->tmpl, validate);
+    if (words < 0) {
+        return words;
+    }
+    int32_t rv = init_steps(header, fields, sample_rate, samples_per_packet, seq, validate);
+    return rv < 0 ? rv : words;
+}
+
+int32_t vrt_write_sequenced_packet(struct vrt_sequencer* seq,
+                                   const void*           body,
+                                   int32_t               words_body,
+                                   void*                 buf,
+                                   int32_t               words_buf) {
+    int32_t rv = vrt_write_packet_template(&seq->tmpl, seq->integer_seconds_timestamp,
+                                           seq->fractional_seconds_timestamp, body, words_body, buf, words_buf);
+    if (rv < 0) {
+        return rv;
+    }
+
+    advance(seq, seq->step, seq->step_remainder);
+
+    return rv;
+}
+
+void vrt_advance_sequencer(struct vrt_sequencer* seq, uint32_t samples) {
+    if (samples == seq->samples_per_packet) {
+        advance(seq, seq->step, seq->step_remainder);
+    } else if (seq->real_time_rate != 0) {
+        uint64_t step           = 0;
+        uint64_t step_remainder = 0;
+        real_time_step(samples, seq->real_time_rate, &step, &step_remainder);
+        advance(seq, step, step_remainder);
+    } else {
+        advance(seq, samples, 0);
+    }
+}
@@ -247,6 +247,20 @@ const char* vrt_string_error(int32_t error /* Do NOT use vrt_error_code, since i
                    "differ";
         case VRT_ERR_EXPECTED_FIELD:
             return "Expected a field that was not present";
+        case VRT_ERR_INVALID_CAPACITY:
+            return "Invalid capacity";
+        case VRT_ERR_STREAMS_FULL:
+            return "No free stream entries";
+        case VRT_ERR_FILE:
+            return "File could not be opened, inspected, or memory mapped";
+        case VRT_ERR_INDEX_FORMAT:
+            return "Index file has the wrong format, version, byte order, or size";
+        case VRT_ERR_UNSUPPORTED_FORMAT:
+            return "Data packet payload format is not supported";
+        case VRT_ERR_PARTIAL_SAMPLE:
+            return "Number of items is not a whole number of samples";
+        case VRT_ERR_EXPECTED_DATA_PACKET:
+            return "Packet type is not a data packet type";
         default:
             return "Unknown";
     }
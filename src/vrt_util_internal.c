@@ -3,79 +3,22 @@
 #include "vrt/vrt_types.h"
 
 /* Defined inline in header */
-extern uint32_t vrt_b2u(bool b);
-extern uint32_t vrt_u2b(uint32_t u);
-extern bool     vrt_has_fractional_timestamp(enum vrt_tsf t);
+extern uint32_t vrt_internal_b2u(bool b);
+extern uint32_t vrt_internal_u2b(uint32_t u);
+extern bool     vrt_internal_has_fractional_timestamp(enum vrt_tsf t);
+extern bool     vrt_internal_validate_structure(enum vrt_validation v);
+extern bool     vrt_internal_validate_content(enum vrt_validation v);
+extern uint32_t vrt_internal_bswap32(uint32_t u);
+extern uint32_t vrt_internal_load(const uint32_t* b, bool swap);
+extern void     vrt_internal_store(uint32_t u, uint32_t* b, bool swap);
+extern int32_t  vrt_popcount32(uint32_t u);
+extern uint32_t vrt_if_context_indicator_word(const struct vrt_context_indicators* ind);
+extern void     vrt_if_context_indicators_from_word(uint32_t word, struct vrt_context_indicators* ind);
+extern int32_t  vrt_if_context_offset(uint32_t indicator, uint32_t bit);
+extern uint32_t vrt_packet_count_delta(uint32_t count, uint32_t last);
+extern int32_t  vrt_packet_count_distance(uint32_t count, uint32_t last);
+extern uint32_t vrt_hash_stream_id(uint32_t stream_id);
 
 int32_t vrt_words_if_context_indicator(const struct vrt_context_indicators* ind) {
-    /* For context indicator field */
-    int32_t words = 1;
-
-    /* Note that Context Field Change Identifier contributes with 0 words, since it's only in
-     * the context indicator field. */
-    if (ind->reference_point_identifier) {
-        words += 1;
-    }
-    if (ind->bandwidth) {
-        words += 2;
-    }
-    if (ind->if_reference_frequency) {
-        words += 2;
-    }
-    if (ind->rf_reference_frequency) {
-        words += 2;
-    }
-    if (ind->rf_reference_frequency_offset) {
-        words += 2;
-    }
-    if (ind->if_band_offset) {
-        words += 2;
-    }
-    if (ind->reference_level) {
-        words += 1;
-    }
-    if (ind->gain) {
-        words += 1;
-    }
-    if (ind->over_range_count) {
-        words += 1;
-    }
-    if (ind->sample_rate) {
-        words += 2;
-    }
-    if (ind->timestamp_adjustment) {
-        words += 2;
-    }
-    if (ind->timestamp_calibration_time) {
-        words += 1;
-    }
-    if (ind->temperature) {
-        words += 1;
-    }
-    if (ind->device_identifier) {
-        words += 2;
-    }
-    if (ind->state_and_event_indicators) {
-        words += 1;
-    }
-    if (ind->data_packet_payload_format) {
-        words += 2;
-    }
-    if (ind->formatted_gps_geolocation) {
-        words += 11;
-    }
-    if (ind->formatted_ins_geolocation) {
-        words += 11;
-    }
-    if (ind->ecef_ephemeris) {
-        words += 13;
-    }
-    if (ind->relative_ephemeris) {
-        words += 13;
-    }
-    if (ind->ephemeris_reference_identifier) {
-        words += 1;
-    }
-
-    return words;
+    return vrt_if_context_offset(vrt_if_context_indicator_word(ind), VRT_CIF0_BIT_GPS_ASCII);
 }
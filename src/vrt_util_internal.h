@@ -1,7 +1,10 @@
 #ifndef SRC_VRT_UTIL_H_
 #define SRC_VRT_UTIL_H_
 
+#include "vrt/detail/vrt_internal.h"
+#include "vrt/vrt_bits.h"
 #include "vrt/vrt_types.h"
+#include "vrt/vrt_util.h"
 
 #include <stdbool.h>
 #include <stdint.h>
@@ -23,37 +26,151 @@ static const uint64_t VRT_UNSPECIFIED_TSF = 0xFFFFFFFFFFFFFFFFU;
  */
 static const uint32_t VRT_UNSPECIFIED_FIXED_POINT = 0x7FFFFFFFU;
 
+/* Hint that memory at address p will soon be read. Never faults, even on an invalid address. */
+#if defined(__GNUC__) || defined(__clang__)
+#define VRT_PREFETCH(p) __builtin_prefetch((p), 0, 3)
+#else
+#define VRT_PREFETCH(p) ((void)(p))
+#endif
+
+/**
+ * Context indicator field bits of fields that are 1 word long.
+ */
+#define VRT_CIF0_WORDS_1                                                                                      \
+    (VRT_BITS_MASK(VRT_BITS_CIF0_REFERENCE_POINT_IDENTIFIER) | VRT_BITS_MASK(VRT_BITS_CIF0_REFERENCE_LEVEL) | \
+     VRT_BITS_MASK(VRT_BITS_CIF0_GAIN) | VRT_BITS_MASK(VRT_BITS_CIF0_OVER_RANGE_COUNT) |                      \
+     VRT_BITS_MASK(VRT_BITS_CIF0_TIMESTAMP_CALIBRATION_TIME) | VRT_BITS_MASK(VRT_BITS_CIF0_TEMPERATURE) |     \
+     VRT_BITS_MASK(VRT_BITS_CIF0_STATE_AND_EVENT_INDICATORS) |                                                \
+     VRT_BITS_MASK(VRT_BITS_CIF0_EPHEMERIS_REFERENCE_IDENTIFIER))
+/**
+ * Context indicator field bits of fields that are 2 words long.
+ */
+#define VRT_CIF0_WORDS_2                                                                                        \
+    (VRT_BITS_MASK(VRT_BITS_CIF0_BANDWIDTH) | VRT_BITS_MASK(VRT_BITS_CIF0_IF_REFERENCE_FREQUENCY) |             \
+     VRT_BITS_MASK(VRT_BITS_CIF0_RF_REFERENCE_FREQUENCY) |                                                      \
+     VRT_BITS_MASK(VRT_BITS_CIF0_RF_REFERENCE_FREQUENCY_OFFSET) | VRT_BITS_MASK(VRT_BITS_CIF0_IF_BAND_OFFSET) | \
+     VRT_BITS_MASK(VRT_BITS_CIF0_SAMPLE_RATE) | VRT_BITS_MASK(VRT_BITS_CIF0_TIMESTAMP_ADJUSTMENT) |             \
+     VRT_BITS_MASK(VRT_BITS_CIF0_DEVICE_IDENTIFIER) | VRT_BITS_MASK(VRT_BITS_CIF0_DATA_PACKET_PAYLOAD_FORMAT))
 /**
- * Convert bool to uint32.
+ * Context indicator field bits of fields that are 11 words long, i.e. Formatted GPS/INS geolocation.
+ */
+#define VRT_CIF0_WORDS_11                                                                                             \
+    (VRT_BITS_MASK(VRT_BITS_CIF0_FORMATTED_GPS_GEOLOCATION) | VRT_BITS_MASK(VRT_BITS_CIF0_FORMATTED_INS_GEOLOCATION))
+/**
+ * Context indicator field bits of fields that are 13 words long, i.e. ECEF/Relative ephemeris.
+ */
+#define VRT_CIF0_WORDS_13                                                                           \
+    (VRT_BITS_MASK(VRT_BITS_CIF0_ECEF_EPHEMERIS) | VRT_BITS_MASK(VRT_BITS_CIF0_RELATIVE_EPHEMERIS))
+/**
+ * Context indicator field bits of all fields with fixed size.
+ */
+#define VRT_CIF0_WORDS_FIXED (VRT_CIF0_WORDS_1 | VRT_CIF0_WORDS_2 | VRT_CIF0_WORDS_11 | VRT_CIF0_WORDS_13)
+/**
+ * Context indicator field bit of GPS ASCII, which is the first field of variable size.
+ */
+static const uint32_t VRT_CIF0_BIT_GPS_ASCII = VRT_BITS_POS(VRT_BITS_CIF0_GPS_ASCII);
+
+/**
+ * Count number of set bits in a word. The builtin is only used where it is a single instruction, since it otherwise
+ * compiles to a library call that is slower than the portable version.
  *
- * \param b Bool to convert.
+ * \param u Word.
  *
- * \return 1 if true and 0 otherwise.
+ * \return Number of set bits.
  */
-inline uint32_t vrt_b2u(bool b) {
-    return b ? 1 : 0;
+inline int32_t vrt_popcount32(uint32_t u) {
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__POPCNT__) || defined(__aarch64__))
+    return __builtin_popcount(u);
+#else
+    u = u - ((u >> 1U) & 0x55555555U);
+    u = (u & 0x33333333U) + ((u >> 2U) & 0x33333333U);
+    u = (u + (u >> 4U)) & 0x0F0F0F0FU;
+    return (int32_t)((u * 0x01010101U) >> 24U);
+#endif
 }
 
 /**
- * Convert uint32 to bool.
+ * Build context indicator field word from the indicator struct. The context field change indicator bit is not set.
  *
- * \param u uint32 to convert.
+ * \param ind Context indicators.
+ *
+ * \return Context indicator field word.
+ */
+inline uint32_t vrt_if_context_indicator_word(const struct vrt_context_indicators* ind) {
+    return vrt_mskw(vrt_internal_b2u(ind->reference_point_identifier), VRT_BITS_CIF0_REFERENCE_POINT_IDENTIFIER) |
+           vrt_mskw(vrt_internal_b2u(ind->bandwidth), VRT_BITS_CIF0_BANDWIDTH) |
+           vrt_mskw(vrt_internal_b2u(ind->if_reference_frequency), VRT_BITS_CIF0_IF_REFERENCE_FREQUENCY) |
+           vrt_mskw(vrt_internal_b2u(ind->rf_reference_frequency), VRT_BITS_CIF0_RF_REFERENCE_FREQUENCY) |
+           vrt_mskw(vrt_internal_b2u(ind->rf_reference_frequency_offset), VRT_BITS_CIF0_RF_REFERENCE_FREQUENCY_OFFSET) |
+           vrt_mskw(vrt_internal_b2u(ind->if_band_offset), VRT_BITS_CIF0_IF_BAND_OFFSET) |
+           vrt_mskw(vrt_internal_b2u(ind->reference_level), VRT_BITS_CIF0_REFERENCE_LEVEL) |
+           vrt_mskw(vrt_internal_b2u(ind->gain), VRT_BITS_CIF0_GAIN) |
+           vrt_mskw(vrt_internal_b2u(ind->over_range_count), VRT_BITS_CIF0_OVER_RANGE_COUNT) |
+           vrt_mskw(vrt_internal_b2u(ind->sample_rate), VRT_BITS_CIF0_SAMPLE_RATE) |
+           vrt_mskw(vrt_internal_b2u(ind->timestamp_adjustment), VRT_BITS_CIF0_TIMESTAMP_ADJUSTMENT) |
+           vrt_mskw(vrt_internal_b2u(ind->timestamp_calibration_time), VRT_BITS_CIF0_TIMESTAMP_CALIBRATION_TIME) |
+           vrt_mskw(vrt_internal_b2u(ind->temperature), VRT_BITS_CIF0_TEMPERATURE) |
+           vrt_mskw(vrt_internal_b2u(ind->device_identifier), VRT_BITS_CIF0_DEVICE_IDENTIFIER) |
+           vrt_mskw(vrt_internal_b2u(ind->state_and_event_indicators), VRT_BITS_CIF0_STATE_AND_EVENT_INDICATORS) |
+           vrt_mskw(vrt_internal_b2u(ind->data_packet_payload_format), VRT_BITS_CIF0_DATA_PACKET_PAYLOAD_FORMAT) |
+           vrt_mskw(vrt_internal_b2u(ind->formatted_gps_geolocation), VRT_BITS_CIF0_FORMATTED_GPS_GEOLOCATION) |
+           vrt_mskw(vrt_internal_b2u(ind->formatted_ins_geolocation), VRT_BITS_CIF0_FORMATTED_INS_GEOLOCATION) |
+           vrt_mskw(vrt_internal_b2u(ind->ecef_ephemeris), VRT_BITS_CIF0_ECEF_EPHEMERIS) |
+           vrt_mskw(vrt_internal_b2u(ind->relative_ephemeris), VRT_BITS_CIF0_RELATIVE_EPHEMERIS) |
+           vrt_mskw(vrt_internal_b2u(ind->ephemeris_reference_identifier),
+                    VRT_BITS_CIF0_EPHEMERIS_REFERENCE_IDENTIFIER) |
+           vrt_mskw(vrt_internal_b2u(ind->gps_ascii), VRT_BITS_CIF0_GPS_ASCII) |
+           vrt_mskw(vrt_internal_b2u(ind->context_association_lists), VRT_BITS_CIF0_CONTEXT_ASSOCIATION_LISTS);
+}
+
+/**
+ * Decode context indicator field word into the indicator struct. The context field change indicator and reserved bits
+ * are ignored.
  *
- * \return false if 0 and true otherwise.
+ * \param word Context indicator field word.
+ * \param ind  Context indicators to decode into.
  */
-inline uint32_t vrt_u2b(uint32_t u) {
-    return u != 0;
+inline void vrt_if_context_indicators_from_word(uint32_t word, struct vrt_context_indicators* ind) {
+    ind->reference_point_identifier     = vrt_internal_u2b(vrt_mskr(word, VRT_BITS_CIF0_REFERENCE_POINT_IDENTIFIER));
+    ind->bandwidth                      = vrt_internal_u2b(vrt_mskr(word, VRT_BITS_CIF0_BANDWIDTH));
+    ind->if_reference_frequency         = vrt_internal_u2b(vrt_mskr(word, VRT_BITS_CIF0_IF_REFERENCE_FREQUENCY));
+    ind->rf_reference_frequency         = vrt_internal_u2b(vrt_mskr(word, VRT_BITS_CIF0_RF_REFERENCE_FREQUENCY));
+    ind->rf_reference_frequency_offset  = vrt_internal_u2b(vrt_mskr(word, VRT_BITS_CIF0_RF_REFERENCE_FREQUENCY_OFFSET));
+    ind->if_band_offset                 = vrt_internal_u2b(vrt_mskr(word, VRT_BITS_CIF0_IF_BAND_OFFSET));
+    ind->reference_level                = vrt_internal_u2b(vrt_mskr(word, VRT_BITS_CIF0_REFERENCE_LEVEL));
+    ind->gain                           = vrt_internal_u2b(vrt_mskr(word, VRT_BITS_CIF0_GAIN));
+    ind->over_range_count               = vrt_internal_u2b(vrt_mskr(word, VRT_BITS_CIF0_OVER_RANGE_COUNT));
+    ind->sample_rate                    = vrt_internal_u2b(vrt_mskr(word, VRT_BITS_CIF0_SAMPLE_RATE));
+    ind->timestamp_adjustment           = vrt_internal_u2b(vrt_mskr(word, VRT_BITS_CIF0_TIMESTAMP_ADJUSTMENT));
+    ind->timestamp_calibration_time     = vrt_internal_u2b(vrt_mskr(word, VRT_BITS_CIF0_TIMESTAMP_CALIBRATION_TIME));
+    ind->temperature                    = vrt_internal_u2b(vrt_mskr(word, VRT_BITS_CIF0_TEMPERATURE));
+    ind->device_identifier              = vrt_internal_u2b(vrt_mskr(word, VRT_BITS_CIF0_DEVICE_IDENTIFIER));
+    ind->state_and_event_indicators     = vrt_internal_u2b(vrt_mskr(word, VRT_BITS_CIF0_STATE_AND_EVENT_INDICATORS));
+    ind->data_packet_payload_format     = vrt_internal_u2b(vrt_mskr(word, VRT_BITS_CIF0_DATA_PACKET_PAYLOAD_FORMAT));
+    ind->formatted_gps_geolocation      = vrt_internal_u2b(vrt_mskr(word, VRT_BITS_CIF0_FORMATTED_GPS_GEOLOCATION));
+    ind->formatted_ins_geolocation      = vrt_internal_u2b(vrt_mskr(word, VRT_BITS_CIF0_FORMATTED_INS_GEOLOCATION));
+    ind->ecef_ephemeris                 = vrt_internal_u2b(vrt_mskr(word, VRT_BITS_CIF0_ECEF_EPHEMERIS));
+    ind->relative_ephemeris             = vrt_internal_u2b(vrt_mskr(word, VRT_BITS_CIF0_RELATIVE_EPHEMERIS));
+    ind->ephemeris_reference_identifier =
+        vrt_internal_u2b(vrt_mskr(word, VRT_BITS_CIF0_EPHEMERIS_REFERENCE_IDENTIFIER));
+    ind->gps_ascii                      = vrt_internal_u2b(vrt_mskr(word, VRT_BITS_CIF0_GPS_ASCII));
+    ind->context_association_lists      = vrt_internal_u2b(vrt_mskr(word, VRT_BITS_CIF0_CONTEXT_ASSOCIATION_LISTS));
 }
 
 /**
- * Check if a packet has the fractional timestamp.
+ * Calculate offset of a fixed size IF context field from the start of the IF context section, i.e. the total size of
+ * the indicator field and all fields preceding it. Since all fields up to GPS ASCII have a fixed size, this is a
+ * weighted count of the indicator bits more significant than the field bit. No branches are involved.
  *
- * \param t TSF field.
+ * \param indicator Context indicator field word.
+ * \param bit       Indicator bit position of field, in [9, 31]. Bit 9 gives the total size of the fixed size fields.
  *
- * \return true if it has the fractional timestamp.
+ * \return Offset in 32-bit words.
  */
-inline bool vrt_has_fractional_timestamp(enum vrt_tsf t) {
-    return t != VRT_TSF_NONE;
+inline int32_t vrt_if_context_offset(uint32_t indicator, uint32_t bit) {
+    const uint32_t i = indicator & (0xFFFFFFFFU << bit << 1U);
+    return 1 + vrt_popcount32(i & VRT_CIF0_WORDS_1) + 2 * vrt_popcount32(i & VRT_CIF0_WORDS_2) +
+           11 * vrt_popcount32(i & VRT_CIF0_WORDS_11) + 13 * vrt_popcount32(i & VRT_CIF0_WORDS_13);
 }
 
 /**
@@ -69,6 +186,51 @@ inline bool vrt_has_fractional_timestamp(enum vrt_tsf t) {
  */
 int32_t vrt_words_if_context_indicator(const struct vrt_context_indicators* ind);
 
+/**
+ * Largest number of packets a packet count may be behind the last one in order to count as late, when there are no
+ * timestamps to tell. Counts further behind are taken as ahead instead, i.e. as lost packets.
+ */
+#define VRT_REORDER_WINDOW 8U
+
+/**
+ * Compute number of steps from one packet count to another, modulo 16.
+ *
+ * \param count Packet count.
+ * \param last  Packet count to count from.
+ *
+ * \return Number of steps, in [0, 15].
+ */
+inline uint32_t vrt_packet_count_delta(uint32_t count, uint32_t last) {
+    return (count - last) & 0x0FU;
+}
+
+/**
+ * Classify a packet count against the last one in order, from the packet counts alone.
+ *
+ * \param count Packet count.
+ * \param last  Packet count of the last packet in order.
+ *
+ * \return Number of packets ahead of last, in [1, 16 - VRT_REORDER_WINDOW), 0 if the same, or minus the number of
+ *         packets behind last, in [-VRT_REORDER_WINDOW, -1], if late.
+ */
+inline int32_t vrt_packet_count_distance(uint32_t count, uint32_t last) {
+    const uint32_t d = vrt_packet_count_delta(count, last);
+    return d >= 16 - VRT_REORDER_WINDOW ? (int32_t)d - 16 : (int32_t)d;
+}
+
+/**
+ * Hash stream ID, for open addressing hash tables. Stream IDs often only differ in a few low bits, so mix them into all
+ * bits.
+ *
+ * \param stream_id Stream ID.
+ *
+ * \return Hash.
+ */
+inline uint32_t vrt_hash_stream_id(uint32_t stream_id) {
+    const uint32_t h = stream_id * 0x9E3779B1U;
+    return h ^ (h >> 16U);
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,442 @@
+#include "vrt/vrt_validate.h"
+
+#include "vrt/vrt_bits.h"
+#include "vrt/vrt_error_code.h"
+
+#include "vrt_util_internal.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * Smallest valid raw Temperature field, i.e. -273.15 degrees C with radix 6, rounded up.
+ */
+static const int32_t MIN_RAW_TEMPERATURE = -17481;
+
+/**
+ * Largest raw latitude, i.e. 90 degrees with radix 22.
+ */
+static const int32_t MAX_RAW_LATITUDE = 90 << 22;
+
+/**
+ * Largest raw longitude and magnetic variation, i.e. 180 degrees with radix 22.
+ */
+static const int32_t MAX_RAW_LONGITUDE = 180 << 22;
+
+/**
+ * Largest raw heading and track angle, i.e. just below 360 degrees with radix 22.
+ */
+static const int32_t MAX_RAW_HEADING = (360 << 22) - 1;
+
+/**
+ * Load 64-bit unsigned integer from two words, most significant first.
+ *
+ * \param b    Buffer to read from.
+ * \param swap True if words shall be byte swapped.
+ *
+ * \return Integer.
+ */
+static inline uint64_t load_uint64(const uint32_t* b, bool swap) {
+    return (uint64_t)vrt_internal_load(b, swap) << 32U | vrt_internal_load(b + 1, swap);
+}
+
+/**
+ * Check if a raw angle is outside bounds, unless it is unspecified.
+ *
+ * \param w   Raw angle word.
+ * \param min Smallest valid raw angle.
+ * \param max Largest valid raw angle.
+ *
+ * \return True if outside bounds.
+ */
+static inline bool angle_outside(uint32_t w, int32_t min, int32_t max) {
+    return w != VRT_UNSPECIFIED_FIXED_POINT && ((int32_t)w < min || (int32_t)w > max);
+}
+
+/**
+ * Validate timestamp words that lead formatted geolocation and ephemeris fields.
+ *
+ * \param b    Field words.
+ * \param swap True if words shall be byte swapped.
+ *
+ * \return 0, or a negative number if error.
+ */
+static inline int32_t validate_position_timestamp(const uint32_t* b, bool swap) {
+    const uint32_t w0                          = vrt_internal_load(b, swap);
+    const uint32_t tsi                         = (w0 >> 26U) & 0x3U;
+    const uint32_t tsf                         = (w0 >> 24U) & 0x3U;
+    const uint64_t fractional_second_timestamp = load_uint64(b + 2, swap);
+    if ((w0 & 0xF0000000U) != 0) {
+        return VRT_ERR_RESERVED;
+    }
+    if (tsi == VRT_TSI_UNDEFINED && vrt_internal_load(b + 1, swap) != VRT_UNSPECIFIED_TSI) {
+        return VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP;
+    }
+    if (tsf == VRT_TSF_UNDEFINED && fractional_second_timestamp != VRT_UNSPECIFIED_TSF) {
+        return VRT_ERR_SET_FRACTIONAL_SECOND_TIMESTAMP;
+    }
+    if (tsf == VRT_TSF_REAL_TIME && fractional_second_timestamp >= (uint64_t)1000000000000) {
+        return VRT_ERR_BOUNDS_REAL_TIME;
+    }
+
+    return 0;
+}
+
+/**
+ * Validate formatted GPS/INS geolocation field.
+ *
+ * \param b    Field words.
+ * \param swap True if words shall be byte swapped.
+ *
+ * \return 0, or a negative number if error.
+ */
+static inline int32_t validate_formatted_geolocation(const uint32_t* b, bool swap) {
+    int32_t rv = validate_position_timestamp(b, swap);
+    if (rv < 0) {
+        return rv;
+    }
+    if (angle_outside(vrt_internal_load(b + 4, swap), -MAX_RAW_LATITUDE, MAX_RAW_LATITUDE)) {
+        return VRT_ERR_BOUNDS_LATITUDE;
+    }
+    if (angle_outside(vrt_internal_load(b + 5, swap), -MAX_RAW_LONGITUDE, MAX_RAW_LONGITUDE)) {
+        return VRT_ERR_BOUNDS_LONGITUDE;
+    }
+    if (angle_outside(vrt_internal_load(b + 8, swap), 0, MAX_RAW_HEADING)) {
+        return VRT_ERR_BOUNDS_HEADING_ANGLE;
+    }
+    if (angle_outside(vrt_internal_load(b + 9, swap), 0, MAX_RAW_HEADING)) {
+        return VRT_ERR_BOUNDS_TRACK_ANGLE;
+    }
+    if (angle_outside(vrt_internal_load(b + 10, swap), -MAX_RAW_LONGITUDE, MAX_RAW_LONGITUDE)) {
+        return VRT_ERR_BOUNDS_MAGNETIC_VARIATION;
+    }
+
+    return 0;
+}
+
+/**
+ * Load first word of a fixed size IF context field.
+ *
+ * \param b         Buffer with IF context section.
+ * \param indicator Context indicator field word.
+ * \param bit       Indicator bit position of field.
+ * \param swap      True if words shall be byte swapped.
+ *
+ * \return Word in host order.
+ */
+static inline uint32_t load_field(const uint32_t* b, uint32_t indicator, uint32_t bit, bool swap) {
+    return vrt_internal_load(b + vrt_if_context_offset(indicator, bit), swap);
+}
+
+/**
+ * Validate IF context section, with optional byte swapping of words. The checks are the same as in
+ * vrt_read_if_context(), but done on the raw words in the same order.
+ *
+ * \param buf       Buffer with IF context section.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param swap      True if words shall be byte swapped.
+ *
+ * \return Number of words in section, or a negative number if error.
+ */
+static VRT_INTERNAL_FORCE_INLINE int32_t validate_if_context(const uint32_t* buf, int32_t words_buf, bool swap) {
+    if (words_buf < 1) {
+        return VRT_ERR_BUFFER_SIZE;
+    }
+    const uint32_t indicator = vrt_internal_load(buf, swap);
+    if (vrt_mskr(indicator, VRT_BITS_CIF0_RESERVED) != 0) {
+        return VRT_ERR_RESERVED;
+    }
+    int32_t words = vrt_if_context_offset(indicator, VRT_CIF0_BIT_GPS_ASCII);
+    if (words_buf < words) {
+        return VRT_ERR_BUFFER_SIZE;
+    }
+
+    /* Fields with something to validate, at their offsets */
+    const uint32_t* b = buf;
+    if (vrt_mskr(indicator, VRT_BITS_CIF0_BANDWIDTH) != 0) {
+        if ((int32_t)load_field(b, indicator, VRT_BITS_POS(VRT_BITS_CIF0_BANDWIDTH), swap) < 0) {
+            return VRT_ERR_BOUNDS_BANDWIDTH;
+        }
+    }
+    if (vrt_mskr(indicator, VRT_BITS_CIF0_REFERENCE_LEVEL) != 0) {
+        if ((load_field(b, indicator, VRT_BITS_POS(VRT_BITS_CIF0_REFERENCE_LEVEL), swap) & 0xFFFF0000U) != 0) {
+            return VRT_ERR_RESERVED;
+        }
+    }
+    if (vrt_mskr(indicator, VRT_BITS_CIF0_GAIN) != 0) {
+        /* Rule 7.1.5.10-6: Stage 2 gain must be zero when stage 1 gain is */
+        const uint32_t w = load_field(b, indicator, VRT_BITS_POS(VRT_BITS_CIF0_GAIN), swap);
+        if ((w & 0xFFFF0000U) != 0 && (w & 0x0000FFFFU) == 0) {
+            return VRT_ERR_GAIN_STAGE2_SET;
+        }
+    }
+    if (vrt_mskr(indicator, VRT_BITS_CIF0_SAMPLE_RATE) != 0) {
+        if ((int32_t)load_field(b, indicator, VRT_BITS_POS(VRT_BITS_CIF0_SAMPLE_RATE), swap) < 0) {
+            return VRT_ERR_BOUNDS_SAMPLE_RATE;
+        }
+    }
+    if (vrt_mskr(indicator, VRT_BITS_CIF0_TEMPERATURE) != 0) {
+        const uint32_t w = load_field(b, indicator, VRT_BITS_POS(VRT_BITS_CIF0_TEMPERATURE), swap);
+        if ((int16_t)(w & 0x0000FFFFU) < MIN_RAW_TEMPERATURE) {
+            return VRT_ERR_BOUNDS_TEMPERATURE;
+        }
+        if ((w & 0xFFFF0000U) != 0) {
+            return VRT_ERR_RESERVED;
+        }
+    }
+    if (vrt_mskr(indicator, VRT_BITS_CIF0_DEVICE_IDENTIFIER) != 0) {
+        const uint32_t* d = b + vrt_if_context_offset(indicator, VRT_BITS_POS(VRT_BITS_CIF0_DEVICE_IDENTIFIER));
+        if ((vrt_internal_load(d, swap) & 0xFF000000U) != 0 || (vrt_internal_load(d + 1, swap) & 0xFFFF0000U) != 0) {
+            return VRT_ERR_RESERVED;
+        }
+    }
+    if (vrt_mskr(indicator, VRT_BITS_CIF0_STATE_AND_EVENT_INDICATORS) != 0) {
+        const uint32_t w = load_field(b, indicator, VRT_BITS_POS(VRT_BITS_CIF0_STATE_AND_EVENT_INDICATORS), swap);
+        if (vrt_mskr(w, VRT_BITS_STATE_AND_EVENT_RESERVED_HIGH) != 0 ||
+            vrt_mskr(w, VRT_BITS_STATE_AND_EVENT_RESERVED_LOW) != 0) {
+            return VRT_ERR_RESERVED;
+        }
+    }
+    if (vrt_mskr(indicator, VRT_BITS_CIF0_DATA_PACKET_PAYLOAD_FORMAT) != 0) {
+        const uint32_t w = load_field(b, indicator, VRT_BITS_POS(VRT_BITS_CIF0_DATA_PACKET_PAYLOAD_FORMAT), swap);
+
+        const uint32_t data_item_format = (w >> 24U) & 0x1FU;
+        if (((w >> 29U) & 0x3U) > VRT_ROC_COMPLEX_POLAR) {
+            return VRT_ERR_INVALID_REAL_OR_COMPLEX;
+        }
+        if ((data_item_format > VRT_DIF_SIGNED_VRT_6_BIT_EXPONENT &&
+             data_item_format < VRT_DIF_IEEE_754_SINGLE_PRECISION_FLOATING_POINT) ||
+            data_item_format > VRT_DIF_UNSIGNED_VRT_6_BIT_EXPONENT) {
+            return VRT_ERR_INVALID_DATA_ITEM_FORMAT;
+        }
+        if ((w & 0x0000F000U) != 0) {
+            return VRT_ERR_RESERVED;
+        }
+    }
+    for (uint32_t bit = VRT_BITS_POS(VRT_BITS_CIF0_FORMATTED_GPS_GEOLOCATION);
+         bit >= VRT_BITS_POS(VRT_BITS_CIF0_FORMATTED_INS_GEOLOCATION); --bit) {
+        if ((indicator & (1U << bit)) != 0) {
+            int32_t rv = validate_formatted_geolocation(b + vrt_if_context_offset(indicator, bit), swap);
+            if (rv < 0) {
+                return rv;
+            }
+        }
+    }
+    for (uint32_t bit = VRT_BITS_POS(VRT_BITS_CIF0_ECEF_EPHEMERIS);
+         bit >= VRT_BITS_POS(VRT_BITS_CIF0_RELATIVE_EPHEMERIS); --bit) {
+        if ((indicator & (1U << bit)) != 0) {
+            int32_t rv = validate_position_timestamp(b + vrt_if_context_offset(indicator, bit), swap);
+            if (rv < 0) {
+                return rv;
+            }
+        }
+    }
+
+    /* Variable size fields, where the size is found inside the field itself */
+    if (vrt_mskr(indicator, VRT_BITS_CIF0_GPS_ASCII) != 0) {
+        if (words_buf < words + 2) {
+            return VRT_ERR_BUFFER_SIZE;
+        }
+        uint32_t number_of_words = vrt_internal_load(b + words + 1, swap);
+        if (number_of_words > (uint32_t)(words_buf - words - 2)) {
+            return VRT_ERR_BUFFER_SIZE;
+        }
+        if ((vrt_internal_load(b + words, swap) & 0xFF000000U) != 0) {
+            return VRT_ERR_RESERVED;
+        }
+        words += 2 + (int32_t)number_of_words;
+    }
+    if (vrt_mskr(indicator, VRT_BITS_CIF0_CONTEXT_ASSOCIATION_LISTS) != 0) {
+        if (words_buf < words + 2) {
+            return VRT_ERR_BUFFER_SIZE;
+        }
+        uint32_t w0 = vrt_internal_load(b + words, swap);
+        uint32_t w1 = vrt_internal_load(b + words + 1, swap);
+        uint32_t n  = ((w0 >> 16U) & 0x01FFU) + (w0 & 0x01FFU) + (w1 >> 16U);
+        uint32_t n4 = w1 & 0x7FFFU;
+        n += (w1 & 0x8000U) != 0 ? 2 * n4 : n4;
+        if (n > (uint32_t)(words_buf - words - 2)) {
+            return VRT_ERR_BUFFER_SIZE;
+        }
+        words += 2 + (int32_t)n;
+    }
+
+    return words;
+}
+
+/**
+ * Validate header word.
+ *
+ * \param h Header word in host byte order.
+ *
+ * \return 0, or a negative number if error.
+ */
+static inline int32_t validate_header(uint32_t h) {
+    const uint32_t packet_type = vrt_mskr(h, VRT_BITS_HEADER_PACKET_TYPE);
+    if (packet_type > VRT_PT_EXT_CONTEXT) {
+        return VRT_ERR_INVALID_PACKET_TYPE;
+    }
+    if ((packet_type & 0x4U) != 0) {
+        /* Context packet */
+        if (vrt_mskr(h, VRT_BITS_HEADER_HAS_TRAILER) != 0) {
+            return VRT_ERR_TRAILER_IN_CONTEXT;
+        }
+    } else if (vrt_mskr(h, VRT_BITS_HEADER_TSM) != 0) {
+        return VRT_ERR_TSM_IN_DATA;
+    }
+    if (vrt_mskr(h, VRT_BITS_HEADER_RESERVED) != 0) {
+        return VRT_ERR_RESERVED;
+    }
+
+    return 0;
+}
+
+/**
+ * Validate packet, with optional byte swapping of words.
+ *
+ * \param buf       Buffer with packet.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param swap      True if words shall be byte swapped.
+ *
+ * \return Number of words in packet, or a negative number if error.
+ */
+static VRT_INTERNAL_FORCE_INLINE int32_t validate_packet(const uint32_t* buf, int32_t words_buf, bool swap) {
+    if (words_buf < 1) {
+        return VRT_ERR_BUFFER_SIZE;
+    }
+
+    /* Header */
+    const uint32_t h  = vrt_internal_load(buf, swap);
+    int32_t        rv = validate_header(h);
+    if (rv < 0) {
+        return rv;
+    }
+    const uint32_t packet_type = vrt_mskr(h, VRT_BITS_HEADER_PACKET_TYPE);
+    const bool     context     = (packet_type & 0x4U) != 0;
+    const uint32_t tsi         = vrt_mskr(h, VRT_BITS_HEADER_TSI);
+    const uint32_t tsf         = vrt_mskr(h, VRT_BITS_HEADER_TSF);
+    const int32_t  packet_size = (int32_t)vrt_mskr(h, VRT_BITS_HEADER_PACKET_SIZE);
+
+    /* Fields */
+    const uint32_t* b           = buf + 1;
+    const bool      has_class   = vrt_mskr(h, VRT_BITS_HEADER_HAS_CLASS_ID) != 0;
+    const int32_t   words_total = 1 + vrt_internal_b2u((packet_type & 0x5U) != 0) + 2 * vrt_internal_b2u(has_class) +
+                                vrt_internal_b2u(tsi != VRT_TSI_NONE) + 2 * vrt_internal_b2u(tsf != VRT_TSF_NONE);
+    if (words_buf < words_total) {
+        return VRT_ERR_BUFFER_SIZE;
+    }
+    b += vrt_internal_b2u((packet_type & 0x5U) != 0);
+    if (has_class) {
+        if ((vrt_internal_load(b, swap) & 0xFF000000U) != 0) {
+            return VRT_ERR_RESERVED;
+        }
+        b += 2;
+    }
+    b += vrt_internal_b2u(tsi != VRT_TSI_NONE);
+    if (tsf == VRT_TSF_REAL_TIME && load_uint64(b, swap) >= (uint64_t)1000000000000) {
+        return VRT_ERR_BOUNDS_REAL_TIME;
+    }
+
+    /* Body */
+    const bool has_trailer = !context && vrt_mskr(h, VRT_BITS_HEADER_HAS_TRAILER) != 0;
+    int32_t    words       = words_total;
+    if (packet_type == VRT_PT_IF_CONTEXT) {
+        int32_t words_if_context = validate_if_context(buf + words, words_buf - words, swap);
+        if (words_if_context < 0) {
+            return words_if_context;
+        }
+        words += words_if_context;
+    } else {
+        int32_t words_body = packet_size - words - (has_trailer ? 1 : 0);
+        if (words_body < 0) {
+            return VRT_ERR_MISMATCH_PACKET_SIZE;
+        }
+        words += words_body;
+        if (words > words_buf) {
+            return VRT_ERR_BUFFER_SIZE;
+        }
+    }
+
+    /* Trailer */
+    if (has_trailer) {
+        words += 1;
+        if (words > words_buf) {
+            return VRT_ERR_BUFFER_SIZE;
+        }
+    }
+
+    if (packet_size != words) {
+        return VRT_ERR_MISMATCH_PACKET_SIZE;
+    }
+
+    return words;
+}
+
+int32_t vrt_validate_packet(const void* buf, int32_t words_buf) {
+    return validate_packet((const uint32_t*)buf, words_buf, false);
+}
+
+int32_t vrt_validate_packet_be(const void* buf, int32_t words_buf) {
+    return validate_packet((const uint32_t*)buf, words_buf, VRT_INTERNAL_NETWORK_ORDER_SWAP);
+}
+
+/**
+ * Validate consecutive packets, with optional byte swapping of words.
+ *
+ * \param buf        Buffer with packets.
+ * \param words_buf  Size of buf in 32-bit words.
+ * \param words_read Number of 32-bit words consumed by valid packets, or offset of the erroneous packet.
+ * \param swap       True if words shall be byte swapped.
+ *
+ * \return Number of valid packets, or a negative number if error.
+ */
+static VRT_INTERNAL_FORCE_INLINE int32_t validate_packets(const void* buf,
+                                                          int32_t     words_buf,
+                                                          int32_t*    words_read,
+                                                          bool        swap) {
+    const uint32_t* b      = (const uint32_t*)buf;
+    int32_t         offset = 0;
+    int32_t         i      = 0;
+
+    for (; offset < words_buf; ++i) {
+        const uint32_t* p = b + offset;
+
+        /* Header. There is always room for it here. */
+        const uint32_t h  = vrt_internal_load(p, swap);
+        int32_t        rv = validate_header(h);
+        if (rv < 0) {
+            *words_read = offset;
+            return rv;
+        }
+
+        /* Stop cleanly at a packet that is cut off by end of buffer */
+        int32_t words_packet = (int32_t)vrt_mskr(h, VRT_BITS_HEADER_PACKET_SIZE);
+        if (words_packet > words_buf - offset) {
+            break;
+        }
+
+        /* Get the next header on its way while the current packet is validated */
+        VRT_PREFETCH(p + words_packet);
+
+        /* Everything must fit inside the packet size, or it would be impossible to find the next packet */
+        rv = validate_packet(p, words_packet, swap);
+        if (rv < 0) {
+            *words_read = offset;
+            return rv == VRT_ERR_BUFFER_SIZE ? VRT_ERR_MISMATCH_PACKET_SIZE : rv;
+        }
+
+        offset += words_packet;
+    }
+
+    *words_read = offset;
+
+    return i;
+}
+
+int32_t vrt_validate_packets(const void* buf, int32_t words_buf, int32_t* words_read) {
+    return validate_packets(buf, words_buf, words_read, false);
+}
+
+int32_t vrt_validate_packets_be(const void* buf, int32_t words_buf, int32_t* words_read) {
+    return validate_packets(buf, words_buf, words_read, VRT_INTERNAL_NETWORK_ORDER_SWAP);
+}
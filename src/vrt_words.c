@@ -5,29 +5,15 @@
 
 #include "vrt_util_internal.h"
 
-int32_t vrt_words_fields(const struct vrt_header* header) {
-    int32_t words = 0;
-    if (vrt_has_stream_id(header)) {
-        words += 1;
-    }
-    if (header->has.class_id) {
-        words += 2;
-    }
-    if (header->tsi != VRT_TSI_NONE) {
-        words += 1;
-    }
-    if (header->tsf != VRT_TSF_NONE) {
-        words += 2;
-    }
-    return words;
-}
+/* Defined inline in header */
+extern int32_t vrt_words_fields(const struct vrt_header* header);
 
 int32_t vrt_words_trailer(const struct vrt_header* header) {
     /* Context packets cannot have a trailer */
     if (vrt_is_context(header)) {
         return 0;
     }
-    return vrt_b2u(header->has.trailer);
+    return vrt_internal_b2u(header->has.trailer);
 }
 
 int32_t vrt_words_if_context(const struct vrt_if_context* if_context) {
@@ -1,9 +1,11 @@
 #include "vrt/vrt_write.h"
 
+#include "vrt/vrt_bits.h"
 #include "vrt/vrt_error_code.h"
 #include "vrt/vrt_types.h"
 #include "vrt/vrt_util.h"
 #include "vrt/vrt_words.h"
+#include "vrt/vrt_write_inline.h"
 #include "vrt_bounds.h"
 
 #include "vrt_fixed_point.h"
@@ -12,246 +14,119 @@
 #include <string.h>
 
 /**
- * Mask a specified number of consecutive bits and shift them to a position in a word.
- *
- * \param val Word to mask.
- * \param pos Position of bits in word, starting from lsb.
- * \param n   Number of bits to mask.
- *
- * \return Bits after masking and shifting.
+ * Same as vrt_internal_write_header_swap(), but compiled into a separate path for each validation level.
  */
-static inline uint32_t mskw(uint32_t val, uint32_t pos, uint32_t n) {
-    uint32_t mask = (1U << n) - 1;
-    return (val & mask) << pos;
+static VRT_INTERNAL_FORCE_INLINE int32_t write_header_specialized(const struct vrt_header* header,
+                                                                  void*                    buf,
+                                                                  int32_t                  words_buf,
+                                                                  enum vrt_validation      validate,
+                                                                  bool                     swap) {
+    switch (validate) {
+        case VRT_VALIDATION_NONE:
+            return vrt_internal_write_header_swap(header, buf, words_buf, VRT_VALIDATION_NONE, swap);
+        case VRT_VALIDATION_STRUCTURAL:
+            return vrt_internal_write_header_swap(header, buf, words_buf, VRT_VALIDATION_STRUCTURAL, swap);
+        default:
+            return vrt_internal_write_header_swap(header, buf, words_buf, VRT_VALIDATION_FULL, swap);
+    }
 }
 
-/**
- * Write uint64 to uint32 buffer by interpreting the first word as most significant.
- *
- * \param val Value to write.
- * \param b   Buffer to write to.
- */
-static inline void write_uint64(uint64_t val, uint32_t* b) {
-    b[0] = (uint32_t)(val >> 32U);
-    b[1] = (uint32_t)val;
+int32_t vrt_write_header(const struct vrt_header* header, void* buf, int32_t words_buf, enum vrt_validation validate) {
+    return write_header_specialized(header, buf, words_buf, validate, false);
 }
 
-int32_t vrt_write_header(const struct vrt_header* header, void* buf, int32_t words_buf, bool validate) {
-    /* Note that it makes sense to have words_buf as signed, to avoid overflow for words_buf - offset */
-
-    /* Number of words are always 1 */
-    const int32_t words = 1;
-
-    /* Check if buf size is sufficient */
-    if (words_buf < words) {
-        return VRT_ERR_BUFFER_SIZE;
-    }
+int32_t vrt_write_header_be(const struct vrt_header* header,
+                            void*                    buf,
+                            int32_t                  words_buf,
+                            enum vrt_validation      validate) {
+    return write_header_specialized(header, buf, words_buf, validate, VRT_INTERNAL_NETWORK_ORDER_SWAP);
+}
 
-    if (validate) {
-        if (header->packet_type < VRT_PT_IF_DATA_WITHOUT_STREAM_ID || header->packet_type > VRT_PT_EXT_CONTEXT) {
-            return VRT_ERR_INVALID_PACKET_TYPE;
-        }
-        if (header->tsm < VRT_TSM_FINE || header->tsm > VRT_TSM_COARSE) {
-            return VRT_ERR_INVALID_TSM;
-        }
-        if (vrt_is_context(header)) {
-            if (header->has.trailer) {
-                return VRT_ERR_TRAILER_IN_CONTEXT;
-            }
-        } else {
-            if (header->tsm != VRT_TSM_FINE) {
-                return VRT_ERR_TSM_IN_DATA;
-            }
-        }
-        if (header->tsi < VRT_TSI_NONE || header->tsi > VRT_TSI_OTHER) {
-            return VRT_ERR_INVALID_TSI;
-        }
-        if (header->tsf < VRT_TSF_NONE || header->tsf > VRT_TSF_FREE_RUNNING_COUNT) {
-            return VRT_ERR_INVALID_TSF;
-        }
-        if (header->packet_count > 0x0F) {
-            return VRT_ERR_BOUNDS_PACKET_COUNT;
-        }
+/**
+ * Same as vrt_internal_write_fields_swap(), but compiled into a separate path for each validation level.
+ */
+static VRT_INTERNAL_FORCE_INLINE int32_t write_fields_specialized(const struct vrt_header* header,
+                                                                  const struct vrt_fields* fields,
+                                                                  void*                    buf,
+                                                                  int32_t                  words_buf,
+                                                                  enum vrt_validation      validate,
+                                                                  bool                     swap) {
+    switch (validate) {
+        case VRT_VALIDATION_NONE:
+            return vrt_internal_write_fields_swap(header, fields, buf, words_buf, VRT_VALIDATION_NONE, swap);
+        case VRT_VALIDATION_STRUCTURAL:
+            return vrt_internal_write_fields_swap(header, fields, buf, words_buf, VRT_VALIDATION_STRUCTURAL, swap);
+        default:
+            return vrt_internal_write_fields_swap(header, fields, buf, words_buf, VRT_VALIDATION_FULL, swap);
     }
-
-    /* Word in header section */
-    uint32_t* b = (uint32_t*)buf;
-
-    /* Rule 6.1.1-6: The reserved bits shall be set to 0. */
-    b[0] = 0;
-
-    b[0] |= mskw(header->packet_type, 28, 4);
-    b[0] |= mskw(vrt_b2u(header->has.class_id), 27, 1);
-    b[0] |= mskw(vrt_b2u(header->has.trailer), 26, 1);
-    b[0] |= mskw(header->tsm, 24, 1);
-    b[0] |= mskw(header->tsi, 22, 2);
-    b[0] |= mskw(header->tsf, 20, 2);
-    b[0] |= mskw(header->packet_count, 16, 4);
-    b[0] |= header->packet_size;
-
-    return words;
 }
 
 int32_t vrt_write_fields(const struct vrt_header* header,
                          const struct vrt_fields* fields,
                          void*                    buf,
                          int32_t                  words_buf,
-                         bool                     validate) {
-    const int32_t words = vrt_words_fields(header);
-
-    /* Check if buf size is sufficient */
-    if (words_buf < words) {
-        return VRT_ERR_BUFFER_SIZE;
-    }
-
-    uint32_t* b = ((uint32_t*)buf);
-
-    if (vrt_has_stream_id(header)) {
-        b[0] = fields->stream_id;
-        b += 1;
-    }
-    if (header->has.class_id) {
-        if (validate) {
-            if (fields->class_id.oui > 0x00FFFFFFU) {
-                return VRT_ERR_BOUNDS_OUI;
-            }
-        }
-
-        b[0] = mskw(fields->class_id.oui, 0, 24);
-        b[1] = mskw(fields->class_id.information_class_code, 16, 16) | fields->class_id.packet_class_code;
-        b += 2;
-    }
-    if (header->tsi != VRT_TSI_NONE) {
-        b[0] = fields->integer_seconds_timestamp;
-        b += 1;
-    }
-    if (vrt_has_fractional_timestamp(header->tsf)) {
-        if (validate) {
-            if (header->tsf == VRT_TSF_REAL_TIME && fields->fractional_seconds_timestamp >= 1000000000000) {
-                return VRT_ERR_BOUNDS_REAL_TIME;
-            }
-        }
-
-        write_uint64(fields->fractional_seconds_timestamp, b);
-        /* No point in increasing b pointer here */
-    }
-
-    return words;
+                         enum vrt_validation      validate) {
+    return write_fields_specialized(header, fields, buf, words_buf, validate, false);
 }
 
-int32_t vrt_write_trailer(const struct vrt_trailer* trailer, void* buf, int32_t words_buf, bool validate) {
-    /* Number of words are always 1 */
-    const int32_t words = 1;
-
-    /* Check if buf size is sufficient */
-    if (words_buf < words) {
-        return VRT_ERR_BUFFER_SIZE;
-    }
-
-    uint32_t* b = (uint32_t*)buf;
-
-    /* Recommendation 6.1.7-1: All unused trailer bits should be set to zero. */
-    b[0] = 0;
+int32_t vrt_write_fields_be(const struct vrt_header* header,
+                            const struct vrt_fields* fields,
+                            void*                    buf,
+                            int32_t                  words_buf,
+                            enum vrt_validation      validate) {
+    return write_fields_specialized(header, fields, buf, words_buf, validate, VRT_INTERNAL_NETWORK_ORDER_SWAP);
+}
 
-    /* Go from msb to lsb */
-    if (trailer->has.calibrated_time) {
-        b[0] |= mskw(vrt_b2u(trailer->calibrated_time), 19, 1);
-        b[0] |= mskw(1, 31, 1);
-    }
-    if (trailer->has.valid_data) {
-        b[0] |= mskw(vrt_b2u(trailer->valid_data), 18, 1);
-        b[0] |= mskw(1, 30, 1);
-    }
-    if (trailer->has.reference_lock) {
-        b[0] |= mskw(vrt_b2u(trailer->reference_lock), 17, 1);
-        b[0] |= mskw(1, 29, 1);
-    }
-    if (trailer->has.agc_or_mgc) {
-        b[0] |= mskw(trailer->agc_or_mgc, 16, 1);
-        b[0] |= mskw(1, 28, 1);
-    }
-    if (trailer->has.detected_signal) {
-        b[0] |= mskw(vrt_b2u(trailer->detected_signal), 15, 1);
-        b[0] |= mskw(1, 27, 1);
-    }
-    if (trailer->has.spectral_inversion) {
-        b[0] |= mskw(vrt_b2u(trailer->spectral_inversion), 14, 1);
-        b[0] |= mskw(1, 26, 1);
-    }
-    if (trailer->has.over_range) {
-        b[0] |= mskw(vrt_b2u(trailer->over_range), 13, 1);
-        b[0] |= mskw(1, 25, 1);
-    }
-    if (trailer->has.sample_loss) {
-        b[0] |= mskw(vrt_b2u(trailer->sample_loss), 12, 1);
-        b[0] |= mskw(1, 24, 1);
-    }
-    if (trailer->has.user_defined11) {
-        b[0] |= mskw(vrt_b2u(trailer->user_defined11), 11, 1);
-        b[0] |= mskw(1, 23, 1);
-    }
-    if (trailer->has.user_defined10) {
-        b[0] |= mskw(vrt_b2u(trailer->user_defined10), 10, 1);
-        b[0] |= mskw(1, 22, 1);
-    }
-    if (trailer->has.user_defined9) {
-        b[0] |= mskw(vrt_b2u(trailer->user_defined9), 9, 1);
-        b[0] |= mskw(1, 21, 1);
-    }
-    if (trailer->has.user_defined8) {
-        b[0] |= mskw(vrt_b2u(trailer->user_defined8), 8, 1);
-        b[0] |= mskw(1, 20, 1);
+/**
+ * Same as vrt_internal_write_trailer_swap(), but compiled into a separate path for each validation level.
+ */
+static VRT_INTERNAL_FORCE_INLINE int32_t write_trailer_specialized(const struct vrt_trailer* trailer,
+                                                                   void*                     buf,
+                                                                   int32_t                   words_buf,
+                                                                   enum vrt_validation       validate,
+                                                                   bool                      swap) {
+    switch (validate) {
+        case VRT_VALIDATION_NONE:
+            return vrt_internal_write_trailer_swap(trailer, buf, words_buf, VRT_VALIDATION_NONE, swap);
+        case VRT_VALIDATION_STRUCTURAL:
+            return vrt_internal_write_trailer_swap(trailer, buf, words_buf, VRT_VALIDATION_STRUCTURAL, swap);
+        default:
+            return vrt_internal_write_trailer_swap(trailer, buf, words_buf, VRT_VALIDATION_FULL, swap);
     }
-    if (trailer->has.associated_context_packet_count) {
-        if (validate) {
-            if (trailer->associated_context_packet_count > 0x7F) {
-                return VRT_ERR_BOUNDS_ASSOCIATED_CONTEXT_PACKET_COUNT;
-            }
-        }
+}
 
-        b[0] |= mskw(trailer->associated_context_packet_count, 0, 7);
-        b[0] |= mskw(1, 7, 1);
-    }
+int32_t vrt_write_trailer(const struct vrt_trailer* trailer,
+                          void*                     buf,
+                          int32_t                   words_buf,
+                          enum vrt_validation       validate) {
+    return write_trailer_specialized(trailer, buf, words_buf, validate, false);
+}
 
-    return words;
+int32_t vrt_write_trailer_be(const struct vrt_trailer* trailer,
+                             void*                     buf,
+                             int32_t                   words_buf,
+                             enum vrt_validation       validate) {
+    return write_trailer_specialized(trailer, buf, words_buf, validate, VRT_INTERNAL_NETWORK_ORDER_SWAP);
 }
 
 /**
  * Write IF context indicator field to buffer.
  *
- * \param c IF context to write.
- * \param b Buffer to write to.
+ * \param c    IF context to write.
+ * \param b    Buffer to write to.
+ * \param swap True if words shall be byte swapped.
  *
  * \return Number of written words, or a negative number if error.
  */
-static int32_t if_context_write_context_indicator_field(const struct vrt_if_context* c, uint32_t* b) {
-    /* Zero reserved bits */
-    b[0] = 0;
-
-    b[0] |= mskw(vrt_b2u(c->context_field_change_indicator), 31, 1);
-    b[0] |= mskw(vrt_b2u(c->has.reference_point_identifier), 30, 1);
-    b[0] |= mskw(vrt_b2u(c->has.bandwidth), 29, 1);
-    b[0] |= mskw(vrt_b2u(c->has.if_reference_frequency), 28, 1);
-    b[0] |= mskw(vrt_b2u(c->has.rf_reference_frequency), 27, 1);
-    b[0] |= mskw(vrt_b2u(c->has.rf_reference_frequency_offset), 26, 1);
-    b[0] |= mskw(vrt_b2u(c->has.if_band_offset), 25, 1);
-    b[0] |= mskw(vrt_b2u(c->has.reference_level), 24, 1);
-    b[0] |= mskw(vrt_b2u(c->has.gain), 23, 1);
-    b[0] |= mskw(vrt_b2u(c->has.over_range_count), 22, 1);
-    b[0] |= mskw(vrt_b2u(c->has.sample_rate), 21, 1);
-    b[0] |= mskw(vrt_b2u(c->has.timestamp_adjustment), 20, 1);
-    b[0] |= mskw(vrt_b2u(c->has.timestamp_calibration_time), 19, 1);
-    b[0] |= mskw(vrt_b2u(c->has.temperature), 18, 1);
-    b[0] |= mskw(vrt_b2u(c->has.device_identifier), 17, 1);
-    b[0] |= mskw(vrt_b2u(c->has.state_and_event_indicators), 16, 1);
-    b[0] |= mskw(vrt_b2u(c->has.data_packet_payload_format), 15, 1);
-    b[0] |= mskw(vrt_b2u(c->has.formatted_gps_geolocation), 14, 1);
-    b[0] |= mskw(vrt_b2u(c->has.formatted_ins_geolocation), 13, 1);
-    b[0] |= mskw(vrt_b2u(c->has.ecef_ephemeris), 12, 1);
-    b[0] |= mskw(vrt_b2u(c->has.relative_ephemeris), 11, 1);
-    b[0] |= mskw(vrt_b2u(c->has.ephemeris_reference_identifier), 10, 1);
-    b[0] |= mskw(vrt_b2u(c->has.gps_ascii), 9, 1);
-    b[0] |= mskw(vrt_b2u(c->has.context_association_lists), 8, 1);
+static VRT_INTERNAL_FORCE_INLINE int32_t if_context_write_context_indicator_field(const struct vrt_if_context* c,
+                                                                                  uint32_t*                    b,
+                                                                                  bool                         swap) {
+    /* Reserved bits are zero */
+    uint32_t w =
+        vrt_mskw(vrt_internal_b2u(c->context_field_change_indicator), VRT_BITS_CIF0_CONTEXT_FIELD_CHANGE_INDICATOR) |
+        vrt_if_context_indicator_word(&c->has);
+
+    vrt_internal_store(w, b, swap);
 
     return 1;
 }
@@ -259,53 +134,58 @@ static int32_t if_context_write_context_indicator_field(const struct vrt_if_cont
 /**
  * Write IF context state and event indicator field to buffer.
  *
- * \param has True if it is included.
- * \param s   State and event fields struct to write.
- * \param b   Buffer to write to.
+ * \param has  True if it is included.
+ * \param s    State and event fields struct to write.
+ * \param b    Buffer to write to.
+ * \param swap True if words shall be byte swapped.
  *
  * \return Number of written words, or a negative number if error.
  */
-static int32_t if_context_write_state_and_event_indicator_field(bool                              has,
-                                                                const struct vrt_state_and_event* s,
-                                                                uint32_t*                         b) {
+static VRT_INTERNAL_FORCE_INLINE int32_t
+if_context_write_state_and_event_indicator_field(bool                              has,
+                                                 const struct vrt_state_and_event* s,
+                                                 uint32_t*                         b,
+                                                 bool                              swap) {
     if (has) {
         /* Zero reserved bits */
-        b[0] = 0;
+        uint32_t w = 0;
 
         if (s->has.calibrated_time) {
-            b[0] |= mskw(vrt_b2u(s->has.calibrated_time), 31, 1);
-            b[0] |= mskw(vrt_b2u(s->calibrated_time), 19, 1);
+            w |= vrt_mskw(vrt_internal_b2u(s->has.calibrated_time), VRT_BITS_STATE_AND_EVENT_HAS_CALIBRATED_TIME);
+            w |= vrt_mskw(vrt_internal_b2u(s->calibrated_time), VRT_BITS_STATE_AND_EVENT_CALIBRATED_TIME);
         }
         if (s->has.valid_data) {
-            b[0] |= mskw(vrt_b2u(s->has.valid_data), 30, 1);
-            b[0] |= mskw(vrt_b2u(s->valid_data), 18, 1);
+            w |= vrt_mskw(vrt_internal_b2u(s->has.valid_data), VRT_BITS_STATE_AND_EVENT_HAS_VALID_DATA);
+            w |= vrt_mskw(vrt_internal_b2u(s->valid_data), VRT_BITS_STATE_AND_EVENT_VALID_DATA);
         }
         if (s->has.reference_lock) {
-            b[0] |= mskw(vrt_b2u(s->has.reference_lock), 29, 1);
-            b[0] |= mskw(vrt_b2u(s->reference_lock), 17, 1);
+            w |= vrt_mskw(vrt_internal_b2u(s->has.reference_lock), VRT_BITS_STATE_AND_EVENT_HAS_REFERENCE_LOCK);
+            w |= vrt_mskw(vrt_internal_b2u(s->reference_lock), VRT_BITS_STATE_AND_EVENT_REFERENCE_LOCK);
         }
         if (s->has.agc_or_mgc) {
-            b[0] |= mskw(vrt_b2u(s->has.agc_or_mgc), 28, 1);
-            b[0] |= mskw(s->agc_or_mgc, 16, 1);
+            w |= vrt_mskw(vrt_internal_b2u(s->has.agc_or_mgc), VRT_BITS_STATE_AND_EVENT_HAS_AGC_OR_MGC);
+            w |= vrt_mskw(s->agc_or_mgc, VRT_BITS_STATE_AND_EVENT_AGC_OR_MGC);
         }
         if (s->has.detected_signal) {
-            b[0] |= mskw(vrt_b2u(s->has.detected_signal), 27, 1);
-            b[0] |= mskw(vrt_b2u(s->detected_signal), 15, 1);
+            w |= vrt_mskw(vrt_internal_b2u(s->has.detected_signal), VRT_BITS_STATE_AND_EVENT_HAS_DETECTED_SIGNAL);
+            w |= vrt_mskw(vrt_internal_b2u(s->detected_signal), VRT_BITS_STATE_AND_EVENT_DETECTED_SIGNAL);
         }
         if (s->has.spectral_inversion) {
-            b[0] |= mskw(vrt_b2u(s->has.spectral_inversion), 26, 1);
-            b[0] |= mskw(vrt_b2u(s->spectral_inversion), 14, 1);
+            w |= vrt_mskw(vrt_internal_b2u(s->has.spectral_inversion), VRT_BITS_STATE_AND_EVENT_HAS_SPECTRAL_INVERSION);
+            w |= vrt_mskw(vrt_internal_b2u(s->spectral_inversion), VRT_BITS_STATE_AND_EVENT_SPECTRAL_INVERSION);
         }
         if (s->has.over_range) {
-            b[0] |= mskw(vrt_b2u(s->has.over_range), 25, 1);
-            b[0] |= mskw(vrt_b2u(s->over_range), 13, 1);
+            w |= vrt_mskw(vrt_internal_b2u(s->has.over_range), VRT_BITS_STATE_AND_EVENT_HAS_OVER_RANGE);
+            w |= vrt_mskw(vrt_internal_b2u(s->over_range), VRT_BITS_STATE_AND_EVENT_OVER_RANGE);
         }
         if (s->has.sample_loss) {
-            b[0] |= mskw(vrt_b2u(s->has.sample_loss), 24, 1);
-            b[0] |= mskw(vrt_b2u(s->sample_loss), 12, 1);
+            w |= vrt_mskw(vrt_internal_b2u(s->has.sample_loss), VRT_BITS_STATE_AND_EVENT_HAS_SAMPLE_LOSS);
+            w |= vrt_mskw(vrt_internal_b2u(s->sample_loss), VRT_BITS_STATE_AND_EVENT_SAMPLE_LOSS);
         }
 
-        b[0] |= mskw(s->user_defined, 0, 8);
+        w |= vrt_mskw(s->user_defined, VRT_BITS_STATE_AND_EVENT_USER_DEFINED);
+
+        vrt_internal_store(w, b, swap);
 
         return 1;
     }
@@ -319,16 +199,19 @@ static int32_t if_context_write_state_and_event_indicator_field(bool
  * \param has      True if it is included.
  * \param f        Data packet payload format struct to write.
  * \param b        Buffer to write to.
- * \param validate True if data shall be validated.
+ * \param validate Level of validation.
+ * \param swap     True if words shall be byte swapped.
  *
  * \return Number of written words, or a negative number if error.
  */
-static int32_t if_context_write_data_packet_payload_format(bool                                         has,
-                                                           const struct vrt_data_packet_payload_format* f,
-                                                           uint32_t*                                    b,
-                                                           bool                                         validate) {
+static VRT_INTERNAL_FORCE_INLINE int32_t
+if_context_write_data_packet_payload_format(bool                                         has,
+                                            const struct vrt_data_packet_payload_format* f,
+                                            uint32_t*                                    b,
+                                            enum vrt_validation                          validate,
+                                            bool                                         swap) {
     if (has) {
-        if (validate) {
+        if (vrt_internal_validate_content(validate)) {
             if (f->packing_method < VRT_PM_PROCESSING_EFFICIENT || f->packing_method > VRT_PM_LINK_EFFICIENT) {
                 return VRT_ERR_INVALID_PACKING_METHOD;
             }
@@ -356,18 +239,19 @@ static int32_t if_context_write_data_packet_payload_format(bool
         }
 
         /* Zero reserved bits */
-        b[0] = 0;
+        uint32_t w = 0;
 
-        b[0] |= mskw(f->packing_method, 31, 1);
-        b[0] |= mskw(f->real_or_complex, 29, 2);
-        b[0] |= mskw(f->data_item_format, 24, 5);
-        b[0] |= mskw(vrt_b2u(f->sample_component_repeat), 23, 1);
-        b[0] |= mskw(f->event_tag_size, 20, 3);
-        b[0] |= mskw(f->channel_tag_size, 16, 4);
-        b[0] |= mskw(f->item_packing_field_size, 6, 6);
-        b[0] |= mskw(f->data_item_size, 0, 6);
+        w |= vrt_mskw(f->packing_method, 31, 1);
+        w |= vrt_mskw(f->real_or_complex, 29, 2);
+        w |= vrt_mskw(f->data_item_format, 24, 5);
+        w |= vrt_mskw(vrt_internal_b2u(f->sample_component_repeat), 23, 1);
+        w |= vrt_mskw(f->event_tag_size, 20, 3);
+        w |= vrt_mskw(f->channel_tag_size, 16, 4);
+        w |= vrt_mskw(f->item_packing_field_size, 6, 6);
+        w |= vrt_mskw(f->data_item_size, 0, 6);
 
-        b[1] = mskw(f->repeat_count, 16, 16) | mskw(f->vector_size, 0, 16);
+        vrt_internal_store(w, b, swap);
+        vrt_internal_store(vrt_mskw(f->repeat_count, 16, 16) | vrt_mskw(f->vector_size, 0, 16), b + 1, swap);
 
         return 2;
     }
@@ -381,16 +265,19 @@ static int32_t if_context_write_data_packet_payload_format(bool
  * \param has      True if it is included.
  * \param g        GPS/INS geolocation field to write.
  * \param b        Buffer to write to.
- * \param validate True if data shall be validated.
+ * \param validate Level of validation.
+ * \param swap     True if words shall be byte swapped.
  *
  * \return Number of written words, or a negative number if error.
  */
-static int32_t if_context_write_formatted_geolocation(bool                                    has,
-                                                      const struct vrt_formatted_geolocation* g,
-                                                      uint32_t*                               b,
-                                                      bool                                    validate) {
+static VRT_INTERNAL_FORCE_INLINE int32_t
+if_context_write_formatted_geolocation(bool                                    has,
+                                       const struct vrt_formatted_geolocation* g,
+                                       uint32_t*                               b,
+                                       enum vrt_validation                     validate,
+                                       bool                                    swap) {
     if (has) {
-        if (validate) {
+        if (vrt_internal_validate_content(validate)) {
             if (g->tsi < VRT_TSI_NONE || g->tsi > VRT_TSI_OTHER) {
                 return VRT_ERR_INVALID_TSI;
             }
@@ -435,31 +322,36 @@ static int32_t if_context_write_formatted_geolocation(bool
             }
         }
 
-        /* Zero reserved bits */
-        b[0] = 0;
-
-        b[0] |= mskw(g->tsi, 26, 2);
-        b[0] |= mskw(g->tsf, 24, 2);
-        b[0] |= mskw(g->oui, 0, 24);
-        b[1] = g->integer_second_timestamp;
-        write_uint64(g->fractional_second_timestamp, b + 2);
-        b[4] = g->has.latitude ? (uint32_t)vrt_double_to_fixed_point_i32(g->latitude, VRT_RADIX_ANGLE)
+        /* Build all words locally, and store them with optional byte swap at once. Zero reserved bits. */
+        uint32_t w[11];
+        w[0] = 0;
+
+        w[0] |= vrt_mskw(g->tsi, 26, 2);
+        w[0] |= vrt_mskw(g->tsf, 24, 2);
+        w[0] |= vrt_mskw(g->oui, 0, 24);
+        w[1] = g->integer_second_timestamp;
+        vrt_internal_write_uint64(g->fractional_second_timestamp, w + 2, false);
+        w[4] = g->has.latitude ? (uint32_t)vrt_double_to_fixed_point_i32(g->latitude, VRT_RADIX_ANGLE)
                                : VRT_UNSPECIFIED_FIXED_POINT;
-        b[5] = g->has.longitude ? (uint32_t)vrt_double_to_fixed_point_i32(g->longitude, VRT_RADIX_ANGLE)
+        w[5] = g->has.longitude ? (uint32_t)vrt_double_to_fixed_point_i32(g->longitude, VRT_RADIX_ANGLE)
                                 : VRT_UNSPECIFIED_FIXED_POINT;
-        b[6] = g->has.altitude ? (uint32_t)vrt_double_to_fixed_point_i32(g->altitude, VRT_RADIX_ALTITUDE)
+        w[6] = g->has.altitude ? (uint32_t)vrt_double_to_fixed_point_i32(g->altitude, VRT_RADIX_ALTITUDE)
                                : VRT_UNSPECIFIED_FIXED_POINT;
-        b[7] = g->has.speed_over_ground ? vrt_double_to_fixed_point_u32(g->speed_over_ground, VRT_RADIX_SPEED_VELOCITY)
+        w[7] = g->has.speed_over_ground ? vrt_double_to_fixed_point_u32(g->speed_over_ground, VRT_RADIX_SPEED_VELOCITY)
                                         : VRT_UNSPECIFIED_FIXED_POINT;
-        b[8] = g->has.heading_angle ? (uint32_t)vrt_double_to_fixed_point_i32(g->heading_angle, VRT_RADIX_ANGLE)
+        w[8] = g->has.heading_angle ? (uint32_t)vrt_double_to_fixed_point_i32(g->heading_angle, VRT_RADIX_ANGLE)
                                     : VRT_UNSPECIFIED_FIXED_POINT;
-        b[9] = g->has.track_angle ? (uint32_t)vrt_double_to_fixed_point_i32(g->track_angle, VRT_RADIX_ANGLE)
+        w[9] = g->has.track_angle ? (uint32_t)vrt_double_to_fixed_point_i32(g->track_angle, VRT_RADIX_ANGLE)
                                   : VRT_UNSPECIFIED_FIXED_POINT;
         /* There seems to be an error in Rule 7.1.5.19-13. A correction seems to be 6.2.5.15-2 -> 7.1.5.19-2.*/
-        b[10] = g->has.magnetic_variation
+        w[10] = g->has.magnetic_variation
                     ? (uint32_t)vrt_double_to_fixed_point_i32(g->magnetic_variation, VRT_RADIX_ANGLE)
                     : VRT_UNSPECIFIED_FIXED_POINT;
 
+        for (int32_t i = 0; i < 11; ++i) {
+            vrt_internal_store(w[i], b + i, swap);
+        }
+
         return 11;
     }
 
@@ -472,13 +364,18 @@ static int32_t if_context_write_formatted_geolocation(bool
  * \param has      True if it is included.
  * \param e        Ephemeris struct to write.
  * \param b        Buffer to write to.
- * \param validate True if data shall be validated.
+ * \param validate Level of validation.
+ * \param swap     True if words shall be byte swapped.
  *
  * \return Number of written words, or a negative number if error.
  */
-static int32_t if_context_write_ephemeris(bool has, const struct vrt_ephemeris* e, uint32_t* b, bool validate) {
+static VRT_INTERNAL_FORCE_INLINE int32_t if_context_write_ephemeris(bool                        has,
+                                                                    const struct vrt_ephemeris* e,
+                                                                    uint32_t*                   b,
+                                                                    enum vrt_validation         validate,
+                                                                    bool                        swap) {
     if (has) {
-        if (validate) {
+        if (vrt_internal_validate_content(validate)) {
             if (e->tsi < VRT_TSI_NONE || e->tsi > VRT_TSI_OTHER) {
                 return VRT_ERR_INVALID_TSI;
             }
@@ -526,33 +423,38 @@ static int32_t if_context_write_ephemeris(bool has, const struct vrt_ephemeris*
             }
         }
 
-        /* Zero reserved bits */
-        b[0] = 0;
-
-        b[0] |= mskw(e->tsi, 26, 2);
-        b[0] |= mskw(e->tsf, 24, 2);
-        b[0] |= mskw(e->oui, 0, 24);
-        b[1] = e->integer_second_timestamp;
-        write_uint64(e->fractional_second_timestamp, b + 2);
-        b[4]  = e->has.position_x ? (uint32_t)vrt_double_to_fixed_point_i32(e->position_x, VRT_RADIX_POSITION)
+        /* Build all words locally, and store them with optional byte swap at once. Zero reserved bits. */
+        uint32_t w[13];
+        w[0] = 0;
+
+        w[0] |= vrt_mskw(e->tsi, 26, 2);
+        w[0] |= vrt_mskw(e->tsf, 24, 2);
+        w[0] |= vrt_mskw(e->oui, 0, 24);
+        w[1] = e->integer_second_timestamp;
+        vrt_internal_write_uint64(e->fractional_second_timestamp, w + 2, false);
+        w[4]  = e->has.position_x ? (uint32_t)vrt_double_to_fixed_point_i32(e->position_x, VRT_RADIX_POSITION)
                                   : VRT_UNSPECIFIED_FIXED_POINT;
-        b[5]  = e->has.position_y ? (uint32_t)vrt_double_to_fixed_point_i32(e->position_y, VRT_RADIX_POSITION)
+        w[5]  = e->has.position_y ? (uint32_t)vrt_double_to_fixed_point_i32(e->position_y, VRT_RADIX_POSITION)
                                   : VRT_UNSPECIFIED_FIXED_POINT;
-        b[6]  = e->has.position_z ? (uint32_t)vrt_double_to_fixed_point_i32(e->position_z, VRT_RADIX_POSITION)
+        w[6]  = e->has.position_z ? (uint32_t)vrt_double_to_fixed_point_i32(e->position_z, VRT_RADIX_POSITION)
                                   : VRT_UNSPECIFIED_FIXED_POINT;
-        b[7]  = e->has.attitude_alpha ? (uint32_t)vrt_double_to_fixed_point_i32(e->attitude_alpha, VRT_RADIX_ANGLE)
+        w[7]  = e->has.attitude_alpha ? (uint32_t)vrt_double_to_fixed_point_i32(e->attitude_alpha, VRT_RADIX_ANGLE)
                                       : VRT_UNSPECIFIED_FIXED_POINT;
-        b[8]  = e->has.attitude_beta ? (uint32_t)vrt_double_to_fixed_point_i32(e->attitude_beta, VRT_RADIX_ANGLE)
+        w[8]  = e->has.attitude_beta ? (uint32_t)vrt_double_to_fixed_point_i32(e->attitude_beta, VRT_RADIX_ANGLE)
                                      : VRT_UNSPECIFIED_FIXED_POINT;
-        b[9]  = e->has.attitude_phi ? (uint32_t)vrt_double_to_fixed_point_i32(e->attitude_phi, VRT_RADIX_ANGLE)
+        w[9]  = e->has.attitude_phi ? (uint32_t)vrt_double_to_fixed_point_i32(e->attitude_phi, VRT_RADIX_ANGLE)
                                     : VRT_UNSPECIFIED_FIXED_POINT;
-        b[10] = e->has.velocity_dx ? (uint32_t)vrt_double_to_fixed_point_i32(e->velocity_dx, VRT_RADIX_SPEED_VELOCITY)
+        w[10] = e->has.velocity_dx ? (uint32_t)vrt_double_to_fixed_point_i32(e->velocity_dx, VRT_RADIX_SPEED_VELOCITY)
                                    : VRT_UNSPECIFIED_FIXED_POINT;
-        b[11] = e->has.velocity_dy ? (uint32_t)vrt_double_to_fixed_point_i32(e->velocity_dy, VRT_RADIX_SPEED_VELOCITY)
+        w[11] = e->has.velocity_dy ? (uint32_t)vrt_double_to_fixed_point_i32(e->velocity_dy, VRT_RADIX_SPEED_VELOCITY)
                                    : VRT_UNSPECIFIED_FIXED_POINT;
-        b[12] = e->has.velocity_dz ? (uint32_t)vrt_double_to_fixed_point_i32(e->velocity_dz, VRT_RADIX_SPEED_VELOCITY)
+        w[12] = e->has.velocity_dz ? (uint32_t)vrt_double_to_fixed_point_i32(e->velocity_dz, VRT_RADIX_SPEED_VELOCITY)
                                    : VRT_UNSPECIFIED_FIXED_POINT;
 
+        for (int32_t i = 0; i < 13; ++i) {
+            vrt_internal_store(w[i], b + i, swap);
+        }
+
         return 13;
     }
 
@@ -565,20 +467,25 @@ static int32_t if_context_write_ephemeris(bool has, const struct vrt_ephemeris*
  * \param has      True if it is included.
  * \param g        GPS ASCII struct to write.
  * \param b        Buffer to write to.
- * \param validate True if data shall be validated.
+ * \param validate Level of validation.
+ * \param swap     True if words shall be byte swapped. Note that the ASCII characters themselves are never swapped.
  *
  * \return Number of written words, or a negative number if error.
  */
-static int32_t if_context_write_gps_ascii(bool has, const struct vrt_gps_ascii* g, uint32_t* b, bool validate) {
+static VRT_INTERNAL_FORCE_INLINE int32_t if_context_write_gps_ascii(bool                        has,
+                                                                    const struct vrt_gps_ascii* g,
+                                                                    uint32_t*                   b,
+                                                                    enum vrt_validation         validate,
+                                                                    bool                        swap) {
     if (has) {
-        if (validate) {
+        if (vrt_internal_validate_content(validate)) {
             if (g->oui > 0x00FFFFFF) {
                 return VRT_ERR_BOUNDS_OUI;
             }
         }
 
-        b[0] = mskw(g->oui, 0, 24);
-        b[1] = g->number_of_words;
+        vrt_internal_store(vrt_mskw(g->oui, 0, 24), b, swap);
+        vrt_internal_store(g->number_of_words, b + 1, swap);
 
         /* Protect against g->ascii == NULL when number_of_words == 0 */
         if (g->number_of_words != 0) {
@@ -597,16 +504,19 @@ static int32_t if_context_write_gps_ascii(bool has, const struct vrt_gps_ascii*
  * \param has      True if it is included.
  * \param l        Context association lists struct to write.
  * \param b        Buffer to write to.
- * \param validate True if data shall be validated.
+ * \param validate Level of validation.
+ * \param swap     True if the list size words shall be byte swapped. Note that the lists themselves are copied as is.
  *
  * \return Number of written words, or a negative number if error.
  */
-static int32_t if_context_write_context_association_lists(bool                                        has,
-                                                          const struct vrt_context_association_lists* l,
-                                                          uint32_t*                                   b,
-                                                          bool                                        validate) {
+static VRT_INTERNAL_FORCE_INLINE int32_t
+if_context_write_context_association_lists(bool                                        has,
+                                           const struct vrt_context_association_lists* l,
+                                           uint32_t*                                   b,
+                                           enum vrt_validation                         validate,
+                                           bool                                        swap) {
     if (has) {
-        if (validate) {
+        if (vrt_internal_validate_structure(validate)) {
             if (l->source_list_size > 0x01FF) {
                 return VRT_ERR_BOUNDS_SOURCE_LIST_SIZE;
             }
@@ -618,15 +528,16 @@ static int32_t if_context_write_context_association_lists(bool
             }
         }
 
-        uint16_t sz1 = (uint16_t)mskw(l->source_list_size, 0, 9);
-        uint16_t sz2 = (uint16_t)mskw(l->system_list_size, 0, 9);
+        uint16_t sz1 = (uint16_t)vrt_mskw(l->source_list_size, 0, 9);
+        uint16_t sz2 = (uint16_t)vrt_mskw(l->system_list_size, 0, 9);
         uint16_t sz3 = l->vector_component_list_size;
-        uint16_t sz4 = (uint16_t)mskw(l->asynchronous_channel_list_size, 0, 15);
+        uint16_t sz4 = (uint16_t)vrt_mskw(l->asynchronous_channel_list_size, 0, 15);
 
         int32_t words = 2 + sz1 + sz2 + sz3 + sz4 + (l->has.asynchronous_channel_tag_list ? sz4 : 0);
 
-        b[0] = sz1 << 16U | sz2;
-        b[1] = sz3 << 16U | vrt_b2u(l->has.asynchronous_channel_tag_list) << 15U | sz4;
+        vrt_internal_store(sz1 << 16U | sz2, b, swap);
+        vrt_internal_store(sz3 << 16U | vrt_internal_b2u(l->has.asynchronous_channel_tag_list) << 15U | sz4, b + 1,
+                           swap);
         b += 2;
         memcpy(b, l->source_context_association_list, sizeof(uint32_t) * sz1);
         b += sz1;
@@ -646,7 +557,23 @@ static int32_t if_context_write_context_association_lists(bool
     return 0;
 }
 
-int32_t vrt_write_if_context(const struct vrt_if_context* if_context, void* buf, int32_t words_buf, bool validate) {
+/**
+ * Write IF context section, with optional byte swapping of words.
+ *
+ * \param if_context IF context to write.
+ * \param buf        Buffer to write to.
+ * \param words_buf  Size of buf in 32-bit words.
+ * \param validate   Level of validation.
+ * \param swap       True if words shall be byte swapped.
+ *
+ * \return Number of written words, or a negative number if error.
+ */
+static VRT_INTERNAL_FORCE_INLINE int32_t
+write_if_context(const struct vrt_if_context* if_context,
+                 void*                        buf,
+                 int32_t                      words_buf,
+                 enum vrt_validation          validate,
+                 bool                         swap) {
     const int32_t words = vrt_words_if_context(if_context);
 
     /* Check if buf size is sufficient */
@@ -656,74 +583,79 @@ int32_t vrt_write_if_context(const struct vrt_if_context* if_context, void* buf,
 
     uint32_t* b = (uint32_t*)buf;
 
-    int32_t rv = if_context_write_context_indicator_field(if_context, b);
+    int32_t rv = if_context_write_context_indicator_field(if_context, b, swap);
     if (rv < 0) {
         return rv;
     }
     b += rv;
     if (if_context->has.reference_point_identifier) {
-        b[0] = if_context->reference_point_identifier;
+        vrt_internal_store(if_context->reference_point_identifier, b, swap);
         b += 1;
     }
     if (if_context->has.bandwidth) {
-        if (validate) {
+        if (vrt_internal_validate_content(validate)) {
             VRT_BOUNDS(VRT_MIN_BANDWIDTH, if_context->bandwidth, VRT_MAX_BANDWIDTH, VRT_ERR_BOUNDS_BANDWIDTH);
         }
 
-        write_uint64((uint64_t)vrt_double_to_fixed_point_i64(if_context->bandwidth, VRT_RADIX_FREQUENCY), b);
+        vrt_internal_write_uint64(
+            (uint64_t)vrt_double_to_fixed_point_i64(if_context->bandwidth, VRT_RADIX_FREQUENCY), b, swap);
         b += 2;
     }
     if (if_context->has.if_reference_frequency) {
-        if (validate) {
+        if (vrt_internal_validate_content(validate)) {
             VRT_BOUNDS(VRT_MIN_IF_REFERENCE_FREQUENCY, if_context->if_reference_frequency,
                        VRT_MAX_IF_REFERENCE_FREQUENCY, VRT_ERR_BOUNDS_IF_REFERENCE_FREQUENCY);
         }
 
-        write_uint64((uint64_t)vrt_double_to_fixed_point_i64(if_context->if_reference_frequency, VRT_RADIX_FREQUENCY),
-                     b);
+        vrt_internal_write_uint64(
+            (uint64_t)vrt_double_to_fixed_point_i64(if_context->if_reference_frequency, VRT_RADIX_FREQUENCY), b, swap);
         b += 2;
     }
     if (if_context->has.rf_reference_frequency) {
-        if (validate) {
+        if (vrt_internal_validate_content(validate)) {
             VRT_BOUNDS(VRT_MIN_RF_REFERENCE_FREQUENCY, if_context->rf_reference_frequency,
                        VRT_MAX_RF_REFERENCE_FREQUENCY, VRT_ERR_BOUNDS_RF_REFERENCE_FREQUENCY);
         }
 
-        write_uint64((uint64_t)vrt_double_to_fixed_point_i64(if_context->rf_reference_frequency, VRT_RADIX_FREQUENCY),
-                     b);
+        vrt_internal_write_uint64(
+            (uint64_t)vrt_double_to_fixed_point_i64(if_context->rf_reference_frequency, VRT_RADIX_FREQUENCY), b, swap);
         b += 2;
     }
     if (if_context->has.rf_reference_frequency_offset) {
-        if (validate) {
+        if (vrt_internal_validate_content(validate)) {
             VRT_BOUNDS(VRT_MIN_RF_REFERENCE_FREQUENCY_OFFSET, if_context->rf_reference_frequency_offset,
                        VRT_MAX_RF_REFERENCE_FREQUENCY_OFFSET, VRT_ERR_BOUNDS_RF_REFERENCE_FREQUENCY_OFFSET);
         }
 
-        write_uint64(
-            (uint64_t)vrt_double_to_fixed_point_i64(if_context->rf_reference_frequency_offset, VRT_RADIX_FREQUENCY), b);
+        vrt_internal_write_uint64(
+            (uint64_t)vrt_double_to_fixed_point_i64(if_context->rf_reference_frequency_offset, VRT_RADIX_FREQUENCY), b,
+            swap);
         b += 2;
     }
     if (if_context->has.if_band_offset) {
-        if (validate) {
+        if (vrt_internal_validate_content(validate)) {
             VRT_BOUNDS(VRT_MIN_IF_BAND_OFFSET, if_context->if_band_offset, VRT_MAX_IF_BAND_OFFSET,
                        VRT_ERR_BOUNDS_IF_BAND_OFFSET);
         }
 
-        write_uint64((uint64_t)vrt_double_to_fixed_point_i64(if_context->if_band_offset, VRT_RADIX_FREQUENCY), b);
+        vrt_internal_write_uint64(
+            (uint64_t)vrt_double_to_fixed_point_i64(if_context->if_band_offset, VRT_RADIX_FREQUENCY), b, swap);
         b += 2;
     }
     if (if_context->has.reference_level) {
-        if (validate) {
+        if (vrt_internal_validate_content(validate)) {
             VRT_BOUNDS(VRT_MIN_REFERENCE_LEVEL, if_context->reference_level, VRT_MAX_REFERENCE_LEVEL,
                        VRT_ERR_BOUNDS_REFERENCE_LEVEL);
         }
 
-        b[0] = (uint32_t)vrt_float_to_fixed_point_i16(if_context->reference_level, VRT_RADIX_REFERENCE_LEVEL) &
-               0x0000FFFFU;
+        vrt_internal_store(
+            (uint32_t)vrt_float_to_fixed_point_i16(if_context->reference_level, VRT_RADIX_REFERENCE_LEVEL) &
+                0x0000FFFFU,
+            b, swap);
         b += 1;
     }
     if (if_context->has.gain) {
-        if (validate) {
+        if (vrt_internal_validate_content(validate)) {
             if (if_context->gain.stage1 < VRT_MIN_GAIN || if_context->gain.stage1 > VRT_MAX_GAIN ||
                 if_context->gain.stage2 < VRT_MIN_GAIN || if_context->gain.stage2 > VRT_MAX_GAIN) {
                 return VRT_ERR_BOUNDS_GAIN;
@@ -736,96 +668,100 @@ int32_t vrt_write_if_context(const struct vrt_if_context* if_context, void* buf,
             }
         }
 
-        b[0] = ((int32_t)mskw(vrt_float_to_fixed_point_i16(if_context->gain.stage2, VRT_RADIX_GAIN), 16, 16) &
-                0xFFFF0000) |
-               ((int32_t)vrt_float_to_fixed_point_i16(if_context->gain.stage1, VRT_RADIX_GAIN) & 0x0000FFFF);
+        uint32_t fp1 = (uint32_t)vrt_float_to_fixed_point_i16(if_context->gain.stage1, VRT_RADIX_GAIN) & 0x0000FFFFU;
+        uint32_t fp2 = (uint32_t)vrt_float_to_fixed_point_i16(if_context->gain.stage2, VRT_RADIX_GAIN) & 0x0000FFFFU;
+        vrt_internal_store(fp2 << 16U | fp1, b, swap);
         b += 1;
     }
     if (if_context->has.over_range_count) {
-        b[0] = if_context->over_range_count;
+        vrt_internal_store(if_context->over_range_count, b, swap);
         b += 1;
     }
     if (if_context->has.sample_rate) {
-        if (validate) {
+        if (vrt_internal_validate_content(validate)) {
             VRT_BOUNDS(VRT_MIN_SAMPLE_RATE, if_context->sample_rate, VRT_MAX_SAMPLE_RATE, VRT_ERR_BOUNDS_SAMPLE_RATE);
         }
 
-        write_uint64((uint64_t)vrt_double_to_fixed_point_i64(if_context->sample_rate, VRT_RADIX_FREQUENCY), b);
+        vrt_internal_write_uint64(
+            (uint64_t)vrt_double_to_fixed_point_i64(if_context->sample_rate, VRT_RADIX_FREQUENCY), b, swap);
         b += 2;
     }
     if (if_context->has.timestamp_adjustment) {
-        write_uint64(if_context->timestamp_adjustment, b);
+        vrt_internal_write_uint64(if_context->timestamp_adjustment, b, swap);
         b += 2;
     }
     if (if_context->has.timestamp_calibration_time) {
-        b[0] = if_context->timestamp_calibration_time;
+        vrt_internal_store(if_context->timestamp_calibration_time, b, swap);
         b += 1;
     }
     if (if_context->has.temperature) {
-        if (validate) {
+        if (vrt_internal_validate_content(validate)) {
             VRT_BOUNDS(VRT_MIN_TEMPERATURE, if_context->temperature, VRT_MAX_TEMPERATURE, VRT_ERR_BOUNDS_TEMPERATURE);
         }
 
-        b[0] = (int32_t)vrt_float_to_fixed_point_i16(if_context->temperature, VRT_RADIX_TEMPERATURE) & 0x0000FFFF;
+        vrt_internal_store(
+            (uint32_t)vrt_float_to_fixed_point_i16(if_context->temperature, VRT_RADIX_TEMPERATURE) & 0x0000FFFFU, b,
+            swap);
         b += 1;
     }
     if (if_context->has.device_identifier) {
-        if (validate) {
+        if (vrt_internal_validate_content(validate)) {
             if (if_context->device_identifier.oui > 0x00FFFFFF) {
                 return VRT_ERR_BOUNDS_OUI;
             }
         }
 
-        b[0] = mskw(if_context->device_identifier.oui, 0, 24);
-        b[1] = if_context->device_identifier.device_code;
+        vrt_internal_store(vrt_mskw(if_context->device_identifier.oui, 0, 24), b, swap);
+        vrt_internal_store(if_context->device_identifier.device_code, b + 1, swap);
         b += 2;
     }
     rv = if_context_write_state_and_event_indicator_field(if_context->has.state_and_event_indicators,
-                                                          &if_context->state_and_event_indicators, b);
+                                                          &if_context->state_and_event_indicators, b, swap);
     if (rv < 0) {
         return rv;
     }
     b += rv;
     rv = if_context_write_data_packet_payload_format(if_context->has.data_packet_payload_format,
-                                                     &if_context->data_packet_payload_format, b, validate);
+                                                     &if_context->data_packet_payload_format, b, validate, swap);
     if (rv < 0) {
         return rv;
     }
     b += rv;
     rv = if_context_write_formatted_geolocation(if_context->has.formatted_gps_geolocation,
-                                                &if_context->formatted_gps_geolocation, b, validate);
+                                                &if_context->formatted_gps_geolocation, b, validate, swap);
     if (rv < 0) {
         return rv;
     }
     b += rv;
     rv = if_context_write_formatted_geolocation(if_context->has.formatted_ins_geolocation,
-                                                &if_context->formatted_ins_geolocation, b, validate);
+                                                &if_context->formatted_ins_geolocation, b, validate, swap);
     if (rv < 0) {
         return rv;
     }
     b += rv;
-    rv = if_context_write_ephemeris(if_context->has.ecef_ephemeris, &if_context->ecef_ephemeris, b, validate);
+    rv = if_context_write_ephemeris(if_context->has.ecef_ephemeris, &if_context->ecef_ephemeris, b, validate, swap);
     if (rv < 0) {
         return rv;
     }
     b += rv;
-    rv = if_context_write_ephemeris(if_context->has.relative_ephemeris, &if_context->relative_ephemeris, b, validate);
+    rv = if_context_write_ephemeris(if_context->has.relative_ephemeris, &if_context->relative_ephemeris, b, validate,
+                                    swap);
     if (rv < 0) {
         return rv;
     }
     b += rv;
     if (if_context->has.ephemeris_reference_identifier) {
-        b[0] = if_context->ephemeris_reference_identifier;
+        vrt_internal_store(if_context->ephemeris_reference_identifier, b, swap);
         b += 1;
     }
-    rv = if_context_write_gps_ascii(if_context->has.gps_ascii, &if_context->gps_ascii, b, validate);
+    rv = if_context_write_gps_ascii(if_context->has.gps_ascii, &if_context->gps_ascii, b, validate, swap);
     if (rv < 0) {
         return rv;
     }
     b += rv;
     /* No need to increase b here since it is last */
     rv = if_context_write_context_association_lists(if_context->has.context_association_lists,
-                                                    &if_context->context_association_lists, b, validate);
+                                                    &if_context->context_association_lists, b, validate, swap);
     if (rv < 0) {
         return rv;
     }
@@ -833,19 +769,66 @@ int32_t vrt_write_if_context(const struct vrt_if_context* if_context, void* buf,
     return words;
 }
 
-int32_t vrt_write_packet(const struct vrt_packet* packet, void* buf, int32_t words_buf, bool validate) {
+/**
+ * Same as write_if_context(), but compiled into a separate path for each validation level.
+ */
+static VRT_INTERNAL_FORCE_INLINE int32_t write_if_context_specialized(const struct vrt_if_context* if_context,
+                                                                      void*                        buf,
+                                                                      int32_t                      words_buf,
+                                                                      enum vrt_validation          validate,
+                                                                      bool                         swap) {
+    switch (validate) {
+        case VRT_VALIDATION_NONE:
+            return write_if_context(if_context, buf, words_buf, VRT_VALIDATION_NONE, swap);
+        case VRT_VALIDATION_STRUCTURAL:
+            return write_if_context(if_context, buf, words_buf, VRT_VALIDATION_STRUCTURAL, swap);
+        default:
+            return write_if_context(if_context, buf, words_buf, VRT_VALIDATION_FULL, swap);
+    }
+}
+
+int32_t vrt_write_if_context(const struct vrt_if_context* if_context,
+                             void*                        buf,
+                             int32_t                      words_buf,
+                             enum vrt_validation          validate) {
+    return write_if_context_specialized(if_context, buf, words_buf, validate, false);
+}
+
+int32_t vrt_write_if_context_be(const struct vrt_if_context* if_context,
+                                void*                        buf,
+                                int32_t                      words_buf,
+                                enum vrt_validation          validate) {
+    return write_if_context_specialized(if_context, buf, words_buf, validate, VRT_INTERNAL_NETWORK_ORDER_SWAP);
+}
+
+/**
+ * Write packet, with optional byte swapping of words.
+ *
+ * \param packet    Packet to write.
+ * \param buf       Buffer to write to.
+ * \param words_buf Size of buf in 32-bit words.
+ * \param validate  Level of validation.
+ * \param swap      True if words shall be byte swapped.
+ *
+ * \return Number of written words, or a negative number if error.
+ */
+static VRT_INTERNAL_FORCE_INLINE int32_t write_packet(const struct vrt_packet* packet,
+                                                      void*                    buf,
+                                                      int32_t                  words_buf,
+                                                      enum vrt_validation      validate,
+                                                      bool                     swap) {
     uint32_t* b = (uint32_t*)buf;
 
     /* Header */
-    int32_t words_header = vrt_write_header(&packet->header, b, words_buf, validate);
+    int32_t words_header = vrt_internal_write_header_swap(&packet->header, b, words_buf, validate, swap);
     if (words_header < 0) {
         return words_header;
     }
     int32_t words_total = words_header;
 
     /* Fields */
-    int32_t words_fields =
-        vrt_write_fields(&packet->header, &packet->fields, b + words_total, words_buf - words_total, validate);
+    int32_t words_fields = vrt_internal_write_fields_swap(
+        &packet->header, &packet->fields, b + words_total, words_buf - words_total, validate, swap);
     if (words_fields < 0) {
         return words_fields;
     }
@@ -873,7 +856,7 @@ int32_t vrt_write_packet(const struct vrt_packet* packet, void* buf, int32_t wor
         case VRT_PT_IF_CONTEXT: {
             /* IF context */
             int32_t words_if_context =
-                vrt_write_if_context(&packet->if_context, b + words_total, words_buf - words_total, validate);
+                write_if_context(&packet->if_context, b + words_total, words_buf - words_total, validate, swap);
             if (words_if_context < 0) {
                 return words_if_context;
             }
@@ -881,14 +864,15 @@ int32_t vrt_write_packet(const struct vrt_packet* packet, void* buf, int32_t wor
             break;
         }
         default: {
-            /* Do nothing here. Note that validation must be false to end up here. */
+            /* Do nothing here. Note that validation must be VRT_VALIDATION_NONE to end up here. */
             break;
         }
     }
 
     /* Trailer */
     if (!vrt_is_context(&packet->header) && packet->header.has.trailer) {
-        int32_t words_trailer = vrt_write_trailer(&packet->trailer, b + words_total, words_buf - words_total, validate);
+        int32_t words_trailer =
+            vrt_internal_write_trailer_swap(&packet->trailer, b + words_total, words_buf - words_total, validate, swap);
         if (words_trailer < 0) {
             return words_trailer;
         }
@@ -901,8 +885,37 @@ int32_t vrt_write_packet(const struct vrt_packet* packet, void* buf, int32_t wor
     }
 
     /* Write packet size directly into buffer to avoid copying const header */
-    b[0] &= 0xFFFF0000;
-    b[0] |= (uint16_t)words_total;
+    vrt_internal_store(vrt_set_bits(vrt_internal_load(b, swap), VRT_BITS_HEADER_PACKET_SIZE, (uint32_t)words_total), b,
+                       swap);
 
     return words_total;
 }
+
+/**
+ * Same as write_packet(), but compiled into a separate path for each validation level.
+ */
+static VRT_INTERNAL_FORCE_INLINE int32_t write_packet_specialized(const struct vrt_packet* packet,
+                                                                  void*                    buf,
+                                                                  int32_t                  words_buf,
+                                                                  enum vrt_validation      validate,
+                                                                  bool                     swap) {
+    switch (validate) {
+        case VRT_VALIDATION_NONE:
+            return write_packet(packet, buf, words_buf, VRT_VALIDATION_NONE, swap);
+        case VRT_VALIDATION_STRUCTURAL:
+            return write_packet(packet, buf, words_buf, VRT_VALIDATION_STRUCTURAL, swap);
+        default:
+            return write_packet(packet, buf, words_buf, VRT_VALIDATION_FULL, swap);
+    }
+}
+
+int32_t vrt_write_packet(const struct vrt_packet* packet, void* buf, int32_t words_buf, enum vrt_validation validate) {
+    return write_packet_specialized(packet, buf, words_buf, validate, false);
+}
+
+int32_t vrt_write_packet_be(const struct vrt_packet* packet,
+                            void*                    buf,
+                            int32_t                  words_buf,
+                            enum vrt_validation      validate) {
+    return write_packet_specialized(packet, buf, words_buf, validate, VRT_INTERNAL_NETWORK_ORDER_SWAP);
+}
@@ -0,0 +1,49 @@
+#ifndef TEST_SRC_CPU_LEVEL_TEST_H_
+#define TEST_SRC_CPU_LEVEL_TEST_H_
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include <../src/vrt_cpu.h>
+
+/**
+ * Fixture that runs each test once per instruction set level, by capping runtime dispatch at the level of the test
+ * parameter. Instantiate with:
+ * \code{.cpp}
+ * INSTANTIATE_TEST_SUITE_P(CpuLevels, MyTest, kCpuLevels, cpu_level_name);
+ * \endcode
+ * Levels the CPU doesn't support fall back to the widest one it does, so run on an AVX2 host to cover all kernels.
+ */
+class CpuLevelTest : public ::testing::TestWithParam<vrt_cpu_level> {
+   protected:
+    void SetUp() override { vrt_cpu_max_level = GetParam(); }
+
+    void TearDown() override { vrt_cpu_max_level = VRT_CPU_LEVEL_AVX2; }
+};
+
+/**
+ * All instruction set levels.
+ */
+static const auto kCpuLevels = ::testing::Values(VRT_CPU_LEVEL_SCALAR, VRT_CPU_LEVEL_SSSE3, VRT_CPU_LEVEL_AVX2);
+
+/**
+ * Name test instances after their instruction set level.
+ *
+ * \param info Test parameter info.
+ *
+ * \return Name.
+ */
+inline std::string cpu_level_name(const ::testing::TestParamInfo<vrt_cpu_level>& info) {
+    switch (info.param) {
+        case VRT_CPU_LEVEL_SCALAR:
+            return "Scalar";
+        case VRT_CPU_LEVEL_SSSE3:
+            return "Ssse3";
+        case VRT_CPU_LEVEL_AVX2:
+            return "Avx2";
+    }
+    return "Unknown";
+}
+
+#endif
@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+
+#include <vrt/vrt_bits.h>
+#include <vrt/vrt_init.h>
+#include <vrt/vrt_read.h>
+#include <vrt/vrt_types.h>
+#include <vrt/vrt_write.h>
+
+class BitsTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        vrt_init_packet(&p_);
+        buf_.fill(0xBAADF00D);
+    }
+
+    vrt_packet               p_{};
+    std::array<uint32_t, 32> buf_{};
+};
+
+TEST_F(BitsTest, GetBits) {
+    ASSERT_EQ(vrt_get_bits(0x12345678, 0, 4), 0x8);
+    ASSERT_EQ(vrt_get_bits(0x12345678, 28, 4), 0x1);
+    ASSERT_EQ(vrt_get_bits(0x12345678, 8, 16), 0x3456);
+}
+
+TEST_F(BitsTest, SetBits) {
+    ASSERT_EQ(vrt_set_bits(0x12345678, 0, 4, 0xA), 0x1234567A);
+    ASSERT_EQ(vrt_set_bits(0x12345678, 28, 4, 0xA), 0xA2345678);
+    ASSERT_EQ(vrt_set_bits(0x12345678, 8, 16, 0), 0x12000078);
+}
+
+TEST_F(BitsTest, PosAndMask) {
+    ASSERT_EQ(VRT_BITS_POS(VRT_BITS_HEADER_PACKET_COUNT), 16);
+    ASSERT_EQ(VRT_BITS_MASK(VRT_BITS_HEADER_PACKET_COUNT), 0x000F0000U);
+    ASSERT_EQ(VRT_BITS_MASK(VRT_BITS_HEADER_PACKET_TYPE), 0xF0000000U);
+    ASSERT_EQ(VRT_BITS_MASK(VRT_BITS_CIF0_CONTEXT_ASSOCIATION_LISTS), 0x00000100U);
+}
+
+TEST_F(BitsTest, LayoutsCoverWords) {
+    /* Each word is covered exactly once, so the layouts can't overlap or leave gaps */
+    uint64_t header = 0;
+    for (uint32_t m : {VRT_BITS_MASK(VRT_BITS_HEADER_PACKET_TYPE), VRT_BITS_MASK(VRT_BITS_HEADER_HAS_CLASS_ID),
+                       VRT_BITS_MASK(VRT_BITS_HEADER_HAS_TRAILER), VRT_BITS_MASK(VRT_BITS_HEADER_RESERVED),
+                       VRT_BITS_MASK(VRT_BITS_HEADER_TSM), VRT_BITS_MASK(VRT_BITS_HEADER_TSI),
+                       VRT_BITS_MASK(VRT_BITS_HEADER_TSF), VRT_BITS_MASK(VRT_BITS_HEADER_PACKET_COUNT),
+                       VRT_BITS_MASK(VRT_BITS_HEADER_PACKET_SIZE)}) {
+        header += m;
+    }
+    ASSERT_EQ(header, 0xFFFFFFFFU);
+
+    uint64_t cif0 = VRT_BITS_MASK(VRT_BITS_CIF0_CONTEXT_FIELD_CHANGE_INDICATOR) +
+                    VRT_BITS_MASK(VRT_BITS_CIF0_RESERVED);
+    for (uint32_t pos = VRT_BITS_POS(VRT_BITS_CIF0_CONTEXT_ASSOCIATION_LISTS);
+         pos <= VRT_BITS_POS(VRT_BITS_CIF0_REFERENCE_POINT_IDENTIFIER); ++pos) {
+        cif0 += 1U << pos;
+    }
+    ASSERT_EQ(cif0, 0xFFFFFFFFU);
+
+    uint64_t state_and_event = VRT_BITS_MASK(VRT_BITS_STATE_AND_EVENT_RESERVED_HIGH) +
+                               VRT_BITS_MASK(VRT_BITS_STATE_AND_EVENT_RESERVED_LOW) +
+                               VRT_BITS_MASK(VRT_BITS_STATE_AND_EVENT_USER_DEFINED);
+    for (uint32_t pos = VRT_BITS_POS(VRT_BITS_STATE_AND_EVENT_SAMPLE_LOSS);
+         pos <= VRT_BITS_POS(VRT_BITS_STATE_AND_EVENT_CALIBRATED_TIME); ++pos) {
+        state_and_event += 1U << pos;
+    }
+    for (uint32_t pos = VRT_BITS_POS(VRT_BITS_STATE_AND_EVENT_HAS_SAMPLE_LOSS);
+         pos <= VRT_BITS_POS(VRT_BITS_STATE_AND_EVENT_HAS_CALIBRATED_TIME); ++pos) {
+        state_and_event += 1U << pos;
+    }
+    ASSERT_EQ(state_and_event, 0xFFFFFFFFU);
+}
+
+TEST_F(BitsTest, SetBitsTruncates) {
+    ASSERT_EQ(vrt_set_bits(0x00000000, 4, 4, 0x1F), 0x000000F0);
+}
+
+TEST_F(BitsTest, HeaderGet) {
+    p_.header.packet_type  = VRT_PT_IF_DATA_WITH_STREAM_ID;
+    p_.header.has.trailer  = true;
+    p_.header.tsi          = VRT_TSI_GPS;
+    p_.header.tsf          = VRT_TSF_REAL_TIME;
+    p_.header.packet_count = 0xA;
+    p_.header.packet_size  = 0xBEEF;
+    ASSERT_EQ(vrt_write_header(&p_.header, buf_.data(), buf_.size(), VRT_VALIDATION_FULL), 1);
+    ASSERT_EQ(vrt_get_bits(buf_[0], VRT_BITS_HEADER_PACKET_TYPE), VRT_PT_IF_DATA_WITH_STREAM_ID);
+    ASSERT_EQ(vrt_get_bits(buf_[0], VRT_BITS_HEADER_HAS_CLASS_ID), 0);
+    ASSERT_EQ(vrt_get_bits(buf_[0], VRT_BITS_HEADER_HAS_TRAILER), 1);
+    ASSERT_EQ(vrt_get_bits(buf_[0], VRT_BITS_HEADER_TSM), VRT_TSM_FINE);
+    ASSERT_EQ(vrt_get_bits(buf_[0], VRT_BITS_HEADER_TSI), VRT_TSI_GPS);
+    ASSERT_EQ(vrt_get_bits(buf_[0], VRT_BITS_HEADER_TSF), VRT_TSF_REAL_TIME);
+    ASSERT_EQ(vrt_get_bits(buf_[0], VRT_BITS_HEADER_PACKET_COUNT), 0xA);
+    ASSERT_EQ(vrt_get_bits(buf_[0], VRT_BITS_HEADER_PACKET_SIZE), 0xBEEF);
+}
+
+TEST_F(BitsTest, HeaderSet) {
+    uint32_t w = 0;
+    w          = vrt_set_bits(w, VRT_BITS_HEADER_PACKET_TYPE, VRT_PT_EXT_CONTEXT);
+    w          = vrt_set_bits(w, VRT_BITS_HEADER_HAS_CLASS_ID, 1);
+    w          = vrt_set_bits(w, VRT_BITS_HEADER_TSM, VRT_TSM_COARSE);
+    w          = vrt_set_bits(w, VRT_BITS_HEADER_TSI, VRT_TSI_OTHER);
+    w          = vrt_set_bits(w, VRT_BITS_HEADER_TSF, VRT_TSF_FREE_RUNNING_COUNT);
+    w          = vrt_set_bits(w, VRT_BITS_HEADER_PACKET_COUNT, 0x5);
+    w          = vrt_set_bits(w, VRT_BITS_HEADER_PACKET_SIZE, 0x1234);
+    ASSERT_EQ(vrt_read_header(&w, 1, &p_.header, VRT_VALIDATION_FULL), 1);
+    ASSERT_EQ(p_.header.packet_type, VRT_PT_EXT_CONTEXT);
+    ASSERT_TRUE(p_.header.has.class_id);
+    ASSERT_FALSE(p_.header.has.trailer);
+    ASSERT_EQ(p_.header.tsm, VRT_TSM_COARSE);
+    ASSERT_EQ(p_.header.tsi, VRT_TSI_OTHER);
+    ASSERT_EQ(p_.header.tsf, VRT_TSF_FREE_RUNNING_COUNT);
+    ASSERT_EQ(p_.header.packet_count, 0x5);
+    ASSERT_EQ(p_.header.packet_size, 0x1234);
+}
+
+TEST_F(BitsTest, TrailerGet) {
+    p_.trailer.has.valid_data                      = true;
+    p_.trailer.valid_data                          = true;
+    p_.trailer.has.sample_loss                     = true;
+    p_.trailer.sample_loss                         = false;
+    p_.trailer.has.user_defined8                   = true;
+    p_.trailer.user_defined8                       = true;
+    p_.trailer.has.associated_context_packet_count = true;
+    p_.trailer.associated_context_packet_count     = 0x55;
+    ASSERT_EQ(vrt_write_trailer(&p_.trailer, buf_.data(), buf_.size(), VRT_VALIDATION_FULL), 1);
+    ASSERT_EQ(vrt_get_bits(buf_[0], VRT_BITS_TRAILER_HAS_CALIBRATED_TIME), 0);
+    ASSERT_EQ(vrt_get_bits(buf_[0], VRT_BITS_TRAILER_HAS_VALID_DATA), 1);
+    ASSERT_EQ(vrt_get_bits(buf_[0], VRT_BITS_TRAILER_VALID_DATA), 1);
+    ASSERT_EQ(vrt_get_bits(buf_[0], VRT_BITS_TRAILER_HAS_SAMPLE_LOSS), 1);
+    ASSERT_EQ(vrt_get_bits(buf_[0], VRT_BITS_TRAILER_SAMPLE_LOSS), 0);
+    ASSERT_EQ(vrt_get_bits(buf_[0], VRT_BITS_TRAILER_HAS_USER_DEFINED8), 1);
+    ASSERT_EQ(vrt_get_bits(buf_[0], VRT_BITS_TRAILER_USER_DEFINED8), 1);
+    ASSERT_EQ(vrt_get_bits(buf_[0], VRT_BITS_TRAILER_HAS_ASSOCIATED_CONTEXT_PACKET_COUNT), 1);
+    ASSERT_EQ(vrt_get_bits(buf_[0], VRT_BITS_TRAILER_ASSOCIATED_CONTEXT_PACKET_COUNT), 0x55);
+}
+
+TEST_F(BitsTest, TrailerSet) {
+    uint32_t w = 0;
+    w          = vrt_set_bits(w, VRT_BITS_TRAILER_HAS_AGC_OR_MGC, 1);
+    w          = vrt_set_bits(w, VRT_BITS_TRAILER_AGC_OR_MGC, VRT_AOM_AGC);
+    w          = vrt_set_bits(w, VRT_BITS_TRAILER_HAS_OVER_RANGE, 1);
+    w          = vrt_set_bits(w, VRT_BITS_TRAILER_OVER_RANGE, 1);
+    ASSERT_EQ(vrt_read_trailer(&w, 1, &p_.trailer), 1);
+    ASSERT_TRUE(p_.trailer.has.agc_or_mgc);
+    ASSERT_EQ(p_.trailer.agc_or_mgc, VRT_AOM_AGC);
+    ASSERT_TRUE(p_.trailer.has.over_range);
+    ASSERT_TRUE(p_.trailer.over_range);
+    ASSERT_FALSE(p_.trailer.has.valid_data);
+    ASSERT_FALSE(p_.trailer.has.associated_context_packet_count);
+}
+
+TEST_F(BitsTest, Cif0) {
+    p_.if_context.context_field_change_indicator = true;
+    p_.if_context.has.bandwidth                  = true;
+    p_.if_context.has.state_and_event_indicators = true;
+    ASSERT_GT(vrt_write_if_context(&p_.if_context, buf_.data(), buf_.size(), VRT_VALIDATION_FULL), 0);
+    ASSERT_EQ(vrt_get_bits(buf_[0], VRT_BITS_CIF0_CONTEXT_FIELD_CHANGE_INDICATOR), 1);
+    ASSERT_EQ(vrt_get_bits(buf_[0], VRT_BITS_CIF0_REFERENCE_POINT_IDENTIFIER), 0);
+    ASSERT_EQ(vrt_get_bits(buf_[0], VRT_BITS_CIF0_BANDWIDTH), 1);
+    ASSERT_EQ(vrt_get_bits(buf_[0], VRT_BITS_CIF0_STATE_AND_EVENT_INDICATORS), 1);
+    ASSERT_EQ(vrt_get_bits(buf_[0], VRT_BITS_CIF0_CONTEXT_ASSOCIATION_LISTS), 0);
+}
+
+TEST_F(BitsTest, StateAndEvent) {
+    p_.if_context.has.state_and_event_indicators                 = true;
+    p_.if_context.state_and_event_indicators.has.reference_lock  = true;
+    p_.if_context.state_and_event_indicators.reference_lock      = true;
+    p_.if_context.state_and_event_indicators.has.detected_signal = true;
+    p_.if_context.state_and_event_indicators.detected_signal     = false;
+    p_.if_context.state_and_event_indicators.user_defined        = 0xA5;
+    ASSERT_EQ(vrt_write_if_context(&p_.if_context, buf_.data(), buf_.size(), VRT_VALIDATION_FULL), 2);
+    ASSERT_EQ(vrt_get_bits(buf_[1], VRT_BITS_STATE_AND_EVENT_HAS_REFERENCE_LOCK), 1);
+    ASSERT_EQ(vrt_get_bits(buf_[1], VRT_BITS_STATE_AND_EVENT_REFERENCE_LOCK), 1);
+    ASSERT_EQ(vrt_get_bits(buf_[1], VRT_BITS_STATE_AND_EVENT_HAS_DETECTED_SIGNAL), 1);
+    ASSERT_EQ(vrt_get_bits(buf_[1], VRT_BITS_STATE_AND_EVENT_DETECTED_SIGNAL), 0);
+    ASSERT_EQ(vrt_get_bits(buf_[1], VRT_BITS_STATE_AND_EVENT_HAS_SAMPLE_LOSS), 0);
+    ASSERT_EQ(vrt_get_bits(buf_[1], VRT_BITS_STATE_AND_EVENT_USER_DEFINED), 0xA5);
+}
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#include <vrt/vrt_byte_swap.h>
+
+#include "cpu_level_test.h"
+#include "hex.h"
+
+static uint32_t reference_swap(uint32_t u) {
+    return (u >> 24U) | ((u >> 8U) & 0x0000FF00U) | ((u << 8U) & 0x00FF0000U) | (u << 24U);
+}
+
+class ByteSwapTest : public CpuLevelTest {
+   protected:
+    void SetUp() override {
+        CpuLevelTest::SetUp();
+        for (size_t i = 0; i < src_.size(); ++i) {
+            src_[i] = 0x01020304U + static_cast<uint32_t>(i) * 0x11111111U;
+        }
+        dst_.fill(0xBAADF00D);
+    }
+
+    std::array<uint32_t, 67> src_{};
+    std::array<uint32_t, 67> dst_{};
+};
+
+TEST_P(ByteSwapTest, DispatchLevel) {
+    if (GetParam() < VRT_CPU_LEVEL_AVX2) {
+        ASSERT_FALSE(vrt_cpu_has_avx2());
+    }
+    if (GetParam() < VRT_CPU_LEVEL_SSSE3) {
+        ASSERT_FALSE(vrt_cpu_has_ssse3());
+    }
+}
+
+TEST_P(ByteSwapTest, NegativeWords) {
+    vrt_byte_swap(src_.data(), dst_.data(), -1);
+    ASSERT_EQ(Hex(dst_[0]), Hex(0xBAADF00D));
+}
+
+TEST_P(ByteSwapTest, ZeroWords) {
+    vrt_byte_swap(src_.data(), dst_.data(), 0);
+    ASSERT_EQ(Hex(dst_[0]), Hex(0xBAADF00D));
+}
+
+TEST_P(ByteSwapTest, OneWord) {
+    src_[0] = 0x01234567;
+    vrt_byte_swap(src_.data(), dst_.data(), 1);
+    ASSERT_EQ(Hex(dst_[0]), Hex(0x67452301));
+    ASSERT_EQ(Hex(dst_[1]), Hex(0xBAADF00D));
+}
+
+TEST_P(ByteSwapTest, OutOfPlaceAllSizes) {
+    /* Covers scalar, SSSE3, and AVX2 paths and their tails */
+    for (int32_t words = 1; words <= static_cast<int32_t>(src_.size()); ++words) {
+        dst_.fill(0xBAADF00D);
+        vrt_byte_swap(src_.data(), dst_.data(), words);
+        for (int32_t i = 0; i < words; ++i) {
+            ASSERT_EQ(Hex(dst_[i]), Hex(reference_swap(src_[i]))) << "words = " << words << ", i = " << i;
+        }
+        if (words < static_cast<int32_t>(dst_.size())) {
+            ASSERT_EQ(Hex(dst_[words]), Hex(0xBAADF00D)) << "words = " << words;
+        }
+    }
+}
+
+TEST_P(ByteSwapTest, InPlace) {
+    std::array<uint32_t, 67> ref{src_};
+    vrt_byte_swap(src_.data(), src_.data(), static_cast<int32_t>(src_.size()));
+    for (size_t i = 0; i < src_.size(); ++i) {
+        ASSERT_EQ(Hex(src_[i]), Hex(reference_swap(ref[i])));
+    }
+}
+
+TEST_P(ByteSwapTest, Twice) {
+    vrt_byte_swap(src_.data(), dst_.data(), static_cast<int32_t>(src_.size()));
+    vrt_byte_swap(dst_.data(), dst_.data(), static_cast<int32_t>(dst_.size()));
+    ASSERT_EQ(src_, dst_);
+}
+
+TEST_P(ByteSwapTest, Unaligned) {
+    constexpr int32_t                         words{33};
+    std::array<uint8_t, sizeof(uint32_t) * 35> in{};
+    std::array<uint8_t, sizeof(uint32_t) * 35> out{};
+    for (size_t i = 0; i < in.size(); ++i) {
+        in[i] = static_cast<uint8_t>(i);
+    }
+
+    vrt_byte_swap(in.data() + 1, out.data() + 3, words);
+    for (int32_t i = 0; i < words; ++i) {
+        for (int32_t j = 0; j < 4; ++j) {
+            ASSERT_EQ(out[3 + 4 * i + j], in[1 + 4 * i + (3 - j)]);
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(CpuLevels, ByteSwapTest, kCpuLevels, cpu_level_name);
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+
+#include <vrt/vrt_byte_swap.h>
+#include <vrt/vrt_context_cache.h>
+#include <vrt/vrt_error_code.h>
+#include <vrt/vrt_types.h>
+#include <vrt/vrt_util.h>
+
+class ContextCacheTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        ASSERT_EQ(vrt_init_context_cache(&cache_, entries_.data(), entries_.size(), words_.data(), 8), 0);
+        /* Bandwidth of 1 Hz */
+        buf_ = {0x20000000, 0x00000000, 0x00100000};
+    }
+
+    std::array<vrt_context_cache_entry, 4> entries_{};
+    std::array<uint32_t, 4 * 8>            words_{};
+    vrt_context_cache                      cache_{};
+    std::array<uint32_t, 3>                buf_{};
+    const vrt_if_context*                  c_{nullptr};
+};
+
+TEST_F(ContextCacheTest, InvalidCapacity) {
+    ASSERT_EQ(vrt_init_context_cache(&cache_, entries_.data(), 3, words_.data(), 8), VRT_ERR_INVALID_CAPACITY);
+}
+
+TEST_F(ContextCacheTest, Miss) {
+    ASSERT_EQ(vrt_read_if_context_cached(&cache_, 1, buf_.data(), buf_.size(), &c_, VRT_VALIDATION_FULL), 3);
+    ASSERT_NE(c_, nullptr);
+    ASSERT_TRUE(c_->has.bandwidth);
+    ASSERT_EQ(c_->bandwidth, 1.0);
+    ASSERT_EQ(cache_.hits, 0);
+    ASSERT_EQ(cache_.misses, 1);
+}
+
+TEST_F(ContextCacheTest, Hit) {
+    ASSERT_EQ(vrt_read_if_context_cached(&cache_, 1, buf_.data(), buf_.size(), &c_, VRT_VALIDATION_FULL), 3);
+    const vrt_if_context* first = c_;
+    ASSERT_EQ(vrt_read_if_context_cached(&cache_, 1, buf_.data(), buf_.size(), &c_, VRT_VALIDATION_FULL), 3);
+    ASSERT_EQ(c_, first);
+    ASSERT_EQ(c_->bandwidth, 1.0);
+    ASSERT_EQ(cache_.hits, 1);
+    ASSERT_EQ(cache_.misses, 1);
+}
+
+TEST_F(ContextCacheTest, ChangedWords) {
+    ASSERT_EQ(vrt_read_if_context_cached(&cache_, 1, buf_.data(), buf_.size(), &c_, VRT_VALIDATION_FULL), 3);
+    buf_[2] = 0x00200000;
+    ASSERT_EQ(vrt_read_if_context_cached(&cache_, 1, buf_.data(), buf_.size(), &c_, VRT_VALIDATION_FULL), 3);
+    ASSERT_EQ(c_->bandwidth, 2.0);
+    ASSERT_EQ(cache_.hits, 0);
+    ASSERT_EQ(cache_.misses, 2);
+}
+
+TEST_F(ContextCacheTest, ChangeIndicator) {
+    buf_[0] |= 0x80000000;
+    ASSERT_EQ(vrt_read_if_context_cached(&cache_, 1, buf_.data(), buf_.size(), &c_, VRT_VALIDATION_FULL), 3);
+    ASSERT_EQ(vrt_read_if_context_cached(&cache_, 1, buf_.data(), buf_.size(), &c_, VRT_VALIDATION_FULL), 3);
+    ASSERT_TRUE(c_->context_field_change_indicator);
+    ASSERT_EQ(cache_.hits, 0);
+    ASSERT_EQ(cache_.misses, 2);
+}
+
+TEST_F(ContextCacheTest, SeparateStreams) {
+    ASSERT_EQ(vrt_read_if_context_cached(&cache_, 1, buf_.data(), buf_.size(), &c_, VRT_VALIDATION_FULL), 3);
+    const vrt_if_context* first = c_;
+    buf_[2]                     = 0x00200000;
+    ASSERT_EQ(vrt_read_if_context_cached(&cache_, 2, buf_.data(), buf_.size(), &c_, VRT_VALIDATION_FULL), 3);
+    ASSERT_NE(c_, first);
+    ASSERT_EQ(first->bandwidth, 1.0);
+    ASSERT_EQ(c_->bandwidth, 2.0);
+    ASSERT_EQ(cache_.size, 2);
+}
+
+TEST_F(ContextCacheTest, StreamsFull) {
+    for (uint32_t i = 0; i < 3; ++i) {
+        ASSERT_EQ(vrt_read_if_context_cached(&cache_, i, buf_.data(), buf_.size(), &c_, VRT_VALIDATION_FULL), 3);
+    }
+    ASSERT_EQ(vrt_read_if_context_cached(&cache_, 3, buf_.data(), buf_.size(), &c_, VRT_VALIDATION_FULL),
+              VRT_ERR_STREAMS_FULL);
+}
+
+TEST_F(ContextCacheTest, TooLarge) {
+    std::array<uint32_t, 9> large{};
+    ASSERT_EQ(vrt_read_if_context_cached(&cache_, 1, large.data(), large.size(), &c_, VRT_VALIDATION_FULL),
+              VRT_ERR_BUFFER_SIZE);
+}
+
+TEST_F(ContextCacheTest, DecodeErrorNotCached) {
+    /* Reserved bit set */
+    buf_[0] |= 0x00000001;
+    ASSERT_LT(vrt_read_if_context_cached(&cache_, 1, buf_.data(), buf_.size(), &c_, VRT_VALIDATION_FULL), 0);
+    ASSERT_LT(vrt_read_if_context_cached(&cache_, 1, buf_.data(), buf_.size(), &c_, VRT_VALIDATION_FULL), 0);
+    ASSERT_EQ(cache_.hits, 0);
+}
+
+TEST_F(ContextCacheTest, BigEndian) {
+    if (vrt_is_platform_little_endian()) {
+        vrt_byte_swap(buf_.data(), buf_.data(), buf_.size());
+    }
+    ASSERT_EQ(vrt_read_if_context_cached_be(&cache_, 1, buf_.data(), buf_.size(), &c_, VRT_VALIDATION_FULL), 3);
+    ASSERT_EQ(vrt_read_if_context_cached_be(&cache_, 1, buf_.data(), buf_.size(), &c_, VRT_VALIDATION_FULL), 3);
+    ASSERT_EQ(c_->bandwidth, 1.0);
+    ASSERT_EQ(cache_.hits, 1);
+}
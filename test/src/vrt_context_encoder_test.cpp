@@ -0,0 +1,199 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+
+#include <vrt/vrt_byte_swap.h>
+#include <vrt/vrt_context_encoder.h>
+#include <vrt/vrt_error_code.h>
+#include <vrt/vrt_init.h>
+#include <vrt/vrt_types.h>
+#include <vrt/vrt_util.h>
+#include <vrt/vrt_write.h>
+
+class ContextEncoderTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        vrt_init_context_encoder(&e_);
+        vrt_init_if_context(&c_);
+        buf_.fill(0xBAADF00D);
+        expected_.fill(0xBAADF00D);
+    }
+
+    /**
+     * Write with the encoder and compare to a plain full write of the same context.
+     */
+    void assert_same_as_full(bool change) {
+        c_.context_field_change_indicator = change;
+        int32_t words                     = vrt_write_if_context(&c_, expected_.data(), expected_.size(),
+                                                                 VRT_VALIDATION_FULL);
+        ASSERT_GT(words, 0);
+        ASSERT_EQ(vrt_write_if_context_delta(&e_, &c_, true, buf_.data(), buf_.size(), VRT_VALIDATION_FULL), words);
+        for (int32_t i = 0; i < words; ++i) {
+            ASSERT_EQ(buf_[i], expected_[i]);
+        }
+    }
+
+    vrt_context_encoder       e_{};
+    vrt_if_context            c_{};
+    std::array<uint32_t, 128> buf_{};
+    std::array<uint32_t, 128> expected_{};
+};
+
+TEST_F(ContextEncoderTest, FirstIsFull) {
+    c_.has.bandwidth = true;
+    c_.bandwidth     = 1.0;
+    ASSERT_EQ(vrt_write_if_context_delta(&e_, &c_, false, buf_.data(), buf_.size(), VRT_VALIDATION_FULL), 3);
+    ASSERT_EQ(buf_[0], 0xA0000000);
+    ASSERT_EQ(buf_[1], 0x00000000);
+    ASSERT_EQ(buf_[2], 0x00100000);
+}
+
+TEST_F(ContextEncoderTest, Unchanged) {
+    c_.has.bandwidth = true;
+    c_.bandwidth     = 1.0;
+    ASSERT_EQ(vrt_write_if_context_delta(&e_, &c_, true, buf_.data(), buf_.size(), VRT_VALIDATION_FULL), 3);
+    ASSERT_EQ(vrt_write_if_context_delta(&e_, &c_, false, buf_.data(), buf_.size(), VRT_VALIDATION_FULL), 0);
+    ASSERT_EQ(vrt_write_if_context_delta(&e_, &c_, true, buf_.data(), buf_.size(), VRT_VALIDATION_FULL), 3);
+    ASSERT_EQ(buf_[0], 0x20000000);
+    ASSERT_EQ(buf_[2], 0x00100000);
+}
+
+TEST_F(ContextEncoderTest, ChangeOnly) {
+    c_.has.bandwidth   = true;
+    c_.bandwidth       = 1.0;
+    c_.has.sample_rate = true;
+    c_.sample_rate     = 1e6;
+    ASSERT_EQ(vrt_write_if_context_delta(&e_, &c_, true, buf_.data(), buf_.size(), VRT_VALIDATION_FULL), 5);
+    c_.bandwidth = 2.0;
+    ASSERT_EQ(vrt_write_if_context_delta(&e_, &c_, false, buf_.data(), buf_.size(), VRT_VALIDATION_FULL), 3);
+    ASSERT_EQ(buf_[0], 0xA0000000);
+    ASSERT_EQ(buf_[1], 0x00000000);
+    ASSERT_EQ(buf_[2], 0x00200000);
+}
+
+TEST_F(ContextEncoderTest, FullAfterChangeOnly) {
+    c_.has.bandwidth   = true;
+    c_.bandwidth       = 1.0;
+    c_.has.sample_rate = true;
+    c_.sample_rate     = 1e6;
+    ASSERT_EQ(vrt_write_if_context_delta(&e_, &c_, true, buf_.data(), buf_.size(), VRT_VALIDATION_FULL), 5);
+    c_.sample_rate = 2e6;
+    ASSERT_EQ(vrt_write_if_context_delta(&e_, &c_, false, buf_.data(), buf_.size(), VRT_VALIDATION_FULL), 3);
+    assert_same_as_full(false);
+}
+
+TEST_F(ContextEncoderTest, AddedField) {
+    c_.has.bandwidth = true;
+    c_.bandwidth     = 1.0;
+    ASSERT_EQ(vrt_write_if_context_delta(&e_, &c_, true, buf_.data(), buf_.size(), VRT_VALIDATION_FULL), 3);
+    c_.has.sample_rate = true;
+    c_.sample_rate     = 1e6;
+    ASSERT_EQ(vrt_write_if_context_delta(&e_, &c_, false, buf_.data(), buf_.size(), VRT_VALIDATION_FULL), 3);
+    ASSERT_EQ(buf_[0], 0x80200000);
+    assert_same_as_full(false);
+}
+
+TEST_F(ContextEncoderTest, RemovedFieldIsFull) {
+    c_.has.bandwidth   = true;
+    c_.bandwidth       = 1.0;
+    c_.has.sample_rate = true;
+    c_.sample_rate     = 1e6;
+    ASSERT_EQ(vrt_write_if_context_delta(&e_, &c_, true, buf_.data(), buf_.size(), VRT_VALIDATION_FULL), 5);
+    c_.has.sample_rate = false;
+    ASSERT_EQ(vrt_write_if_context_delta(&e_, &c_, false, buf_.data(), buf_.size(), VRT_VALIDATION_FULL), 3);
+    ASSERT_EQ(buf_[0], 0xA0000000);
+    ASSERT_EQ(buf_[2], 0x00100000);
+}
+
+TEST_F(ContextEncoderTest, OverRangeCountIsNotChange) {
+    c_.has.over_range_count = true;
+    c_.over_range_count     = 1;
+    ASSERT_EQ(vrt_write_if_context_delta(&e_, &c_, true, buf_.data(), buf_.size(), VRT_VALIDATION_FULL), 2);
+    c_.over_range_count = 2;
+    ASSERT_EQ(vrt_write_if_context_delta(&e_, &c_, false, buf_.data(), buf_.size(), VRT_VALIDATION_FULL), 2);
+    ASSERT_EQ(buf_[0], 0x00400000);
+    ASSERT_EQ(buf_[1], 0x00000002);
+}
+
+TEST_F(ContextEncoderTest, SpliceManyFields) {
+    c_.has.reference_point_identifier                 = true;
+    c_.reference_point_identifier                     = 0x12345678;
+    c_.has.bandwidth                                  = true;
+    c_.bandwidth                                      = 1.0;
+    c_.has.gain                                       = true;
+    c_.gain.stage1                                    = 1.0F;
+    c_.has.sample_rate                                = true;
+    c_.sample_rate                                    = 1e6;
+    c_.has.state_and_event_indicators                 = true;
+    c_.state_and_event_indicators.has.calibrated_time = true;
+    c_.state_and_event_indicators.calibrated_time     = true;
+    c_.has.formatted_gps_geolocation                  = true;
+    c_.formatted_gps_geolocation.has.latitude         = true;
+    c_.formatted_gps_geolocation.latitude             = 45.0;
+    c_.has.ephemeris_reference_identifier             = true;
+    c_.ephemeris_reference_identifier                 = 0xABCDEF01;
+    ASSERT_EQ(vrt_write_if_context_delta(&e_, &c_, true, buf_.data(), buf_.size(), VRT_VALIDATION_FULL), 20);
+    c_.sample_rate                        = 2e6;
+    c_.formatted_gps_geolocation.latitude = -45.0;
+    c_.ephemeris_reference_identifier     = 0x01;
+    assert_same_as_full(true);
+    c_.state_and_event_indicators.calibrated_time = false;
+    ASSERT_GT(vrt_write_if_context_delta(&e_, &c_, false, buf_.data(), buf_.size(), VRT_VALIDATION_FULL), 0);
+    assert_same_as_full(false);
+}
+
+TEST_F(ContextEncoderTest, GpsAscii) {
+    const std::array<char, 8> ascii{'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h'};
+    c_.has.bandwidth             = true;
+    c_.bandwidth                 = 1.0;
+    c_.has.gps_ascii             = true;
+    c_.gps_ascii.number_of_words = 2;
+    c_.gps_ascii.ascii           = ascii.data();
+    assert_same_as_full(true);
+    assert_same_as_full(false);
+
+    /* Contents may have changed, so unchanged fixed size fields are left out but GPS ASCII is written */
+    ASSERT_EQ(vrt_write_if_context_delta(&e_, &c_, false, buf_.data(), buf_.size(), VRT_VALIDATION_FULL), 5);
+    ASSERT_EQ(buf_[0], 0x00000200);
+    ASSERT_EQ(buf_[2], 2);
+    c_.has.gps_ascii = false;
+    ASSERT_EQ(vrt_write_if_context_delta(&e_, &c_, true, buf_.data(), buf_.size(), VRT_VALIDATION_FULL), 3);
+    ASSERT_EQ(vrt_write_if_context_delta(&e_, &c_, false, buf_.data(), buf_.size(), VRT_VALIDATION_FULL), 0);
+}
+
+TEST_F(ContextEncoderTest, BufferSize) {
+    c_.has.bandwidth = true;
+    c_.bandwidth     = 1.0;
+    ASSERT_EQ(vrt_write_if_context_delta(&e_, &c_, true, buf_.data(), 2, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+}
+
+TEST_F(ContextEncoderTest, ErrorKeepsState) {
+    c_.has.bandwidth = true;
+    c_.bandwidth     = 1.0;
+    ASSERT_EQ(vrt_write_if_context_delta(&e_, &c_, true, buf_.data(), buf_.size(), VRT_VALIDATION_FULL), 3);
+    c_.bandwidth = -1.0;
+    ASSERT_EQ(vrt_write_if_context_delta(&e_, &c_, false, buf_.data(), buf_.size(), VRT_VALIDATION_FULL),
+              VRT_ERR_BOUNDS_BANDWIDTH);
+    ASSERT_EQ(vrt_write_if_context_delta(&e_, &c_, true, buf_.data(), buf_.size(), VRT_VALIDATION_FULL),
+              VRT_ERR_BOUNDS_BANDWIDTH);
+    c_.bandwidth = 1.0;
+    ASSERT_EQ(vrt_write_if_context_delta(&e_, &c_, false, buf_.data(), buf_.size(), VRT_VALIDATION_FULL), 0);
+}
+
+TEST_F(ContextEncoderTest, BigEndian) {
+    c_.has.bandwidth   = true;
+    c_.bandwidth       = 1.0;
+    c_.has.sample_rate = true;
+    c_.sample_rate     = 1e6;
+    ASSERT_EQ(vrt_write_if_context_delta_be(&e_, &c_, true, buf_.data(), buf_.size(), VRT_VALIDATION_FULL), 5);
+    c_.bandwidth = 2.0;
+    ASSERT_EQ(vrt_write_if_context_delta_be(&e_, &c_, false, buf_.data(), buf_.size(), VRT_VALIDATION_FULL), 3);
+    ASSERT_EQ(vrt_write_if_context_delta_be(&e_, &c_, true, buf_.data(), buf_.size(), VRT_VALIDATION_FULL), 5);
+    if (vrt_is_platform_little_endian()) {
+        vrt_byte_swap(buf_.data(), buf_.data(), 5);
+    }
+    ASSERT_EQ(buf_[0], 0x20200000);
+    ASSERT_EQ(buf_[2], 0x00200000);
+    ASSERT_EQ(buf_[4], 0x24000000);
+}
@@ -0,0 +1,448 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <vrt/vrt_byte_swap.h>
+#include <vrt/vrt_convert.h>
+#include <vrt/vrt_error_code.h>
+#include <vrt/vrt_types.h>
+#include <vrt/vrt_util.h>
+
+#include "cpu_level_test.h"
+
+class ConvertTest : public CpuLevelTest {
+   protected:
+    void SetUp() override {
+        CpuLevelTest::SetUp();
+        f_                         = {};
+        f_.packing_method          = VRT_PM_PROCESSING_EFFICIENT;
+        f_.real_or_complex         = VRT_ROC_COMPLEX_CARTESIAN;
+        f_.data_item_format        = VRT_DIF_SIGNED_FIXED_POINT;
+        f_.item_packing_field_size = 15;
+        f_.data_item_size          = 15;
+    }
+
+    /**
+     * Reference conversion of host order words.
+     */
+    static std::vector<float> reference(const std::vector<uint32_t>& words, int32_t bits, bool is_signed, float scale) {
+        std::vector<float> r;
+        for (uint32_t w : words) {
+            for (int32_t pos = 32 - bits; pos >= 0; pos -= bits) {
+                uint64_t u = (w >> pos) & ((uint64_t{1} << bits) - 1);
+                int64_t  v = static_cast<int64_t>(u);
+                if (is_signed && (u >> (bits - 1)) != 0) {
+                    v -= int64_t{1} << bits;
+                }
+                r.push_back(static_cast<float>(v) * scale);
+            }
+        }
+        return r;
+    }
+
+    /**
+     * Reference unpacking of host order words, one bit at a time, into item packing fields.
+     */
+    static std::vector<uint64_t> reference_fields(const std::vector<uint32_t>& words, int32_t bits, bool link) {
+        const int64_t         total     = static_cast<int64_t>(words.size()) * 32;
+        const int64_t         container = bits <= 32 ? 32 : 64;
+        const int64_t         per       = container / bits;
+        std::vector<uint64_t> r;
+        for (int64_t i = 0;; ++i) {
+            const int64_t offset = link ? i * bits : i / per * container + i % per * bits;
+            if (link ? offset + bits > total : (i / per + 1) * container > total) {
+                return r;
+            }
+            uint64_t v = 0;
+            for (int64_t k = offset; k < offset + bits; ++k) {
+                v = (v << 1U) | ((words[k / 32] >> (31 - k % 32)) & 1U);
+            }
+            r.push_back(v);
+        }
+    }
+
+    /**
+     * Reference packing of item packing fields into host order words, one bit at a time.
+     */
+    static std::vector<uint32_t> reference_words(const std::vector<uint64_t>& fields, int32_t bits, bool link) {
+        const int64_t         container = bits <= 32 ? 32 : 64;
+        const int64_t         per       = container / bits;
+        std::vector<uint32_t> r;
+        int64_t               end = 0;
+        for (std::size_t i = 0; i < fields.size(); ++i) {
+            const int64_t offset = link ? i * bits : i / per * container + i % per * bits;
+            end                  = link ? offset + bits : (i / per + 1) * container;
+            r.resize((end + 31) / 32);
+            for (int64_t k = 0; k < bits; ++k) {
+                if (((fields[i] >> (bits - 1 - k)) & 1U) != 0) {
+                    r[(offset + k) / 32] |= 1U << (31 - (offset + k) % 32);
+                }
+            }
+        }
+        return r;
+    }
+
+    vrt_data_packet_payload_format f_{};
+    vrt_converter                  c_{};
+};
+
+TEST_P(ConvertTest, Unsupported) {
+    f_.data_item_format = VRT_DIF_IEEE_754_SINGLE_PRECISION_FLOATING_POINT;
+    ASSERT_EQ(vrt_init_converter(&c_, &f_, 1.0F), VRT_ERR_UNSUPPORTED_FORMAT);
+    SetUp();
+    f_.item_packing_field_size = 11;
+    ASSERT_EQ(vrt_init_converter(&c_, &f_, 1.0F), VRT_ERR_UNSUPPORTED_FORMAT);
+    SetUp();
+    f_.event_tag_size = 1;
+    ASSERT_EQ(vrt_init_converter(&c_, &f_, 1.0F), VRT_ERR_UNSUPPORTED_FORMAT);
+    SetUp();
+    f_.data_item_size   = 11;
+    f_.event_tag_size   = 1;
+    f_.channel_tag_size = 3;
+    ASSERT_EQ(vrt_init_converter(&c_, &f_, 1.0F), 0);
+    SetUp();
+    f_.packing_method = VRT_PM_LINK_EFFICIENT;
+    ASSERT_EQ(vrt_init_converter(&c_, &f_, 1.0F), 0);
+    SetUp();
+    ASSERT_EQ(vrt_init_converter(&c_, &f_, 1.0F), 0);
+}
+
+TEST_P(ConvertTest, BufferSize) {
+    ASSERT_EQ(vrt_init_converter(&c_, &f_, 1.0F), 0);
+    std::vector<uint32_t> body(4);
+    std::vector<float>    dst(8);
+    ASSERT_EQ(vrt_convert_to_float(&c_, body.data(), 4, dst.data(), 7), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_convert_to_float(&c_, body.data(), 4, dst.data(), 8), 8);
+    ASSERT_EQ(vrt_convert_to_float(&c_, body.data(), 0, dst.data(), 0), 0);
+}
+
+TEST_P(ConvertTest, ComplexInt16) {
+    ASSERT_EQ(vrt_init_converter(&c_, &f_, 1.0F / 32768), 0);
+    std::vector<uint32_t> body{0x7FFF8000, 0x0001FFFF};
+    std::vector<float>    dst(4);
+    ASSERT_EQ(vrt_convert_to_float(&c_, body.data(), body.size(), dst.data(), dst.size()), 4);
+    ASSERT_EQ(dst, (std::vector<float>{32767.0F / 32768, -1.0F, 1.0F / 32768, -1.0F / 32768}));
+}
+
+TEST_P(ConvertTest, AllFormats) {
+    std::mt19937 rng(1);
+    for (int32_t bits : {8, 16, 32}) {
+        for (vrt_data_item_format dif : {VRT_DIF_SIGNED_FIXED_POINT, VRT_DIF_UNSIGNED_FIXED_POINT}) {
+            f_.item_packing_field_size = bits - 1;
+            f_.data_item_size          = bits - 1;
+            f_.data_item_format        = dif;
+            const float scale          = 0.25F;
+            ASSERT_EQ(vrt_init_converter(&c_, &f_, scale), 0);
+            /* Lengths that exercise both vector loops and scalar tails */
+            for (int32_t words = 0; words < 40; ++words) {
+                std::vector<uint32_t> body(words);
+                for (uint32_t& w : body) {
+                    w = static_cast<uint32_t>(rng());
+                }
+                const std::vector<float> expected = reference(body, bits, dif == VRT_DIF_SIGNED_FIXED_POINT, scale);
+
+                std::vector<float> dst(expected.size() + 1, -7.0F);
+                ASSERT_EQ(vrt_convert_to_float(&c_, body.data(), words, dst.data(), dst.size()), expected.size());
+                ASSERT_EQ(std::vector<float>(dst.begin(), dst.end() - 1), expected) << bits << " bits, " << words;
+                ASSERT_EQ(dst.back(), -7.0F);
+
+                std::vector<uint32_t> be = body;
+                if (vrt_is_platform_little_endian()) {
+                    vrt_byte_swap(be.data(), be.data(), words);
+                }
+                std::fill(dst.begin(), dst.end(), -7.0F);
+                ASSERT_EQ(vrt_convert_to_float_be(&c_, be.data(), words, dst.data(), dst.size()), expected.size());
+                ASSERT_EQ(std::vector<float>(dst.begin(), dst.end() - 1), expected) << bits << " bits, " << words;
+            }
+        }
+    }
+}
+
+TEST_P(ConvertTest, LinkEfficient12) {
+    f_.packing_method          = VRT_PM_LINK_EFFICIENT;
+    f_.real_or_complex         = VRT_ROC_REAL;
+    f_.item_packing_field_size = 11;
+    f_.data_item_size          = 11;
+    ASSERT_EQ(vrt_init_converter(&c_, &f_, 1.0F), 0);
+    std::vector<uint32_t> body{0x12345678, 0x9ABCDEF0};
+    std::vector<float>    dst(5);
+    ASSERT_EQ(vrt_convert_to_float(&c_, body.data(), body.size(), dst.data(), dst.size()), 5);
+    ASSERT_EQ(dst, (std::vector<float>{0x123, 0x456, 0x789, 0xABC - 4096, 0xDEF - 4096}));
+    /* The trailing 4 bits are padding */
+    ASSERT_EQ(vrt_convert_to_float(&c_, body.data(), body.size(), dst.data(), 4), VRT_ERR_BUFFER_SIZE);
+}
+
+TEST_P(ConvertTest, Tags) {
+    f_.real_or_complex         = VRT_ROC_REAL;
+    f_.item_packing_field_size = 15;
+    f_.data_item_size          = 9;
+    f_.event_tag_size          = 2;
+    f_.channel_tag_size        = 4;
+    ASSERT_EQ(vrt_init_converter(&c_, &f_, 1.0F), 0);
+    /* Item 0x201, event tag 0x2, channel tag 0x5, and item 0x0FF, event tag 0x1, channel tag 0xA */
+    std::vector<uint32_t> body{0x80653FDA};
+    std::vector<int64_t>  items(2);
+    std::vector<uint8_t>  event_tags(2);
+    std::vector<uint16_t> channel_tags(2);
+    ASSERT_EQ(vrt_unpack_items(&c_, body.data(), body.size(), items.data(), event_tags.data(), channel_tags.data(), 1),
+              VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_unpack_items(&c_, body.data(), body.size(), items.data(), event_tags.data(), channel_tags.data(), 2),
+              2);
+    ASSERT_EQ(items, (std::vector<int64_t>{0x201 - 1024, 0x0FF}));
+    ASSERT_EQ(event_tags, (std::vector<uint8_t>{0x2, 0x1}));
+    ASSERT_EQ(channel_tags, (std::vector<uint16_t>{0x5, 0xA}));
+    ASSERT_EQ(vrt_unpack_items(&c_, body.data(), body.size(), items.data(), nullptr, nullptr, 2), 2);
+}
+
+TEST_P(ConvertTest, ProcessingEfficient40) {
+    f_.real_or_complex         = VRT_ROC_REAL;
+    f_.data_item_format        = VRT_DIF_UNSIGNED_FIXED_POINT;
+    f_.item_packing_field_size = 39;
+    f_.data_item_size          = 39;
+    ASSERT_EQ(vrt_init_converter(&c_, &f_, 1.0F), 0);
+    /* One item per 64-bit container, where the last 24 bits are unused */
+    std::vector<uint32_t> body{0x12345678, 0x9AFFFFFF, 0xFEDCBA98, 0x76FFFFFF, 0x00000000};
+    std::vector<int64_t>  items(2);
+    ASSERT_EQ(vrt_unpack_items(&c_, body.data(), body.size(), items.data(), nullptr, nullptr, items.size()), 2);
+    ASSERT_EQ(items, (std::vector<int64_t>{0x123456789A, 0xFEDCBA9876}));
+}
+
+TEST_P(ConvertTest, AllWidths) {
+    std::mt19937 rng(2);
+    for (vrt_packing_method pm : {VRT_PM_PROCESSING_EFFICIENT, VRT_PM_LINK_EFFICIENT}) {
+        for (int32_t bits = 1; bits <= 64; ++bits) {
+            for (vrt_data_item_format dif : {VRT_DIF_SIGNED_FIXED_POINT, VRT_DIF_UNSIGNED_FIXED_POINT}) {
+                for (bool tags : {false, true}) {
+                    const int32_t event_tag_size   = tags ? std::min(bits - 1, 3) : 0;
+                    const int32_t channel_tag_size = tags ? std::min(bits - 1 - event_tag_size, 5) : 0;
+                    const int32_t item_size        = bits - event_tag_size - channel_tag_size - (tags ? rng() % 2 : 0);
+                    if (item_size < 1) {
+                        continue;
+                    }
+                    f_.packing_method          = pm;
+                    f_.data_item_format        = dif;
+                    f_.item_packing_field_size = bits - 1;
+                    f_.data_item_size          = item_size - 1;
+                    f_.event_tag_size          = event_tag_size;
+                    f_.channel_tag_size        = channel_tag_size;
+                    const float scale          = 0.5F;
+                    ASSERT_EQ(vrt_init_converter(&c_, &f_, scale), 0);
+
+                    /* Lengths that exercise both vector loops and scalar tails */
+                    for (int32_t words = 0; words < 40; ++words) {
+                        std::vector<uint32_t> body(words);
+                        for (uint32_t& w : body) {
+                            w = static_cast<uint32_t>(rng());
+                        }
+                        const std::vector<uint64_t> fields =
+                            reference_fields(body, bits, pm == VRT_PM_LINK_EFFICIENT);
+
+                        std::vector<int64_t>  expected_items;
+                        std::vector<uint8_t>  expected_event_tags;
+                        std::vector<uint16_t> expected_channel_tags;
+                        std::vector<float>    expected_floats;
+                        for (uint64_t f : fields) {
+                            const uint64_t u = f >> (bits - item_size);
+                            int64_t        v = static_cast<int64_t>(u);
+                            if (dif == VRT_DIF_SIGNED_FIXED_POINT && item_size < 64 && (u >> (item_size - 1)) != 0) {
+                                v = static_cast<int64_t>(u - (uint64_t{1} << item_size));
+                            }
+                            expected_items.push_back(v);
+                            expected_event_tags.push_back((f >> channel_tag_size) & ((1U << event_tag_size) - 1));
+                            expected_channel_tags.push_back(f & ((1U << channel_tag_size) - 1));
+                            expected_floats.push_back(
+                                (dif == VRT_DIF_SIGNED_FIXED_POINT ? static_cast<float>(v) : static_cast<float>(u)) *
+                                scale);
+                        }
+                        const int32_t n = static_cast<int32_t>(fields.size());
+
+                        std::vector<int64_t>  items(n);
+                        std::vector<uint8_t>  event_tags(n);
+                        std::vector<uint16_t> channel_tags(n);
+                        std::vector<float>    dst(n + 1, -7.0F);
+                        ASSERT_EQ(vrt_unpack_items(&c_, body.data(), words, items.data(), event_tags.data(),
+                                                   channel_tags.data(), n),
+                                  n);
+                        ASSERT_EQ(items, expected_items) << bits << " bits, " << words;
+                        ASSERT_EQ(event_tags, expected_event_tags) << bits << " bits, " << words;
+                        ASSERT_EQ(channel_tags, expected_channel_tags) << bits << " bits, " << words;
+                        ASSERT_EQ(vrt_convert_to_float(&c_, body.data(), words, dst.data(), dst.size()), n);
+                        ASSERT_EQ(std::vector<float>(dst.begin(), dst.end() - 1), expected_floats)
+                            << bits << " bits, " << words;
+                        ASSERT_EQ(dst.back(), -7.0F);
+
+                        std::vector<uint32_t> be = body;
+                        if (vrt_is_platform_little_endian()) {
+                            vrt_byte_swap(be.data(), be.data(), words);
+                        }
+                        std::fill(items.begin(), items.end(), 0);
+                        ASSERT_EQ(vrt_unpack_items_be(&c_, be.data(), words, items.data(), nullptr, nullptr, n), n);
+                        ASSERT_EQ(items, expected_items) << bits << " bits, " << words;
+                        std::fill(dst.begin(), dst.end(), -7.0F);
+                        ASSERT_EQ(vrt_convert_to_float_be(&c_, be.data(), words, dst.data(), dst.size()), n);
+                        ASSERT_EQ(std::vector<float>(dst.begin(), dst.end() - 1), expected_floats)
+                            << bits << " bits, " << words;
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_P(ConvertTest, FromFloatInt16) {
+    ASSERT_EQ(vrt_init_converter(&c_, &f_, 1.0F), 0);
+    /* Ties are rounded to even, and out of range and NaN are saturated */
+    std::vector<float> src{32767.5F, -32768.5F, 2.5F, 3.5F, std::numeric_limits<float>::quiet_NaN(), 1e9F, -1.0F};
+    std::vector<uint32_t> body(5, 0xFFFFFFFF);
+    ASSERT_EQ(vrt_convert_from_float(&c_, src.data(), src.size(), body.data(), 3), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_convert_from_float(&c_, src.data(), src.size(), body.data(), 4), 4);
+    ASSERT_EQ(body, (std::vector<uint32_t>{0x7FFF8000, 0x00020004, 0x80007FFF, 0xFFFF0000, 0xFFFFFFFF}));
+    ASSERT_EQ(vrt_convert_from_float(&c_, src.data(), 0, body.data(), 0), 0);
+
+    ASSERT_EQ(vrt_convert_from_float_be(&c_, src.data(), 2, body.data(), 1), 1);
+    ASSERT_EQ(body[0], vrt_is_platform_little_endian() ? 0x0080FF7F : 0x7FFF8000);
+}
+
+TEST_P(ConvertTest, PackItems) {
+    f_.real_or_complex         = VRT_ROC_REAL;
+    f_.packing_method          = VRT_PM_LINK_EFFICIENT;
+    f_.item_packing_field_size = 15;
+    f_.data_item_size          = 9;
+    f_.event_tag_size          = 2;
+    f_.channel_tag_size        = 4;
+    ASSERT_EQ(vrt_init_converter(&c_, &f_, 1.0F), 0);
+    /* Items are saturated, and tags truncated */
+    std::vector<int64_t>  items{-512, 0x0FF, 1000};
+    std::vector<uint8_t>  event_tags{0x2, 0x5, 0x0};
+    std::vector<uint16_t> channel_tags{0x5, 0xA, 0x1F};
+    std::vector<uint32_t> body(2, 0xFFFFFFFF);
+    ASSERT_EQ(vrt_pack_items(&c_, items.data(), event_tags.data(), channel_tags.data(), 3, body.data(), 1),
+              VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_pack_items(&c_, items.data(), event_tags.data(), channel_tags.data(), 3, body.data(), 2), 2);
+    ASSERT_EQ(body, (std::vector<uint32_t>{0x80253FDA, 0x7FCF0000}));
+    ASSERT_EQ(vrt_pack_items(&c_, items.data(), nullptr, nullptr, 3, body.data(), 2), 2);
+    ASSERT_EQ(body, (std::vector<uint32_t>{0x80003FC0, 0x7FC00000}));
+}
+
+TEST_P(ConvertTest, PackAllWidths) {
+    std::mt19937    rng(3);
+    std::mt19937_64 rng64(4);
+    for (vrt_packing_method pm : {VRT_PM_PROCESSING_EFFICIENT, VRT_PM_LINK_EFFICIENT}) {
+        for (int32_t bits = 1; bits <= 64; ++bits) {
+            for (vrt_data_item_format dif : {VRT_DIF_SIGNED_FIXED_POINT, VRT_DIF_UNSIGNED_FIXED_POINT}) {
+                for (bool tags : {false, true}) {
+                    const bool    is_signed        = dif == VRT_DIF_SIGNED_FIXED_POINT;
+                    const int32_t event_tag_size   = tags ? std::min(bits - 1, 3) : 0;
+                    const int32_t channel_tag_size = tags ? std::min(bits - 1 - event_tag_size, 5) : 0;
+                    const int32_t item_size        = bits - event_tag_size - channel_tag_size - (tags ? rng() % 2 : 0);
+                    if (item_size < 1) {
+                        continue;
+                    }
+                    f_.packing_method          = pm;
+                    f_.data_item_format        = dif;
+                    f_.item_packing_field_size = bits - 1;
+                    f_.data_item_size          = item_size - 1;
+                    f_.event_tag_size          = event_tag_size;
+                    f_.channel_tag_size        = channel_tag_size;
+                    ASSERT_EQ(vrt_init_converter(&c_, &f_, 0.25F), 0);
+
+                    /* Item range, as double */
+                    const double                           top = std::ldexp(1.0, is_signed ? item_size - 1 : item_size);
+                    const double                           lo  = is_signed ? -top : 0.0;
+                    std::uniform_real_distribution<double> range(lo - top / 4, top + top / 4);
+
+                    /* Lengths that exercise both vector loops and scalar tails */
+                    for (int32_t n = 0; n < 70; ++n) {
+                        std::vector<float>    src(n);
+                        std::vector<int64_t>  items(n);
+                        std::vector<uint8_t>  event_tags(n);
+                        std::vector<uint16_t> channel_tags(n);
+                        std::vector<uint64_t> float_fields;
+                        std::vector<uint64_t> item_fields;
+                        for (int32_t i = 0; i < n; ++i) {
+                            switch (rng() % 8) {
+                                case 0:
+                                    src[i] = std::numeric_limits<float>::quiet_NaN();
+                                    break;
+                                case 1:
+                                    /* Tie */
+                                    src[i] = (static_cast<float>(rng() % 64) - 32.0F + 0.5F) * 0.25F;
+                                    break;
+                                default:
+                                    src[i] = static_cast<float>(range(rng)) * 0.25F;
+                                    break;
+                            }
+                            /* Random magnitudes, to exercise saturation */
+                            items[i]        = static_cast<int64_t>(rng64()) >> (rng() % 64);
+                            event_tags[i]   = static_cast<uint8_t>(rng());
+                            channel_tags[i] = static_cast<uint16_t>(rng());
+
+                            const uint64_t mask = item_size == 64 ? ~uint64_t{0} : (uint64_t{1} << item_size) - 1;
+                            const double   r    = std::nearbyint(static_cast<double>(src[i] * 4.0F));
+                            uint64_t       u;
+                            if (!(r >= lo)) {
+                                u = is_signed ? mask / 2 + 1 : 0;
+                            } else if (r >= top) {
+                                u = is_signed ? mask / 2 : mask;
+                            } else {
+                                u = is_signed ? static_cast<uint64_t>(static_cast<int64_t>(r))
+                                              : static_cast<uint64_t>(r);
+                            }
+                            float_fields.push_back((u & mask) << (bits - item_size));
+
+                            int64_t v = items[i];
+                            if (item_size < 64) {
+                                const int64_t vlo = is_signed ? -(int64_t{1} << (item_size - 1)) : 0;
+                                const int64_t vhi = is_signed ? (int64_t{1} << (item_size - 1)) - 1
+                                                              : static_cast<int64_t>(mask);
+                                v                 = std::clamp(v, vlo, vhi);
+                            }
+                            item_fields.push_back(
+                                ((static_cast<uint64_t>(v) & mask) << (bits - item_size)) |
+                                ((event_tags[i] & ((1U << event_tag_size) - 1)) << channel_tag_size) |
+                                (channel_tags[i] & ((1U << channel_tag_size) - 1)));
+                        }
+                        const std::vector<uint32_t> expected_floats =
+                            reference_words(float_fields, bits, pm == VRT_PM_LINK_EFFICIENT);
+                        const std::vector<uint32_t> expected_items =
+                            reference_words(item_fields, bits, pm == VRT_PM_LINK_EFFICIENT);
+                        const int32_t words = static_cast<int32_t>(expected_floats.size());
+
+                        std::vector<uint32_t> body(words + 1, 0xDEADBEEF);
+                        ASSERT_EQ(vrt_convert_from_float(&c_, src.data(), n, body.data(), words), words);
+                        ASSERT_EQ(std::vector<uint32_t>(body.begin(), body.end() - 1), expected_floats)
+                            << bits << " bits, " << n;
+                        ASSERT_EQ(body.back(), 0xDEADBEEF);
+                        ASSERT_EQ(vrt_convert_from_float_be(&c_, src.data(), n, body.data(), words), words);
+                        if (vrt_is_platform_little_endian()) {
+                            vrt_byte_swap(body.data(), body.data(), words);
+                        }
+                        ASSERT_EQ(std::vector<uint32_t>(body.begin(), body.end() - 1), expected_floats)
+                            << bits << " bits, " << n;
+
+                        ASSERT_EQ(vrt_pack_items(&c_, items.data(), event_tags.data(), channel_tags.data(), n,
+                                                 body.data(), words),
+                                  words);
+                        ASSERT_EQ(std::vector<uint32_t>(body.begin(), body.end() - 1), expected_items)
+                            << bits << " bits, " << n;
+                        ASSERT_EQ(vrt_pack_items_be(&c_, items.data(), event_tags.data(), channel_tags.data(), n,
+                                                    body.data(), words),
+                                  words);
+                        if (vrt_is_platform_little_endian()) {
+                            vrt_byte_swap(body.data(), body.data(), words);
+                        }
+                        ASSERT_EQ(std::vector<uint32_t>(body.begin(), body.end() - 1), expected_items)
+                            << bits << " bits, " << n;
+                    }
+                }
+            }
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(CpuLevels, ConvertTest, kCpuLevels, cpu_level_name);
@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <vrt/vrt_demux.h>
+#include <vrt/vrt_error_code.h>
+#include <vrt/vrt_types.h>
+
+/**
+ * Records stream IDs of packets passed to a callback.
+ */
+struct Recorder {
+    std::vector<uint32_t> stream_ids;
+};
+
+static void record(const vrt_packet_descriptor* descriptor, void* user) {
+    static_cast<Recorder*>(user)->stream_ids.push_back(descriptor->fields.stream_id);
+}
+
+class DemuxTest : public ::testing::Test {
+   protected:
+    void SetUp() override { ASSERT_EQ(vrt_init_demux(&demux_, entries_.data(), entries_.size(), record, &other_), 0); }
+
+    /**
+     * Append packet descriptor with stream ID.
+     */
+    void append(uint32_t stream_id) {
+        vrt_packet_descriptor d{};
+        d.header.packet_type = VRT_PT_IF_DATA_WITH_STREAM_ID;
+        d.fields.stream_id   = stream_id;
+        descs_.push_back(d);
+    }
+
+    std::array<vrt_demux_entry, 16>    entries_{};
+    vrt_demux                          demux_{};
+    std::vector<vrt_packet_descriptor> descs_;
+    Recorder                           other_;
+};
+
+TEST_F(DemuxTest, InvalidCapacity) {
+    ASSERT_EQ(vrt_init_demux(&demux_, entries_.data(), 0, nullptr, nullptr), VRT_ERR_INVALID_CAPACITY);
+    ASSERT_EQ(vrt_init_demux(&demux_, entries_.data(), -4, nullptr, nullptr), VRT_ERR_INVALID_CAPACITY);
+    ASSERT_EQ(vrt_init_demux(&demux_, entries_.data(), 12, nullptr, nullptr), VRT_ERR_INVALID_CAPACITY);
+}
+
+TEST_F(DemuxTest, Empty) {
+    append(1);
+    ASSERT_EQ(vrt_demux_dispatch(&demux_, descs_.data(), descs_.size()), 0);
+    ASSERT_EQ(other_.stream_ids, std::vector<uint32_t>{1});
+    ASSERT_EQ(vrt_demux_find(&demux_, 1), nullptr);
+}
+
+TEST_F(DemuxTest, Interleaved) {
+    Recorder a;
+    Recorder b;
+    ASSERT_EQ(vrt_demux_add(&demux_, 0xA, record, &a), 0);
+    ASSERT_EQ(vrt_demux_add(&demux_, 0xB, record, &b), 0);
+    for (uint32_t id : {0xA, 0xA, 0xB, 0xC, 0xA, 0xB, 0xB}) {
+        append(id);
+    }
+    ASSERT_EQ(vrt_demux_dispatch(&demux_, descs_.data(), descs_.size()), 6);
+    ASSERT_EQ(a.stream_ids, std::vector<uint32_t>(3, 0xA));
+    ASSERT_EQ(b.stream_ids, std::vector<uint32_t>(3, 0xB));
+    ASSERT_EQ(other_.stream_ids, std::vector<uint32_t>{0xC});
+}
+
+TEST_F(DemuxTest, WithoutStreamId) {
+    Recorder a;
+    ASSERT_EQ(vrt_demux_add(&demux_, 0, record, &a), 0);
+    vrt_packet_descriptor d{};
+    d.header.packet_type = VRT_PT_IF_DATA_WITHOUT_STREAM_ID;
+    descs_.push_back(d);
+    ASSERT_EQ(vrt_demux_dispatch(&demux_, descs_.data(), descs_.size()), 0);
+    ASSERT_TRUE(a.stream_ids.empty());
+    ASSERT_EQ(other_.stream_ids.size(), 1);
+}
+
+TEST_F(DemuxTest, NoFallback) {
+    ASSERT_EQ(vrt_init_demux(&demux_, entries_.data(), entries_.size(), nullptr, nullptr), 0);
+    append(1);
+    ASSERT_EQ(vrt_demux_dispatch(&demux_, descs_.data(), descs_.size()), 0);
+}
+
+TEST_F(DemuxTest, Replace) {
+    Recorder a;
+    Recorder b;
+    ASSERT_EQ(vrt_demux_add(&demux_, 0xA, record, &a), 0);
+    ASSERT_EQ(vrt_demux_add(&demux_, 0xA, record, &b), 0);
+    ASSERT_EQ(demux_.size, 1);
+    append(0xA);
+    ASSERT_EQ(vrt_demux_dispatch(&demux_, descs_.data(), descs_.size()), 1);
+    ASSERT_TRUE(a.stream_ids.empty());
+    ASSERT_EQ(b.stream_ids.size(), 1);
+}
+
+TEST_F(DemuxTest, Full) {
+    Recorder a;
+    for (uint32_t i = 0; i < 12; ++i) {
+        ASSERT_EQ(vrt_demux_add(&demux_, i, record, &a), 0);
+    }
+    ASSERT_EQ(vrt_demux_add(&demux_, 12, record, &a), VRT_ERR_STREAMS_FULL);
+    ASSERT_EQ(vrt_demux_add(&demux_, 11, record, &a), 0);
+}
+
+TEST_F(DemuxTest, Remove) {
+    /* Many streams, so probe sequences overlap and entries are shifted on removal */
+    std::array<Recorder, 12> r;
+    for (uint32_t i = 0; i < r.size(); ++i) {
+        ASSERT_EQ(vrt_demux_add(&demux_, i << 4U, record, &r[i]), 0);
+    }
+    for (uint32_t i = 0; i < r.size(); i += 2) {
+        ASSERT_TRUE(vrt_demux_remove(&demux_, i << 4U));
+    }
+    ASSERT_FALSE(vrt_demux_remove(&demux_, 0));
+    ASSERT_EQ(demux_.size, 6);
+    for (uint32_t i = 0; i < r.size(); ++i) {
+        vrt_demux_entry* e = vrt_demux_find(&demux_, i << 4U);
+        if (i % 2 == 0) {
+            ASSERT_EQ(e, nullptr);
+        } else {
+            ASSERT_NE(e, nullptr);
+            ASSERT_EQ(e->user, &r[i]);
+        }
+    }
+}
+
+TEST_F(DemuxTest, LastAcrossCalls) {
+    Recorder a;
+    ASSERT_EQ(vrt_demux_add(&demux_, 0xA, record, &a), 0);
+    append(0xA);
+    ASSERT_EQ(vrt_demux_dispatch(&demux_, descs_.data(), descs_.size()), 1);
+    ASSERT_EQ(demux_.last, vrt_demux_find(&demux_, 0xA));
+    ASSERT_TRUE(vrt_demux_remove(&demux_, 0xA));
+    ASSERT_EQ(demux_.last, nullptr);
+    ASSERT_EQ(vrt_demux_dispatch(&demux_, descs_.data(), descs_.size()), 0);
+    ASSERT_EQ(a.stream_ids.size(), 1);
+    ASSERT_EQ(other_.stream_ids.size(), 1);
+}
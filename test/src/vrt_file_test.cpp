@@ -0,0 +1,182 @@
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <vrt/vrt_byte_swap.h>
+#include <vrt/vrt_error_code.h>
+#include <vrt/vrt_file.h>
+#include <vrt/vrt_init.h>
+#include <vrt/vrt_types.h>
+#include <vrt/vrt_util.h>
+#include <vrt/vrt_write.h>
+
+class FileTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        std::array<char, 32> path{"/tmp/vrt_file_test_XXXXXX"};
+        int                  fd = mkstemp(path.data());
+        ASSERT_GE(fd, 0);
+        close(fd);
+        path_ = path.data();
+    }
+
+    void TearDown() override {
+        vrt_close_file_reader(&reader_);
+        std::remove(path_.c_str());
+    }
+
+    /**
+     * Append data packet with a body of a given size, where every body word is the packet index.
+     */
+    void append(uint32_t words_body) {
+        vrt_packet p;
+        vrt_init_packet(&p);
+        const auto            index = static_cast<uint32_t>(bodies_.size());
+        std::vector<uint32_t> body(words_body, index);
+        p.header.packet_type  = VRT_PT_IF_DATA_WITH_STREAM_ID;
+        p.header.packet_count = index % 16;
+        p.fields.stream_id    = index;
+        p.body                = body.data();
+        p.words_body          = static_cast<int32_t>(words_body);
+        std::vector<uint32_t> buf(2 + words_body);
+        ASSERT_EQ(vrt_write_packet(&p, buf.data(), buf.size(), VRT_VALIDATION_FULL), buf.size());
+        words_.insert(words_.end(), buf.begin(), buf.end());
+        bodies_.push_back(words_body);
+    }
+
+    /**
+     * Write appended packets to file, optionally leaving out some trailing bytes.
+     */
+    void flush(std::size_t bytes_cut = 0) {
+        std::FILE* fp = std::fopen(path_.c_str(), "wb");
+        ASSERT_NE(fp, nullptr);
+        const std::size_t bytes = words_.size() * sizeof(uint32_t) - bytes_cut;
+        if (bytes > 0) {
+            ASSERT_EQ(std::fwrite(words_.data(), bytes, 1, fp), 1);
+        }
+        std::fclose(fp);
+    }
+
+    /**
+     * Read all packets in file, n at a time, and check them against the appended ones.
+     */
+    void assert_read_all(int32_t n, bool be) {
+        std::vector<vrt_packet_descriptor> descs(n);
+        std::size_t                        index = 0;
+        for (;;) {
+            const uint64_t offset = reader_.offset;
+            int32_t        rv     = be ? vrt_read_file_packets_be(&reader_, descs.data(), n, VRT_VALIDATION_FULL)
+                                       : vrt_read_file_packets(&reader_, descs.data(), n, VRT_VALIDATION_FULL);
+            ASSERT_GE(rv, 0);
+            if (rv == 0) {
+                break;
+            }
+            for (int32_t i = 0; i < rv; ++i, ++index) {
+                const vrt_packet_descriptor& d = descs[i];
+                ASSERT_LT(index, bodies_.size());
+                ASSERT_EQ(d.fields.stream_id, index);
+                ASSERT_EQ(d.words_body, bodies_[index]);
+                const auto* body = static_cast<const uint32_t*>(d.body);
+                for (int32_t j = 0; j < d.words_body; ++j) {
+                    /* Body words are left in file byte order */
+                    uint32_t w = body[j];
+                    if (be && vrt_is_platform_little_endian()) {
+                        vrt_byte_swap(&w, &w, 1);
+                    }
+                    ASSERT_EQ(w, index);
+                }
+                /* Descriptor offset is relative to the reader offset before the call */
+                ASSERT_LT(offset + d.offset * sizeof(uint32_t), reader_.size);
+            }
+        }
+        ASSERT_EQ(index, bodies_.size());
+        ASSERT_EQ(reader_.offset, reader_.size);
+    }
+
+    std::string           path_;
+    vrt_file_reader       reader_{-1, 0, 0, nullptr, 0, 0, 0};
+    std::vector<uint32_t> words_;
+    std::vector<uint32_t> bodies_;
+};
+
+TEST_F(FileTest, Missing) {
+    ASSERT_EQ(vrt_open_file_reader(&reader_, "/nonexistent/recording.vrt", 0), VRT_ERR_FILE);
+    ASSERT_EQ(reader_.fd, -1);
+}
+
+TEST_F(FileTest, Empty) {
+    flush();
+    ASSERT_EQ(vrt_open_file_reader(&reader_, path_.c_str(), 0), 0);
+    vrt_packet_descriptor d;
+    ASSERT_EQ(vrt_read_file_packets(&reader_, &d, 1, VRT_VALIDATION_FULL), 0);
+}
+
+TEST_F(FileTest, WholeFile) {
+    for (uint32_t i = 0; i < 100; ++i) {
+        append(i * 7 % 50);
+    }
+    flush();
+    ASSERT_EQ(vrt_open_file_reader(&reader_, path_.c_str(), 0), 0);
+    assert_read_all(16, false);
+}
+
+TEST_F(FileTest, SlidingWindow) {
+    /* Several minimum size windows, with packets crossing window boundaries */
+    for (uint32_t i = 0; i < 1000; ++i) {
+        append(1000 + i * 37 % 3000);
+    }
+    flush();
+    ASSERT_EQ(vrt_open_file_reader(&reader_, path_.c_str(), 1), 0);
+    ASSERT_LT(reader_.window, reader_.size / 4);
+    assert_read_all(7, false);
+}
+
+TEST_F(FileTest, MaxSizePackets) {
+    for (uint32_t i = 0; i < 5; ++i) {
+        append(0xFFFF - 2);
+    }
+    flush();
+    ASSERT_EQ(vrt_open_file_reader(&reader_, path_.c_str(), 1), 0);
+    assert_read_all(1, false);
+}
+
+TEST_F(FileTest, BigEndian) {
+    for (uint32_t i = 0; i < 100; ++i) {
+        append(i);
+    }
+    if (vrt_is_platform_little_endian()) {
+        vrt_byte_swap(words_.data(), words_.data(), static_cast<int32_t>(words_.size()));
+    }
+    flush();
+    ASSERT_EQ(vrt_open_file_reader(&reader_, path_.c_str(), 1), 0);
+    assert_read_all(3, true);
+}
+
+TEST_F(FileTest, CutOff) {
+    append(10);
+    append(10);
+    flush(3);
+    ASSERT_EQ(vrt_open_file_reader(&reader_, path_.c_str(), 0), 0);
+    std::array<vrt_packet_descriptor, 4> descs{};
+    ASSERT_EQ(vrt_read_file_packets(&reader_, descs.data(), descs.size(), VRT_VALIDATION_FULL), 1);
+    ASSERT_EQ(vrt_read_file_packets(&reader_, descs.data(), descs.size(), VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(reader_.offset, 12 * sizeof(uint32_t));
+}
+
+TEST_F(FileTest, Error) {
+    append(10);
+    append(10);
+    words_[12] |= 0x02000000;
+    flush();
+    ASSERT_EQ(vrt_open_file_reader(&reader_, path_.c_str(), 0), 0);
+    std::array<vrt_packet_descriptor, 4> descs{};
+    ASSERT_EQ(vrt_read_file_packets(&reader_, descs.data(), descs.size(), VRT_VALIDATION_FULL), VRT_ERR_RESERVED);
+    ASSERT_EQ(descs[0].fields.stream_id, 0);
+    ASSERT_EQ(reader_.offset, 12 * sizeof(uint32_t));
+}
@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+
+#include <vrt/vrt_byte_swap.h>
+#include <vrt/vrt_error_code.h>
+#include <vrt/vrt_if_context_view.h>
+#include <vrt/vrt_init.h>
+#include <vrt/vrt_read.h>
+#include <vrt/vrt_types.h>
+#include <vrt/vrt_util.h>
+#include <vrt/vrt_write.h>
+
+class IfContextViewTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        vrt_init_if_context(&c_);
+        buf_.fill(0xBAADF00D);
+    }
+
+    /**
+     * Write IF context with a mix of fields to buffer.
+     *
+     * \return Number of written words.
+     */
+    int32_t write_if_context() {
+        c_.has.reference_point_identifier     = true;
+        c_.has.rf_reference_frequency         = true;
+        c_.has.reference_level                = true;
+        c_.has.gain                           = true;
+        c_.has.sample_rate                    = true;
+        c_.has.timestamp_adjustment           = true;
+        c_.has.temperature                    = true;
+        c_.has.device_identifier              = true;
+        c_.has.formatted_gps_geolocation      = true;
+        c_.has.ephemeris_reference_identifier = true;
+        c_.has.gps_ascii                      = true;
+        c_.has.context_association_lists      = true;
+
+        c_.reference_point_identifier     = 0x12345678;
+        c_.rf_reference_frequency         = 2.4e9;
+        c_.reference_level                = -12.5F;
+        c_.gain.stage1                    = 3.5F;
+        c_.gain.stage2                    = -1.25F;
+        c_.sample_rate                    = 44100.0;
+        c_.timestamp_adjustment           = 0xABCDEF0123456789;
+        c_.temperature                    = 36.5F;
+        c_.device_identifier.oui          = 0x00123456;
+        c_.device_identifier.device_code  = 0xBEEF;
+        c_.ephemeris_reference_identifier = 0x87654321;
+        c_.gps_ascii.number_of_words      = 2;
+        c_.gps_ascii.ascii                = "ABCDEFGH";
+
+        c_.context_association_lists.source_list_size                = 2;
+        c_.context_association_lists.source_context_association_list = list_.data();
+
+        return vrt_write_if_context(&c_, buf_.data(), buf_.size(), VRT_VALIDATION_FULL);
+    }
+
+    vrt_if_context           c_{};
+    vrt_if_context_view      v_{};
+    std::array<uint32_t, 64> buf_{};
+    std::array<uint32_t, 2>  list_{0xAAAAAAAA, 0xBBBBBBBB};
+};
+
+TEST_F(IfContextViewTest, NegativeSizeBuffer) {
+    ASSERT_EQ(vrt_read_if_context_view(buf_.data(), -1, &v_, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+}
+
+TEST_F(IfContextViewTest, ZeroSizeBuffer) {
+    ASSERT_EQ(vrt_read_if_context_view(buf_.data(), 0, &v_, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+}
+
+TEST_F(IfContextViewTest, None) {
+    buf_[0] = 0x00000000;
+    ASSERT_EQ(vrt_read_if_context_view(buf_.data(), 1, &v_, VRT_VALIDATION_FULL), 1);
+    double sample_rate = 1.0;
+    ASSERT_FALSE(vrt_if_context_view_sample_rate(&v_, &sample_rate));
+    ASSERT_EQ(sample_rate, 1.0);
+}
+
+TEST_F(IfContextViewTest, Reserved) {
+    buf_[0] = 0x00000001;
+    ASSERT_EQ(vrt_read_if_context_view(buf_.data(), 1, &v_, VRT_VALIDATION_FULL), VRT_ERR_RESERVED);
+    ASSERT_EQ(vrt_read_if_context_view(buf_.data(), 1, &v_, VRT_VALIDATION_NONE), 1);
+}
+
+TEST_F(IfContextViewTest, FixedFieldsOutsideBuffer) {
+    buf_[0] = 0x00200000;
+    ASSERT_EQ(vrt_read_if_context_view(buf_.data(), 2, &v_, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_read_if_context_view(buf_.data(), 3, &v_, VRT_VALIDATION_FULL), 3);
+}
+
+TEST_F(IfContextViewTest, GpsAsciiOutsideBuffer) {
+    buf_[0] = 0x00000200;
+    buf_[1] = 0x00000000;
+    buf_[2] = 0x00000002;
+    ASSERT_EQ(vrt_read_if_context_view(buf_.data(), 4, &v_, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_read_if_context_view(buf_.data(), 5, &v_, VRT_VALIDATION_FULL), 5);
+}
+
+TEST_F(IfContextViewTest, AssociationListsOutsideBuffer) {
+    buf_[0] = 0x00000100;
+    buf_[1] = 0x00010001;
+    buf_[2] = 0x00018001;
+    ASSERT_EQ(vrt_read_if_context_view(buf_.data(), 7, &v_, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_read_if_context_view(buf_.data(), 8, &v_, VRT_VALIDATION_FULL), 8);
+}
+
+TEST_F(IfContextViewTest, SameAsRead) {
+    int32_t words = write_if_context();
+    ASSERT_GT(words, 0);
+    ASSERT_EQ(vrt_read_if_context_view(buf_.data(), words, &v_, VRT_VALIDATION_FULL), words);
+
+    vrt_if_context c{};
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), words, &c, VRT_VALIDATION_FULL), words);
+
+    uint32_t u32 = 0;
+    ASSERT_TRUE(vrt_if_context_view_reference_point_identifier(&v_, &u32));
+    ASSERT_EQ(u32, c.reference_point_identifier);
+    ASSERT_TRUE(vrt_if_context_view_ephemeris_reference_identifier(&v_, &u32));
+    ASSERT_EQ(u32, c.ephemeris_reference_identifier);
+    ASSERT_FALSE(vrt_if_context_view_over_range_count(&v_, &u32));
+    ASSERT_FALSE(vrt_if_context_view_timestamp_calibration_time(&v_, &u32));
+
+    double d = 0.0;
+    ASSERT_TRUE(vrt_if_context_view_rf_reference_frequency(&v_, &d));
+    ASSERT_EQ(d, c.rf_reference_frequency);
+    ASSERT_TRUE(vrt_if_context_view_sample_rate(&v_, &d));
+    ASSERT_EQ(d, c.sample_rate);
+    ASSERT_FALSE(vrt_if_context_view_bandwidth(&v_, &d));
+    ASSERT_FALSE(vrt_if_context_view_if_reference_frequency(&v_, &d));
+    ASSERT_FALSE(vrt_if_context_view_rf_reference_frequency_offset(&v_, &d));
+    ASSERT_FALSE(vrt_if_context_view_if_band_offset(&v_, &d));
+
+    float f = 0.0F;
+    ASSERT_TRUE(vrt_if_context_view_reference_level(&v_, &f));
+    ASSERT_EQ(f, c.reference_level);
+    ASSERT_TRUE(vrt_if_context_view_temperature(&v_, &f));
+    ASSERT_EQ(f, c.temperature);
+
+    vrt_gain g{};
+    ASSERT_TRUE(vrt_if_context_view_gain(&v_, &g));
+    ASSERT_EQ(g.stage1, c.gain.stage1);
+    ASSERT_EQ(g.stage2, c.gain.stage2);
+
+    uint64_t u64 = 0;
+    ASSERT_TRUE(vrt_if_context_view_timestamp_adjustment(&v_, &u64));
+    ASSERT_EQ(u64, c.timestamp_adjustment);
+
+    vrt_device_identifier di{};
+    ASSERT_TRUE(vrt_if_context_view_device_identifier(&v_, &di));
+    ASSERT_EQ(di.oui, c.device_identifier.oui);
+    ASSERT_EQ(di.device_code, c.device_identifier.device_code);
+}
+
+TEST_F(IfContextViewTest, NetworkByteOrder) {
+    int32_t words = write_if_context();
+    ASSERT_GT(words, 0);
+    if (vrt_is_platform_little_endian()) {
+        vrt_byte_swap(buf_.data(), buf_.data(), words);
+    }
+    ASSERT_EQ(vrt_read_if_context_view_be(buf_.data(), words, &v_, VRT_VALIDATION_FULL), words);
+
+    double sample_rate = 0.0;
+    ASSERT_TRUE(vrt_if_context_view_sample_rate(&v_, &sample_rate));
+    ASSERT_EQ(sample_rate, c_.sample_rate);
+    uint64_t timestamp_adjustment = 0;
+    ASSERT_TRUE(vrt_if_context_view_timestamp_adjustment(&v_, &timestamp_adjustment));
+    ASSERT_EQ(timestamp_adjustment, c_.timestamp_adjustment);
+}
@@ -0,0 +1,359 @@
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <vrt/vrt_byte_swap.h>
+#include <vrt/vrt_error_code.h>
+#include <vrt/vrt_file.h>
+#include <vrt/vrt_index.h>
+#include <vrt/vrt_init.h>
+#include <vrt/vrt_types.h>
+#include <vrt/vrt_util.h>
+#include <vrt/vrt_words.h>
+#include <vrt/vrt_write.h>
+
+class IndexTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        recording_path_ = temp_path();
+        index_path_     = temp_path();
+    }
+
+    void TearDown() override {
+        vrt_close_index(&index_);
+        std::remove(recording_path_.c_str());
+        std::remove(index_path_.c_str());
+    }
+
+    static std::string temp_path() {
+        std::array<char, 32> path{"/tmp/vrt_index_test_XXXXXX"};
+        int                  fd = mkstemp(path.data());
+        EXPECT_GE(fd, 0);
+        close(fd);
+        return path.data();
+    }
+
+    /**
+     * Append packet to recording. Stream ID 0 means a data packet without stream ID.
+     */
+    void append(uint32_t stream_id,
+                uint32_t integer_seconds_timestamp,
+                uint64_t fractional_seconds_timestamp,
+                vrt_tsi  tsi = VRT_TSI_UTC,
+                vrt_tsf  tsf = VRT_TSF_SAMPLE_COUNT) {
+        vrt_packet p;
+        vrt_init_packet(&p);
+        std::array<uint32_t, 3> body{1, 2, 3};
+        p.header.packet_type = stream_id != 0 ? VRT_PT_IF_DATA_WITH_STREAM_ID : VRT_PT_IF_DATA_WITHOUT_STREAM_ID;
+        p.header.packet_count                 = static_cast<uint8_t>(packets_.size() % 16);
+        p.header.tsi                          = tsi;
+        p.header.tsf                          = tsf;
+        p.fields.stream_id                    = stream_id;
+        p.fields.integer_seconds_timestamp    = integer_seconds_timestamp;
+        p.fields.fractional_seconds_timestamp = fractional_seconds_timestamp;
+        p.body                                = body.data();
+        p.words_body                          = body.size();
+        std::array<uint32_t, 16> buf{};
+        int32_t                  words = vrt_write_packet(&p, buf.data(), buf.size(), VRT_VALIDATION_FULL);
+        ASSERT_GT(words, 0);
+        offsets_.push_back(words_.size() * sizeof(uint32_t));
+        words_.insert(words_.end(), buf.begin(), buf.begin() + words);
+        packets_.push_back(p);
+    }
+
+    void flush() {
+        std::FILE* fp = std::fopen(recording_path_.c_str(), "wb");
+        ASSERT_NE(fp, nullptr);
+        if (!words_.empty()) {
+            ASSERT_EQ(std::fwrite(words_.data(), words_.size() * sizeof(uint32_t), 1, fp), 1);
+        }
+        std::fclose(fp);
+    }
+
+    /**
+     * Append packets from three interleaved streams, and some without stream ID.
+     */
+    void append_mix() {
+        for (uint32_t i = 0; i < 300; ++i) {
+            uint32_t id = i % 5 == 4 ? 0 : 0xC0 - i % 3;
+            append(id, 1000 + i, i * 10);
+        }
+    }
+
+    /**
+     * Build index of a recording where stream 0xA has 100 packets with strictly increasing times, interleaved with
+     * another stream. Then check that seeking to the time of each packet, or just after it, finds the right one.
+     */
+    template <typename F>
+    void assert_seek(vrt_tsi tsi, vrt_tsf tsf, double sample_rate, F timestamps) {
+        constexpr uint64_t    kN = 100;
+        std::vector<vrt_time> times;
+        for (uint64_t k = 0; k < kN; ++k) {
+            uint32_t is = 0;
+            uint64_t fs = 0;
+            vrt_time t{};
+            timestamps(k, &is, &fs, &t);
+            append(0xA, is, fs, tsi, tsf);
+            append(0xB, 0, 0, VRT_TSI_NONE, VRT_TSF_NONE);
+            times.push_back(t);
+        }
+        flush();
+        ASSERT_EQ(vrt_build_index(recording_path_.c_str(), index_path_.c_str()), 0);
+        ASSERT_EQ(vrt_open_index(&index_, index_path_.c_str()), 0);
+
+        for (uint64_t capacity : {1, 7, 10, 1000}) {
+            std::vector<vrt_time_index_block> blocks(capacity);
+            vrt_time_index                    ti;
+            ASSERT_EQ(vrt_init_time_index(&ti, &index_, 0xA, sample_rate, blocks.data(), capacity), 0);
+            ASSERT_EQ(ti.n, kN);
+            ASSERT_LE(ti.n_blocks, capacity);
+            for (uint64_t k = 0; k < kN; ++k) {
+                uint64_t packet = kN + 1;
+                ASSERT_EQ(vrt_seek_time_index(&ti, &times[k], &packet), 0);
+                ASSERT_EQ(packet, k) << "capacity " << capacity;
+                ASSERT_EQ(index_.entries[ti.packets[packet].packet].stream_id, 0xA);
+
+                vrt_time after = times[k];
+                after.ps += 1;
+                ASSERT_EQ(vrt_seek_time_index(&ti, &after, &packet), 0);
+                ASSERT_EQ(packet, k + 1) << "capacity " << capacity;
+            }
+            vrt_time before{-1, 0};
+            uint64_t packet = kN + 1;
+            ASSERT_EQ(vrt_seek_time_index(&ti, &before, &packet), 0);
+            ASSERT_EQ(packet, 0);
+        }
+    }
+
+    std::string             recording_path_;
+    std::string             index_path_;
+    vrt_index               index_{};
+    std::vector<uint32_t>   words_;
+    std::vector<uint64_t>   offsets_;
+    std::vector<vrt_packet> packets_;
+};
+
+TEST_F(IndexTest, Empty) {
+    flush();
+    ASSERT_EQ(vrt_build_index(recording_path_.c_str(), index_path_.c_str()), 0);
+    ASSERT_EQ(vrt_open_index(&index_, index_path_.c_str()), 0);
+    ASSERT_EQ(index_.n, 0);
+    ASSERT_EQ(vrt_index_packet(&index_, 0), nullptr);
+    const vrt_index_stream_entry* s = nullptr;
+    ASSERT_EQ(vrt_index_stream(&index_, 1, &s), 0);
+    ASSERT_EQ(s, nullptr);
+}
+
+TEST_F(IndexTest, MissingRecording) {
+    ASSERT_EQ(vrt_build_index("/nonexistent/recording.vrt", index_path_.c_str()), VRT_ERR_FILE);
+}
+
+TEST_F(IndexTest, Packets) {
+    append_mix();
+    flush();
+    ASSERT_EQ(vrt_build_index(recording_path_.c_str(), index_path_.c_str()), 0);
+    ASSERT_EQ(vrt_open_index(&index_, index_path_.c_str()), 0);
+    ASSERT_EQ(index_.n, packets_.size());
+    for (uint64_t i = 0; i < packets_.size(); ++i) {
+        const vrt_index_entry* e = vrt_index_packet(&index_, i);
+        ASSERT_NE(e, nullptr);
+        const vrt_packet& p = packets_[i];
+        ASSERT_EQ(e->offset, offsets_[i]);
+        ASSERT_EQ(e->packet_type, p.header.packet_type);
+        ASSERT_EQ(e->packet_count, p.header.packet_count);
+        ASSERT_EQ(e->tsi, p.header.tsi);
+        ASSERT_EQ(e->tsf, p.header.tsf);
+        ASSERT_EQ(e->stream_id, p.fields.stream_id);
+        ASSERT_EQ(e->integer_seconds_timestamp, p.fields.integer_seconds_timestamp);
+        ASSERT_EQ(e->fractional_seconds_timestamp, p.fields.fractional_seconds_timestamp);
+        ASSERT_EQ(e->words, vrt_words_packet(&p));
+    }
+    ASSERT_EQ(vrt_index_packet(&index_, packets_.size()), nullptr);
+}
+
+TEST_F(IndexTest, Streams) {
+    append_mix();
+    flush();
+    ASSERT_EQ(vrt_build_index(recording_path_.c_str(), index_path_.c_str()), 0);
+    ASSERT_EQ(vrt_open_index(&index_, index_path_.c_str()), 0);
+    ASSERT_EQ(index_.n_streams, 240);
+    for (uint32_t id : {0xBE, 0xBF, 0xC0}) {
+        const vrt_index_stream_entry* s = nullptr;
+        uint64_t                      n = vrt_index_stream(&index_, id, &s);
+        ASSERT_EQ(n, 80);
+        uint64_t prev = 0;
+        for (uint64_t i = 0; i < n; ++i) {
+            ASSERT_EQ(s[i].stream_id, id);
+            ASSERT_EQ(packets_[s[i].packet].fields.stream_id, id);
+            if (i > 0) {
+                ASSERT_GT(s[i].packet, prev);
+            }
+            prev = s[i].packet;
+        }
+    }
+    const vrt_index_stream_entry* s = nullptr;
+    ASSERT_EQ(vrt_index_stream(&index_, 0, &s), 0);
+    ASSERT_EQ(s, nullptr);
+    ASSERT_EQ(vrt_index_stream(&index_, 0xBD, &s), 0);
+    ASSERT_EQ(vrt_index_stream(&index_, 0xC1, &s), 0);
+}
+
+TEST_F(IndexTest, SeekReader) {
+    append_mix();
+    flush();
+    ASSERT_EQ(vrt_build_index(recording_path_.c_str(), index_path_.c_str()), 0);
+    ASSERT_EQ(vrt_open_index(&index_, index_path_.c_str()), 0);
+
+    /* Jump to first packet of a stream */
+    const vrt_index_stream_entry* s = nullptr;
+    ASSERT_GT(vrt_index_stream(&index_, 0xBE, &s), 0);
+    vrt_file_reader reader;
+    ASSERT_EQ(vrt_open_file_reader(&reader, recording_path_.c_str(), 0), 0);
+    vrt_seek_file_reader(&reader, vrt_index_packet(&index_, s[0].packet)->offset);
+    vrt_packet_descriptor d;
+    ASSERT_EQ(vrt_read_file_packets(&reader, &d, 1, VRT_VALIDATION_FULL), 1);
+    ASSERT_EQ(d.fields.stream_id, 0xBE);
+    ASSERT_EQ(d.fields.integer_seconds_timestamp, 1002);
+    vrt_close_file_reader(&reader);
+}
+
+TEST_F(IndexTest, BigEndian) {
+    append_mix();
+    if (vrt_is_platform_little_endian()) {
+        vrt_byte_swap(words_.data(), words_.data(), static_cast<int32_t>(words_.size()));
+    }
+    flush();
+    ASSERT_EQ(vrt_build_index_be(recording_path_.c_str(), index_path_.c_str()), 0);
+    ASSERT_EQ(vrt_open_index(&index_, index_path_.c_str()), 0);
+    ASSERT_EQ(index_.n, packets_.size());
+    ASSERT_EQ(vrt_index_packet(&index_, 7)->stream_id, packets_[7].fields.stream_id);
+}
+
+TEST_F(IndexTest, InvalidRecording) {
+    append_mix();
+    words_[offsets_[3] / sizeof(uint32_t)] |= 0x02000000;
+    flush();
+    ASSERT_EQ(vrt_build_index(recording_path_.c_str(), index_path_.c_str()), VRT_ERR_RESERVED);
+    ASSERT_EQ(vrt_open_index(&index_, index_path_.c_str()), VRT_ERR_INDEX_FORMAT);
+}
+
+TEST_F(IndexTest, InvalidFormat) {
+    append_mix();
+    flush();
+    ASSERT_EQ(vrt_build_index(recording_path_.c_str(), index_path_.c_str()), 0);
+
+    /* Truncated */
+    ASSERT_EQ(truncate(index_path_.c_str(), 1000), 0);
+    ASSERT_EQ(vrt_open_index(&index_, index_path_.c_str()), VRT_ERR_INDEX_FORMAT);
+    ASSERT_EQ(truncate(index_path_.c_str(), 10), 0);
+    ASSERT_EQ(vrt_open_index(&index_, index_path_.c_str()), VRT_ERR_INDEX_FORMAT);
+
+    /* Not an index */
+    ASSERT_EQ(vrt_open_index(&index_, recording_path_.c_str()), VRT_ERR_INDEX_FORMAT);
+    ASSERT_EQ(vrt_open_index(&index_, "/nonexistent/recording.idx"), VRT_ERR_FILE);
+}
+
+TEST_F(IndexTest, SeekTimeNone) {
+    assert_seek(VRT_TSI_UTC, VRT_TSF_NONE, 0.0, [](uint64_t k, uint32_t* is, uint64_t* /*fs*/, vrt_time* t) {
+        *is = 1000 + k;
+        *t  = {static_cast<int32_t>(*is), 0};
+    });
+}
+
+TEST_F(IndexTest, SeekTimeSampleCount) {
+    /* Two packets per second */
+    assert_seek(VRT_TSI_UTC, VRT_TSF_SAMPLE_COUNT, 1e6, [](uint64_t k, uint32_t* is, uint64_t* fs, vrt_time* t) {
+        *is = 1000 + k / 2;
+        *fs = k % 2 * 500000;
+        *t  = {static_cast<int32_t>(*is), k % 2 * 500000000000};
+    });
+}
+
+TEST_F(IndexTest, SeekTimeRealTime) {
+    assert_seek(VRT_TSI_GPS, VRT_TSF_REAL_TIME, 0.0, [](uint64_t k, uint32_t* is, uint64_t* fs, vrt_time* t) {
+        *is = 1000 + k / 3;
+        *fs = k % 3 * 1000;
+        *t  = {static_cast<int32_t>(*is), *fs};
+    });
+}
+
+TEST_F(IndexTest, SeekTimeFreeRunningCount) {
+    /* Integer seconds are ignored */
+    auto timestamps = [](uint64_t k, uint32_t* is, uint64_t* fs, vrt_time* t) {
+        *is = 7;
+        *fs = 2000000 + k * 250000;
+        *t  = {static_cast<int32_t>(2 + k / 4), k % 4 * 250000000000};
+    };
+    assert_seek(VRT_TSI_OTHER, VRT_TSF_FREE_RUNNING_COUNT, 1e6, timestamps);
+}
+
+TEST_F(IndexTest, SeekTimeNonIntegerSampleRate) {
+    /* Sample rate is truncated, for both integer and fractional part of the time */
+    assert_seek(VRT_TSI_UTC, VRT_TSF_SAMPLE_COUNT, 1e6 + 0.5, [](uint64_t k, uint32_t* is, uint64_t* fs, vrt_time* t) {
+        *is = 1000 + k / 2;
+        *fs = k % 2 * 500000;
+        *t  = {static_cast<int32_t>(*is), k % 2 * 500000000000};
+    });
+}
+
+TEST_F(IndexTest, SeekTimeNonIntegerFreeRunningCount) {
+    auto timestamps = [](uint64_t k, uint32_t* is, uint64_t* fs, vrt_time* t) {
+        *is = 7;
+        *fs = 2000000 + k * 250000;
+        *t  = {static_cast<int32_t>(2 + k / 4), k % 4 * 250000000000};
+    };
+    assert_seek(VRT_TSI_OTHER, VRT_TSF_FREE_RUNNING_COUNT, 1e6 + 0.75, timestamps);
+}
+
+TEST_F(IndexTest, SeekTimeSubHertz) {
+    append(0xA, 1000, 0, VRT_TSI_UTC, VRT_TSF_SAMPLE_COUNT);
+    for (uint64_t i = 0; i < 4; ++i) {
+        append(0xB, 0, i, VRT_TSI_OTHER, VRT_TSF_FREE_RUNNING_COUNT);
+    }
+    flush();
+    ASSERT_EQ(vrt_build_index(recording_path_.c_str(), index_path_.c_str()), 0);
+    ASSERT_EQ(vrt_open_index(&index_, index_path_.c_str()), 0);
+
+    std::array<vrt_time_index_block, 4> blocks{};
+    vrt_time_index                      ti;
+    for (double sample_rate : {0.5, 0.999, -1.0}) {
+        ASSERT_EQ(vrt_init_time_index(&ti, &index_, 0xA, sample_rate, blocks.data(), blocks.size()),
+                  VRT_ERR_MISSING_SAMPLE_RATE);
+        ASSERT_EQ(vrt_init_time_index(&ti, &index_, 0xB, sample_rate, blocks.data(), blocks.size()),
+                  VRT_ERR_MISSING_SAMPLE_RATE);
+    }
+    ASSERT_EQ(vrt_init_time_index(&ti, &index_, 0xB, 1.5, blocks.data(), blocks.size()), 0);
+    ASSERT_EQ(ti.n, 4);
+    vrt_time t{3, 0};
+    uint64_t packet = 0;
+    ASSERT_EQ(vrt_seek_time_index(&ti, &t, &packet), 0);
+    ASSERT_EQ(packet, 3);
+}
+
+TEST_F(IndexTest, SeekTimeErrors) {
+    append(0xA, 1000, 0, VRT_TSI_UTC, VRT_TSF_SAMPLE_COUNT);
+    append(0xB, 0, 0, VRT_TSI_NONE, VRT_TSF_NONE);
+    flush();
+    ASSERT_EQ(vrt_build_index(recording_path_.c_str(), index_path_.c_str()), 0);
+    ASSERT_EQ(vrt_open_index(&index_, index_path_.c_str()), 0);
+
+    std::array<vrt_time_index_block, 4> blocks{};
+    vrt_time_index                      ti;
+    ASSERT_EQ(vrt_init_time_index(&ti, &index_, 0xA, 1e6, blocks.data(), 0), VRT_ERR_INVALID_CAPACITY);
+    ASSERT_EQ(vrt_init_time_index(&ti, &index_, 0xA, 0.0, blocks.data(), blocks.size()), VRT_ERR_MISSING_SAMPLE_RATE);
+    ASSERT_EQ(vrt_init_time_index(&ti, &index_, 0xB, 0.0, blocks.data(), blocks.size()), VRT_ERR_EXPECTED_FIELD);
+
+    /* Unknown stream has no packets */
+    ASSERT_EQ(vrt_init_time_index(&ti, &index_, 0xC, 0.0, blocks.data(), blocks.size()), 0);
+    ASSERT_EQ(ti.n, 0);
+    vrt_time t{1000, 0};
+    uint64_t packet = 1;
+    ASSERT_EQ(vrt_seek_time_index(&ti, &t, &packet), 0);
+    ASSERT_EQ(packet, 0);
+}
@@ -0,0 +1,210 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include <vrt/vrt_init.h>
+#include <vrt/vrt_loss_tracker.h>
+#include <vrt/vrt_types.h>
+
+class LossTrackerTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        vrt_init_header(&h_);
+        vrt_init_fields(&f_);
+        vrt_init_loss_tracker(&t_, 0.0, 0);
+    }
+
+    /**
+     * Update tracker with a packet.
+     */
+    void update(uint8_t packet_count, uint32_t integer_seconds_timestamp, uint64_t fractional_seconds_timestamp) {
+        h_.packet_count                 = packet_count;
+        f_.integer_seconds_timestamp    = integer_seconds_timestamp;
+        f_.fractional_seconds_timestamp = fractional_seconds_timestamp;
+        vrt_update_loss_tracker(&t_, &h_, &f_);
+    }
+
+    /**
+     * Update tracker with a packet without timestamps.
+     */
+    void update(uint8_t packet_count) { update(packet_count, 0, 0); }
+
+    vrt_header       h_{};
+    vrt_fields       f_{};
+    vrt_loss_tracker t_{};
+};
+
+TEST_F(LossTrackerTest, InOrder) {
+    for (int i = 0; i < 40; ++i) {
+        update(i % 16);
+    }
+    ASSERT_EQ(t_.received, 40);
+    ASSERT_EQ(t_.lost, 0);
+    ASSERT_EQ(t_.duplicated, 0);
+    ASSERT_EQ(t_.reordered, 0);
+}
+
+TEST_F(LossTrackerTest, StartAnywhere) {
+    update(9);
+    update(10);
+    ASSERT_EQ(t_.lost, 0);
+}
+
+TEST_F(LossTrackerTest, Gap) {
+    update(14);
+    update(15);
+    update(3);
+    ASSERT_EQ(t_.received, 3);
+    ASSERT_EQ(t_.lost, 3);
+}
+
+TEST_F(LossTrackerTest, Duplicate) {
+    update(0);
+    update(1);
+    update(1);
+    update(2);
+    ASSERT_EQ(t_.duplicated, 1);
+    ASSERT_EQ(t_.lost, 0);
+}
+
+TEST_F(LossTrackerTest, Reordered) {
+    update(0);
+    update(1);
+    update(3);
+    ASSERT_EQ(t_.lost, 1);
+    update(2);
+    update(4);
+    ASSERT_EQ(t_.lost, 0);
+    ASSERT_EQ(t_.reordered, 1);
+}
+
+TEST_F(LossTrackerTest, LateDuplicate) {
+    update(0);
+    update(1);
+    update(3);
+    update(1);
+    ASSERT_EQ(t_.lost, 1);
+    ASSERT_EQ(t_.duplicated, 1);
+    ASSERT_EQ(t_.reordered, 0);
+}
+
+TEST_F(LossTrackerTest, ReorderedTwice) {
+    update(0);
+    update(2);
+    update(1);
+    update(1);
+    ASSERT_EQ(t_.lost, 0);
+    ASSERT_EQ(t_.duplicated, 1);
+    ASSERT_EQ(t_.reordered, 1);
+}
+
+TEST_F(LossTrackerTest, ReorderedAfterLaterPackets) {
+    update(0);
+    update(3);
+    update(4);
+    update(5);
+    update(1);
+    update(2);
+    ASSERT_EQ(t_.lost, 0);
+    ASSERT_EQ(t_.reordered, 2);
+
+    /* Packets 6 to 11 lost, where 6 and 5 are 7 and 8 packets behind 13 when they arrive */
+    update(12);
+    ASSERT_EQ(t_.lost, 6);
+    update(13);
+    update(6);
+    update(5);
+    ASSERT_EQ(t_.lost, 5);
+    ASSERT_EQ(t_.reordered, 3);
+    ASSERT_EQ(t_.duplicated, 1);
+}
+
+TEST_F(LossTrackerTest, ReorderWindow) {
+    update(8);
+    update(0);
+    ASSERT_EQ(t_.duplicated, 1);
+    update(15);
+    ASSERT_EQ(t_.lost, 6);
+}
+
+TEST_F(LossTrackerTest, SixteenLostWithoutTimestamps) {
+    update(0);
+    update(1);
+    ASSERT_EQ(t_.lost, 0);
+}
+
+TEST_F(LossTrackerTest, SixteenLostSampleCount) {
+    vrt_init_loss_tracker(&t_, 1000.0, 100);
+    h_.tsi = VRT_TSI_UTC;
+    h_.tsf = VRT_TSF_SAMPLE_COUNT;
+    update(0, 5, 0);
+    update(1, 6, 700);
+    ASSERT_EQ(t_.lost, 16);
+    update(2, 6, 800);
+    ASSERT_EQ(t_.lost, 16);
+}
+
+TEST_F(LossTrackerTest, ManyLostRealTime) {
+    vrt_init_loss_tracker(&t_, 1e6, 1000);
+    h_.tsi = VRT_TSI_GPS;
+    h_.tsf = VRT_TSF_REAL_TIME;
+    update(0, 5, 999000000000);
+    update(5, 6, 20000000000);
+    ASSERT_EQ(t_.lost, 20);
+}
+
+TEST_F(LossTrackerTest, ManyLostFreeRunningCount) {
+    vrt_init_loss_tracker(&t_, 0.0, 10);
+    h_.tsf = VRT_TSF_FREE_RUNNING_COUNT;
+    update(0, 0, 1000);
+    update(1, 0, 1330);
+    ASSERT_EQ(t_.lost, 32);
+}
+
+TEST_F(LossTrackerTest, TimestampJitter) {
+    vrt_init_loss_tracker(&t_, 1000.0, 100);
+    h_.tsi = VRT_TSI_UTC;
+    h_.tsf = VRT_TSF_SAMPLE_COUNT;
+    update(0, 0, 0);
+    update(1, 0, 140);
+    update(2, 0, 190);
+    ASSERT_EQ(t_.lost, 0);
+}
+
+TEST_F(LossTrackerTest, ReorderedTimestamps) {
+    vrt_init_loss_tracker(&t_, 1000.0, 100);
+    h_.tsi = VRT_TSI_UTC;
+    h_.tsf = VRT_TSF_SAMPLE_COUNT;
+    update(0, 0, 0);
+    update(2, 0, 200);
+    update(1, 0, 100);
+    update(3, 0, 300);
+    ASSERT_EQ(t_.lost, 0);
+    ASSERT_EQ(t_.reordered, 1);
+}
+
+TEST_F(LossTrackerTest, DuplicateTimestamps) {
+    vrt_init_loss_tracker(&t_, 1000.0, 100);
+    h_.tsi = VRT_TSI_UTC;
+    h_.tsf = VRT_TSF_SAMPLE_COUNT;
+    update(0, 0, 0);
+    update(0, 0, 0);
+    ASSERT_EQ(t_.duplicated, 1);
+    ASSERT_EQ(t_.lost, 0);
+}
+
+TEST_F(LossTrackerTest, Packets) {
+    std::vector<vrt_packet_descriptor> descs(6);
+    const std::vector<uint8_t>         counts{0, 1, 2, 5, 5, 4};
+    for (std::size_t i = 0; i < descs.size(); ++i) {
+        vrt_init_header(&descs[i].header);
+        vrt_init_fields(&descs[i].fields);
+        descs[i].header.packet_count = counts[i];
+    }
+    vrt_update_loss_tracker_packets(&t_, descs.data(), descs.size());
+    ASSERT_EQ(t_.received, 6);
+    ASSERT_EQ(t_.lost, 1);
+    ASSERT_EQ(t_.duplicated, 1);
+    ASSERT_EQ(t_.reordered, 1);
+}
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+
+#include <vrt/vrt_byte_swap.h>
+#include <vrt/vrt_error_code.h>
+#include <vrt/vrt_init.h>
+#include <vrt/vrt_read.h>
+#include <vrt/vrt_types.h>
+#include <vrt/vrt_util.h>
+
+class MergeIfContextTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        vrt_init_if_context(&c_);
+        buf_.fill(0xBAADF00D);
+    }
+
+    vrt_if_context          c_{};
+    std::array<uint32_t, 8> buf_{};
+};
+
+TEST_F(MergeIfContextTest, BufferSize) {
+    ASSERT_EQ(vrt_merge_if_context(buf_.data(), 0, &c_, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+}
+
+TEST_F(MergeIfContextTest, Empty) {
+    buf_[0] = 0x00000000;
+    ASSERT_EQ(vrt_merge_if_context(buf_.data(), buf_.size(), &c_, VRT_VALIDATION_FULL), 1);
+    ASSERT_FALSE(c_.context_field_change_indicator);
+    ASSERT_FALSE(c_.has.bandwidth);
+}
+
+TEST_F(MergeIfContextTest, KeepsAbsentFields) {
+    buf_[0] = 0x20000000;
+    buf_[1] = 0x00000000;
+    buf_[2] = 0x00100000;
+    ASSERT_EQ(vrt_merge_if_context(buf_.data(), buf_.size(), &c_, VRT_VALIDATION_FULL), 3);
+    ASSERT_TRUE(c_.has.bandwidth);
+    ASSERT_EQ(c_.bandwidth, 1.0);
+
+    buf_[0] = 0x80200000;
+    buf_[1] = 0x000000F4;
+    buf_[2] = 0x24000000;
+    ASSERT_EQ(vrt_merge_if_context(buf_.data(), buf_.size(), &c_, VRT_VALIDATION_FULL), 3);
+    ASSERT_TRUE(c_.context_field_change_indicator);
+    ASSERT_TRUE(c_.has.bandwidth);
+    ASSERT_EQ(c_.bandwidth, 1.0);
+    ASSERT_TRUE(c_.has.sample_rate);
+    ASSERT_EQ(c_.sample_rate, 1e6);
+
+    buf_[0] = 0x20000000;
+    buf_[1] = 0x00000000;
+    buf_[2] = 0x00200000;
+    ASSERT_EQ(vrt_merge_if_context(buf_.data(), buf_.size(), &c_, VRT_VALIDATION_FULL), 3);
+    ASSERT_FALSE(c_.context_field_change_indicator);
+    ASSERT_EQ(c_.bandwidth, 2.0);
+    ASSERT_TRUE(c_.has.sample_rate);
+    ASSERT_EQ(c_.sample_rate, 1e6);
+}
+
+TEST_F(MergeIfContextTest, KeepsAbsentSubstructs) {
+    buf_[0] = 0x00010000;
+    buf_[1] = 0x80080000;
+    ASSERT_EQ(vrt_merge_if_context(buf_.data(), buf_.size(), &c_, VRT_VALIDATION_FULL), 2);
+    ASSERT_TRUE(c_.has.state_and_event_indicators);
+    ASSERT_TRUE(c_.state_and_event_indicators.has.calibrated_time);
+    ASSERT_TRUE(c_.state_and_event_indicators.calibrated_time);
+
+    buf_[0] = 0x40000000;
+    buf_[1] = 0x12345678;
+    ASSERT_EQ(vrt_merge_if_context(buf_.data(), buf_.size(), &c_, VRT_VALIDATION_FULL), 2);
+    ASSERT_EQ(c_.reference_point_identifier, 0x12345678);
+    ASSERT_TRUE(c_.has.state_and_event_indicators);
+    ASSERT_TRUE(c_.state_and_event_indicators.has.calibrated_time);
+    ASSERT_TRUE(c_.state_and_event_indicators.calibrated_time);
+}
+
+TEST_F(MergeIfContextTest, ReadStillZeroes) {
+    buf_[0] = 0x20000000;
+    buf_[1] = 0x00000000;
+    buf_[2] = 0x00100000;
+    ASSERT_EQ(vrt_merge_if_context(buf_.data(), buf_.size(), &c_, VRT_VALIDATION_FULL), 3);
+    buf_[0] = 0x00000000;
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), buf_.size(), &c_, VRT_VALIDATION_FULL), 1);
+    ASSERT_FALSE(c_.has.bandwidth);
+    ASSERT_EQ(c_.bandwidth, 0.0);
+}
+
+TEST_F(MergeIfContextTest, InvalidBandwidth) {
+    buf_[0] = 0x20000000;
+    buf_[1] = 0xFFFFFFFF;
+    buf_[2] = 0xFFFFFFFF;
+    ASSERT_EQ(vrt_merge_if_context(buf_.data(), buf_.size(), &c_, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_BANDWIDTH);
+}
+
+TEST_F(MergeIfContextTest, BigEndian) {
+    buf_[0] = 0x20000000;
+    buf_[1] = 0x00000000;
+    buf_[2] = 0x00100000;
+    if (vrt_is_platform_little_endian()) {
+        vrt_byte_swap(buf_.data(), buf_.data(), 3);
+    }
+    ASSERT_EQ(vrt_merge_if_context_be(buf_.data(), buf_.size(), &c_, VRT_VALIDATION_FULL), 3);
+    ASSERT_TRUE(c_.has.bandwidth);
+    ASSERT_EQ(c_.bandwidth, 1.0);
+}
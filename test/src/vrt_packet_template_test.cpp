@@ -0,0 +1,198 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+
+#include <vrt/vrt_error_code.h>
+#include <vrt/vrt_init.h>
+#include <vrt/vrt_packet_template.h>
+#include <vrt/vrt_types.h>
+#include <vrt/vrt_write.h>
+
+class PacketTemplateTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        vrt_init_packet(&p_);
+        body_.fill(0xABABABAB);
+        buf_.fill(0xBAADF00D);
+        ref_.fill(0xBAADF00D);
+    }
+
+    vrt_packet               p_{};
+    vrt_packet_template      tmpl_{};
+    std::array<uint32_t, 4>  body_{};
+    std::array<uint32_t, 16> buf_{};
+    std::array<uint32_t, 16> ref_{};
+};
+
+TEST_F(PacketTemplateTest, None) {
+    ASSERT_EQ(vrt_compile_packet_template(&p_.header, &p_.fields, nullptr, &tmpl_, VRT_VALIDATION_FULL), 1);
+    ASSERT_EQ(vrt_write_packet_template(&tmpl_, 0, 0, nullptr, 0, buf_.data(), buf_.size()), 1);
+    ASSERT_EQ(buf_[0], 0x00000001);
+    ASSERT_EQ(buf_[1], 0xBAADF00D);
+}
+
+TEST_F(PacketTemplateTest, EqualToWritePacket) {
+    p_.header.packet_type                  = VRT_PT_IF_DATA_WITH_STREAM_ID;
+    p_.header.has.class_id                 = true;
+    p_.header.has.trailer                  = true;
+    p_.header.tsi                          = VRT_TSI_UTC;
+    p_.header.tsf                          = VRT_TSF_REAL_TIME;
+    p_.header.packet_count                 = 3;
+    p_.fields.stream_id                    = 0xFEDCBA98;
+    p_.fields.class_id.oui                 = 0x00123456;
+    p_.fields.class_id.packet_class_code   = 0xABCD;
+    p_.fields.integer_seconds_timestamp    = 0x12345678;
+    p_.fields.fractional_seconds_timestamp = 0x000000E8D4A50FFF;
+    p_.trailer.has.valid_data              = true;
+    p_.trailer.valid_data                  = true;
+    p_.body                                = body_.data();
+    p_.words_body                          = body_.size();
+    p_.header.packet_size                  = 12;
+
+    ASSERT_EQ(vrt_compile_packet_template(&p_.header, &p_.fields, &p_.trailer, &tmpl_, VRT_VALIDATION_FULL), 8);
+    ASSERT_EQ(vrt_write_packet(&p_, ref_.data(), ref_.size(), VRT_VALIDATION_FULL), 12);
+    ASSERT_EQ(vrt_write_packet_template(&tmpl_, p_.fields.integer_seconds_timestamp,
+                                        p_.fields.fractional_seconds_timestamp, body_.data(), body_.size(),
+                                        buf_.data(), buf_.size()),
+              12);
+    ASSERT_EQ(buf_, ref_);
+}
+
+TEST_F(PacketTemplateTest, EqualToWritePacketBe) {
+    p_.header.packet_type                  = VRT_PT_IF_DATA_WITH_STREAM_ID;
+    p_.header.tsi                          = VRT_TSI_GPS;
+    p_.header.tsf                          = VRT_TSF_SAMPLE_COUNT;
+    p_.fields.stream_id                    = 0xFEDCBA98;
+    p_.fields.integer_seconds_timestamp    = 0x12345678;
+    p_.fields.fractional_seconds_timestamp = 0x0123456789ABCDEF;
+    p_.body                                = body_.data();
+    p_.words_body                          = body_.size();
+    p_.header.packet_size                  = 9;
+
+    ASSERT_EQ(vrt_compile_packet_template_be(&p_.header, &p_.fields, nullptr, &tmpl_, VRT_VALIDATION_FULL), 5);
+    ASSERT_EQ(vrt_write_packet_be(&p_, ref_.data(), ref_.size(), VRT_VALIDATION_FULL), 9);
+    ASSERT_EQ(vrt_write_packet_template(&tmpl_, p_.fields.integer_seconds_timestamp,
+                                        p_.fields.fractional_seconds_timestamp, body_.data(), body_.size(),
+                                        buf_.data(), buf_.size()),
+              9);
+    ASSERT_EQ(buf_, ref_);
+}
+
+TEST_F(PacketTemplateTest, OnlyFractionalTimestamp) {
+    p_.header.tsf = VRT_TSF_FREE_RUNNING_COUNT;
+    ASSERT_EQ(vrt_compile_packet_template(&p_.header, &p_.fields, nullptr, &tmpl_, VRT_VALIDATION_FULL), 3);
+    ASSERT_EQ(vrt_write_packet_template(&tmpl_, 0xFFFFFFFF, 0x0123456789ABCDEF, nullptr, 0, buf_.data(), buf_.size()),
+              3);
+    ASSERT_EQ(buf_[0], 0x00300003);
+    ASSERT_EQ(buf_[1], 0x01234567);
+    ASSERT_EQ(buf_[2], 0x89ABCDEF);
+    ASSERT_EQ(buf_[3], 0xBAADF00D);
+}
+
+TEST_F(PacketTemplateTest, PacketCountWraparound) {
+    p_.header.packet_count = 0xE;
+    ASSERT_EQ(vrt_compile_packet_template(&p_.header, &p_.fields, nullptr, &tmpl_, VRT_VALIDATION_FULL), 1);
+    ASSERT_EQ(vrt_write_packet_template(&tmpl_, 0, 0, nullptr, 0, buf_.data(), 1), 1);
+    ASSERT_EQ(buf_[0], 0x000E0001);
+    ASSERT_EQ(vrt_write_packet_template(&tmpl_, 0, 0, nullptr, 0, buf_.data(), 1), 1);
+    ASSERT_EQ(buf_[0], 0x000F0001);
+    ASSERT_EQ(vrt_write_packet_template(&tmpl_, 0, 0, nullptr, 0, buf_.data(), 1), 1);
+    ASSERT_EQ(buf_[0], 0x00000001);
+    ASSERT_EQ(tmpl_.packet_count, 1);
+}
+
+TEST_F(PacketTemplateTest, BodyInPlace) {
+    p_.header.has.trailer = true;
+    ASSERT_EQ(vrt_compile_packet_template(&p_.header, &p_.fields, &p_.trailer, &tmpl_, VRT_VALIDATION_FULL), 2);
+    ASSERT_EQ(vrt_write_packet_template(&tmpl_, 0, 0, nullptr, 2, buf_.data(), buf_.size()), 4);
+    ASSERT_EQ(buf_[0], 0x04000004);
+    ASSERT_EQ(buf_[1], 0xBAADF00D);
+    ASSERT_EQ(buf_[2], 0xBAADF00D);
+    ASSERT_EQ(buf_[3], 0x00000000);
+    ASSERT_EQ(buf_[4], 0xBAADF00D);
+}
+
+TEST_F(PacketTemplateTest, BufferTooSmall) {
+    ASSERT_EQ(vrt_compile_packet_template(&p_.header, &p_.fields, nullptr, &tmpl_, VRT_VALIDATION_FULL), 1);
+    ASSERT_EQ(vrt_write_packet_template(&tmpl_, 0, 0, body_.data(), body_.size(), buf_.data(), 4),
+              VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(buf_[0], 0xBAADF00D);
+    ASSERT_EQ(tmpl_.packet_count, 0);
+}
+
+TEST_F(PacketTemplateTest, NegativeBodySize) {
+    ASSERT_EQ(vrt_compile_packet_template(&p_.header, &p_.fields, nullptr, &tmpl_, VRT_VALIDATION_FULL), 1);
+    ASSERT_EQ(vrt_write_packet_template(&tmpl_, 0, 0, nullptr, -1, buf_.data(), buf_.size()),
+              VRT_ERR_BOUNDS_PACKET_SIZE);
+}
+
+TEST_F(PacketTemplateTest, BodyTooLarge) {
+    ASSERT_EQ(vrt_compile_packet_template(&p_.header, &p_.fields, nullptr, &tmpl_, VRT_VALIDATION_FULL), 1);
+    ASSERT_EQ(vrt_write_packet_template(&tmpl_, 0, 0, nullptr, 0xFFFF, buf_.data(), 0x10000),
+              VRT_ERR_BOUNDS_PACKET_SIZE);
+}
+
+TEST_F(PacketTemplateTest, InvalidPacketType) {
+    p_.header.packet_type = static_cast<vrt_packet_type>(8);
+    ASSERT_EQ(vrt_compile_packet_template(&p_.header, &p_.fields, nullptr, &tmpl_, VRT_VALIDATION_FULL),
+              VRT_ERR_INVALID_PACKET_TYPE);
+}
+
+TEST_F(PacketTemplateTest, Context) {
+    p_.header.packet_type = VRT_PT_IF_CONTEXT;
+    ASSERT_EQ(vrt_compile_packet_template(&p_.header, &p_.fields, nullptr, &tmpl_, VRT_VALIDATION_FULL),
+              VRT_ERR_EXPECTED_DATA_PACKET);
+    p_.header.packet_type = VRT_PT_EXT_CONTEXT;
+    ASSERT_EQ(vrt_compile_packet_template(&p_.header, &p_.fields, nullptr, &tmpl_, VRT_VALIDATION_NONE),
+              VRT_ERR_EXPECTED_DATA_PACKET);
+}
+
+TEST_F(PacketTemplateTest, TrailerInContext) {
+    p_.header.packet_type = VRT_PT_IF_CONTEXT;
+    p_.header.has.trailer = true;
+    ASSERT_EQ(vrt_compile_packet_template(&p_.header, &p_.fields, &p_.trailer, &tmpl_, VRT_VALIDATION_FULL),
+              VRT_ERR_TRAILER_IN_CONTEXT);
+}
+
+TEST_F(PacketTemplateTest, InvalidOui) {
+    p_.header.has.class_id = true;
+    p_.fields.class_id.oui = 0x01000000;
+    ASSERT_EQ(vrt_compile_packet_template(&p_.header, &p_.fields, nullptr, &tmpl_, VRT_VALIDATION_FULL),
+              VRT_ERR_BOUNDS_OUI);
+    ASSERT_EQ(vrt_compile_packet_template(&p_.header, &p_.fields, nullptr, &tmpl_, VRT_VALIDATION_NONE), 3);
+}
+
+TEST_F(PacketTemplateTest, InvalidAssociatedContextPacketCount) {
+    p_.header.has.trailer                          = true;
+    p_.trailer.has.associated_context_packet_count = true;
+    p_.trailer.associated_context_packet_count     = 0x80;
+    ASSERT_EQ(vrt_compile_packet_template(&p_.header, &p_.fields, &p_.trailer, &tmpl_, VRT_VALIDATION_FULL),
+              VRT_ERR_BOUNDS_ASSOCIATED_CONTEXT_PACKET_COUNT);
+}
+
+TEST_F(PacketTemplateTest, TimestampsIgnoredWhenCompiling) {
+    p_.header.tsf                          = VRT_TSF_REAL_TIME;
+    p_.fields.fractional_seconds_timestamp = 1000000000000;
+    ASSERT_EQ(vrt_compile_packet_template(&p_.header, &p_.fields, nullptr, &tmpl_, VRT_VALIDATION_FULL), 3);
+}
+
+TEST_F(PacketTemplateTest, Parts) {
+    p_.header.packet_type     = VRT_PT_IF_DATA_WITH_STREAM_ID;
+    p_.header.has.trailer     = true;
+    p_.header.tsi             = VRT_TSI_UTC;
+    p_.fields.stream_id       = 0xFEDCBA98;
+    p_.trailer.has.valid_data = true;
+    p_.trailer.valid_data     = true;
+
+    ASSERT_EQ(vrt_compile_packet_template(&p_.header, &p_.fields, &p_.trailer, &tmpl_, VRT_VALIDATION_FULL), 4);
+    ASSERT_EQ(vrt_write_packet_template(&tmpl_, 0x12345678, 0, body_.data(), body_.size(), ref_.data(), ref_.size()),
+              8);
+    ASSERT_EQ(vrt_write_packet_template_parts(&tmpl_, 0x12345678, 0, body_.size(), buf_.data(), buf_.data() + 3), 8);
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_EQ(buf_[i], ref_[i] | (i == 0 ? 0x00010000U : 0));
+    }
+    ASSERT_EQ(buf_[3], ref_[7]);
+    ASSERT_EQ(vrt_write_packet_template_parts(&tmpl_, 0, 0, 0x10000, buf_.data(), buf_.data() + 3),
+              VRT_ERR_BOUNDS_PACKET_SIZE);
+}
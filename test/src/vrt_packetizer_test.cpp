@@ -0,0 +1,195 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <vrt/vrt_byte_swap.h>
+#include <vrt/vrt_convert.h>
+#include <vrt/vrt_error_code.h>
+#include <vrt/vrt_init.h>
+#include <vrt/vrt_packetizer.h>
+#include <vrt/vrt_types.h>
+#include <vrt/vrt_util.h>
+
+class PacketizerTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        vrt_init_header(&h_);
+        vrt_init_fields(&f_);
+        vrt_init_trailer(&t_);
+        h_.packet_type               = VRT_PT_IF_DATA_WITH_STREAM_ID;
+        h_.has.trailer               = true;
+        h_.tsi                       = VRT_TSI_UTC;
+        h_.tsf                       = VRT_TSF_SAMPLE_COUNT;
+        f_.stream_id                 = 0xDEADBEEF;
+        f_.integer_seconds_timestamp = 100;
+        t_.has.valid_data            = true;
+        t_.valid_data                = true;
+        fmt_.packing_method          = VRT_PM_PROCESSING_EFFICIENT;
+        fmt_.real_or_complex         = VRT_ROC_COMPLEX_CARTESIAN;
+        fmt_.data_item_format        = VRT_DIF_SIGNED_FIXED_POINT;
+        fmt_.item_packing_field_size = 15;
+        fmt_.data_item_size          = 15;
+    }
+
+    /**
+     * Generate n floats in [-1, 1).
+     */
+    static std::vector<float> floats(int32_t n) {
+        std::vector<float> src(n);
+        for (int32_t i = 0; i < n; ++i) {
+            src[i] = static_cast<float>((i * 37) % 200 - 100) / 100.0F;
+        }
+        return src;
+    }
+
+    /**
+     * Packetize n floats both into one buffer and as scatter/gather buffers over a body packed in one go, and check
+     * that the packets are equal.
+     */
+    void check_iov(int32_t words_packet, int32_t n, int32_t n_iov) {
+        vrt_packetizer a{};
+        vrt_packetizer b{};
+        const int32_t  samples = vrt_init_packetizer(&h_, &f_, &t_, &fmt_, kScale, 1000.0, words_packet, &a,
+                                                     VRT_VALIDATION_FULL);
+        ASSERT_GT(samples, 0);
+        ASSERT_EQ(vrt_init_packetizer(&h_, &f_, &t_, &fmt_, kScale, 1000.0, words_packet, &b, VRT_VALIDATION_FULL),
+                  samples);
+
+        std::vector<float>    src = floats(n);
+        std::vector<uint32_t> buf(4096);
+        const int32_t         words = vrt_packetize_float(&a, src.data(), n, buf.data(), buf.size());
+        ASSERT_GE(words, 0);
+
+        std::vector<uint32_t> body(4096);
+        ASSERT_GE(vrt_convert_from_float(&b.converter, src.data(), n, body.data(), body.size()), 0);
+        std::vector<uint32_t>  parts(1024);
+        std::vector<vrt_iovec> iov(128);
+        ASSERT_EQ(vrt_packetize_iov(&b, body.data(), n, parts.data(), parts.size(), iov.data(), iov.size()), n_iov);
+
+        std::vector<uint32_t> gathered;
+        for (int32_t i = 0; i < n_iov; ++i) {
+            const std::size_t size = gathered.size();
+            gathered.resize(size + iov[i].iov_len / sizeof(uint32_t));
+            std::memcpy(gathered.data() + size, iov[i].iov_base, iov[i].iov_len);
+        }
+        ASSERT_EQ(gathered.size(), words);
+        for (int32_t i = 0; i < words; ++i) {
+            ASSERT_EQ(gathered[i], buf[i]) << "word " << i;
+        }
+        ASSERT_EQ(b.seq.fractional_seconds_timestamp, a.seq.fractional_seconds_timestamp);
+        ASSERT_EQ(b.seq.tmpl.packet_count, a.seq.tmpl.packet_count);
+    }
+
+    static constexpr float kScale = 1.0F / 16384;
+
+    vrt_header                     h_{};
+    vrt_fields                     f_{};
+    vrt_trailer                    t_{};
+    vrt_data_packet_payload_format fmt_{};
+    vrt_packetizer                 p_{};
+};
+
+TEST_F(PacketizerTest, Float) {
+    /* 6 words of header, fields, and trailer, so 20 complex 16-bit samples per packet */
+    ASSERT_EQ(vrt_init_packetizer(&h_, &f_, &t_, &fmt_, kScale, 1000.0, 26, &p_, VRT_VALIDATION_FULL), 20);
+
+    std::vector<float>    src = floats(2 * 50);
+    std::vector<uint32_t> buf(128, 0xBAADF00D);
+    ASSERT_EQ(vrt_packetize_float(&p_, src.data(), src.size(), buf.data(), buf.size()), 26 + 26 + 16);
+    ASSERT_EQ(buf[68], 0xBAADF00D);
+
+    std::vector<uint32_t> body(20);
+    for (int32_t i = 0; i < 3; ++i) {
+        const int32_t   words_body = i < 2 ? 20 : 10;
+        const uint32_t* packet     = buf.data() + 26 * i;
+        ASSERT_EQ(packet[0], 0x14500000U | (static_cast<uint32_t>(i) << 16U) | (6U + words_body));
+        ASSERT_EQ(packet[1], 0xDEADBEEF);
+        ASSERT_EQ(packet[2], 100);
+        ASSERT_EQ(packet[3], 0);
+        ASSERT_EQ(packet[4], 20U * i);
+        ASSERT_EQ(packet[5 + words_body], 0x40040000U);
+
+        vrt_converter c{};
+        ASSERT_EQ(vrt_init_converter(&c, &fmt_, kScale), 0);
+        ASSERT_EQ(vrt_convert_from_float(&c, src.data() + 40 * i, 2 * (words_body), body.data(), body.size()),
+                  words_body);
+        for (int32_t j = 0; j < words_body; ++j) {
+            ASSERT_EQ(packet[5 + j], body[j]);
+        }
+    }
+
+    /* Next burst continues where this one ended */
+    ASSERT_EQ(p_.seq.fractional_seconds_timestamp, 50);
+    ASSERT_EQ(p_.seq.tmpl.packet_count, 3);
+}
+
+TEST_F(PacketizerTest, Iov) {
+    check_iov(26, 2 * 50, 9);
+    check_iov(26, 2 * 40, 6);
+    check_iov(26, 0, 0);
+}
+
+TEST_F(PacketizerTest, IovLinkEfficient) {
+    /* 11-bit complex samples fill a whole number of words every 16 samples, i.e. 11 words */
+    fmt_.packing_method          = VRT_PM_LINK_EFFICIENT;
+    fmt_.item_packing_field_size = 10;
+    fmt_.data_item_size          = 10;
+    ASSERT_EQ(vrt_init_packetizer(&h_, &f_, &t_, &fmt_, kScale, 1000.0, 6 + 30, &p_, VRT_VALIDATION_FULL), 32);
+    ASSERT_EQ(p_.words_body, 22);
+
+    check_iov(6 + 30, 2 * 70, 9);
+    check_iov(6 + 30, 2 * 1, 3);
+}
+
+TEST_F(PacketizerTest, IovProcessingEfficient) {
+    /* Three 10-bit items per word, so a block is two words of three complex samples */
+    fmt_.item_packing_field_size = 9;
+    fmt_.data_item_size          = 9;
+    ASSERT_EQ(vrt_init_packetizer(&h_, &f_, &t_, &fmt_, kScale, 1000.0, 6 + 25, &p_, VRT_VALIDATION_FULL), 36);
+    ASSERT_EQ(p_.words_body, 24);
+
+    check_iov(6 + 25, 2 * 100, 9);
+}
+
+TEST_F(PacketizerTest, BigEndian) {
+    vrt_packetizer be{};
+    ASSERT_EQ(vrt_init_packetizer(&h_, &f_, &t_, &fmt_, kScale, 1000.0, 26, &p_, VRT_VALIDATION_FULL), 20);
+    ASSERT_EQ(vrt_init_packetizer_be(&h_, &f_, &t_, &fmt_, kScale, 1000.0, 26, &be, VRT_VALIDATION_FULL), 20);
+
+    std::vector<float>    src = floats(2 * 30);
+    std::vector<uint32_t> buf(64);
+    std::vector<uint32_t> buf_be(64);
+    ASSERT_EQ(vrt_packetize_float(&p_, src.data(), src.size(), buf.data(), buf.size()), 42);
+    ASSERT_EQ(vrt_packetize_float(&be, src.data(), src.size(), buf_be.data(), buf_be.size()), 42);
+    if (vrt_is_platform_little_endian()) {
+        vrt_byte_swap(buf.data(), buf.data(), 42);
+    }
+    ASSERT_EQ(buf, buf_be);
+}
+
+TEST_F(PacketizerTest, Errors) {
+    ASSERT_EQ(vrt_init_packetizer(&h_, &f_, &t_, &fmt_, kScale, 1000.0, 6, &p_, VRT_VALIDATION_FULL),
+              VRT_ERR_BOUNDS_PACKET_SIZE);
+    ASSERT_EQ(vrt_init_packetizer(&h_, &f_, &t_, &fmt_, kScale, 0.0, 26, &p_, VRT_VALIDATION_FULL),
+              VRT_ERR_MISSING_SAMPLE_RATE);
+    fmt_.data_item_format = VRT_DIF_IEEE_754_SINGLE_PRECISION_FLOATING_POINT;
+    ASSERT_EQ(vrt_init_packetizer(&h_, &f_, &t_, &fmt_, kScale, 1000.0, 26, &p_, VRT_VALIDATION_FULL),
+              VRT_ERR_UNSUPPORTED_FORMAT);
+    fmt_.data_item_format = VRT_DIF_SIGNED_FIXED_POINT;
+    ASSERT_EQ(vrt_init_packetizer(&h_, &f_, &t_, &fmt_, kScale, 1000.0, 0x10000, &p_, VRT_VALIDATION_FULL),
+              0xFFFF - 6);
+
+    ASSERT_EQ(vrt_init_packetizer(&h_, &f_, &t_, &fmt_, kScale, 1000.0, 26, &p_, VRT_VALIDATION_FULL), 20);
+    std::vector<float>     src = floats(2 * 50);
+    std::vector<uint32_t>  buf(128);
+    std::vector<vrt_iovec> iov(9);
+    ASSERT_EQ(vrt_packetize_float(&p_, src.data(), 3, buf.data(), buf.size()), VRT_ERR_PARTIAL_SAMPLE);
+    ASSERT_EQ(vrt_packetize_float(&p_, src.data(), src.size(), buf.data(), 67), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_packetize_iov(&p_, buf.data(), src.size(), buf.data(), 17, iov.data(), iov.size()),
+              VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_packetize_iov(&p_, buf.data(), src.size(), buf.data(), 18, iov.data(), 8), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(p_.seq.fractional_seconds_timestamp, 0);
+    ASSERT_EQ(p_.seq.tmpl.packet_count, 0);
+}
@@ -0,0 +1,206 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <any>
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+
+#include <vrt/vrt_error_code.h>
+#include <vrt/vrt_read.h>
+#include <vrt/vrt_types.h>
+#include <vrt/vrt_util.h>
+
+#include "hex.h"
+#include "init_garbage.h"
+#include "read_assertions.h"
+
+class ReadBeTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        init_garbage_packet(&p_);
+        buf_.fill(0xBAADF00D);
+    }
+
+    /**
+     * Convert word from host order to network order.
+     *
+     * \param u Word in host order.
+     *
+     * \return Word in network order.
+     */
+    static uint32_t hton(uint32_t u) {
+        if (!vrt_is_platform_little_endian()) {
+            return u;
+        }
+        return (u >> 24U) | ((u >> 8U) & 0x0000FF00U) | ((u << 8U) & 0x00FF0000U) | (u << 24U);
+    }
+
+    /**
+     * Fill buffer with words in network order, as if they had been received from the wire.
+     *
+     * \param words Words in host order.
+     */
+    void set_network(std::initializer_list<uint32_t> words) {
+        size_t i = 0;
+        for (uint32_t w : words) {
+            buf_[i++] = hton(w);
+        }
+    }
+
+    vrt_packet               p_{};
+    std::array<uint32_t, 32> buf_{};
+};
+
+TEST_F(ReadBeTest, HeaderBufferSize) {
+    ASSERT_EQ(vrt_read_header_be(buf_.data(), 0, &p_.header, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+}
+
+TEST_F(ReadBeTest, Header) {
+    set_network({0x1C6AABCD});
+    ASSERT_EQ(vrt_read_header_be(buf_.data(), 1, &p_.header, VRT_VALIDATION_NONE), 1);
+    SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
+    assert_header(p_.header, {{"packet_type", VRT_PT_IF_DATA_WITH_STREAM_ID},
+                              {"has.class_id", true},
+                              {"has.trailer", true},
+                              {"tsi", VRT_TSI_UTC},
+                              {"tsf", VRT_TSF_REAL_TIME},
+                              {"packet_count", static_cast<uint8_t>(0xA)},
+                              {"packet_size", static_cast<uint16_t>(0xABCD)}});
+}
+
+TEST_F(ReadBeTest, HeaderReserved) {
+    set_network({0x02000000});
+    ASSERT_EQ(vrt_read_header_be(buf_.data(), 1, &p_.header, VRT_VALIDATION_FULL), VRT_ERR_RESERVED);
+}
+
+TEST_F(ReadBeTest, Fields) {
+    p_.header.packet_type  = VRT_PT_IF_DATA_WITH_STREAM_ID;
+    p_.header.has.class_id = true;
+    p_.header.tsi          = VRT_TSI_UTC;
+    p_.header.tsf          = VRT_TSF_SAMPLE_COUNT;
+    set_network({0xABABABAB, 0x00123456, 0x1234ABCD, 0xBEEFBEEF, 0x00000001, 0x00000002});
+    ASSERT_EQ(vrt_read_fields_be(&p_.header, buf_.data(), 6, &p_.fields, VRT_VALIDATION_FULL), 6);
+    SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
+    assert_fields(p_.fields, {{"stream_id", 0xABABABAB},
+                              {"class_id.oui", 0x00123456U},
+                              {"class_id.information_class_code", static_cast<uint16_t>(0x1234)},
+                              {"class_id.packet_class_code", static_cast<uint16_t>(0xABCD)},
+                              {"integer_seconds_timestamp", 0xBEEFBEEF},
+                              {"fractional_seconds_timestamp", static_cast<uint64_t>(0x0000000100000002)}});
+}
+
+TEST_F(ReadBeTest, FieldsReserved) {
+    p_.header.packet_type  = VRT_PT_IF_DATA_WITHOUT_STREAM_ID;
+    p_.header.has.class_id = true;
+    p_.header.tsi          = VRT_TSI_NONE;
+    p_.header.tsf          = VRT_TSF_NONE;
+    set_network({0xFF000000, 0x00000000});
+    ASSERT_EQ(vrt_read_fields_be(&p_.header, buf_.data(), 2, &p_.fields, VRT_VALIDATION_FULL), VRT_ERR_RESERVED);
+}
+
+TEST_F(ReadBeTest, Trailer) {
+    set_network({0x80080085});
+    ASSERT_EQ(vrt_read_trailer_be(buf_.data(), 1, &p_.trailer), 1);
+    SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
+    assert_trailer(p_.trailer, {{"has.calibrated_time", true},
+                                {"calibrated_time", true},
+                                {"has.associated_context_packet_count", true},
+                                {"associated_context_packet_count", static_cast<uint8_t>(0x05)}});
+}
+
+TEST_F(ReadBeTest, IfContextBufferSize) {
+    set_network({0x20000000, 0x00000001, 0x00100000});
+    ASSERT_EQ(vrt_read_if_context_be(buf_.data(), 2, &p_.if_context, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+}
+
+TEST_F(ReadBeTest, IfContextBandwidth) {
+    set_network({0x20000000, 0x00000001, 0x00100000});
+    ASSERT_EQ(vrt_read_if_context_be(buf_.data(), 3, &p_.if_context, VRT_VALIDATION_FULL), 3);
+    SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
+    assert_if_context(p_.if_context, {{"has.bandwidth", true}, {"bandwidth", 4097.0}});
+}
+
+TEST_F(ReadBeTest, IfContextFormattedGpsGeolocationLatitude) {
+    set_network({0x00004000, 0x00000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400000, 0x7FFFFFFF, 0x7FFFFFFF,
+                 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF});
+    ASSERT_EQ(vrt_read_if_context_be(buf_.data(), 12, &p_.if_context, VRT_VALIDATION_FULL), 12);
+    SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
+    assert_if_context(p_.if_context, {{"has.formatted_gps_geolocation", true},
+                                      {"formatted_gps_geolocation.has.latitude", true},
+                                      {"formatted_gps_geolocation.latitude", 1.0}});
+}
+
+TEST_F(ReadBeTest, IfContextGpsAscii) {
+    set_network({0x00000200, 0x00ABCDEF, 0x00000001});
+    /* Characters are in transmission order and never swapped */
+    buf_[3] = 0x44434241;
+    ASSERT_EQ(vrt_read_if_context_be(buf_.data(), 4, &p_.if_context, VRT_VALIDATION_FULL), 4);
+    ASSERT_TRUE(p_.if_context.has.gps_ascii);
+    ASSERT_EQ(Hex(p_.if_context.gps_ascii.oui), Hex(0x00ABCDEF));
+    ASSERT_EQ(p_.if_context.gps_ascii.number_of_words, 1);
+    ASSERT_EQ(p_.if_context.gps_ascii.ascii, reinterpret_cast<const char*>(buf_.data() + 3));
+}
+
+TEST_F(ReadBeTest, IfContextAssociationLists) {
+    set_network({0x00000100, 0x00010000, 0x00000000, 0x12345678});
+    ASSERT_EQ(vrt_read_if_context_be(buf_.data(), 4, &p_.if_context, VRT_VALIDATION_FULL), 4);
+    const vrt_context_association_lists& l{p_.if_context.context_association_lists};
+    ASSERT_EQ(l.source_list_size, 1);
+    ASSERT_EQ(l.system_list_size, 0);
+    ASSERT_EQ(l.source_context_association_list, buf_.data() + 3);
+    /* List words are left in network order */
+    ASSERT_EQ(Hex(l.source_context_association_list[0]), Hex(hton(0x12345678)));
+}
+
+TEST_F(ReadBeTest, PacketDataWithTrailer) {
+    set_network({0x14000005, 0xABABABAB, 0x01020304, 0x05060708, 0x40000000});
+    ASSERT_EQ(vrt_read_packet_be(buf_.data(), 5, &p_, VRT_VALIDATION_FULL), 5);
+    SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
+    assert_header(p_.header, {{"packet_type", VRT_PT_IF_DATA_WITH_STREAM_ID},
+                              {"has.trailer", true},
+                              {"packet_size", static_cast<uint16_t>(5)}});
+    assert_fields(p_.fields, {{"stream_id", 0xABABABAB}});
+    assert_trailer(p_.trailer, {{"has.valid_data", true}});
+    ASSERT_EQ(p_.words_body, 2);
+    ASSERT_EQ(p_.body, buf_.data() + 2);
+    /* Body is left in network order */
+    const uint32_t* body{static_cast<const uint32_t*>(p_.body)};
+    ASSERT_EQ(Hex(body[0]), Hex(hton(0x01020304)));
+    ASSERT_EQ(Hex(body[1]), Hex(hton(0x05060708)));
+}
+
+TEST_F(ReadBeTest, PacketIfContext) {
+    set_network({0x41000006, 0xABABABAB, 0x20000000, 0x00000001, 0x00100000});
+    ASSERT_EQ(vrt_read_packet_be(buf_.data(), 6, &p_, VRT_VALIDATION_FULL), VRT_ERR_MISMATCH_PACKET_SIZE);
+    set_network({0x41000005, 0xABABABAB, 0x20000000, 0x00000001, 0x00100000});
+    ASSERT_EQ(vrt_read_packet_be(buf_.data(), 5, &p_, VRT_VALIDATION_FULL), 5);
+    SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
+    assert_header(p_.header, {{"packet_type", VRT_PT_IF_CONTEXT},
+                              {"tsm", VRT_TSM_COARSE},
+                              {"packet_size", static_cast<uint16_t>(5)}});
+    assert_fields(p_.fields, {{"stream_id", 0xABABABAB}});
+    assert_if_context(p_.if_context, {{"has.bandwidth", true}, {"bandwidth", 4097.0}});
+}
+
+TEST_F(ReadBeTest, PacketSameAsHost) {
+    const std::initializer_list<uint32_t> words{0x1C400006, 0xABABABAB, 0x00123456, 0x1234ABCD, 0xFEDCBA98, 0x800C0000};
+    set_network(words);
+    vrt_packet p_be{};
+    ASSERT_EQ(vrt_read_packet_be(buf_.data(), 6, &p_be, VRT_VALIDATION_FULL), 6);
+
+    std::array<uint32_t, 6> host{};
+    std::copy(words.begin(), words.end(), host.begin());
+    ASSERT_EQ(vrt_read_packet(host.data(), 6, &p_, VRT_VALIDATION_FULL), 6);
+
+    ASSERT_EQ(p_be.header.packet_type, p_.header.packet_type);
+    ASSERT_EQ(p_be.header.packet_size, p_.header.packet_size);
+    ASSERT_EQ(p_be.fields.stream_id, p_.fields.stream_id);
+    ASSERT_EQ(p_be.fields.class_id.oui, p_.fields.class_id.oui);
+    ASSERT_EQ(p_be.fields.class_id.packet_class_code, p_.fields.class_id.packet_class_code);
+    ASSERT_EQ(p_be.fields.integer_seconds_timestamp, p_.fields.integer_seconds_timestamp);
+    ASSERT_EQ(p_be.trailer.has.calibrated_time, p_.trailer.has.calibrated_time);
+    ASSERT_EQ(p_be.trailer.calibrated_time, p_.trailer.calibrated_time);
+    ASSERT_EQ(p_be.trailer.over_range, p_.trailer.over_range);
+}
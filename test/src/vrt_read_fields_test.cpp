@@ -27,25 +27,25 @@ class ReadFieldsTest : public ::testing::Test {
 };
 
 TEST_F(ReadFieldsTest, NegativeSizeBuffer) {
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), -1, &f_, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), -1, &f_, false), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), -1, &f_, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), -1, &f_, VRT_VALIDATION_NONE), VRT_ERR_BUFFER_SIZE);
 }
 
 TEST_F(ReadFieldsTest, None) {
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 0, &f_, true), 0);
+    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 0, &f_, VRT_VALIDATION_FULL), 0);
 }
 
 TEST_F(ReadFieldsTest, IfDataWithStreamId) {
     h_.packet_type = VRT_PT_IF_DATA_WITH_STREAM_ID;
     buf_[0]        = 0xFEFEBEBE;
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 1, &f_, true), 1);
+    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 1, &f_, VRT_VALIDATION_FULL), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_fields(f_, {{"stream_id", static_cast<uint32_t>(0xFEFEBEBE)}});
 }
 
 TEST_F(ReadFieldsTest, ExtDataWithoutStreamId) {
     h_.packet_type = VRT_PT_EXT_DATA_WITHOUT_STREAM_ID;
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 0, &f_, true), 0);
+    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 0, &f_, VRT_VALIDATION_FULL), 0);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_fields(f_, {});
 }
@@ -53,8 +53,8 @@ TEST_F(ReadFieldsTest, ExtDataWithoutStreamId) {
 TEST_F(ReadFieldsTest, ExtDataWithStreamId) {
     h_.packet_type = VRT_PT_EXT_DATA_WITH_STREAM_ID;
     buf_[0]        = 0xFEFEBEBE;
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 0, &f_, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 1, &f_, true), 1);
+    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 0, &f_, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 1, &f_, VRT_VALIDATION_FULL), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_fields(f_, {{"stream_id", static_cast<uint32_t>(0xFEFEBEBE)}});
 }
@@ -62,8 +62,8 @@ TEST_F(ReadFieldsTest, ExtDataWithStreamId) {
 TEST_F(ReadFieldsTest, IfContext) {
     h_.packet_type = VRT_PT_IF_CONTEXT;
     buf_[0]        = 0xFEFEBEBE;
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 0, &f_, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 1, &f_, true), 1);
+    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 0, &f_, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 1, &f_, VRT_VALIDATION_FULL), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_fields(f_, {{"stream_id", static_cast<uint32_t>(0xFEFEBEBE)}});
 }
@@ -71,8 +71,8 @@ TEST_F(ReadFieldsTest, IfContext) {
 TEST_F(ReadFieldsTest, ExtContext) {
     h_.packet_type = VRT_PT_EXT_CONTEXT;
     buf_[0]        = 0xFEFEBEBE;
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 0, &f_, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 1, &f_, true), 1);
+    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 0, &f_, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 1, &f_, VRT_VALIDATION_FULL), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_fields(f_, {{"stream_id", static_cast<uint32_t>(0xFEFEBEBE)}});
 }
@@ -81,7 +81,7 @@ TEST_F(ReadFieldsTest, ClassIdOui) {
     h_.has.class_id = true;
     buf_[0]         = 0x00FEDCBA;
     buf_[1]         = 0x00000000;
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 2, &f_, true), 2);
+    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 2, &f_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_fields(f_, {{"class_id.oui", static_cast<uint32_t>(0x00FEDCBA)}});
 }
@@ -90,7 +90,7 @@ TEST_F(ReadFieldsTest, ClassIdInformationClassCode) {
     h_.has.class_id = true;
     buf_[0]         = 0x00000000;
     buf_[1]         = 0xABAB0000;
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 2, &f_, true), 2);
+    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 2, &f_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_fields(f_, {{"class_id.information_class_code", static_cast<uint16_t>(0xABAB)}});
 }
@@ -99,7 +99,7 @@ TEST_F(ReadFieldsTest, ClassIdPacketClassCode) {
     h_.has.class_id = true;
     buf_[0]         = 0x00000000;
     buf_[1]         = 0x0000CBCB;
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 2, &f_, true), 2);
+    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 2, &f_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_fields(f_, {{"class_id.packet_class_code", static_cast<uint16_t>(0xCBCB)}});
 }
@@ -108,8 +108,9 @@ TEST_F(ReadFieldsTest, ClassIdReserved) {
     h_.has.class_id = true;
     buf_[0]         = 0xFF000000;
     buf_[1]         = 0x00000000;
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 2, &f_, true), VRT_ERR_RESERVED);
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 2, &f_, false), 2);
+    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 2, &f_, VRT_VALIDATION_FULL), VRT_ERR_RESERVED);
+    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 2, &f_, VRT_VALIDATION_STRUCTURAL), VRT_ERR_RESERVED);
+    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 2, &f_, VRT_VALIDATION_NONE), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_fields(f_, {});
 }
@@ -117,8 +118,8 @@ TEST_F(ReadFieldsTest, ClassIdReserved) {
 TEST_F(ReadFieldsTest, IntegerSecondsTimestamp) {
     h_.tsi  = VRT_TSI_OTHER;
     buf_[0] = 0x12345678;
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 0, &f_, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 1, &f_, true), 1);
+    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 0, &f_, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 1, &f_, VRT_VALIDATION_FULL), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_fields(f_, {{"integer_seconds_timestamp", static_cast<uint32_t>(0x12345678)}});
 }
@@ -127,8 +128,8 @@ TEST_F(ReadFieldsTest, FractionalSecondsTimestamp) {
     h_.tsf  = VRT_TSF_REAL_TIME;
     buf_[0] = 0x000000E8;
     buf_[1] = 0xD4A50FFF;
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 1, &f_, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 2, &f_, true), 2);
+    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 1, &f_, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 2, &f_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_fields(f_, {{"fractional_seconds_timestamp", static_cast<uint64_t>(0x000000E8D4A50FFF)}});
 }
@@ -137,8 +138,9 @@ TEST_F(ReadFieldsTest, FractionalSecondsTimestampInvalid) {
     h_.tsf  = VRT_TSF_REAL_TIME;
     buf_[0] = 0x000000E8;
     buf_[1] = 0xD4A51000;
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 2, &f_, true), VRT_ERR_BOUNDS_REAL_TIME);
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 2, &f_, false), 2);
+    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 2, &f_, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_REAL_TIME);
+    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 2, &f_, VRT_VALIDATION_STRUCTURAL), 2);
+    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 2, &f_, VRT_VALIDATION_NONE), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_fields(f_, {{"fractional_seconds_timestamp", static_cast<uint64_t>(0x000000E8D4A51000)}});
 }
@@ -148,8 +150,8 @@ TEST_F(ReadFieldsTest, EveryOther1) {
     h_.tsi         = VRT_TSI_UTC;
     buf_[0]        = 0xABABCBCB;
     buf_[1]        = 0xCECEBEBE;
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 1, &f_, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 2, &f_, true), 2);
+    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 1, &f_, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 2, &f_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_fields(f_, {{"stream_id", static_cast<uint32_t>(0xABABCBCB)},
                        {"integer_seconds_timestamp", static_cast<uint32_t>(0xCECEBEBE)}});
@@ -162,8 +164,8 @@ TEST_F(ReadFieldsTest, EveryOther2) {
     buf_[1]         = 0xABABCBCB;
     buf_[2]         = 0xCECEBEBE;
     buf_[3]         = 0xBABBA011;
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 3, &f_, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 4, &f_, true), 4);
+    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 3, &f_, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 4, &f_, VRT_VALIDATION_FULL), 4);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_fields(f_, {{"class_id.oui", static_cast<uint32_t>(0x00FEDCBA)},
                        {"class_id.information_class_code", static_cast<uint16_t>(0xABAB)},
@@ -182,8 +184,8 @@ TEST_F(ReadFieldsTest, All) {
     buf_[3]         = 0xCECEBEBE;
     buf_[4]         = 0xADDABEBB;
     buf_[5]         = 0xEFEFEF01;
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 5, &f_, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 6, &f_, true), 6);
+    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 5, &f_, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_read_fields(&h_, buf_.data(), 6, &f_, VRT_VALIDATION_FULL), 6);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_fields(f_, {{"stream_id", static_cast<uint32_t>(0xCECEBEBE)},
                        {"class_id.oui", static_cast<uint32_t>(0x00FEDCBA)},
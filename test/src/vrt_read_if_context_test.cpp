@@ -25,33 +25,34 @@ class ReadIfContextTest : public ::testing::Test {
 };
 
 TEST_F(ReadIfContextTest, NegativeSizeBuffer) {
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), -1, &c_, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), -1, &c_, false), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), -1, &c_, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), -1, &c_, VRT_VALIDATION_NONE), VRT_ERR_BUFFER_SIZE);
 }
 
 TEST_F(ReadIfContextTest, ZeroSizeBuffer) {
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 0, &c_, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 0, &c_, false), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 0, &c_, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 0, &c_, VRT_VALIDATION_NONE), VRT_ERR_BUFFER_SIZE);
 }
 
 TEST_F(ReadIfContextTest, None) {
     buf_[0] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 1, &c_, true), 1);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 1, &c_, VRT_VALIDATION_FULL), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {});
 }
 
 TEST_F(ReadIfContextTest, ContextFieldChangeIndicator) {
     buf_[0] = 0x80000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 1, &c_, true), 1);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 1, &c_, VRT_VALIDATION_FULL), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"context_field_change_indicator", true}});
 }
 
 TEST_F(ReadIfContextTest, ContextIndicatorsReserved) {
     buf_[0] = 0x000000FF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 1, &c_, true), VRT_ERR_RESERVED);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 1, &c_, false), 1);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 1, &c_, VRT_VALIDATION_FULL), VRT_ERR_RESERVED);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 1, &c_, VRT_VALIDATION_STRUCTURAL), VRT_ERR_RESERVED);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 1, &c_, VRT_VALIDATION_NONE), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {});
 }
@@ -59,7 +60,7 @@ TEST_F(ReadIfContextTest, ContextIndicatorsReserved) {
 TEST_F(ReadIfContextTest, ReferencePointIdentifier) {
     buf_[0] = 0x40000000;
     buf_[1] = 0xFEDCBA98;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.reference_point_identifier", true}, {"reference_point_identifier", 0xFEDCBA98}});
 }
@@ -68,7 +69,7 @@ TEST_F(ReadIfContextTest, Bandwidth) {
     buf_[0] = 0x20000000;
     buf_[1] = 0x00000001;
     buf_[2] = 0x00100000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_FULL), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.bandwidth", true}, {"bandwidth", 4097.0}});
 }
@@ -77,8 +78,9 @@ TEST_F(ReadIfContextTest, BandwidthInvalid) {
     buf_[0] = 0x20000000;
     buf_[1] = 0xFFFFFFFF;
     buf_[2] = 0xFFF00000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), VRT_ERR_BOUNDS_BANDWIDTH);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, false), 3);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_BANDWIDTH);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_STRUCTURAL), 3);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_NONE), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.bandwidth", true}, {"bandwidth", -1.0}});
 }
@@ -87,7 +89,7 @@ TEST_F(ReadIfContextTest, IfReferenceFrequency) {
     buf_[0] = 0x10000000;
     buf_[1] = 0x00000001;
     buf_[2] = 0x00100000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_FULL), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.if_reference_frequency", true}, {"if_reference_frequency", 4097.0}});
 }
@@ -96,7 +98,7 @@ TEST_F(ReadIfContextTest, RfReferenceFrequency) {
     buf_[0] = 0x08000000;
     buf_[1] = 0x00000001;
     buf_[2] = 0x00100000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_FULL), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.rf_reference_frequency", true}, {"rf_reference_frequency", 4097.0}});
 }
@@ -105,7 +107,7 @@ TEST_F(ReadIfContextTest, RfReferenceFrequencyOffset) {
     buf_[0] = 0x04000000;
     buf_[1] = 0x00000001;
     buf_[2] = 0x00100000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_FULL), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.rf_reference_frequency_offset", true}, {"rf_reference_frequency_offset", 4097.0}});
 }
@@ -114,7 +116,7 @@ TEST_F(ReadIfContextTest, IfBandOffset) {
     buf_[0] = 0x02000000;
     buf_[1] = 0x00000001;
     buf_[2] = 0x00100000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_FULL), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.if_band_offset", true}, {"if_band_offset", 4097.0}});
 }
@@ -122,7 +124,7 @@ TEST_F(ReadIfContextTest, IfBandOffset) {
 TEST_F(ReadIfContextTest, ReferenceLevel) {
     buf_[0] = 0x01000000;
     buf_[1] = 0x0000FF80;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.reference_level", true}, {"reference_level", -1.0F}});
 }
@@ -130,8 +132,9 @@ TEST_F(ReadIfContextTest, ReferenceLevel) {
 TEST_F(ReadIfContextTest, ReferenceLevelReserved) {
     buf_[0] = 0x01000000;
     buf_[1] = 0xFFFFFF80;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), VRT_ERR_RESERVED);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, false), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), VRT_ERR_RESERVED);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_STRUCTURAL), VRT_ERR_RESERVED);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_NONE), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.reference_level", true}, {"reference_level", -1.0F}});
 }
@@ -139,7 +142,7 @@ TEST_F(ReadIfContextTest, ReferenceLevelReserved) {
 TEST_F(ReadIfContextTest, Gain1) {
     buf_[0] = 0x00800000;
     buf_[1] = 0xFF80FF80;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.gain", true}, {"gain.stage2", -1.0F}, {"gain.stage1", -1.0F}});
 }
@@ -147,7 +150,7 @@ TEST_F(ReadIfContextTest, Gain1) {
 TEST_F(ReadIfContextTest, Gain2) {
     buf_[0] = 0x00800000;
     buf_[1] = 0x0000FF80;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.gain", true}, {"gain.stage2", 0.0F}, {"gain.stage1", -1.0F}});
 }
@@ -155,8 +158,9 @@ TEST_F(ReadIfContextTest, Gain2) {
 TEST_F(ReadIfContextTest, GainInvalid) {
     buf_[0] = 0x00800000;
     buf_[1] = 0xFF800000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), VRT_ERR_GAIN_STAGE2_SET);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, false), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), VRT_ERR_GAIN_STAGE2_SET);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_STRUCTURAL), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_NONE), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.gain", true}, {"gain.stage2", -1.0F}, {"gain.stage1", 0.0F}});
 }
@@ -164,7 +168,7 @@ TEST_F(ReadIfContextTest, GainInvalid) {
 TEST_F(ReadIfContextTest, OverRangeCount) {
     buf_[0] = 0x00400000;
     buf_[1] = 0xFFEEDDCC;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.over_range_count", true}, {"over_range_count", static_cast<uint32_t>(0xFFEEDDCC)}});
 }
@@ -173,7 +177,7 @@ TEST_F(ReadIfContextTest, SampleRate) {
     buf_[0] = 0x00200000;
     buf_[1] = 0x00000001;
     buf_[2] = 0x00100000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_FULL), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.sample_rate", true}, {"sample_rate", 4097.0}});
 }
@@ -182,8 +186,8 @@ TEST_F(ReadIfContextTest, SampleRateInvalid) {
     buf_[0] = 0x00200000;
     buf_[1] = 0xFFFFFFFF;
     buf_[2] = 0xFFF00000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), VRT_ERR_BOUNDS_SAMPLE_RATE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, false), 3);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_SAMPLE_RATE);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_NONE), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.sample_rate", true}, {"sample_rate", -1.0}});
 }
@@ -192,7 +196,7 @@ TEST_F(ReadIfContextTest, TimestampAdjustment) {
     buf_[0] = 0x00100000;
     buf_[1] = 0xABCDEFAB;
     buf_[2] = 0xBABBABBA;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_FULL), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_, {{"has.timestamp_adjustment", true}, {"timestamp_adjustment", static_cast<uint64_t>(0xABCDEFABBABBABBA)}});
@@ -201,7 +205,7 @@ TEST_F(ReadIfContextTest, TimestampAdjustment) {
 TEST_F(ReadIfContextTest, TimestampCalibrationTime) {
     buf_[0] = 0x00080000;
     buf_[1] = 0xABCDEFAB;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.timestamp_calibration_time", true},
                            {"timestamp_calibration_time", static_cast<uint32_t>(0xABCDEFAB)}});
@@ -210,7 +214,7 @@ TEST_F(ReadIfContextTest, TimestampCalibrationTime) {
 TEST_F(ReadIfContextTest, Temperature) {
     buf_[0] = 0x00040000;
     buf_[1] = 0x0000FFC0;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.temperature", true}, {"temperature", -1.0F}});
 }
@@ -218,8 +222,8 @@ TEST_F(ReadIfContextTest, Temperature) {
 TEST_F(ReadIfContextTest, TemperatureInvalid) {
     buf_[0] = 0x00040000;
     buf_[1] = 0x0000BB80;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), VRT_ERR_BOUNDS_TEMPERATURE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, false), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_TEMPERATURE);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_NONE), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.temperature", true}, {"temperature", -274.0F}});
 }
@@ -227,8 +231,8 @@ TEST_F(ReadIfContextTest, TemperatureInvalid) {
 TEST_F(ReadIfContextTest, TemperatureReserved) {
     buf_[0] = 0x00040000;
     buf_[1] = 0xFFFFBBC0;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), VRT_ERR_RESERVED);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, false), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), VRT_ERR_RESERVED);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_NONE), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.temperature", true}, {"temperature", -273.0F}});
 }
@@ -237,7 +241,7 @@ TEST_F(ReadIfContextTest, DeviceIdentifierOui) {
     buf_[0] = 0x00020000;
     buf_[1] = 0x00ABCDEF;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_FULL), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_,
                       {{"has.device_identifier", true}, {"device_identifier.oui", static_cast<uint32_t>(0x00ABCDEF)}});
@@ -247,8 +251,8 @@ TEST_F(ReadIfContextTest, DeviceIdentifierOuiInvalid) {
     buf_[0] = 0x00020000;
     buf_[1] = 0xFFABCDEF;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), VRT_ERR_RESERVED);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, false), 3);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_FULL), VRT_ERR_RESERVED);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_NONE), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_,
                       {{"has.device_identifier", true}, {"device_identifier.oui", static_cast<uint32_t>(0x00ABCDEF)}});
@@ -258,7 +262,7 @@ TEST_F(ReadIfContextTest, DeviceIdentifierDeviceCode) {
     buf_[0] = 0x00020000;
     buf_[1] = 0x00000000;
     buf_[2] = 0x0000ABCD;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_FULL), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_, {{"has.device_identifier", true}, {"device_identifier.device_code", static_cast<uint16_t>(0xABCD)}});
@@ -268,8 +272,8 @@ TEST_F(ReadIfContextTest, DeviceIdentifierDeviceCodeInvalid) {
     buf_[0] = 0x00020000;
     buf_[1] = 0x00000000;
     buf_[2] = 0xFFFFABCD;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), VRT_ERR_RESERVED);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, false), 3);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_FULL), VRT_ERR_RESERVED);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_NONE), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_, {{"has.device_identifier", true}, {"device_identifier.device_code", static_cast<uint16_t>(0xABCD)}});
@@ -278,7 +282,7 @@ TEST_F(ReadIfContextTest, DeviceIdentifierDeviceCodeInvalid) {
 TEST_F(ReadIfContextTest, StateAndEventIndicatorsHasCalibratedTime) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x80000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_, {{"has.state_and_event_indicators", true}, {"state_and_event_indicators.has.calibrated_time", true}});
@@ -287,7 +291,7 @@ TEST_F(ReadIfContextTest, StateAndEventIndicatorsHasCalibratedTime) {
 TEST_F(ReadIfContextTest, StateAndEventIndicatorsHasValidData) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x40000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_,
                       {{"has.state_and_event_indicators", true}, {"state_and_event_indicators.has.valid_data", true}});
@@ -296,7 +300,7 @@ TEST_F(ReadIfContextTest, StateAndEventIndicatorsHasValidData) {
 TEST_F(ReadIfContextTest, StateAndEventIndicatorsHasReferenceLock) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x20000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_, {{"has.state_and_event_indicators", true}, {"state_and_event_indicators.has.reference_lock", true}});
@@ -305,7 +309,7 @@ TEST_F(ReadIfContextTest, StateAndEventIndicatorsHasReferenceLock) {
 TEST_F(ReadIfContextTest, StateAndEventIndicatorsHasAgcOrMgc) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x10000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_,
                       {{"has.state_and_event_indicators", true}, {"state_and_event_indicators.has.agc_or_mgc", true}});
@@ -314,7 +318,7 @@ TEST_F(ReadIfContextTest, StateAndEventIndicatorsHasAgcOrMgc) {
 TEST_F(ReadIfContextTest, StateAndEventIndicatorsHasDetectedSignal) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x08000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_, {{"has.state_and_event_indicators", true}, {"state_and_event_indicators.has.detected_signal", true}});
@@ -323,7 +327,7 @@ TEST_F(ReadIfContextTest, StateAndEventIndicatorsHasDetectedSignal) {
 TEST_F(ReadIfContextTest, StateAndEventIndicatorsHasSpectralInversion) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x04000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_, {{"has.state_and_event_indicators", true}, {"state_and_event_indicators.has.spectral_inversion", true}});
@@ -332,7 +336,7 @@ TEST_F(ReadIfContextTest, StateAndEventIndicatorsHasSpectralInversion) {
 TEST_F(ReadIfContextTest, StateAndEventIndicatorsHasOverRange) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x02000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_,
                       {{"has.state_and_event_indicators", true}, {"state_and_event_indicators.has.over_range", true}});
@@ -341,7 +345,7 @@ TEST_F(ReadIfContextTest, StateAndEventIndicatorsHasOverRange) {
 TEST_F(ReadIfContextTest, StateAndEventIndicatorsHasSampleLoss) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x01000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_,
                       {{"has.state_and_event_indicators", true}, {"state_and_event_indicators.has.sample_loss", true}});
@@ -350,7 +354,7 @@ TEST_F(ReadIfContextTest, StateAndEventIndicatorsHasSampleLoss) {
 TEST_F(ReadIfContextTest, StateAndEventIndicatorsCalibratedTime) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x00080000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.state_and_event_indicators", true}});
 }
@@ -358,7 +362,7 @@ TEST_F(ReadIfContextTest, StateAndEventIndicatorsCalibratedTime) {
 TEST_F(ReadIfContextTest, StateAndEventIndicatorsValidData) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x00040000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.state_and_event_indicators", true}});
 }
@@ -366,7 +370,7 @@ TEST_F(ReadIfContextTest, StateAndEventIndicatorsValidData) {
 TEST_F(ReadIfContextTest, StateAndEventIndicatorsReferenceLock) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x00020000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.state_and_event_indicators", true}});
 }
@@ -374,7 +378,7 @@ TEST_F(ReadIfContextTest, StateAndEventIndicatorsReferenceLock) {
 TEST_F(ReadIfContextTest, StateAndEventIndicatorsAgcOrMgc) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x00010000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.state_and_event_indicators", true}});
 }
@@ -382,7 +386,7 @@ TEST_F(ReadIfContextTest, StateAndEventIndicatorsAgcOrMgc) {
 TEST_F(ReadIfContextTest, StateAndEventIndicatorsDetectedSignal) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x00008000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.state_and_event_indicators", true}});
 }
@@ -390,7 +394,7 @@ TEST_F(ReadIfContextTest, StateAndEventIndicatorsDetectedSignal) {
 TEST_F(ReadIfContextTest, StateAndEventIndicatorsSpectralInversion) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x00004000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.state_and_event_indicators", true}});
 }
@@ -398,7 +402,7 @@ TEST_F(ReadIfContextTest, StateAndEventIndicatorsSpectralInversion) {
 TEST_F(ReadIfContextTest, StateAndEventIndicatorsOverRange) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x00002000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.state_and_event_indicators", true}});
 }
@@ -406,7 +410,7 @@ TEST_F(ReadIfContextTest, StateAndEventIndicatorsOverRange) {
 TEST_F(ReadIfContextTest, StateAndEventIndicatorsSampleLoss) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x00001000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.state_and_event_indicators", true}});
 }
@@ -414,7 +418,7 @@ TEST_F(ReadIfContextTest, StateAndEventIndicatorsSampleLoss) {
 TEST_F(ReadIfContextTest, StateAndEventIndicatorsBothCalibratedTime) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x80080000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.state_and_event_indicators", true},
                            {"state_and_event_indicators.has.calibrated_time", true},
@@ -424,7 +428,7 @@ TEST_F(ReadIfContextTest, StateAndEventIndicatorsBothCalibratedTime) {
 TEST_F(ReadIfContextTest, StateAndEventIndicatorsBothValidData) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x40040000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.state_and_event_indicators", true},
                            {"state_and_event_indicators.has.valid_data", true},
@@ -434,7 +438,7 @@ TEST_F(ReadIfContextTest, StateAndEventIndicatorsBothValidData) {
 TEST_F(ReadIfContextTest, StateAndEventIndicatorsBothReferenceLock) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x20020000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.state_and_event_indicators", true},
                            {"state_and_event_indicators.has.reference_lock", true},
@@ -444,7 +448,7 @@ TEST_F(ReadIfContextTest, StateAndEventIndicatorsBothReferenceLock) {
 TEST_F(ReadIfContextTest, StateAndEventIndicatorsBothAgcOrMgc) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x10010000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.state_and_event_indicators", true},
                            {"state_and_event_indicators.has.agc_or_mgc", true},
@@ -454,7 +458,7 @@ TEST_F(ReadIfContextTest, StateAndEventIndicatorsBothAgcOrMgc) {
 TEST_F(ReadIfContextTest, StateAndEventIndicatorsBothDetectedSignal) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x08008000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.state_and_event_indicators", true},
                            {"state_and_event_indicators.has.detected_signal", true},
@@ -464,7 +468,7 @@ TEST_F(ReadIfContextTest, StateAndEventIndicatorsBothDetectedSignal) {
 TEST_F(ReadIfContextTest, StateAndEventIndicatorsBothSpectralInversion) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x04004000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.state_and_event_indicators", true},
                            {"state_and_event_indicators.has.spectral_inversion", true},
@@ -474,7 +478,7 @@ TEST_F(ReadIfContextTest, StateAndEventIndicatorsBothSpectralInversion) {
 TEST_F(ReadIfContextTest, StateAndEventIndicatorsBothOverRange) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x02002000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.state_and_event_indicators", true},
                            {"state_and_event_indicators.has.over_range", true},
@@ -484,7 +488,7 @@ TEST_F(ReadIfContextTest, StateAndEventIndicatorsBothOverRange) {
 TEST_F(ReadIfContextTest, StateAndEventIndicatorsUserDefined) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x000000FF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.state_and_event_indicators", true},
                            {"state_and_event_indicators.user_defined", static_cast<uint8_t>(0xFF)}});
@@ -493,8 +497,8 @@ TEST_F(ReadIfContextTest, StateAndEventIndicatorsUserDefined) {
 TEST_F(ReadIfContextTest, StateAndEventIndicatorsReserved) {
     buf_[0] = 0x00010000;
     buf_[1] = 0x00F00F00;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), VRT_ERR_RESERVED);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, false), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), VRT_ERR_RESERVED);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_NONE), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.state_and_event_indicators", true}});
 }
@@ -503,7 +507,7 @@ TEST_F(ReadIfContextTest, DataPacketPayloadFormatPackingMethod) {
     buf_[0] = 0x00008000;
     buf_[1] = 0x80000000;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_FULL), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.data_packet_payload_format", true},
                            {"data_packet_payload_format.packing_method", VRT_PM_LINK_EFFICIENT}});
@@ -513,7 +517,7 @@ TEST_F(ReadIfContextTest, DataPacketPayloadFormatRealOrComplex) {
     buf_[0] = 0x00008000;
     buf_[1] = 0x40000000;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_FULL), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.data_packet_payload_format", true},
                            {"data_packet_payload_format.real_or_complex", VRT_ROC_COMPLEX_POLAR}});
@@ -523,8 +527,8 @@ TEST_F(ReadIfContextTest, DataPacketPayloadFormatRealOrComplexInvalid) {
     buf_[0] = 0x00008000;
     buf_[1] = 0x60000000;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), VRT_ERR_INVALID_REAL_OR_COMPLEX);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, false), 3);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_FULL), VRT_ERR_INVALID_REAL_OR_COMPLEX);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_NONE), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.data_packet_payload_format", true},
                            {"data_packet_payload_format.real_or_complex", static_cast<vrt_real_complex>(3)}});
@@ -534,7 +538,7 @@ TEST_F(ReadIfContextTest, DataPacketPayloadFormatDataItemFormat) {
     buf_[0] = 0x00008000;
     buf_[1] = 0x16000000;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_FULL), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.data_packet_payload_format", true},
                            {"data_packet_payload_format.data_item_format", VRT_DIF_UNSIGNED_VRT_6_BIT_EXPONENT}});
@@ -544,8 +548,8 @@ TEST_F(ReadIfContextTest, DataPacketPayloadFormatDataItemFormatInvalid1) {
     buf_[0] = 0x00008000;
     buf_[1] = 0x07000000;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), VRT_ERR_INVALID_DATA_ITEM_FORMAT);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, false), 3);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_FULL), VRT_ERR_INVALID_DATA_ITEM_FORMAT);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_NONE), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.data_packet_payload_format", true},
                            {"data_packet_payload_format.data_item_format", static_cast<vrt_data_item_format>(0x07)}});
@@ -555,8 +559,8 @@ TEST_F(ReadIfContextTest, DataPacketPayloadFormatDataItemFormatInvalid2) {
     buf_[0] = 0x00008000;
     buf_[1] = 0x0D000000;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), VRT_ERR_INVALID_DATA_ITEM_FORMAT);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, false), 3);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_FULL), VRT_ERR_INVALID_DATA_ITEM_FORMAT);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_NONE), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.data_packet_payload_format", true},
                            {"data_packet_payload_format.data_item_format", static_cast<vrt_data_item_format>(0x0D)}});
@@ -566,8 +570,8 @@ TEST_F(ReadIfContextTest, DataPacketPayloadFormatDataItemFormatInvalid3) {
     buf_[0] = 0x00008000;
     buf_[1] = 0x17000000;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), VRT_ERR_INVALID_DATA_ITEM_FORMAT);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, false), 3);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_FULL), VRT_ERR_INVALID_DATA_ITEM_FORMAT);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_NONE), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.data_packet_payload_format", true},
                            {"data_packet_payload_format.data_item_format", static_cast<vrt_data_item_format>(0x17)}});
@@ -577,7 +581,7 @@ TEST_F(ReadIfContextTest, DataPacketPayloadFormatSampleComponentRepeat) {
     buf_[0] = 0x00008000;
     buf_[1] = 0x00800000;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_FULL), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_, {{"has.data_packet_payload_format", true}, {"data_packet_payload_format.sample_component_repeat", true}});
@@ -587,7 +591,7 @@ TEST_F(ReadIfContextTest, DataPacketPayloadFormatEventTagSize) {
     buf_[0] = 0x00008000;
     buf_[1] = 0x00700000;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_FULL), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.data_packet_payload_format", true},
                            {"data_packet_payload_format.event_tag_size", static_cast<uint8_t>(0x7)}});
@@ -597,7 +601,7 @@ TEST_F(ReadIfContextTest, DataPacketPayloadFormatChannelTagSize) {
     buf_[0] = 0x00008000;
     buf_[1] = 0x000F0000;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_FULL), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.data_packet_payload_format", true},
                            {"data_packet_payload_format.channel_tag_size", static_cast<uint8_t>(0xF)}});
@@ -607,7 +611,7 @@ TEST_F(ReadIfContextTest, DataPacketPayloadFormatItemPackingFieldSize) {
     buf_[0] = 0x00008000;
     buf_[1] = 0x00000FC0;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_FULL), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.data_packet_payload_format", true},
                            {"data_packet_payload_format.item_packing_field_size", static_cast<uint8_t>(0x3F)}});
@@ -617,7 +621,7 @@ TEST_F(ReadIfContextTest, DataPacketPayloadFormatDataItemSize) {
     buf_[0] = 0x00008000;
     buf_[1] = 0x0000003F;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_FULL), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.data_packet_payload_format", true},
                            {"data_packet_payload_format.data_item_size", static_cast<uint8_t>(0x3F)}});
@@ -627,7 +631,7 @@ TEST_F(ReadIfContextTest, DataPacketPayloadFormatRepeatCount) {
     buf_[0] = 0x00008000;
     buf_[1] = 0x00000000;
     buf_[2] = 0xFFFF0000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_FULL), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.data_packet_payload_format", true},
                            {"data_packet_payload_format.repeat_count", static_cast<uint16_t>(0xFFFF)}});
@@ -637,7 +641,7 @@ TEST_F(ReadIfContextTest, DataPacketPayloadFormatVectorSize) {
     buf_[0] = 0x00008000;
     buf_[1] = 0x00000000;
     buf_[2] = 0x0000FFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_FULL), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.data_packet_payload_format", true},
                            {"data_packet_payload_format.vector_size", static_cast<uint16_t>(0xFFFF)}});
@@ -647,8 +651,8 @@ TEST_F(ReadIfContextTest, DataPacketPayloadFormatReserved) {
     buf_[0] = 0x00008000;
     buf_[1] = 0x0000F000;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), VRT_ERR_RESERVED);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, false), 3);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_FULL), VRT_ERR_RESERVED);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_NONE), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.data_packet_payload_format", true}});
 }
@@ -666,7 +670,7 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationTsi) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true}, {"formatted_gps_geolocation.tsi", VRT_TSI_OTHER}});
 }
@@ -684,7 +688,7 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationTsf) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_, {{"has.formatted_gps_geolocation", true}, {"formatted_gps_geolocation.tsf", VRT_TSF_FREE_RUNNING_COUNT}});
@@ -703,7 +707,7 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationOui) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.oui", static_cast<uint32_t>(0x00FFFFFF)}});
@@ -722,7 +726,7 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationIntegerSecondTimestamp) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.tsi", VRT_TSI_UTC},
@@ -742,8 +746,8 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationIntegerSecondTimestampInvalid)
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_NONE), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.integer_second_timestamp", static_cast<uint32_t>(0xABABABAB)}});
@@ -762,7 +766,7 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationFractionalSecondTimestamp) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_, {{"has.formatted_gps_geolocation", true},
@@ -783,8 +787,8 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationFractionalSecondTimestampInvali
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_SET_FRACTIONAL_SECOND_TIMESTAMP);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), VRT_ERR_SET_FRACTIONAL_SECOND_TIMESTAMP);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_NONE), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_, {{"has.formatted_gps_geolocation", true},
@@ -804,8 +808,9 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationFractionalSecondTimestampInvali
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_REAL_TIME);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_REAL_TIME);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_STRUCTURAL), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_NONE), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_, {{"has.formatted_gps_geolocation", true},
@@ -826,7 +831,7 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationLatitude) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.has.latitude", true},
@@ -846,8 +851,9 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationLatitudeInvalidSmall) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_LATITUDE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_LATITUDE);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_STRUCTURAL), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_NONE), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.has.latitude", true},
@@ -867,8 +873,8 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationLatitudeInvalidLarge) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_LATITUDE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_LATITUDE);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_NONE), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.has.latitude", true},
@@ -888,7 +894,7 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationLongitude) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.has.longitude", true},
@@ -908,8 +914,8 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationLongitudeInvalidSmall) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_LONGITUDE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_LONGITUDE);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_NONE), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.has.longitude", true},
@@ -929,8 +935,8 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationLongitudeInvalidLarge) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_LONGITUDE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_LONGITUDE);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_NONE), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.has.longitude", true},
@@ -950,7 +956,7 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationAltitude) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.has.altitude", true},
@@ -970,7 +976,7 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationSpeedOverGround) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.has.speed_over_ground", true},
@@ -990,7 +996,7 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationHeadingAngle) {
     buf_[9]  = 0x00400000;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.has.heading_angle", true},
@@ -1010,8 +1016,8 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationHeadingAngleInvalidSmall) {
     buf_[9]  = 0xFFC00000;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_HEADING_ANGLE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_HEADING_ANGLE);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_NONE), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.has.heading_angle", true},
@@ -1031,8 +1037,8 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationHeadingAngleInvalidLarge) {
     buf_[9]  = 0x5A000000;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_HEADING_ANGLE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_HEADING_ANGLE);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_NONE), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.has.heading_angle", true},
@@ -1052,7 +1058,7 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationTrackAngle) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x00400000;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.has.track_angle", true},
@@ -1072,8 +1078,8 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationTrackAngleInvalidSmall) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0xFFC00000;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_TRACK_ANGLE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_TRACK_ANGLE);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_NONE), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.has.track_angle", true},
@@ -1093,8 +1099,8 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationTrackAngleInvalidLarge) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x5A000000;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_TRACK_ANGLE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_TRACK_ANGLE);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_NONE), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.has.track_angle", true},
@@ -1114,7 +1120,7 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationMagneticVariation) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x00400000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.has.magnetic_variation", true},
@@ -1134,8 +1140,8 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationMagneticVariationInvalidSmall)
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0xD2C00000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_MAGNETIC_VARIATION);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_MAGNETIC_VARIATION);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_NONE), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.has.magnetic_variation", true},
@@ -1155,8 +1161,8 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationMagneticVariationInvalidLarge)
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x2D400000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_MAGNETIC_VARIATION);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_MAGNETIC_VARIATION);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_NONE), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true},
                            {"formatted_gps_geolocation.has.magnetic_variation", true},
@@ -1176,8 +1182,8 @@ TEST_F(ReadIfContextTest, FormattedGpsGeolocationReserved) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_RESERVED);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), VRT_ERR_RESERVED);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_NONE), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_gps_geolocation", true}});
 }
@@ -1195,7 +1201,7 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationTsi) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true}, {"formatted_ins_geolocation.tsi", VRT_TSI_OTHER}});
 }
@@ -1213,7 +1219,7 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationTsf) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_, {{"has.formatted_ins_geolocation", true}, {"formatted_ins_geolocation.tsf", VRT_TSF_FREE_RUNNING_COUNT}});
@@ -1232,7 +1238,7 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationOui) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.oui", static_cast<uint32_t>(0x00FFFFFF)}});
@@ -1251,7 +1257,7 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationIntegerSecondTimestamp) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.tsi", VRT_TSI_UTC},
@@ -1271,8 +1277,8 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationIntegerSecondTimestampInvalid)
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_NONE), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.integer_second_timestamp", static_cast<uint32_t>(0xABABABAB)}});
@@ -1291,7 +1297,7 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationFractionalSecondTimestamp) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_, {{"has.formatted_ins_geolocation", true},
@@ -1312,8 +1318,8 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationFractionalSecondTimestampInvali
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_SET_FRACTIONAL_SECOND_TIMESTAMP);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), VRT_ERR_SET_FRACTIONAL_SECOND_TIMESTAMP);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_NONE), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_, {{"has.formatted_ins_geolocation", true},
@@ -1333,8 +1339,8 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationFractionalSecondTimestampInvali
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_REAL_TIME);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_REAL_TIME);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_NONE), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_, {{"has.formatted_ins_geolocation", true},
@@ -1355,7 +1361,7 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationLatitude) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.has.latitude", true},
@@ -1375,8 +1381,8 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationLatitudeInvalidSmall) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_LATITUDE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_LATITUDE);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_NONE), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.has.latitude", true},
@@ -1396,8 +1402,8 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationLatitudeInvalidLarge) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_LATITUDE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_LATITUDE);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_NONE), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.has.latitude", true},
@@ -1417,7 +1423,7 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationLongitude) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.has.longitude", true},
@@ -1437,8 +1443,8 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationLongitudeInvalidSmall) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_LONGITUDE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_LONGITUDE);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_NONE), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.has.longitude", true},
@@ -1458,8 +1464,8 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationLongitudeInvalidLarge) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_LONGITUDE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_LONGITUDE);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_NONE), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.has.longitude", true},
@@ -1479,7 +1485,7 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationAltitude) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.has.altitude", true},
@@ -1499,7 +1505,7 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationSpeedOverGround) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.has.speed_over_ground", true},
@@ -1519,7 +1525,7 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationHeadingAngle) {
     buf_[9]  = 0x00400000;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.has.heading_angle", true},
@@ -1539,8 +1545,8 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationHeadingAngleSmall) {
     buf_[9]  = 0xFFC00000;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_HEADING_ANGLE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_HEADING_ANGLE);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_NONE), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.has.heading_angle", true},
@@ -1560,8 +1566,8 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationHeadingAngleInvalidLarge) {
     buf_[9]  = 0x5A000000;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_HEADING_ANGLE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_HEADING_ANGLE);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_NONE), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.has.heading_angle", true},
@@ -1581,7 +1587,7 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationTrackAngle) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x00400000;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.has.track_angle", true},
@@ -1601,8 +1607,8 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationTrackAngleInvalidSmall) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0xFFC00000;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_TRACK_ANGLE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_TRACK_ANGLE);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_NONE), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.has.track_angle", true},
@@ -1622,8 +1628,8 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationTrackAngleInvalidLarge) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x5A000000;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_TRACK_ANGLE);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_TRACK_ANGLE);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_NONE), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.has.track_angle", true},
@@ -1643,7 +1649,7 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationMagneticVariation) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x00400000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.has.magnetic_variation", true},
@@ -1663,8 +1669,8 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationMagneticVariationInvalidSmall)
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0xD2C00000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_MAGNETIC_VARIATION);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_MAGNETIC_VARIATION);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_NONE), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.has.magnetic_variation", true},
@@ -1684,8 +1690,8 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationMagneticVariationInvalidLarge)
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x2D400000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_BOUNDS_MAGNETIC_VARIATION);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_MAGNETIC_VARIATION);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_NONE), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true},
                            {"formatted_ins_geolocation.has.magnetic_variation", true},
@@ -1705,8 +1711,8 @@ TEST_F(ReadIfContextTest, FormattedInsGeolocationReserved) {
     buf_[9]  = 0x7FFFFFFF;
     buf_[10] = 0x7FFFFFFF;
     buf_[11] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, true), VRT_ERR_RESERVED);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, false), 12);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_FULL), VRT_ERR_RESERVED);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 12, &c_, VRT_VALIDATION_NONE), 12);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.formatted_ins_geolocation", true}});
 }
@@ -1726,7 +1732,7 @@ TEST_F(ReadIfContextTest, EcefEphemerisTsi) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.ecef_ephemeris", true}, {"ecef_ephemeris.tsi", VRT_TSI_OTHER}});
 }
@@ -1746,7 +1752,7 @@ TEST_F(ReadIfContextTest, EcefEphemerisTsf) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.ecef_ephemeris", true}, {"ecef_ephemeris.tsf", VRT_TSF_FREE_RUNNING_COUNT}});
 }
@@ -1766,7 +1772,7 @@ TEST_F(ReadIfContextTest, EcefEphemerisEcefOui) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.ecef_ephemeris", true}, {"ecef_ephemeris.oui", static_cast<uint32_t>(0x00FFFFFF)}});
 }
@@ -1786,7 +1792,7 @@ TEST_F(ReadIfContextTest, EcefEphemerisIntegerSecondTimestamp) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.ecef_ephemeris", true},
                            {"ecef_ephemeris.tsi", VRT_TSI_UTC},
@@ -1808,8 +1814,8 @@ TEST_F(ReadIfContextTest, EcefEphemerisIntegerSecondTimestampInvalid) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, false), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_NONE), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.ecef_ephemeris", true},
                            {"ecef_ephemeris.integer_second_timestamp", static_cast<uint32_t>(0xABABABAB)}});
@@ -1830,7 +1836,7 @@ TEST_F(ReadIfContextTest, EcefEphemerisFractionalSecondTimestamp) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.ecef_ephemeris", true},
                            {"ecef_ephemeris.tsf", VRT_TSF_SAMPLE_COUNT},
@@ -1852,8 +1858,8 @@ TEST_F(ReadIfContextTest, EcefEphemerisFractionalSecondTimestampInvalid1) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), VRT_ERR_SET_FRACTIONAL_SECOND_TIMESTAMP);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, false), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), VRT_ERR_SET_FRACTIONAL_SECOND_TIMESTAMP);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_NONE), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.ecef_ephemeris", true},
                            {"ecef_ephemeris.fractional_second_timestamp", static_cast<uint64_t>(0x000000E8D4A50FFF)}});
@@ -1874,8 +1880,8 @@ TEST_F(ReadIfContextTest, EcefEphemerisFractionalSecondTimestampInvalid2) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), VRT_ERR_BOUNDS_REAL_TIME);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, false), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_REAL_TIME);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_NONE), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.ecef_ephemeris", true},
                            {"ecef_ephemeris.tsf", VRT_TSF_REAL_TIME},
@@ -1897,7 +1903,7 @@ TEST_F(ReadIfContextTest, EcefEphemerisPositionX) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_,
@@ -1919,7 +1925,7 @@ TEST_F(ReadIfContextTest, EcefEphemerisPositionY) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_,
@@ -1941,7 +1947,7 @@ TEST_F(ReadIfContextTest, EcefEphemerisPositionZ) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_,
@@ -1963,7 +1969,7 @@ TEST_F(ReadIfContextTest, EcefEphemerisAttitudeAlpha) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.ecef_ephemeris", true},
                            {"ecef_ephemeris.has.attitude_alpha", true},
@@ -1985,7 +1991,7 @@ TEST_F(ReadIfContextTest, EcefEphemerisAttitudeBeta) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.ecef_ephemeris", true},
                            {"ecef_ephemeris.has.attitude_beta", true},
@@ -2007,7 +2013,7 @@ TEST_F(ReadIfContextTest, EcefEphemerisAttitudePhi) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.ecef_ephemeris", true},
                            {"ecef_ephemeris.has.attitude_phi", true},
@@ -2029,7 +2035,7 @@ TEST_F(ReadIfContextTest, EcefEphemerisVelocityDx) {
     buf_[11] = 0x00010000;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_,
@@ -2051,7 +2057,7 @@ TEST_F(ReadIfContextTest, EcefEphemerisVelocityDy) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x00010000;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_,
@@ -2073,7 +2079,7 @@ TEST_F(ReadIfContextTest, EcefEphemerisVelocityDz) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x00010000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_,
@@ -2095,8 +2101,8 @@ TEST_F(ReadIfContextTest, EcefEphemerisReserved) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), VRT_ERR_RESERVED);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, false), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), VRT_ERR_RESERVED);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_NONE), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.ecef_ephemeris", true}});
 }
@@ -2116,7 +2122,7 @@ TEST_F(ReadIfContextTest, RelativeEphemerisTsi) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.relative_ephemeris", true}, {"relative_ephemeris.tsi", VRT_TSI_OTHER}});
 }
@@ -2136,7 +2142,7 @@ TEST_F(ReadIfContextTest, RelativeEphemerisTsf) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.relative_ephemeris", true}, {"relative_ephemeris.tsf", VRT_TSF_FREE_RUNNING_COUNT}});
 }
@@ -2156,7 +2162,7 @@ TEST_F(ReadIfContextTest, RelativeEphemerisEcefOui) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_, {{"has.relative_ephemeris", true}, {"relative_ephemeris.oui", static_cast<uint32_t>(0x00FFFFFF)}});
@@ -2177,7 +2183,7 @@ TEST_F(ReadIfContextTest, RelativeEphemerisIntegerSecondTimestamp) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.relative_ephemeris", true},
                            {"relative_ephemeris.tsi", VRT_TSI_UTC},
@@ -2199,8 +2205,8 @@ TEST_F(ReadIfContextTest, RelativeEphemerisIntegerSecondTimestampInvalid) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, false), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_NONE), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.relative_ephemeris", true},
                            {"relative_ephemeris.integer_second_timestamp", static_cast<uint32_t>(0xABABABAB)}});
@@ -2221,7 +2227,7 @@ TEST_F(ReadIfContextTest, RelativeEphemerisFractionalSecondTimestamp) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_,
                       {{"has.relative_ephemeris", true},
@@ -2244,8 +2250,8 @@ TEST_F(ReadIfContextTest, RelativeEphemerisFractionalSecondTimestampInvalid1) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), VRT_ERR_SET_FRACTIONAL_SECOND_TIMESTAMP);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, false), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), VRT_ERR_SET_FRACTIONAL_SECOND_TIMESTAMP);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_NONE), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_,
                       {{"has.relative_ephemeris", true},
@@ -2267,8 +2273,8 @@ TEST_F(ReadIfContextTest, RelativeEphemerisFractionalSecondTimestampInvalid2) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), VRT_ERR_BOUNDS_REAL_TIME);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, false), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_REAL_TIME);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_NONE), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_,
                       {{"has.relative_ephemeris", true},
@@ -2291,7 +2297,7 @@ TEST_F(ReadIfContextTest, RelativeEphemerisPositionX) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.relative_ephemeris", true},
                            {"relative_ephemeris.has.position_x", true},
@@ -2313,7 +2319,7 @@ TEST_F(ReadIfContextTest, RelativeEphemerisPositionY) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.relative_ephemeris", true},
                            {"relative_ephemeris.has.position_y", true},
@@ -2335,7 +2341,7 @@ TEST_F(ReadIfContextTest, RelativeEphemerisPositionZ) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.relative_ephemeris", true},
                            {"relative_ephemeris.has.position_z", true},
@@ -2357,7 +2363,7 @@ TEST_F(ReadIfContextTest, RelativeEphemerisAttitudeAlpha) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.relative_ephemeris", true},
                            {"relative_ephemeris.has.attitude_alpha", true},
@@ -2379,7 +2385,7 @@ TEST_F(ReadIfContextTest, RelativeEphemerisAttitudeBeta) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.relative_ephemeris", true},
                            {"relative_ephemeris.has.attitude_beta", true},
@@ -2401,7 +2407,7 @@ TEST_F(ReadIfContextTest, RelativeEphemerisAttitudePhi) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.relative_ephemeris", true},
                            {"relative_ephemeris.has.attitude_phi", true},
@@ -2423,7 +2429,7 @@ TEST_F(ReadIfContextTest, RelativeEphemerisVelocityDx) {
     buf_[11] = 0x00010000;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.relative_ephemeris", true},
                            {"relative_ephemeris.has.velocity_dx", true},
@@ -2445,7 +2451,7 @@ TEST_F(ReadIfContextTest, RelativeEphemerisVelocityDy) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x00010000;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.relative_ephemeris", true},
                            {"relative_ephemeris.has.velocity_dy", true},
@@ -2467,7 +2473,7 @@ TEST_F(ReadIfContextTest, RelativeEphemerisVelocityDz) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x00010000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.relative_ephemeris", true},
                            {"relative_ephemeris.has.velocity_dz", true},
@@ -2489,8 +2495,8 @@ TEST_F(ReadIfContextTest, RelativeEphemerisReserved) {
     buf_[11] = 0x7FFFFFFF;
     buf_[12] = 0x7FFFFFFF;
     buf_[13] = 0x7FFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, true), VRT_ERR_RESERVED);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, false), 14);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_FULL), VRT_ERR_RESERVED);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 14, &c_, VRT_VALIDATION_NONE), 14);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.relative_ephemeris", true}});
 }
@@ -2498,7 +2504,7 @@ TEST_F(ReadIfContextTest, RelativeEphemerisReserved) {
 TEST_F(ReadIfContextTest, EphemerisReferenceIdentifier) {
     buf_[0] = 0x00000400;
     buf_[1] = 0xFFFFFFFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, true), 2);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_,
                       {{"has.ephemeris_reference_identifier", true}, {"ephemeris_reference_identifier", 0xFFFFFFFF}});
@@ -2508,7 +2514,7 @@ TEST_F(ReadIfContextTest, GpsAsciiOui) {
     buf_[0] = 0x00000200;
     buf_[1] = 0x00FFFFFF;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_FULL), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.gps_ascii", true}, {"gps_ascii.oui", static_cast<uint32_t>(0x00FFFFFF)}});
 }
@@ -2519,7 +2525,7 @@ TEST_F(ReadIfContextTest, GpsAsciiAscii) {
     buf_[2] = 0x00000003;
     std::string str("Raspberry c");
     std::memcpy(buf_.data() + 3, str.c_str(), 3 * 4);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 6, &c_, true), 6);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 6, &c_, VRT_VALIDATION_FULL), 6);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.gps_ascii", true},
                            {"gps_ascii.number_of_words", static_cast<uint32_t>(0x00000003)},
@@ -2531,17 +2537,33 @@ TEST_F(ReadIfContextTest, GpsAsciiReserved) {
     buf_[0] = 0x00000200;
     buf_[1] = 0xFF000000;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), VRT_ERR_RESERVED);
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, false), 3);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_FULL), VRT_ERR_RESERVED);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_NONE), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.gps_ascii", true}});
 }
 
+TEST_F(ReadIfContextTest, GpsAsciiOutsideBuffer) {
+    buf_[0] = 0x00000200;
+    buf_[1] = 0x00000000;
+    buf_[2] = 0x7FFFFFFF;
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+}
+
+TEST_F(ReadIfContextTest, ContextAssocationListsOutsideBuffer) {
+    buf_[0] = 0x00000100;
+    buf_[1] = 0x01FF01FF;
+    buf_[2] = 0x00000000;
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 2, &c_, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+}
+
 TEST_F(ReadIfContextTest, ContextAssocationListsEmpty) {
     buf_[0] = 0x00000100;
     buf_[1] = 0x00000000;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_FULL), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.context_association_lists", true}});
 }
@@ -2550,7 +2572,7 @@ TEST_F(ReadIfContextTest, ContextAssocationListsSource) {
     buf_[0] = 0x00000100;
     buf_[1] = 0xFFFF0000;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 514, &c_, true), 514);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 514, &c_, VRT_VALIDATION_FULL), 514);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.context_association_lists", true},
                            {"context_association_lists.source_list_size", static_cast<uint16_t>(0x01FF)},
@@ -2562,7 +2584,7 @@ TEST_F(ReadIfContextTest, ContextAssocationListsSystem) {
     buf_[0] = 0x00000100;
     buf_[1] = 0x0000FFFF;
     buf_[2] = 0x00000000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 514, &c_, true), 514);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 514, &c_, VRT_VALIDATION_FULL), 514);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.context_association_lists", true},
                            {"context_association_lists.system_list_size", static_cast<uint16_t>(0x01FF)},
@@ -2574,7 +2596,7 @@ TEST_F(ReadIfContextTest, ContextAssocationListsVectorComponent) {
     buf_[0] = 0x00000100;
     buf_[1] = 0x00000000;
     buf_[2] = 0xFFFF0000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 65538, &c_, true), 65538);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 65538, &c_, VRT_VALIDATION_FULL), 65538);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.context_association_lists", true},
                            {"context_association_lists.vector_component_list_size", static_cast<uint16_t>(0xFFFF)},
@@ -2586,7 +2608,7 @@ TEST_F(ReadIfContextTest, ContextAssocationListsHasChannelTag) {
     buf_[0] = 0x00000100;
     buf_[1] = 0x00000000;
     buf_[2] = 0x00008000;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, true), 3);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 3, &c_, VRT_VALIDATION_FULL), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.context_association_lists", true},
                            {"context_association_lists.has.asynchronous_channel_tag_list", true}});
@@ -2596,7 +2618,7 @@ TEST_F(ReadIfContextTest, ContextAssocationListsContextAssociation) {
     buf_[0] = 0x00000100;
     buf_[1] = 0x00000000;
     buf_[2] = 0x00007FFF;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 32770, &c_, true), 32770);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 32770, &c_, VRT_VALIDATION_FULL), 32770);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.context_association_lists", true},
                            {"context_association_lists.asynchronous_channel_list_size", static_cast<uint16_t>(0x7FFF)},
@@ -2608,7 +2630,7 @@ TEST_F(ReadIfContextTest, ContextAssocationListsContextChannelTag) {
     buf_[0] = 0x00000100;
     buf_[1] = 0x00000000;
     buf_[2] = 0x00008003;
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 9, &c_, true), 9);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 9, &c_, VRT_VALIDATION_FULL), 9);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"has.context_association_lists", true},
                            {"context_association_lists.has.asynchronous_channel_tag_list", true},
@@ -2665,7 +2687,7 @@ TEST_F(ReadIfContextTest, EveryOther1) {
     buf_[42] = 0x5A5A5A5A;
     buf_[43] = 0x5A5A5A5A; /* GPS ASCII */
 
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 44, &c_, true), 44);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 44, &c_, VRT_VALIDATION_FULL), 44);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(c_, {{"context_field_change_indicator", true},
                            {"has.bandwidth", true},
@@ -2797,7 +2819,7 @@ TEST_F(ReadIfContextTest, EveryOther2) {
     buf_[42] = 0x5A5A5A5A;
     buf_[43] = 0x5A5A5A5A; /* Context association lists */
 
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 44, &c_, true), 44);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 44, &c_, VRT_VALIDATION_FULL), 44);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_,
@@ -2989,7 +3011,7 @@ TEST_F(ReadIfContextTest, All) {
     buf_[85] = 0x5A5A5A5A;
     buf_[86] = 0x5A5A5A5A; /* Context association lists */
 
-    ASSERT_EQ(vrt_read_if_context(buf_.data(), 87, &c_, true), 87);
+    ASSERT_EQ(vrt_read_if_context(buf_.data(), 87, &c_, VRT_VALIDATION_FULL), 87);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_if_context(
         c_,
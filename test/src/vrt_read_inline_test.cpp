@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#include <vrt/vrt_byte_swap.h>
+#include <vrt/vrt_error_code.h>
+#include <vrt/vrt_read.h>
+#include <vrt/vrt_read_inline.h>
+#include <vrt/vrt_types.h>
+#include <vrt/vrt_util.h>
+
+class ReadInlineTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        std::memset(&lib_, 0, sizeof(lib_));
+        std::memset(&inl_, 0, sizeof(inl_));
+        buf_.fill(0xBAADF00D);
+    }
+
+    /**
+     * Byte swap buffer in place if platform is little endian, i.e. convert it to network order.
+     */
+    void to_network() {
+        if (vrt_is_platform_little_endian()) {
+            vrt_byte_swap(buf_.data(), buf_.data(), buf_.size());
+        }
+    }
+
+    /**
+     * Assert that the library and inline functions decoded the same.
+     */
+    void assert_same() { ASSERT_EQ(std::memcmp(&lib_, &inl_, sizeof(lib_)), 0); }
+
+    /**
+     * Header words to test with, covering all packet types, indicator bits, and reserved bits.
+     */
+    static uint32_t header_word(uint32_t i) { return (i << 20U) | 0x00050003U; }
+
+    static constexpr uint32_t       n_headers_{1U << 12U};
+    static constexpr vrt_validation levels_[3]{VRT_VALIDATION_NONE, VRT_VALIDATION_STRUCTURAL, VRT_VALIDATION_FULL};
+    vrt_packet                      lib_{};
+    vrt_packet                      inl_{};
+    std::array<uint32_t, 8>         buf_{};
+};
+
+TEST_F(ReadInlineTest, Header) {
+    for (vrt_validation v : levels_) {
+        for (uint32_t i = 0; i < n_headers_; ++i) {
+            buf_[0] = header_word(i);
+            ASSERT_EQ(vrt_read_header_inline(buf_.data(), buf_.size(), &inl_.header, v),
+                      vrt_read_header(buf_.data(), buf_.size(), &lib_.header, v))
+                << "header " << buf_[0] << ", validate " << v;
+            assert_same();
+        }
+    }
+}
+
+TEST_F(ReadInlineTest, HeaderBufferSize) {
+    ASSERT_EQ(vrt_read_header_inline(buf_.data(), 0, &inl_.header, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+}
+
+TEST_F(ReadInlineTest, HeaderBe) {
+    for (uint32_t i = 0; i < n_headers_; ++i) {
+        buf_[0] = header_word(i);
+        to_network();
+        ASSERT_EQ(vrt_read_header_be_inline(buf_.data(), buf_.size(), &inl_.header, VRT_VALIDATION_FULL),
+                  vrt_read_header_be(buf_.data(), buf_.size(), &lib_.header, VRT_VALIDATION_FULL));
+        assert_same();
+    }
+}
+
+TEST_F(ReadInlineTest, Fields) {
+    buf_ = {0x12345678, 0xFF123456, 0x9ABCDEF0, 0x11111111, 0x000000E8, 0xD4A51000, 0, 0};
+    for (vrt_validation v : levels_) {
+        for (uint32_t i = 0; i < n_headers_; ++i) {
+            uint32_t h = header_word(i);
+            ASSERT_EQ(vrt_read_header(&h, 1, &lib_.header, VRT_VALIDATION_NONE), 1);
+            inl_.header = lib_.header;
+            ASSERT_EQ(vrt_read_fields_inline(&inl_.header, buf_.data(), buf_.size(), &inl_.fields, v),
+                      vrt_read_fields(&lib_.header, buf_.data(), buf_.size(), &lib_.fields, v))
+                << "header " << header_word(i) << ", validate " << v;
+            assert_same();
+        }
+    }
+}
+
+TEST_F(ReadInlineTest, FieldsBufferSize) {
+    inl_.header.packet_type = VRT_PT_IF_DATA_WITH_STREAM_ID;
+    ASSERT_EQ(vrt_read_fields_inline(&inl_.header, buf_.data(), 0, &inl_.fields, VRT_VALIDATION_FULL),
+              VRT_ERR_BUFFER_SIZE);
+}
+
+TEST_F(ReadInlineTest, FieldsBe) {
+    buf_ = {0x12345678, 0x00123456, 0x9ABCDEF0, 0x11111111, 0x000000E8, 0xD4A50FFF, 0, 0};
+    to_network();
+    for (uint32_t i = 0; i < n_headers_; ++i) {
+        uint32_t h = header_word(i);
+        ASSERT_EQ(vrt_read_header(&h, 1, &lib_.header, VRT_VALIDATION_NONE), 1);
+        inl_.header = lib_.header;
+        ASSERT_EQ(vrt_read_fields_be_inline(&inl_.header, buf_.data(), buf_.size(), &inl_.fields, VRT_VALIDATION_FULL),
+                  vrt_read_fields_be(&lib_.header, buf_.data(), buf_.size(), &lib_.fields, VRT_VALIDATION_FULL));
+        assert_same();
+    }
+}
+
+TEST_F(ReadInlineTest, Trailer) {
+    for (uint32_t i = 0; i < 0x10000; ++i) {
+        buf_[0] = (i * 0x00010001U) ^ 0x5A5A0000U;
+        ASSERT_EQ(vrt_read_trailer_inline(buf_.data(), buf_.size(), &inl_.trailer),
+                  vrt_read_trailer(buf_.data(), buf_.size(), &lib_.trailer))
+            << "trailer " << buf_[0];
+        assert_same();
+    }
+}
+
+TEST_F(ReadInlineTest, TrailerBufferSize) {
+    ASSERT_EQ(vrt_read_trailer_inline(buf_.data(), 0, &inl_.trailer), VRT_ERR_BUFFER_SIZE);
+}
+
+TEST_F(ReadInlineTest, TrailerBe) {
+    buf_[0] = 0xCAFEBABE;
+    to_network();
+    ASSERT_EQ(vrt_read_trailer_be_inline(buf_.data(), buf_.size(), &inl_.trailer),
+              vrt_read_trailer_be(buf_.data(), buf_.size(), &lib_.trailer));
+    assert_same();
+}
@@ -25,19 +25,19 @@ class ReadPacketTest : public ::testing::Test {
 };
 
 TEST_F(ReadPacketTest, NegativeSizeBuffer) {
-    ASSERT_EQ(vrt_read_packet(buf_.data(), -1, &p_, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_read_packet(buf_.data(), -1, &p_, false), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), -1, &p_, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), -1, &p_, VRT_VALIDATION_NONE), VRT_ERR_BUFFER_SIZE);
 }
 
 TEST_F(ReadPacketTest, ZeroSizeBuffer) {
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 0, &p_, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 0, &p_, false), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 0, &p_, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 0, &p_, VRT_VALIDATION_NONE), VRT_ERR_BUFFER_SIZE);
 }
 
 TEST_F(ReadPacketTest, EmptyIfDataWithoutStreamId) {
     buf_[0] = 0x00000001;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 1, &p_, true), 1);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 1, &p_, VRT_VALIDATION_FULL), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(p_.header, {{"packet_size", static_cast<uint16_t>(1)}});
     assert_fields(p_.fields, {});
@@ -49,7 +49,7 @@ TEST_F(ReadPacketTest, EmptyIfDataWithStreamId) {
     buf_[0] = 0x10000002;
     buf_[1] = 0xABABABAB;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 2, &p_, true), 2);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 2, &p_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(p_.header,
                   {{"packet_type", VRT_PT_IF_DATA_WITH_STREAM_ID}, {"packet_size", static_cast<uint16_t>(2)}});
@@ -61,7 +61,7 @@ TEST_F(ReadPacketTest, EmptyIfDataWithStreamId) {
 TEST_F(ReadPacketTest, EmptyExtDataWithoutStreamId) {
     buf_[0] = 0x20000001;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 1, &p_, true), 1);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 1, &p_, VRT_VALIDATION_FULL), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(p_.header,
                   {{"packet_type", VRT_PT_EXT_DATA_WITHOUT_STREAM_ID}, {"packet_size", static_cast<uint16_t>(1)}});
@@ -74,7 +74,7 @@ TEST_F(ReadPacketTest, EmptyExtDataWithStreamId) {
     buf_[0] = 0x30000002;
     buf_[1] = 0xABABABAB;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 2, &p_, true), 2);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 2, &p_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(p_.header,
                   {{"packet_type", VRT_PT_EXT_DATA_WITH_STREAM_ID}, {"packet_size", static_cast<uint16_t>(2)}});
@@ -88,7 +88,7 @@ TEST_F(ReadPacketTest, EmptyIfContext) {
     buf_[1] = 0xABABABAB;
     buf_[2] = 0x00000000;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, true), 3);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, VRT_VALIDATION_FULL), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(p_.header, {{"packet_type", VRT_PT_IF_CONTEXT}, {"packet_size", static_cast<uint16_t>(3)}});
     assert_fields(p_.fields, {{"stream_id", 0xABABABAB}});
@@ -101,7 +101,7 @@ TEST_F(ReadPacketTest, EmptyExtContext) {
     buf_[0] = 0x50000002;
     buf_[1] = 0xABABABAB;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 2, &p_, true), 2);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 2, &p_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(p_.header, {{"packet_type", VRT_PT_EXT_CONTEXT}, {"packet_size", static_cast<uint16_t>(2)}});
     assert_fields(p_.fields, {{"stream_id", 0xABABABAB}});
@@ -115,7 +115,7 @@ TEST_F(ReadPacketTest, BodyIfDataWithoutStreamId) {
     buf_[2] = 0xFEFEFEFE;
     buf_[3] = 0xDEDEDEDE;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 4, &p_, true), 4);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 4, &p_, VRT_VALIDATION_FULL), 4);
     assert_header(p_.header, {{"packet_size", static_cast<uint16_t>(4)}});
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_fields(p_.fields, {});
@@ -133,7 +133,7 @@ TEST_F(ReadPacketTest, BodyIfDataWithStreamId) {
     buf_[3] = 0xFEFEFEFE;
     buf_[4] = 0xDEDEDEDE;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 5, &p_, true), 5);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 5, &p_, VRT_VALIDATION_FULL), 5);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(p_.header,
                   {{"packet_type", VRT_PT_IF_DATA_WITH_STREAM_ID}, {"packet_size", static_cast<uint16_t>(5)}});
@@ -151,7 +151,7 @@ TEST_F(ReadPacketTest, BodyExtDataWithoutStreamId) {
     buf_[2] = 0xFEFEFEFE;
     buf_[3] = 0xDEDEDEDE;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 4, &p_, true), 4);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 4, &p_, VRT_VALIDATION_FULL), 4);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(p_.header,
                   {{"packet_type", VRT_PT_EXT_DATA_WITHOUT_STREAM_ID}, {"packet_size", static_cast<uint16_t>(4)}});
@@ -170,7 +170,7 @@ TEST_F(ReadPacketTest, BodyExtDataWithStreamId) {
     buf_[3] = 0xFEFEFEFE;
     buf_[4] = 0xDEDEDEDE;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 5, &p_, true), 5);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 5, &p_, VRT_VALIDATION_FULL), 5);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(p_.header,
                   {{"packet_type", VRT_PT_EXT_DATA_WITH_STREAM_ID}, {"packet_size", static_cast<uint16_t>(5)}});
@@ -187,7 +187,7 @@ TEST_F(ReadPacketTest, BodyIfContext) {
     buf_[1] = 0xABABABAB;
     buf_[2] = 0x00000000;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, true), 3);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, VRT_VALIDATION_FULL), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(p_.header, {{"packet_type", VRT_PT_IF_CONTEXT}, {"packet_size", static_cast<uint16_t>(3)}});
     assert_fields(p_.fields, {{"stream_id", 0xABABABAB}});
@@ -203,7 +203,7 @@ TEST_F(ReadPacketTest, BodyExtContext) {
     buf_[3] = 0xFEFEFEFE;
     buf_[4] = 0xDEDEDEDE;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 5, &p_, true), 5);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 5, &p_, VRT_VALIDATION_FULL), 5);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(p_.header, {{"packet_type", VRT_PT_EXT_CONTEXT}, {"packet_size", static_cast<uint16_t>(5)}});
     assert_fields(p_.fields, {{"stream_id", 0xABABABAB}});
@@ -219,15 +219,15 @@ TEST_F(ReadPacketTest, BodyErrBufferSize) {
     buf_[1] = 0xCECECECE;
     buf_[2] = 0xFEFEFEFE;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 2, &p_, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 2, &p_, false), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 2, &p_, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 2, &p_, VRT_VALIDATION_NONE), VRT_ERR_BUFFER_SIZE);
 }
 
 TEST_F(ReadPacketTest, TrailerIfDataWithoutStreamId) {
     buf_[0] = 0x04000002;
     buf_[1] = 0x01001000;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 2, &p_, true), 2);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 2, &p_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(p_.header, {{"has.trailer", true}, {"packet_size", static_cast<uint16_t>(2)}});
     assert_fields(p_.fields, {});
@@ -241,7 +241,7 @@ TEST_F(ReadPacketTest, TrailerIfDataWithStreamId) {
     buf_[1] = 0xABABABAB;
     buf_[2] = 0x01001000;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, true), 3);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, VRT_VALIDATION_FULL), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(p_.header, {{"packet_type", VRT_PT_IF_DATA_WITH_STREAM_ID},
                               {"has.trailer", true},
@@ -256,7 +256,7 @@ TEST_F(ReadPacketTest, TrailerExtDataWithoutStreamId) {
     buf_[0] = 0x24000002;
     buf_[1] = 0x01001000;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 2, &p_, true), 2);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 2, &p_, VRT_VALIDATION_FULL), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(p_.header, {{"packet_type", VRT_PT_EXT_DATA_WITHOUT_STREAM_ID},
                               {"has.trailer", true},
@@ -271,7 +271,7 @@ TEST_F(ReadPacketTest, TrailerExtDataWithStreamId) {
     buf_[1] = 0xABABABAB;
     buf_[2] = 0x01001000;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, true), 3);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, VRT_VALIDATION_FULL), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(p_.header, {{"packet_type", VRT_PT_EXT_DATA_WITH_STREAM_ID},
                               {"has.trailer", true},
@@ -287,8 +287,8 @@ TEST_F(ReadPacketTest, TrailerIfContext) {
     buf_[1] = 0xABABABAB;
     buf_[2] = 0x00000000;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, true), VRT_ERR_TRAILER_IN_CONTEXT);
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, false), 3);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, VRT_VALIDATION_FULL), VRT_ERR_TRAILER_IN_CONTEXT);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, VRT_VALIDATION_NONE), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(
         p_.header,
@@ -303,8 +303,8 @@ TEST_F(ReadPacketTest, TrailerExtContext) {
     buf_[0] = 0x54000002;
     buf_[1] = 0xABABABAB;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 2, &p_, true), VRT_ERR_TRAILER_IN_CONTEXT);
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 2, &p_, false), 2);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 2, &p_, VRT_VALIDATION_FULL), VRT_ERR_TRAILER_IN_CONTEXT);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 2, &p_, VRT_VALIDATION_NONE), 2);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(
         p_.header,
@@ -317,8 +317,9 @@ TEST_F(ReadPacketTest, TrailerExtContext) {
 TEST_F(ReadPacketTest, ValidationHeader) {
     buf_[0] = 0x02000001;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 1, &p_, true), VRT_ERR_RESERVED);
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 1, &p_, false), 1);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 1, &p_, VRT_VALIDATION_FULL), VRT_ERR_RESERVED);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 1, &p_, VRT_VALIDATION_STRUCTURAL), VRT_ERR_RESERVED);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 1, &p_, VRT_VALIDATION_NONE), 1);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(p_.header, {{"packet_size", static_cast<uint16_t>(1)}});
     ASSERT_EQ(p_.words_body, 0);
@@ -329,8 +330,9 @@ TEST_F(ReadPacketTest, ValidationFields) {
     buf_[0] = 0x00200003;
     buf_[1] = 0xFFFFFFFF;
     buf_[2] = 0xFFFFFFFF;
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, true), VRT_ERR_BOUNDS_REAL_TIME);
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, false), 3);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_REAL_TIME);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, VRT_VALIDATION_STRUCTURAL), 3);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, VRT_VALIDATION_NONE), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     ASSERT_EQ(Hex(p_.header.packet_type), Hex(VRT_PT_IF_DATA_WITHOUT_STREAM_ID));
 
@@ -346,8 +348,8 @@ TEST_F(ReadPacketTest, ValidationIfContext) {
     buf_[2] = 0x00200000;
     buf_[3] = 0xFFFFFFFF;
     buf_[4] = 0xFFF00000;
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 5, &p_, true), VRT_ERR_BOUNDS_SAMPLE_RATE);
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 5, &p_, false), 5);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 5, &p_, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_SAMPLE_RATE);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 5, &p_, VRT_VALIDATION_NONE), 5);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     ASSERT_TRUE(p_.if_context.has.sample_rate);
     ASSERT_DOUBLE_EQ(p_.if_context.sample_rate, -1.0);
@@ -363,7 +365,8 @@ TEST_F(ReadPacketTest, ValidationPacketSizeMismatch1) {
     buf_[0] = 0x04000001;
     buf_[1] = 0x01001000;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, true), VRT_ERR_MISMATCH_PACKET_SIZE);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, VRT_VALIDATION_FULL), VRT_ERR_MISMATCH_PACKET_SIZE);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, VRT_VALIDATION_STRUCTURAL), VRT_ERR_MISMATCH_PACKET_SIZE);
 }
 
 TEST_F(ReadPacketTest, ValidationPacketSizeMismatch2) {
@@ -371,8 +374,8 @@ TEST_F(ReadPacketTest, ValidationPacketSizeMismatch2) {
     buf_[1] = 0xABABABAB;
     buf_[2] = 0x00000000;
 
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, true), VRT_ERR_MISMATCH_PACKET_SIZE);
-    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, false), 3);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, VRT_VALIDATION_FULL), VRT_ERR_MISMATCH_PACKET_SIZE);
+    ASSERT_EQ(vrt_read_packet(buf_.data(), 3, &p_, VRT_VALIDATION_NONE), 3);
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     assert_header(p_.header, {{"packet_type", VRT_PT_IF_CONTEXT}, {"packet_size", static_cast<uint16_t>(4)}});
     assert_fields(p_.fields, {{"stream_id", 0xABABABAB}});
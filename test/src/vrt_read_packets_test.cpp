@@ -0,0 +1,182 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+
+#include <vrt/vrt_byte_swap.h>
+#include <vrt/vrt_error_code.h>
+#include <vrt/vrt_read.h>
+#include <vrt/vrt_types.h>
+#include <vrt/vrt_util.h>
+
+class ReadPacketsTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        buf_.fill(0xBAADF00D);
+        descs_.fill({});
+    }
+
+    std::array<uint32_t, 16>             buf_{};
+    std::array<vrt_packet_descriptor, 4> descs_{};
+    int32_t                              words_read_{-1};
+};
+
+TEST_F(ReadPacketsTest, NegativeSizeBuffer) {
+    ASSERT_EQ(vrt_read_packets(buf_.data(), -1, descs_.data(), descs_.size(), &words_read_, VRT_VALIDATION_FULL), 0);
+    ASSERT_EQ(words_read_, 0);
+}
+
+TEST_F(ReadPacketsTest, ZeroSizeBuffer) {
+    ASSERT_EQ(vrt_read_packets(buf_.data(), 0, descs_.data(), descs_.size(), &words_read_, VRT_VALIDATION_FULL), 0);
+    ASSERT_EQ(words_read_, 0);
+}
+
+TEST_F(ReadPacketsTest, ZeroDescriptors) {
+    buf_[0] = 0x00000001;
+    ASSERT_EQ(vrt_read_packets(buf_.data(), 1, descs_.data(), 0, &words_read_, VRT_VALIDATION_FULL), 0);
+    ASSERT_EQ(words_read_, 0);
+}
+
+TEST_F(ReadPacketsTest, SinglePacket) {
+    buf_[0] = 0x14000004;
+    buf_[1] = 0xABABABAB;
+    buf_[2] = 0xCDCDCDCD;
+    buf_[3] = 0x40000000;
+
+    ASSERT_EQ(vrt_read_packets(buf_.data(), 4, descs_.data(), descs_.size(), &words_read_, VRT_VALIDATION_FULL), 1);
+    ASSERT_EQ(words_read_, 4);
+    ASSERT_EQ(descs_[0].offset, 0);
+    ASSERT_EQ(descs_[0].words, 4);
+    ASSERT_EQ(descs_[0].header.packet_type, VRT_PT_IF_DATA_WITH_STREAM_ID);
+    ASSERT_TRUE(descs_[0].header.has.trailer);
+    ASSERT_EQ(descs_[0].header.packet_size, 4);
+    ASSERT_EQ(descs_[0].fields.stream_id, 0xABABABAB);
+    ASSERT_EQ(descs_[0].words_body, 1);
+    ASSERT_EQ(descs_[0].body, buf_.data() + 2);
+    ASSERT_TRUE(descs_[0].trailer.has.valid_data);
+    ASSERT_FALSE(descs_[0].trailer.valid_data);
+}
+
+TEST_F(ReadPacketsTest, MultiplePackets) {
+    buf_[0] = 0x10000003;
+    buf_[1] = 0x00000001;
+    buf_[2] = 0xABABABAB;
+    buf_[3] = 0x00000001;
+    buf_[4] = 0x10800004;
+    buf_[5] = 0x00000002;
+    buf_[6] = 0x12345678;
+    buf_[7] = 0xCDCDCDCD;
+
+    ASSERT_EQ(vrt_read_packets(buf_.data(), 8, descs_.data(), descs_.size(), &words_read_, VRT_VALIDATION_FULL), 3);
+    ASSERT_EQ(words_read_, 8);
+
+    ASSERT_EQ(descs_[0].offset, 0);
+    ASSERT_EQ(descs_[0].words, 3);
+    ASSERT_EQ(descs_[0].fields.stream_id, 1);
+    ASSERT_EQ(descs_[0].words_body, 1);
+    ASSERT_EQ(descs_[0].body, buf_.data() + 2);
+    ASSERT_FALSE(descs_[0].trailer.has.valid_data);
+
+    ASSERT_EQ(descs_[1].offset, 3);
+    ASSERT_EQ(descs_[1].words, 1);
+    ASSERT_EQ(descs_[1].header.packet_type, VRT_PT_IF_DATA_WITHOUT_STREAM_ID);
+    ASSERT_EQ(descs_[1].words_body, 0);
+    ASSERT_EQ(descs_[1].body, nullptr);
+
+    ASSERT_EQ(descs_[2].offset, 4);
+    ASSERT_EQ(descs_[2].words, 4);
+    ASSERT_EQ(descs_[2].header.tsi, VRT_TSI_GPS);
+    ASSERT_EQ(descs_[2].fields.stream_id, 2);
+    ASSERT_EQ(descs_[2].fields.integer_seconds_timestamp, 0x12345678);
+    ASSERT_EQ(descs_[2].words_body, 1);
+    ASSERT_EQ(descs_[2].body, buf_.data() + 7);
+}
+
+TEST_F(ReadPacketsTest, StopAtDescriptorCount) {
+    buf_[0] = 0x00000001;
+    buf_[1] = 0x00000001;
+    buf_[2] = 0x00000001;
+
+    ASSERT_EQ(vrt_read_packets(buf_.data(), 3, descs_.data(), 2, &words_read_, VRT_VALIDATION_FULL), 2);
+    ASSERT_EQ(words_read_, 2);
+}
+
+TEST_F(ReadPacketsTest, StopAtPartialTail) {
+    buf_[0] = 0x00000002;
+    buf_[1] = 0xABABABAB;
+    buf_[2] = 0x10000005;
+    buf_[3] = 0x00000001;
+
+    ASSERT_EQ(vrt_read_packets(buf_.data(), 4, descs_.data(), descs_.size(), &words_read_, VRT_VALIDATION_FULL), 1);
+    ASSERT_EQ(words_read_, 2);
+    ASSERT_EQ(descs_[0].words, 2);
+}
+
+TEST_F(ReadPacketsTest, IfContext) {
+    buf_[0] = 0x40000005;
+    buf_[1] = 0x00000001;
+    buf_[2] = 0x20000000;
+    buf_[3] = 0x00000000;
+    buf_[4] = 0x00100000;
+
+    ASSERT_EQ(vrt_read_packets(buf_.data(), 5, descs_.data(), descs_.size(), &words_read_, VRT_VALIDATION_FULL), 1);
+    ASSERT_EQ(words_read_, 5);
+    ASSERT_EQ(descs_[0].header.packet_type, VRT_PT_IF_CONTEXT);
+    ASSERT_EQ(descs_[0].words_body, 3);
+    ASSERT_EQ(descs_[0].body, buf_.data() + 2);
+}
+
+TEST_F(ReadPacketsTest, InvalidHeader) {
+    buf_[0] = 0x00000001;
+    buf_[1] = 0x70000001;
+
+    ASSERT_EQ(vrt_read_packets(buf_.data(), 2, descs_.data(), descs_.size(), &words_read_, VRT_VALIDATION_FULL),
+              VRT_ERR_INVALID_PACKET_TYPE);
+    ASSERT_EQ(words_read_, 1);
+    ASSERT_EQ(descs_[0].words, 1);
+}
+
+TEST_F(ReadPacketsTest, FieldsOutsidePacket) {
+    buf_[0] = 0x10000001;
+    buf_[1] = 0xABABABAB;
+
+    ASSERT_EQ(vrt_read_packets(buf_.data(), 2, descs_.data(), descs_.size(), &words_read_, VRT_VALIDATION_FULL),
+              VRT_ERR_MISMATCH_PACKET_SIZE);
+    ASSERT_EQ(words_read_, 0);
+    ASSERT_EQ(vrt_read_packets(buf_.data(), 2, descs_.data(), descs_.size(), &words_read_, VRT_VALIDATION_NONE),
+              VRT_ERR_MISMATCH_PACKET_SIZE);
+}
+
+TEST_F(ReadPacketsTest, ZeroPacketSize) {
+    buf_[0] = 0x00000000;
+
+    ASSERT_EQ(vrt_read_packets(buf_.data(), 1, descs_.data(), descs_.size(), &words_read_, VRT_VALIDATION_NONE),
+              VRT_ERR_MISMATCH_PACKET_SIZE);
+    ASSERT_EQ(words_read_, 0);
+}
+
+TEST_F(ReadPacketsTest, TrailerOutsidePacket) {
+    buf_[0] = 0x04000001;
+    buf_[1] = 0x00000000;
+
+    ASSERT_EQ(vrt_read_packets(buf_.data(), 2, descs_.data(), descs_.size(), &words_read_, VRT_VALIDATION_FULL),
+              VRT_ERR_MISMATCH_PACKET_SIZE);
+}
+
+TEST_F(ReadPacketsTest, NetworkByteOrder) {
+    buf_[0] = 0x00000002;
+    buf_[1] = 0xABABABAB;
+    buf_[2] = 0x10000002;
+    buf_[3] = 0x00000002;
+    if (vrt_is_platform_little_endian()) {
+        vrt_byte_swap(buf_.data(), buf_.data(), 4);
+    }
+
+    ASSERT_EQ(vrt_read_packets_be(buf_.data(), 4, descs_.data(), descs_.size(), &words_read_, VRT_VALIDATION_FULL), 2);
+    ASSERT_EQ(words_read_, 4);
+    ASSERT_EQ(descs_[0].header.packet_type, VRT_PT_IF_DATA_WITHOUT_STREAM_ID);
+    ASSERT_EQ(descs_[0].words, 2);
+    ASSERT_EQ(descs_[0].body, buf_.data() + 1);
+    ASSERT_EQ(descs_[1].header.packet_type, VRT_PT_IF_DATA_WITH_STREAM_ID);
+    ASSERT_EQ(descs_[1].fields.stream_id, 2);
+}
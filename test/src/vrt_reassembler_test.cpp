@@ -0,0 +1,289 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include <vrt/vrt_error_code.h>
+#include <vrt/vrt_init.h>
+#include <vrt/vrt_packetizer.h>
+#include <vrt/vrt_read.h>
+#include <vrt/vrt_reassembler.h>
+#include <vrt/vrt_types.h>
+#include <vrt/vrt_words.h>
+
+class ReassemblerTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        vrt_init_header(&h_);
+        vrt_init_fields(&f_);
+        h_.packet_type               = VRT_PT_IF_DATA_WITH_STREAM_ID;
+        h_.tsi                       = VRT_TSI_UTC;
+        h_.tsf                       = VRT_TSF_SAMPLE_COUNT;
+        f_.integer_seconds_timestamp = 100;
+        fmt_.packing_method          = VRT_PM_PROCESSING_EFFICIENT;
+        fmt_.real_or_complex         = VRT_ROC_COMPLEX_CARTESIAN;
+        fmt_.data_item_format        = VRT_DIF_SIGNED_FIXED_POINT;
+        fmt_.item_packing_field_size = 15;
+        fmt_.data_item_size          = 15;
+    }
+
+    /**
+     * Packetize n complex samples, 20 per packet, with distinct values, and read the packets back.
+     */
+    void packetize(int32_t n, double sample_rate = 1000.0) {
+        vrt_packetizer p{};
+        const int32_t  words_packet = 1 + vrt_words_fields(&h_) + 20;
+        ASSERT_EQ(vrt_init_packetizer(&h_, &f_, nullptr, &fmt_, kScale, sample_rate, words_packet, &p,
+                                      VRT_VALIDATION_FULL),
+                  20);
+        src_.resize(2 * n);
+        for (int32_t i = 0; i < 2 * n; ++i) {
+            src_[i] = static_cast<float>(i % 1000 + 1) * kScale;
+        }
+        buf_.resize(4096);
+        const int32_t words = vrt_packetize_float(&p, src_.data(), 2 * n, buf_.data(), buf_.size());
+        ASSERT_GT(words, 0);
+
+        descriptors_.resize(64);
+        int32_t       words_read = 0;
+        const int32_t packets    = vrt_read_packets(buf_.data(), words, descriptors_.data(), descriptors_.size(),
+                                                    &words_read, VRT_VALIDATION_FULL);
+        ASSERT_EQ(packets, (n + 19) / 20);
+        descriptors_.resize(packets);
+    }
+
+    /**
+     * Reassemble packet i into ring.
+     */
+    int32_t reassemble(std::size_t i) {
+        const vrt_packet_descriptor& d = descriptors_[i];
+        return vrt_reassemble(&r_, &d.header, &d.fields, d.body, d.words_body);
+    }
+
+    /**
+     * Check that ring holds source items from item offset, for n items from ring item index.
+     */
+    void check_ring(uint64_t index, int32_t offset, int32_t n) {
+        for (int32_t i = 0; i < n; ++i) {
+            ASSERT_EQ(ring_[(index + i) & r_.mask], src_[offset + i]) << "item " << i;
+        }
+    }
+
+    static constexpr float kScale = 1.0F / 16384;
+
+    vrt_header                         h_{};
+    vrt_fields                         f_{};
+    vrt_data_packet_payload_format     fmt_{};
+    vrt_reassembler                    r_{};
+    std::vector<float>                 ring_;
+    std::vector<float>                 src_;
+    std::vector<uint32_t>              buf_;
+    std::vector<vrt_packet_descriptor> descriptors_;
+};
+
+TEST_F(ReassemblerTest, Continuous) {
+    packetize(100);
+    ring_.resize(256 + 40);
+    ASSERT_EQ(vrt_init_reassembler(&r_, &fmt_, kScale, 1000.0, ring_.data(), 256, 40), 0);
+    for (std::size_t i = 0; i < descriptors_.size(); ++i) {
+        ASSERT_EQ(reassemble(i), 0);
+    }
+    ASSERT_EQ(r_.head, 200);
+    check_ring(0, 0, 200);
+    ASSERT_EQ(r_.packets, 5);
+    ASSERT_EQ(r_.gaps, 0);
+    ASSERT_EQ(r_.count_mismatches, 0);
+}
+
+TEST_F(ReassemblerTest, Gap) {
+    packetize(100);
+    ring_.assign(256 + 40, 1.0F);
+    ASSERT_EQ(vrt_init_reassembler(&r_, &fmt_, kScale, 1000.0, ring_.data(), 256, 40), 0);
+    ASSERT_EQ(reassemble(0), 0);
+    ASSERT_EQ(reassemble(2), 40);
+    ASSERT_EQ(reassemble(1), 0);
+    ASSERT_EQ(reassemble(2), 0);
+    ASSERT_EQ(reassemble(4), 40);
+
+    ASSERT_EQ(r_.head, 200);
+    check_ring(0, 0, 40);
+    for (int32_t i = 40; i < 80; ++i) {
+        ASSERT_EQ(ring_[i], 0.0F);
+    }
+    check_ring(80, 80, 40);
+    check_ring(160, 160, 40);
+    ASSERT_EQ(r_.gaps, 2);
+    ASSERT_EQ(r_.gap_items, 80);
+    ASSERT_EQ(r_.late, 2);
+    ASSERT_EQ(r_.count_mismatches, 0);
+}
+
+TEST_F(ReassemblerTest, PacketCount) {
+    h_.tsi = VRT_TSI_NONE;
+    h_.tsf = VRT_TSF_NONE;
+    packetize(100);
+    ring_.resize(256 + 40);
+    ASSERT_EQ(vrt_init_reassembler(&r_, &fmt_, kScale, 0.0, ring_.data(), 256, 40), 0);
+    ASSERT_EQ(reassemble(0), 0);
+    ASSERT_EQ(reassemble(3), 80);
+    ASSERT_EQ(reassemble(3), 0);
+    ASSERT_EQ(reassemble(1), 0);
+    ASSERT_EQ(reassemble(4), 0);
+    ASSERT_EQ(r_.head, 200);
+    check_ring(120, 60 * 2, 40);
+    check_ring(160, 80 * 2, 40);
+    ASSERT_EQ(r_.late, 2);
+}
+
+TEST_F(ReassemblerTest, PacketCountBurstLoss) {
+    h_.tsi = VRT_TSI_NONE;
+    h_.tsf = VRT_TSF_NONE;
+    packetize(300);
+    ring_.resize(1024 + 40);
+    ASSERT_EQ(vrt_init_reassembler(&r_, &fmt_, kScale, 0.0, ring_.data(), 1024, 40), 0);
+    ASSERT_EQ(reassemble(0), 0);
+    /* Packets 1 to 10 are lost, so packet 11 looks 5 steps behind */
+    ASSERT_EQ(reassemble(11), 0);
+    ASSERT_EQ(r_.late, 1);
+    ASSERT_EQ(reassemble(12), 11 * 20 * 2);
+    ASSERT_EQ(reassemble(13), 0);
+    ASSERT_EQ(reassemble(14), 0);
+    ASSERT_EQ(r_.head, 600);
+    check_ring(0, 0, 40);
+    check_ring(480, 480, 120);
+    ASSERT_EQ(r_.packets, 4);
+    ASSERT_EQ(r_.gaps, 1);
+    ASSERT_EQ(r_.gap_items, 440);
+    ASSERT_EQ(r_.late, 1);
+}
+
+TEST_F(ReassemblerTest, PacketCountConsecutiveLate) {
+    h_.tsi = VRT_TSI_NONE;
+    h_.tsf = VRT_TSF_NONE;
+    packetize(100);
+    ring_.resize(256 + 40);
+    ASSERT_EQ(vrt_init_reassembler(&r_, &fmt_, kScale, 0.0, ring_.data(), 256, 40), 0);
+    ASSERT_EQ(reassemble(0), 0);
+    ASSERT_EQ(reassemble(3), 80);
+    ASSERT_EQ(reassemble(4), 0);
+    ASSERT_EQ(reassemble(1), 0);
+    ASSERT_EQ(reassemble(2), 0);
+    ASSERT_EQ(r_.head, 200);
+    ASSERT_EQ(r_.gaps, 1);
+    ASSERT_EQ(r_.late, 2);
+}
+
+TEST_F(ReassemblerTest, CountMismatch) {
+    packetize(60);
+    ring_.resize(256 + 40);
+    ASSERT_EQ(vrt_init_reassembler(&r_, &fmt_, kScale, 1000.0, ring_.data(), 256, 40), 0);
+    descriptors_[1].header.packet_count = 7;
+    for (std::size_t i = 0; i < descriptors_.size(); ++i) {
+        ASSERT_EQ(reassemble(i), 0);
+    }
+    ASSERT_EQ(r_.count_mismatches, 2);
+}
+
+TEST_F(ReassemblerTest, RealTime) {
+    /* Picosecond timestamps of samples at 3 MHz are truncated by the sender */
+    h_.tsf = VRT_TSF_REAL_TIME;
+    packetize(1000, 3e6);
+    ring_.resize(2048 + 40);
+    ASSERT_EQ(vrt_init_reassembler(&r_, &fmt_, kScale, 3e6, ring_.data(), 2048, 40), 0);
+    for (std::size_t i = 0; i < descriptors_.size(); ++i) {
+        ASSERT_EQ(reassemble(i), 0);
+    }
+    ASSERT_EQ(r_.late, 0);
+    ASSERT_EQ(r_.head, 2000);
+}
+
+TEST_F(ReassemblerTest, Wrap) {
+    /* Packets of 40 items don't divide the capacity, so they wrap at every offset */
+    packetize(1000);
+    ring_.resize(64 + 40);
+    ASSERT_EQ(vrt_init_reassembler(&r_, &fmt_, kScale, 1000.0, ring_.data(), 64, 40), 0);
+    for (std::size_t i = 0; i < descriptors_.size(); ++i) {
+        ASSERT_EQ(reassemble(i), 0);
+        check_ring(r_.tail, static_cast<int32_t>(r_.tail), 40);
+        vrt_consume_reassembler(&r_, 40);
+    }
+    ASSERT_EQ(r_.head, 2000);
+    ASSERT_EQ(r_.tail, 2000);
+}
+
+TEST_F(ReassemblerTest, BufferSize) {
+    packetize(100);
+    ring_.resize(64 + 40);
+    ASSERT_EQ(vrt_init_reassembler(&r_, &fmt_, kScale, 1000.0, ring_.data(), 64, 40), 0);
+    ASSERT_EQ(reassemble(0), 0);
+    ASSERT_EQ(reassemble(1), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(r_.head, 40);
+    ASSERT_EQ(r_.packets, 1);
+    vrt_consume_reassembler(&r_, 30);
+    ASSERT_EQ(reassemble(1), 0);
+    vrt_consume_reassembler(&r_, 1000);
+    ASSERT_EQ(r_.tail, 80);
+
+    /* Gap larger than the capacity isn't zero-filled */
+    ASSERT_EQ(reassemble(4), 80);
+    ASSERT_EQ(r_.head, 120);
+    check_ring(80, 160, 40);
+
+    /* Overhang too small for body */
+    ASSERT_EQ(vrt_init_reassembler(&r_, &fmt_, kScale, 1000.0, ring_.data(), 64, 20), 0);
+    ASSERT_EQ(reassemble(0), 0);
+    ASSERT_EQ(reassemble(1), VRT_ERR_BUFFER_SIZE);
+}
+
+TEST_F(ReassemblerTest, Spans) {
+    packetize(100);
+
+    /* Bodies that directly follow each other, as if headers were received into a separate buffer */
+    std::vector<uint32_t> bodies;
+    for (const vrt_packet_descriptor& d : descriptors_) {
+        const uint32_t* b = static_cast<const uint32_t*>(d.body);
+        bodies.insert(bodies.end(), b, b + d.words_body);
+    }
+    for (std::size_t i = 0, offset = 0; i < descriptors_.size(); ++i) {
+        descriptors_[i].body = bodies.data() + offset;
+        offset += descriptors_[i].words_body;
+    }
+    descriptors_.erase(descriptors_.begin() + 2);
+
+    ASSERT_EQ(vrt_init_reassembler(&r_, &fmt_, kScale, 1000.0, nullptr, 0, 0), 0);
+    std::vector<vrt_reassembly_span> spans(1);
+    int32_t                          packets_read = 0;
+    ASSERT_EQ(vrt_reassemble_spans(&r_, descriptors_.data(), descriptors_.size(), spans.data(), spans.size(),
+                                   &packets_read),
+              1);
+    ASSERT_EQ(packets_read, 2);
+    ASSERT_EQ(spans[0].body, bodies.data());
+    ASSERT_EQ(spans[0].words, 40);
+    ASSERT_EQ(spans[0].items, 80);
+    ASSERT_EQ(spans[0].gap, 0);
+
+    ASSERT_EQ(vrt_reassemble_spans(&r_, descriptors_.data() + 2, 2, spans.data(), spans.size(), &packets_read), 1);
+    ASSERT_EQ(packets_read, 2);
+    ASSERT_EQ(spans[0].body, bodies.data() + 60);
+    ASSERT_EQ(spans[0].words, 40);
+    ASSERT_EQ(spans[0].gap, 40);
+    ASSERT_EQ(r_.gaps, 1);
+
+    /* Bodies in place are separated by headers, so every packet is a span of its own */
+    packetize(100);
+    ASSERT_EQ(vrt_init_reassembler(&r_, &fmt_, kScale, 1000.0, nullptr, 0, 0), 0);
+    spans.resize(8);
+    ASSERT_EQ(vrt_reassemble_spans(&r_, descriptors_.data(), descriptors_.size(), spans.data(), spans.size(),
+                                   &packets_read),
+              5);
+    ASSERT_EQ(packets_read, 5);
+}
+
+TEST_F(ReassemblerTest, InvalidCapacity) {
+    ring_.resize(64);
+    ASSERT_EQ(vrt_init_reassembler(&r_, &fmt_, kScale, 1000.0, ring_.data(), 48, 0), VRT_ERR_INVALID_CAPACITY);
+    ASSERT_EQ(vrt_init_reassembler(&r_, &fmt_, kScale, 1000.0, ring_.data(), 0, 0), VRT_ERR_INVALID_CAPACITY);
+    ASSERT_EQ(vrt_init_reassembler(&r_, &fmt_, kScale, 1000.0, nullptr, 64, 0), VRT_ERR_INVALID_CAPACITY);
+    fmt_.data_item_format = VRT_DIF_IEEE_754_SINGLE_PRECISION_FLOATING_POINT;
+    ASSERT_EQ(vrt_init_reassembler(&r_, &fmt_, kScale, 1000.0, ring_.data(), 64, 0), VRT_ERR_UNSUPPORTED_FORMAT);
+}
@@ -0,0 +1,207 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+
+#include <vrt/vrt_byte_swap.h>
+#include <vrt/vrt_error_code.h>
+#include <vrt/vrt_init.h>
+#include <vrt/vrt_sequencer.h>
+#include <vrt/vrt_types.h>
+#include <vrt/vrt_util.h>
+
+class SequencerTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        vrt_init_header(&h_);
+        vrt_init_fields(&f_);
+        buf_.fill(0xBAADF00D);
+    }
+
+    /**
+     * Write next packet, with TSI and TSF but no other fields, and return its timestamps.
+     */
+    void write_next(uint32_t* integer_seconds_timestamp, uint64_t* fractional_seconds_timestamp) {
+        ASSERT_EQ(vrt_write_sequenced_packet(&seq_, nullptr, 0, buf_.data(), buf_.size()), 4);
+        *integer_seconds_timestamp    = buf_[1];
+        *fractional_seconds_timestamp = (static_cast<uint64_t>(buf_[2]) << 32U) | buf_[3];
+    }
+
+    vrt_header              h_{};
+    vrt_fields              f_{};
+    vrt_sequencer           seq_{};
+    std::array<uint32_t, 8> buf_{};
+};
+
+TEST_F(SequencerTest, PacketCount) {
+    ASSERT_EQ(vrt_init_sequencer(&h_, &f_, nullptr, 0.0, 8, &seq_, VRT_VALIDATION_FULL), 1);
+    for (uint32_t i = 0; i < 20; ++i) {
+        ASSERT_EQ(vrt_write_sequenced_packet(&seq_, nullptr, 0, buf_.data(), buf_.size()), 1);
+        ASSERT_EQ(buf_[0], ((i % 16) << 16U) | 0x00000001);
+    }
+}
+
+TEST_F(SequencerTest, SampleCount) {
+    h_.tsi                          = VRT_TSI_UTC;
+    h_.tsf                          = VRT_TSF_SAMPLE_COUNT;
+    f_.integer_seconds_timestamp    = 10;
+    f_.fractional_seconds_timestamp = 0;
+    ASSERT_EQ(vrt_init_sequencer(&h_, &f_, nullptr, 1000.0, 400, &seq_, VRT_VALIDATION_FULL), 4);
+
+    const std::array<uint32_t, 5> is{10, 10, 10, 11, 11};
+    const std::array<uint64_t, 5> fs{0, 400, 800, 200, 600};
+    for (std::size_t i = 0; i < is.size(); ++i) {
+        uint32_t i_ts = 0;
+        uint64_t f_ts = 0;
+        write_next(&i_ts, &f_ts);
+        ASSERT_EQ(i_ts, is[i]);
+        ASSERT_EQ(f_ts, fs[i]);
+    }
+}
+
+TEST_F(SequencerTest, SampleCountSeveralSecondsPerPacket) {
+    h_.tsi = VRT_TSI_UTC;
+    h_.tsf = VRT_TSF_SAMPLE_COUNT;
+    ASSERT_EQ(vrt_init_sequencer(&h_, &f_, nullptr, 10.0, 25, &seq_, VRT_VALIDATION_FULL), 4);
+
+    uint32_t i_ts = 0;
+    uint64_t f_ts = 0;
+    write_next(&i_ts, &f_ts);
+    write_next(&i_ts, &f_ts);
+    ASSERT_EQ(i_ts, 2);
+    ASSERT_EQ(f_ts, 5);
+}
+
+TEST_F(SequencerTest, RealTimeRemainder) {
+    h_.tsi                          = VRT_TSI_GPS;
+    h_.tsf                          = VRT_TSF_REAL_TIME;
+    f_.integer_seconds_timestamp    = 7;
+    f_.fractional_seconds_timestamp = 0;
+    ASSERT_EQ(vrt_init_sequencer(&h_, &f_, nullptr, 3.0, 1, &seq_, VRT_VALIDATION_FULL), 4);
+
+    const std::array<uint32_t, 4> is{7, 7, 7, 8};
+    const std::array<uint64_t, 4> fs{0, 333333333333, 666666666666, 0};
+    for (std::size_t i = 0; i < is.size(); ++i) {
+        uint32_t i_ts = 0;
+        uint64_t f_ts = 0;
+        write_next(&i_ts, &f_ts);
+        ASSERT_EQ(i_ts, is[i]);
+        ASSERT_EQ(f_ts, fs[i]);
+    }
+}
+
+TEST_F(SequencerTest, RealTimeHighSampleRate) {
+    h_.tsi = VRT_TSI_UTC;
+    h_.tsf = VRT_TSF_REAL_TIME;
+    ASSERT_EQ(vrt_init_sequencer(&h_, &f_, nullptr, 100e6, 1000, &seq_, VRT_VALIDATION_FULL), 4);
+
+    /* 10 us per packet, so a second is 100000 packets */
+    uint32_t i_ts = 0;
+    uint64_t f_ts = 0;
+    for (int i = 0; i < 100000; ++i) {
+        write_next(&i_ts, &f_ts);
+        ASSERT_EQ(f_ts, static_cast<uint64_t>(i) * 10000000);
+    }
+    write_next(&i_ts, &f_ts);
+    ASSERT_EQ(i_ts, 1);
+    ASSERT_EQ(f_ts, 0);
+}
+
+TEST_F(SequencerTest, Advance) {
+    h_.tsi = VRT_TSI_UTC;
+    h_.tsf = VRT_TSF_REAL_TIME;
+    ASSERT_EQ(vrt_init_sequencer(&h_, &f_, nullptr, 3.0, 3, &seq_, VRT_VALIDATION_FULL), 4);
+
+    /* A shorter packet of 2 samples, then a full one of 3 */
+    vrt_advance_sequencer(&seq_, 2);
+    ASSERT_EQ(seq_.integer_seconds_timestamp, 0);
+    ASSERT_EQ(seq_.fractional_seconds_timestamp, 666666666666);
+    vrt_advance_sequencer(&seq_, 3);
+    ASSERT_EQ(seq_.integer_seconds_timestamp, 1);
+    ASSERT_EQ(seq_.fractional_seconds_timestamp, 666666666666);
+    vrt_advance_sequencer(&seq_, 1);
+    ASSERT_EQ(seq_.integer_seconds_timestamp, 2);
+    ASSERT_EQ(seq_.fractional_seconds_timestamp, 0);
+    ASSERT_EQ(seq_.tmpl.packet_count, 0);
+}
+
+TEST_F(SequencerTest, FreeRunningCount) {
+    h_.tsi                          = VRT_TSI_OTHER;
+    h_.tsf                          = VRT_TSF_FREE_RUNNING_COUNT;
+    f_.integer_seconds_timestamp    = 3;
+    f_.fractional_seconds_timestamp = 0xFFFFFFFF;
+    ASSERT_EQ(vrt_init_sequencer(&h_, &f_, nullptr, 0.0, 2, &seq_, VRT_VALIDATION_FULL), 4);
+
+    uint32_t i_ts = 0;
+    uint64_t f_ts = 0;
+    write_next(&i_ts, &f_ts);
+    write_next(&i_ts, &f_ts);
+    ASSERT_EQ(i_ts, 3);
+    ASSERT_EQ(f_ts, 0x100000001);
+}
+
+TEST_F(SequencerTest, IntegerOnly) {
+    h_.tsi                       = VRT_TSI_UTC;
+    f_.integer_seconds_timestamp = 5;
+    ASSERT_EQ(vrt_init_sequencer(&h_, &f_, nullptr, 10.0, 4, &seq_, VRT_VALIDATION_FULL), 2);
+
+    const std::array<uint32_t, 5> is{5, 5, 5, 6, 6};
+    for (uint32_t i_ts : is) {
+        ASSERT_EQ(vrt_write_sequenced_packet(&seq_, nullptr, 0, buf_.data(), buf_.size()), 2);
+        ASSERT_EQ(buf_[1], i_ts);
+    }
+}
+
+TEST_F(SequencerTest, BigEndian) {
+    h_.tsi                          = VRT_TSI_UTC;
+    h_.tsf                          = VRT_TSF_SAMPLE_COUNT;
+    f_.integer_seconds_timestamp    = 0x12345678;
+    f_.fractional_seconds_timestamp = 0x00000010;
+    ASSERT_EQ(vrt_init_sequencer_be(&h_, &f_, nullptr, 1000.0, 1, &seq_, VRT_VALIDATION_FULL), 4);
+    ASSERT_EQ(vrt_write_sequenced_packet(&seq_, nullptr, 0, buf_.data(), buf_.size()), 4);
+    ASSERT_EQ(vrt_write_sequenced_packet(&seq_, nullptr, 0, buf_.data(), buf_.size()), 4);
+
+    std::array<uint32_t, 4> expected{0x00510004, 0x12345678, 0x00000000, 0x00000011};
+    if (vrt_is_platform_little_endian()) {
+        vrt_byte_swap(expected.data(), expected.data(), expected.size());
+    }
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(buf_[i], expected[i]);
+    }
+}
+
+TEST_F(SequencerTest, ErrorLeavesState) {
+    h_.tsi = VRT_TSI_UTC;
+    h_.tsf = VRT_TSF_SAMPLE_COUNT;
+    ASSERT_EQ(vrt_init_sequencer(&h_, &f_, nullptr, 1000.0, 400, &seq_, VRT_VALIDATION_FULL), 4);
+    ASSERT_EQ(vrt_write_sequenced_packet(&seq_, nullptr, 0, buf_.data(), 3), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(seq_.fractional_seconds_timestamp, 0);
+    ASSERT_EQ(seq_.tmpl.packet_count, 0);
+}
+
+TEST_F(SequencerTest, MissingSampleRate) {
+    h_.tsi = VRT_TSI_UTC;
+    h_.tsf = VRT_TSF_REAL_TIME;
+    ASSERT_EQ(vrt_init_sequencer(&h_, &f_, nullptr, 0.5, 1, &seq_, VRT_VALIDATION_FULL), VRT_ERR_MISSING_SAMPLE_RATE);
+    h_.tsf = VRT_TSF_NONE;
+    ASSERT_EQ(vrt_init_sequencer(&h_, &f_, nullptr, 0.0, 1, &seq_, VRT_VALIDATION_FULL), VRT_ERR_MISSING_SAMPLE_RATE);
+}
+
+TEST_F(SequencerTest, BoundsSampleCount) {
+    h_.tsf                          = VRT_TSF_SAMPLE_COUNT;
+    f_.fractional_seconds_timestamp = 1000;
+    ASSERT_EQ(vrt_init_sequencer(&h_, &f_, nullptr, 1000.0, 1, &seq_, VRT_VALIDATION_FULL),
+              VRT_ERR_BOUNDS_SAMPLE_COUNT);
+    ASSERT_EQ(vrt_init_sequencer(&h_, &f_, nullptr, 1000.0, 1, &seq_, VRT_VALIDATION_NONE), 3);
+}
+
+TEST_F(SequencerTest, BoundsRealTime) {
+    h_.tsf                          = VRT_TSF_REAL_TIME;
+    f_.fractional_seconds_timestamp = 1000000000000;
+    ASSERT_EQ(vrt_init_sequencer(&h_, &f_, nullptr, 1000.0, 1, &seq_, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_REAL_TIME);
+}
+
+TEST_F(SequencerTest, InvalidHeader) {
+    h_.packet_count = 0x10;
+    ASSERT_EQ(vrt_init_sequencer(&h_, &f_, nullptr, 0.0, 1, &seq_, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_PACKET_COUNT);
+}
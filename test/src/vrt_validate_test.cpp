@@ -0,0 +1,191 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+#include <vrt/vrt_byte_swap.h>
+#include <vrt/vrt_error_code.h>
+#include <vrt/vrt_init.h>
+#include <vrt/vrt_read.h>
+#include <vrt/vrt_types.h>
+#include <vrt/vrt_util.h>
+#include <vrt/vrt_validate.h>
+#include <vrt/vrt_write.h>
+
+class ValidateTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        vrt_init_packet(&p_);
+        buf_.fill(0xBAADF00D);
+    }
+
+    /**
+     * Write a data packet with all optional fields and trailer.
+     */
+    int32_t write_data() {
+        p_.header.packet_type                  = VRT_PT_IF_DATA_WITH_STREAM_ID;
+        p_.header.has.class_id                 = true;
+        p_.header.has.trailer                  = true;
+        p_.header.tsi                          = VRT_TSI_UTC;
+        p_.header.tsf                          = VRT_TSF_REAL_TIME;
+        p_.fields.stream_id                    = 0xABABABAB;
+        p_.fields.class_id.oui                 = 0x00123456;
+        p_.fields.integer_seconds_timestamp    = 1700000000;
+        p_.fields.fractional_seconds_timestamp = 123456789;
+        p_.body                                = body_.data();
+        p_.words_body                          = body_.size();
+        p_.trailer.has.valid_data              = true;
+        p_.trailer.valid_data                  = true;
+        return vrt_write_packet(&p_, buf_.data(), buf_.size(), VRT_VALIDATION_FULL);
+    }
+
+    /**
+     * Write an IF context packet with fields that have something to validate.
+     */
+    int32_t write_context() {
+        vrt_if_context* c = &p_.if_context;
+
+        p_.header.packet_type                                        = VRT_PT_IF_CONTEXT;
+        p_.fields.stream_id                                          = 0xABABABAB;
+        c->has.bandwidth                                             = true;
+        c->bandwidth                                                 = 1e6;
+        c->has.reference_level                                       = true;
+        c->reference_level                                           = -10.0F;
+        c->has.gain                                                  = true;
+        c->gain.stage1                                               = 1.0F;
+        c->gain.stage2                                               = 2.0F;
+        c->has.sample_rate                                           = true;
+        c->sample_rate                                               = 2e6;
+        c->has.temperature                                           = true;
+        c->temperature                                               = -273.0F;
+        c->has.device_identifier                                     = true;
+        c->device_identifier.oui                                     = 0x00123456;
+        c->has.state_and_event_indicators                            = true;
+        c->state_and_event_indicators.has.valid_data                 = true;
+        c->state_and_event_indicators.valid_data                     = true;
+        c->has.data_packet_payload_format                            = true;
+        c->data_packet_payload_format.data_item_format               = VRT_DIF_IEEE_754_SINGLE_PRECISION_FLOATING_POINT;
+        c->has.formatted_gps_geolocation                             = true;
+        c->formatted_gps_geolocation.tsi                             = VRT_TSI_UTC;
+        c->formatted_gps_geolocation.tsf                             = VRT_TSF_REAL_TIME;
+        c->formatted_gps_geolocation.fractional_second_timestamp     = 0;
+        c->formatted_gps_geolocation.has.latitude                    = true;
+        c->formatted_gps_geolocation.latitude                        = 90.0;
+        c->formatted_gps_geolocation.has.longitude                   = true;
+        c->formatted_gps_geolocation.longitude                       = -180.0;
+        c->formatted_gps_geolocation.has.heading_angle               = true;
+        c->formatted_gps_geolocation.heading_angle                   = 0.0;
+        c->has.relative_ephemeris                                    = true;
+        c->relative_ephemeris.tsf                                    = VRT_TSF_REAL_TIME;
+        c->relative_ephemeris.fractional_second_timestamp            = 0;
+        c->has.gps_ascii                                             = true;
+        c->gps_ascii.number_of_words                                 = 1;
+        c->gps_ascii.ascii                                           = "abcd";
+        c->has.context_association_lists                             = true;
+        c->context_association_lists.source_list_size                = 1;
+        c->context_association_lists.source_context_association_list = body_.data();
+        return vrt_write_packet(&p_, buf_.data(), buf_.size(), VRT_VALIDATION_FULL);
+    }
+
+    /**
+     * Flip each bit of the packet in turn, and check that validation agrees with reading with validation.
+     */
+    void assert_same_as_read(int32_t words) {
+        ASSERT_GT(words, 0);
+        for (int32_t i = 0; i < words; ++i) {
+            for (uint32_t bit = 0; bit < 32; ++bit) {
+                std::array<uint32_t, 64> b = buf_;
+                b[i] ^= 1U << bit;
+                vrt_packet p{};
+                ASSERT_EQ(vrt_validate_packet(b.data(), words),
+                          vrt_read_packet(b.data(), words, &p, VRT_VALIDATION_FULL))
+                    << "word " << i << ", bit " << bit;
+            }
+        }
+    }
+
+    vrt_packet               p_{};
+    std::array<uint32_t, 2>  body_{0x01234567, 0x89ABCDEF};
+    std::array<uint32_t, 64> buf_{};
+    int32_t                  words_read_{-1};
+};
+
+TEST_F(ValidateTest, BufferSize) {
+    ASSERT_EQ(vrt_validate_packet(buf_.data(), 0), VRT_ERR_BUFFER_SIZE);
+}
+
+TEST_F(ValidateTest, Data) {
+    int32_t words = write_data();
+    ASSERT_EQ(words, 10);
+    ASSERT_EQ(vrt_validate_packet(buf_.data(), buf_.size()), words);
+}
+
+TEST_F(ValidateTest, Context) {
+    int32_t words = write_context();
+    ASSERT_GT(words, 0);
+    ASSERT_EQ(vrt_validate_packet(buf_.data(), buf_.size()), words);
+}
+
+TEST_F(ValidateTest, InvalidPacketType) {
+    buf_[0] = 0x60000001;
+    ASSERT_EQ(vrt_validate_packet(buf_.data(), buf_.size()), VRT_ERR_INVALID_PACKET_TYPE);
+}
+
+TEST_F(ValidateTest, TsmInData) {
+    buf_[0] = 0x01000001;
+    ASSERT_EQ(vrt_validate_packet(buf_.data(), buf_.size()), VRT_ERR_TSM_IN_DATA);
+}
+
+TEST_F(ValidateTest, PacketSizeMismatch) {
+    buf_[0] = 0x00000002;
+    ASSERT_EQ(vrt_validate_packet(buf_.data(), buf_.size()), 2);
+    buf_[0] = 0x04000000;
+    ASSERT_EQ(vrt_validate_packet(buf_.data(), buf_.size()), VRT_ERR_MISMATCH_PACKET_SIZE);
+}
+
+TEST_F(ValidateTest, SameAsReadData) {
+    assert_same_as_read(write_data());
+}
+
+TEST_F(ValidateTest, SameAsReadContext) {
+    assert_same_as_read(write_context());
+}
+
+TEST_F(ValidateTest, Packets) {
+    int32_t words = write_data();
+    std::copy(buf_.begin(), buf_.begin() + words, buf_.begin() + words);
+    ASSERT_EQ(vrt_validate_packets(buf_.data(), 2 * words, &words_read_), 2);
+    ASSERT_EQ(words_read_, 2 * words);
+}
+
+TEST_F(ValidateTest, PacketsPartialTail) {
+    int32_t words = write_data();
+    std::copy(buf_.begin(), buf_.begin() + words, buf_.begin() + words);
+    ASSERT_EQ(vrt_validate_packets(buf_.data(), 2 * words - 1, &words_read_), 1);
+    ASSERT_EQ(words_read_, words);
+}
+
+TEST_F(ValidateTest, PacketsError) {
+    int32_t words = write_data();
+    std::copy(buf_.begin(), buf_.begin() + words, buf_.begin() + words);
+    buf_[words] |= 0x02000000;
+    ASSERT_EQ(vrt_validate_packets(buf_.data(), 2 * words, &words_read_), VRT_ERR_RESERVED);
+    ASSERT_EQ(words_read_, words);
+}
+
+TEST_F(ValidateTest, PacketsFieldsOutsidePacket) {
+    buf_[0] = 0x18000002;
+    ASSERT_EQ(vrt_validate_packets(buf_.data(), buf_.size(), &words_read_), VRT_ERR_MISMATCH_PACKET_SIZE);
+    ASSERT_EQ(words_read_, 0);
+}
+
+TEST_F(ValidateTest, BigEndian) {
+    int32_t words = write_context();
+    if (vrt_is_platform_little_endian()) {
+        vrt_byte_swap(buf_.data(), buf_.data(), words);
+    }
+    ASSERT_EQ(vrt_validate_packet_be(buf_.data(), words), words);
+    ASSERT_EQ(vrt_validate_packets_be(buf_.data(), words, &words_read_), 1);
+    ASSERT_EQ(words_read_, words);
+}
@@ -232,3 +232,11 @@ TEST_F(WordsIfContextTest, All) {
 
     ASSERT_EQ(vrt_words_if_context(&c_), 108);
 }
+
+TEST_F(WordsIfContextTest, Mixed) {
+    c_.has.reference_point_identifier = true;
+    c_.has.sample_rate                = true;
+    c_.has.formatted_ins_geolocation  = true;
+    c_.has.relative_ephemeris         = true;
+    ASSERT_EQ(vrt_words_if_context(&c_), 28);
+}
@@ -0,0 +1,196 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#include <vrt/vrt_error_code.h>
+#include <vrt/vrt_init.h>
+#include <vrt/vrt_read.h>
+#include <vrt/vrt_types.h>
+#include <vrt/vrt_util.h>
+#include <vrt/vrt_write.h>
+
+#include "hex.h"
+
+class WriteBeTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        vrt_init_packet(&p_);
+        buf_.fill(0xBAADF00D);
+        host_.fill(0xBAADF00D);
+    }
+
+    /**
+     * Convert word from host order to network order.
+     *
+     * \param u Word in host order.
+     *
+     * \return Word in network order.
+     */
+    static uint32_t hton(uint32_t u) {
+        if (!vrt_is_platform_little_endian()) {
+            return u;
+        }
+        return (u >> 24U) | ((u >> 8U) & 0x0000FF00U) | ((u << 8U) & 0x00FF0000U) | (u << 24U);
+    }
+
+    /**
+     * Fill IF context with a mix of fields, including variable size ones.
+     */
+    void init_if_context() {
+        p_.header.packet_type = VRT_PT_IF_CONTEXT;
+        p_.fields.stream_id   = 0xABABABAB;
+
+        vrt_if_context& c{p_.if_context};
+        c.has.bandwidth                                  = true;
+        c.bandwidth                                      = 4097.0;
+        c.has.gain                                       = true;
+        c.gain.stage1                                    = -1.0F;
+        c.gain.stage2                                    = 1.0F;
+        c.has.temperature                                = true;
+        c.temperature                                    = -2.0F;
+        c.has.sample_rate                                = true;
+        c.sample_rate                                    = 8000.0;
+        c.has.state_and_event_indicators                 = true;
+        c.state_and_event_indicators.has.reference_lock  = true;
+        c.state_and_event_indicators.reference_lock      = true;
+        c.state_and_event_indicators.user_defined        = 0xA5;
+        c.has.data_packet_payload_format                 = true;
+        c.data_packet_payload_format.data_item_size      = 15;
+        c.data_packet_payload_format.repeat_count        = 0x1234;
+        c.has.formatted_gps_geolocation                  = true;
+        c.formatted_gps_geolocation.has.latitude         = true;
+        c.formatted_gps_geolocation.latitude             = 1.0;
+        c.has.ecef_ephemeris                             = true;
+        c.ecef_ephemeris.has.velocity_dz                 = true;
+        c.ecef_ephemeris.velocity_dz                     = -3.0;
+        c.has.gps_ascii                                  = true;
+        c.gps_ascii.oui                                  = 0x00123456;
+        c.gps_ascii.number_of_words                      = 2;
+        c.gps_ascii.ascii                                = "ABCDEFGH";
+        c.has.context_association_lists                  = true;
+        c.context_association_lists.source_list_size     = 2;
+
+        c.context_association_lists.source_context_association_list = list_.data();
+    }
+
+    vrt_packet               p_{};
+    std::array<uint32_t, 2>  list_{0x01020304, 0x05060708};
+    std::array<uint32_t, 64> buf_{};
+    std::array<uint32_t, 64> host_{};
+};
+
+TEST_F(WriteBeTest, HeaderBufferSize) {
+    ASSERT_EQ(vrt_write_header_be(&p_.header, buf_.data(), 0, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+}
+
+TEST_F(WriteBeTest, Header) {
+    p_.header.packet_type  = VRT_PT_IF_DATA_WITH_STREAM_ID;
+    p_.header.has.trailer  = true;
+    p_.header.packet_count = 0xA;
+    p_.header.packet_size  = 0xABCD;
+    ASSERT_EQ(vrt_write_header_be(&p_.header, buf_.data(), 1, VRT_VALIDATION_FULL), 1);
+    ASSERT_EQ(Hex(buf_[0]), Hex(hton(0x140AABCD)));
+    ASSERT_EQ(Hex(buf_[1]), Hex(0xBAADF00D));
+}
+
+TEST_F(WriteBeTest, HeaderInvalid) {
+    p_.header.packet_count = 0x10;
+    ASSERT_EQ(vrt_write_header_be(&p_.header, buf_.data(), 1, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_PACKET_COUNT);
+}
+
+TEST_F(WriteBeTest, Fields) {
+    p_.header.packet_type                     = VRT_PT_IF_DATA_WITH_STREAM_ID;
+    p_.header.has.class_id                    = true;
+    p_.header.tsi                             = VRT_TSI_UTC;
+    p_.header.tsf                             = VRT_TSF_SAMPLE_COUNT;
+    p_.fields.stream_id                       = 0xABABABAB;
+    p_.fields.class_id.oui                    = 0x00123456;
+    p_.fields.class_id.information_class_code = 0x1234;
+    p_.fields.class_id.packet_class_code      = 0xABCD;
+    p_.fields.integer_seconds_timestamp       = 0xBEEFBEEF;
+    p_.fields.fractional_seconds_timestamp    = 0x0000000100000002;
+    ASSERT_EQ(vrt_write_fields_be(&p_.header, &p_.fields, buf_.data(), 6, VRT_VALIDATION_FULL), 6);
+    ASSERT_EQ(Hex(buf_[0]), Hex(hton(0xABABABAB)));
+    ASSERT_EQ(Hex(buf_[1]), Hex(hton(0x00123456)));
+    ASSERT_EQ(Hex(buf_[2]), Hex(hton(0x1234ABCD)));
+    ASSERT_EQ(Hex(buf_[3]), Hex(hton(0xBEEFBEEF)));
+    ASSERT_EQ(Hex(buf_[4]), Hex(hton(0x00000001)));
+    ASSERT_EQ(Hex(buf_[5]), Hex(hton(0x00000002)));
+    ASSERT_EQ(Hex(buf_[6]), Hex(0xBAADF00D));
+}
+
+TEST_F(WriteBeTest, Trailer) {
+    p_.trailer.has.calibrated_time                 = true;
+    p_.trailer.calibrated_time                     = true;
+    p_.trailer.has.associated_context_packet_count = true;
+    p_.trailer.associated_context_packet_count     = 0x05;
+    ASSERT_EQ(vrt_write_trailer_be(&p_.trailer, buf_.data(), 1, VRT_VALIDATION_FULL), 1);
+    ASSERT_EQ(Hex(buf_[0]), Hex(hton(0x80080085)));
+}
+
+TEST_F(WriteBeTest, IfContextSameAsHost) {
+    init_if_context();
+    const int32_t words = vrt_write_if_context(&p_.if_context, host_.data(), host_.size(), VRT_VALIDATION_FULL);
+    ASSERT_GT(words, 0);
+    ASSERT_EQ(vrt_write_if_context_be(&p_.if_context, buf_.data(), buf_.size(), VRT_VALIDATION_FULL), words);
+
+    /* GPS ASCII words and context association lists are copied as is, but everything else is swapped */
+    const int32_t words_ascii = 2;
+    const int32_t words_lists = 2;
+    const int32_t end_fixed   = words - 2 - words_ascii - 2 - words_lists;
+    for (int32_t i = 0; i < end_fixed + 2; ++i) {
+        ASSERT_EQ(Hex(buf_[i]), Hex(hton(host_[i]))) << "i = " << i;
+    }
+    ASSERT_EQ(std::memcmp(buf_.data() + end_fixed + 2, "ABCDEFGH", 8), 0);
+    ASSERT_EQ(Hex(buf_[end_fixed + 4]), Hex(hton(host_[end_fixed + 4])));
+    ASSERT_EQ(Hex(buf_[end_fixed + 5]), Hex(hton(host_[end_fixed + 5])));
+    ASSERT_EQ(Hex(buf_[end_fixed + 6]), Hex(0x01020304));
+    ASSERT_EQ(Hex(buf_[end_fixed + 7]), Hex(0x05060708));
+    ASSERT_EQ(Hex(buf_[words]), Hex(0xBAADF00D));
+}
+
+TEST_F(WriteBeTest, IfContextInvalid) {
+    p_.if_context.has.bandwidth = true;
+    p_.if_context.bandwidth     = -1.0;
+    ASSERT_EQ(vrt_write_if_context_be(&p_.if_context, buf_.data(), buf_.size(), VRT_VALIDATION_FULL),
+              VRT_ERR_BOUNDS_BANDWIDTH);
+}
+
+TEST_F(WriteBeTest, PacketDataWithTrailer) {
+    std::array<uint32_t, 2> body{0x01020304, 0x05060708};
+    p_.header.packet_type     = VRT_PT_IF_DATA_WITH_STREAM_ID;
+    p_.header.has.trailer     = true;
+    p_.fields.stream_id       = 0xABABABAB;
+    p_.trailer.has.valid_data = true;
+    p_.words_body             = body.size();
+    p_.body                   = body.data();
+    ASSERT_EQ(vrt_write_packet_be(&p_, buf_.data(), buf_.size(), VRT_VALIDATION_FULL), 5);
+    ASSERT_EQ(Hex(buf_[0]), Hex(hton(0x14000005)));
+    ASSERT_EQ(Hex(buf_[1]), Hex(hton(0xABABABAB)));
+    /* Body is copied as is */
+    ASSERT_EQ(Hex(buf_[2]), Hex(0x01020304));
+    ASSERT_EQ(Hex(buf_[3]), Hex(0x05060708));
+    ASSERT_EQ(Hex(buf_[4]), Hex(hton(0x40000000)));
+    ASSERT_EQ(Hex(buf_[5]), Hex(0xBAADF00D));
+}
+
+TEST_F(WriteBeTest, PacketRoundTrip) {
+    init_if_context();
+    const int32_t words = vrt_write_packet_be(&p_, buf_.data(), buf_.size(), VRT_VALIDATION_FULL);
+    ASSERT_GT(words, 0);
+
+    /* Read it back in network order, and write it again in host order. This should match a direct host order write. */
+    vrt_packet p_read{};
+    ASSERT_EQ(vrt_read_packet_be(buf_.data(), words, &p_read, VRT_VALIDATION_FULL), words);
+    std::array<uint32_t, 64> host_read{};
+    host_read.fill(0xBAADF00D);
+    ASSERT_EQ(vrt_write_packet(&p_read, host_read.data(), host_read.size(), VRT_VALIDATION_FULL), words);
+    ASSERT_EQ(vrt_write_packet(&p_, host_.data(), host_.size(), VRT_VALIDATION_FULL), words);
+
+    /* Except for the verbatim context association lists, which are in network order after the round trip */
+    for (int32_t i = 0; i < words - 2; ++i) {
+        ASSERT_EQ(Hex(host_read[i]), Hex(host_[i])) << "i = " << i;
+    }
+}
@@ -24,25 +24,25 @@ class WriteFieldsTest : public ::testing::Test {
 };
 
 TEST_F(WriteFieldsTest, NegativeSizeBuffer) {
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), -1, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), -1, false), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), -1, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), -1, VRT_VALIDATION_NONE), VRT_ERR_BUFFER_SIZE);
 }
 
 TEST_F(WriteFieldsTest, None) {
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 0, true), 0);
+    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 0, VRT_VALIDATION_FULL), 0);
 }
 
 TEST_F(WriteFieldsTest, IfDataWithoutStreamId) {
     h_.packet_type = VRT_PT_IF_DATA_WITHOUT_STREAM_ID;
     f_.stream_id   = 0xFEDCBA98;
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 1, true), 0);
+    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 1, VRT_VALIDATION_FULL), 0);
 }
 
 TEST_F(WriteFieldsTest, IfDataWithStreamId) {
     h_.packet_type = VRT_PT_IF_DATA_WITH_STREAM_ID;
     f_.stream_id   = 0xFEDCBA98;
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 0, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 1, true), 1);
+    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 0, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 1, VRT_VALIDATION_FULL), 1);
     ASSERT_EQ(Hex(buf_[0]), Hex(0xFEDCBA98));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xBAADF00D));
 }
@@ -50,14 +50,14 @@ TEST_F(WriteFieldsTest, IfDataWithStreamId) {
 TEST_F(WriteFieldsTest, ExtDataWithoutStreamId) {
     h_.packet_type = VRT_PT_EXT_DATA_WITHOUT_STREAM_ID;
     f_.stream_id   = 0xFEDCBA98;
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 1, true), 0);
+    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 1, VRT_VALIDATION_FULL), 0);
 }
 
 TEST_F(WriteFieldsTest, ExtDataWithStreamId) {
     h_.packet_type = VRT_PT_EXT_DATA_WITH_STREAM_ID;
     f_.stream_id   = 0xFEDCBA98;
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 0, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 1, true), 1);
+    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 0, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 1, VRT_VALIDATION_FULL), 1);
     ASSERT_EQ(Hex(buf_[0]), Hex(0xFEDCBA98));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xBAADF00D));
 }
@@ -65,8 +65,8 @@ TEST_F(WriteFieldsTest, ExtDataWithStreamId) {
 TEST_F(WriteFieldsTest, IfContext) {
     h_.packet_type = VRT_PT_IF_CONTEXT;
     f_.stream_id   = 0xFEDCBA98;
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 0, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 1, true), 1);
+    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 0, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 1, VRT_VALIDATION_FULL), 1);
     ASSERT_EQ(Hex(buf_[0]), Hex(0xFEDCBA98));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xBAADF00D));
 }
@@ -74,8 +74,8 @@ TEST_F(WriteFieldsTest, IfContext) {
 TEST_F(WriteFieldsTest, ExtContext) {
     h_.packet_type = VRT_PT_EXT_CONTEXT;
     f_.stream_id   = 0xFEDCBA98;
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 0, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 1, true), 1);
+    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 0, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 1, VRT_VALIDATION_FULL), 1);
     ASSERT_EQ(Hex(buf_[0]), Hex(0xFEDCBA98));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xBAADF00D));
 }
@@ -85,8 +85,8 @@ TEST_F(WriteFieldsTest, ClassId) {
     f_.class_id.oui                    = 0x00FEDCBA;
     f_.class_id.information_class_code = 0xFEDC;
     f_.class_id.packet_class_code      = 0xBA98;
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 1, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 1, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00FEDCBA));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xFEDCBA98));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -97,8 +97,9 @@ TEST_F(WriteFieldsTest, ClassIdInvalid) {
     f_.class_id.oui                    = 0xFFFEDCBA;
     f_.class_id.information_class_code = 0xFEDC;
     f_.class_id.packet_class_code      = 0xBA98;
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 2, true), VRT_ERR_BOUNDS_OUI);
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 2, false), 2);
+    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 2, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_OUI);
+    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 2, VRT_VALIDATION_STRUCTURAL), 2);
+    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 2, VRT_VALIDATION_NONE), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00FEDCBA));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xFEDCBA98));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -107,7 +108,7 @@ TEST_F(WriteFieldsTest, ClassIdInvalid) {
 TEST_F(WriteFieldsTest, IntegerSecondsTimestamp) {
     h_.tsi                       = VRT_TSI_OTHER;
     f_.integer_seconds_timestamp = 0xFEDCBA98;
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 1, true), 1);
+    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 1, VRT_VALIDATION_FULL), 1);
     ASSERT_EQ(Hex(buf_[0]), Hex(0xFEDCBA98));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xBAADF00D));
 }
@@ -115,7 +116,7 @@ TEST_F(WriteFieldsTest, IntegerSecondsTimestamp) {
 TEST_F(WriteFieldsTest, FractionalSecondsTimestamp) {
     h_.tsf                          = VRT_TSF_REAL_TIME;
     f_.fractional_seconds_timestamp = 0x000000E8D4A50FFF;
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x000000E8));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xD4A50FFF));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -124,8 +125,8 @@ TEST_F(WriteFieldsTest, FractionalSecondsTimestamp) {
 TEST_F(WriteFieldsTest, FractionalSecondsTimestampInvalid) {
     h_.tsf                          = VRT_TSF_REAL_TIME;
     f_.fractional_seconds_timestamp = 0x000000E8D4A51000;
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 2, true), VRT_ERR_BOUNDS_REAL_TIME);
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 2, false), 2);
+    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 2, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_REAL_TIME);
+    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 2, VRT_VALIDATION_NONE), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x000000E8));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xD4A51000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -139,8 +140,8 @@ TEST_F(WriteFieldsTest, EveryOther1) {
     h_.packet_count              = 0xF;
     f_.stream_id                 = 0xDEADBEEF;
     f_.integer_seconds_timestamp = 0xFEDCBA98;
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 1, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 1, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0xDEADBEEF));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xFEDCBA98));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -156,8 +157,8 @@ TEST_F(WriteFieldsTest, EveryOther2) {
     f_.class_id.information_class_code = 0xFEDC;
     f_.class_id.packet_class_code      = 0xBA98;
     f_.fractional_seconds_timestamp    = 0xFEDCBA987654321F;
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 3, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 4, true), 4);
+    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 3, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 4, VRT_VALIDATION_FULL), 4);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00FEDCBA));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xFEDCBA98));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xFEDCBA98));
@@ -177,8 +178,8 @@ TEST_F(WriteFieldsTest, All) {
     f_.class_id.packet_class_code      = 0xBA98;
     f_.integer_seconds_timestamp       = 0xFEDCBA98;
     f_.fractional_seconds_timestamp    = 0xFEDCBA987654321F;
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 5, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 6, true), 6);
+    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 5, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_write_fields(&h_, &f_, buf_.data(), 6, VRT_VALIDATION_FULL), 6);
     ASSERT_EQ(Hex(buf_[0]), Hex(0xDEADBEEF));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00FEDCBA));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xFEDCBA98));
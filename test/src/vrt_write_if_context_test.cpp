@@ -80,24 +80,24 @@ static void buf_cmp_geolocation_ephemeris(const std::array<uint32_t, 1024>& buf,
 }
 
 TEST_F(WriteIfContextTest, NegativeSizeBuffer) {
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), -1, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), -1, false), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), -1, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), -1, VRT_VALIDATION_NONE), VRT_ERR_BUFFER_SIZE);
 }
 
 TEST_F(WriteIfContextTest, ZeroSizeBuffer) {
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 0, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 0, false), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 0, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 0, VRT_VALIDATION_NONE), VRT_ERR_BUFFER_SIZE);
 }
 
 TEST_F(WriteIfContextTest, None) {
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 1, true), 1);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 1, VRT_VALIDATION_FULL), 1);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xBAADF00D));
 }
 
 TEST_F(WriteIfContextTest, ContextFieldChange) {
     c_.context_field_change_indicator = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 1, true), 1);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 1, VRT_VALIDATION_FULL), 1);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x80000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xBAADF00D));
 }
@@ -105,7 +105,7 @@ TEST_F(WriteIfContextTest, ContextFieldChange) {
 TEST_F(WriteIfContextTest, ReferencePointIdentifier) {
     c_.has.reference_point_identifier = true;
     c_.reference_point_identifier     = 0xFEFEFEFE;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x40000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xFEFEFEFE));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -114,7 +114,7 @@ TEST_F(WriteIfContextTest, ReferencePointIdentifier) {
 TEST_F(WriteIfContextTest, Bandwidth) {
     c_.has.bandwidth = true;
     c_.bandwidth     = 4097.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x20000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000001));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00100000));
@@ -124,7 +124,7 @@ TEST_F(WriteIfContextTest, Bandwidth) {
 TEST_F(WriteIfContextTest, BandwidthSmall) {
     c_.has.bandwidth = true;
     c_.bandwidth     = 0.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x20000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
@@ -134,7 +134,7 @@ TEST_F(WriteIfContextTest, BandwidthSmall) {
 TEST_F(WriteIfContextTest, BandwidthLarge) {
     c_.has.bandwidth = true;
     c_.bandwidth     = 8.79e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x20000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x7FE94D3D));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xC0000000));
@@ -144,8 +144,8 @@ TEST_F(WriteIfContextTest, BandwidthLarge) {
 TEST_F(WriteIfContextTest, BandwidthInvalidSmall) {
     c_.has.bandwidth = true;
     c_.bandwidth     = -1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_BANDWIDTH);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_BANDWIDTH);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_NONE), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x20000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xFFFFFFFF));
     /* Due to low precision of double when converting to fixed point, don't do the comparison below */
@@ -156,14 +156,14 @@ TEST_F(WriteIfContextTest, BandwidthInvalidSmall) {
 TEST_F(WriteIfContextTest, BandwidthInvalidLarge) {
     c_.has.bandwidth = true;
     c_.bandwidth     = 8.80e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_BANDWIDTH);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_BANDWIDTH);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_NONE), 3);
 }
 
 TEST_F(WriteIfContextTest, IfReferenceFrequency) {
     c_.has.if_reference_frequency = true;
     c_.if_reference_frequency     = 4097.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x10000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000001));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00100000));
@@ -173,7 +173,7 @@ TEST_F(WriteIfContextTest, IfReferenceFrequency) {
 TEST_F(WriteIfContextTest, IfReferenceFrequencySmall) {
     c_.has.if_reference_frequency = true;
     c_.if_reference_frequency     = -8.79e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x10000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x8016B2C2));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x40000000));
@@ -183,7 +183,7 @@ TEST_F(WriteIfContextTest, IfReferenceFrequencySmall) {
 TEST_F(WriteIfContextTest, IfReferenceFrequencyLarge) {
     c_.has.if_reference_frequency = true;
     c_.if_reference_frequency     = 8.79e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x10000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x7FE94D3D));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xC0000000));
@@ -193,21 +193,21 @@ TEST_F(WriteIfContextTest, IfReferenceFrequencyLarge) {
 TEST_F(WriteIfContextTest, IfReferenceFrequencyInvalidSmall) {
     c_.has.if_reference_frequency = true;
     c_.if_reference_frequency     = -8.80e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_IF_REFERENCE_FREQUENCY);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_IF_REFERENCE_FREQUENCY);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_NONE), 3);
 }
 
 TEST_F(WriteIfContextTest, IfReferenceFrequencyInvalidLarge) {
     c_.has.if_reference_frequency = true;
     c_.if_reference_frequency     = 8.80e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_IF_REFERENCE_FREQUENCY);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_IF_REFERENCE_FREQUENCY);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_NONE), 3);
 }
 
 TEST_F(WriteIfContextTest, RfReferenceFrequency) {
     c_.has.rf_reference_frequency = true;
     c_.rf_reference_frequency     = 4097.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x08000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000001));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00100000));
@@ -217,7 +217,7 @@ TEST_F(WriteIfContextTest, RfReferenceFrequency) {
 TEST_F(WriteIfContextTest, RfReferenceFrequencySmall) {
     c_.has.rf_reference_frequency = true;
     c_.rf_reference_frequency     = -8.79e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x08000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x8016B2C2));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x40000000));
@@ -227,7 +227,7 @@ TEST_F(WriteIfContextTest, RfReferenceFrequencySmall) {
 TEST_F(WriteIfContextTest, RfReferenceFrequencyLarge) {
     c_.has.rf_reference_frequency = true;
     c_.rf_reference_frequency     = 8.79e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x08000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x7FE94D3D));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xC0000000));
@@ -237,21 +237,21 @@ TEST_F(WriteIfContextTest, RfReferenceFrequencyLarge) {
 TEST_F(WriteIfContextTest, RfReferenceFrequencyInvalidSmall) {
     c_.has.rf_reference_frequency = true;
     c_.rf_reference_frequency     = -8.80e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_RF_REFERENCE_FREQUENCY);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_RF_REFERENCE_FREQUENCY);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_NONE), 3);
 }
 
 TEST_F(WriteIfContextTest, RfReferenceFrequencyInvalidLarge) {
     c_.has.rf_reference_frequency = true;
     c_.rf_reference_frequency     = 8.80e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_RF_REFERENCE_FREQUENCY);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_RF_REFERENCE_FREQUENCY);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_NONE), 3);
 }
 
 TEST_F(WriteIfContextTest, RfReferenceFrequencyOffset) {
     c_.has.rf_reference_frequency_offset = true;
     c_.rf_reference_frequency_offset     = 4097.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x04000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000001));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00100000));
@@ -261,7 +261,7 @@ TEST_F(WriteIfContextTest, RfReferenceFrequencyOffset) {
 TEST_F(WriteIfContextTest, RfReferenceFrequencyOffsetSmall) {
     c_.has.rf_reference_frequency_offset = true;
     c_.rf_reference_frequency_offset     = -8.79e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x04000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x8016B2C2));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x40000000));
@@ -271,7 +271,7 @@ TEST_F(WriteIfContextTest, RfReferenceFrequencyOffsetSmall) {
 TEST_F(WriteIfContextTest, RfReferenceFrequencyOffsetLarge) {
     c_.has.rf_reference_frequency_offset = true;
     c_.rf_reference_frequency_offset     = 8.79e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x04000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x7FE94D3D));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xC0000000));
@@ -281,21 +281,23 @@ TEST_F(WriteIfContextTest, RfReferenceFrequencyOffsetLarge) {
 TEST_F(WriteIfContextTest, RfReferenceFrequencyOffsetInvalidSmall) {
     c_.has.rf_reference_frequency_offset = true;
     c_.rf_reference_frequency_offset     = -8.80e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_RF_REFERENCE_FREQUENCY_OFFSET);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL),
+              VRT_ERR_BOUNDS_RF_REFERENCE_FREQUENCY_OFFSET);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_NONE), 3);
 }
 
 TEST_F(WriteIfContextTest, RfReferenceFrequencyOffsetInvalidLarge) {
     c_.has.rf_reference_frequency_offset = true;
     c_.rf_reference_frequency_offset     = 8.80e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_RF_REFERENCE_FREQUENCY_OFFSET);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL),
+              VRT_ERR_BOUNDS_RF_REFERENCE_FREQUENCY_OFFSET);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_NONE), 3);
 }
 
 TEST_F(WriteIfContextTest, IfBandOffset) {
     c_.has.if_band_offset = true;
     c_.if_band_offset     = 4097.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x02000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000001));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00100000));
@@ -305,7 +307,7 @@ TEST_F(WriteIfContextTest, IfBandOffset) {
 TEST_F(WriteIfContextTest, IfBandOffsetSmall) {
     c_.has.if_band_offset = true;
     c_.if_band_offset     = -8.79e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x02000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x8016B2C2));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x40000000));
@@ -315,7 +317,7 @@ TEST_F(WriteIfContextTest, IfBandOffsetSmall) {
 TEST_F(WriteIfContextTest, IfBandOffsetLarge) {
     c_.has.if_band_offset = true;
     c_.if_band_offset     = 8.79e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x02000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x7FE94D3D));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xC0000000));
@@ -325,21 +327,21 @@ TEST_F(WriteIfContextTest, IfBandOffsetLarge) {
 TEST_F(WriteIfContextTest, IfBandOffsetInvalidSmall) {
     c_.has.if_band_offset = true;
     c_.if_band_offset     = -8.80e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_IF_BAND_OFFSET);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_IF_BAND_OFFSET);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_NONE), 3);
 }
 
 TEST_F(WriteIfContextTest, IfBandOffsetInvalidLarge) {
     c_.has.if_band_offset = true;
     c_.if_band_offset     = 8.80e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_IF_BAND_OFFSET);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_IF_BAND_OFFSET);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_NONE), 3);
 }
 
 TEST_F(WriteIfContextTest, ReferenceLevel) {
     c_.has.reference_level = true;
     c_.reference_level     = -1.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x01000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x0000FF80));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -348,7 +350,7 @@ TEST_F(WriteIfContextTest, ReferenceLevel) {
 TEST_F(WriteIfContextTest, ReferenceLevelSmall) {
     c_.has.reference_level = true;
     c_.reference_level     = -256.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x01000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -357,7 +359,7 @@ TEST_F(WriteIfContextTest, ReferenceLevelSmall) {
 TEST_F(WriteIfContextTest, ReferenceLevelLarge) {
     c_.has.reference_level = true;
     c_.reference_level     = 255.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x01000000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00007F80));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -366,22 +368,22 @@ TEST_F(WriteIfContextTest, ReferenceLevelLarge) {
 TEST_F(WriteIfContextTest, ReferenceLevelInvalidSmall) {
     c_.has.reference_level = true;
     c_.reference_level     = -257.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), VRT_ERR_BOUNDS_REFERENCE_LEVEL);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, false), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_REFERENCE_LEVEL);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_NONE), 2);
 }
 
 TEST_F(WriteIfContextTest, ReferenceLevelInvalidLarge) {
     c_.has.reference_level = true;
     c_.reference_level     = 256.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), VRT_ERR_BOUNDS_REFERENCE_LEVEL);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, false), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_REFERENCE_LEVEL);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_NONE), 2);
 }
 
 TEST_F(WriteIfContextTest, Gain1) {
     c_.has.gain    = true;
     c_.gain.stage1 = -1.0F;
     c_.gain.stage2 = 1.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00800000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x0080FF80));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -391,7 +393,7 @@ TEST_F(WriteIfContextTest, Gain2) {
     c_.has.gain    = true;
     c_.gain.stage1 = -1.0F;
     c_.gain.stage2 = 0.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00800000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x0000FF80));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -401,7 +403,7 @@ TEST_F(WriteIfContextTest, GainSmall) {
     c_.has.gain    = true;
     c_.gain.stage1 = -256.0F;
     c_.gain.stage2 = -256.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00800000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x80008000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -411,7 +413,7 @@ TEST_F(WriteIfContextTest, GainLarge) {
     c_.has.gain    = true;
     c_.gain.stage1 = 255.0F;
     c_.gain.stage2 = 255.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00800000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x7F807F80));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -421,40 +423,41 @@ TEST_F(WriteIfContextTest, GainStage1InvalidSmall) {
     c_.has.gain    = true;
     c_.gain.stage1 = -257.0F;
     c_.gain.stage2 = 1.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), VRT_ERR_BOUNDS_GAIN);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, false), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_GAIN);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_NONE), 2);
 }
 
 TEST_F(WriteIfContextTest, GainStage2InvalidSmall) {
     c_.has.gain    = true;
     c_.gain.stage1 = 1.0F;
     c_.gain.stage2 = -257.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), VRT_ERR_BOUNDS_GAIN);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, false), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_GAIN);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_NONE), 2);
 }
 
 TEST_F(WriteIfContextTest, GainStage1InvalidLarge) {
     c_.has.gain    = true;
     c_.gain.stage1 = 256.0F;
     c_.gain.stage2 = 1.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), VRT_ERR_BOUNDS_GAIN);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, false), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_GAIN);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_NONE), 2);
 }
 
 TEST_F(WriteIfContextTest, GainStage2InvalidLarge) {
     c_.has.gain    = true;
     c_.gain.stage1 = 1.0F;
     c_.gain.stage2 = 256.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), VRT_ERR_BOUNDS_GAIN);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, false), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_GAIN);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_NONE), 2);
 }
 
 TEST_F(WriteIfContextTest, GainInvalidStage2Set) {
     c_.has.gain    = true;
     c_.gain.stage1 = 0.0F;
     c_.gain.stage2 = 1.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), VRT_ERR_GAIN_STAGE2_SET);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, false), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), VRT_ERR_GAIN_STAGE2_SET);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_STRUCTURAL), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_NONE), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00800000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00800000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -463,7 +466,7 @@ TEST_F(WriteIfContextTest, GainInvalidStage2Set) {
 TEST_F(WriteIfContextTest, OverRangeCount) {
     c_.has.over_range_count = true;
     c_.over_range_count     = 0xFEFEFEFE;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00400000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xFEFEFEFE));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -472,7 +475,7 @@ TEST_F(WriteIfContextTest, OverRangeCount) {
 TEST_F(WriteIfContextTest, SampleRate) {
     c_.has.sample_rate = true;
     c_.sample_rate     = 4097.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00200000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000001));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00100000));
@@ -482,7 +485,7 @@ TEST_F(WriteIfContextTest, SampleRate) {
 TEST_F(WriteIfContextTest, SampleRateSmall) {
     c_.has.sample_rate = true;
     c_.sample_rate     = 0.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00200000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
@@ -492,7 +495,7 @@ TEST_F(WriteIfContextTest, SampleRateSmall) {
 TEST_F(WriteIfContextTest, SampleRateLarge) {
     c_.has.sample_rate = true;
     c_.sample_rate     = 8.79e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00200000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x7FE94D3D));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xC0000000));
@@ -502,8 +505,8 @@ TEST_F(WriteIfContextTest, SampleRateLarge) {
 TEST_F(WriteIfContextTest, SampleRateInvalidSmall) {
     c_.has.sample_rate = true;
     c_.sample_rate     = -1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_SAMPLE_RATE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_SAMPLE_RATE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_NONE), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00200000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xFFFFFFFF));
     /* Due to low precision of double when converting to fixed point, don't do the comparison below */
@@ -514,14 +517,14 @@ TEST_F(WriteIfContextTest, SampleRateInvalidSmall) {
 TEST_F(WriteIfContextTest, SampleRateInvalidLarge) {
     c_.has.sample_rate = true;
     c_.sample_rate     = 8.80e12;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_SAMPLE_RATE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_SAMPLE_RATE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_NONE), 3);
 }
 
 TEST_F(WriteIfContextTest, TimestampAdjustment) {
     c_.has.timestamp_adjustment = true;
     c_.timestamp_adjustment     = 0xABABABABBEBEBEBE;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00100000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xABABABAB));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBEBEBEBE));
@@ -531,7 +534,7 @@ TEST_F(WriteIfContextTest, TimestampAdjustment) {
 TEST_F(WriteIfContextTest, TimestampCalibrationTime) {
     c_.has.timestamp_calibration_time = true;
     c_.timestamp_calibration_time     = 0xABABABAB;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00080000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xABABABAB));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -540,7 +543,7 @@ TEST_F(WriteIfContextTest, TimestampCalibrationTime) {
 TEST_F(WriteIfContextTest, Temperature) {
     c_.has.temperature = true;
     c_.temperature     = -1.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00040000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x0000FFC0));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -549,7 +552,7 @@ TEST_F(WriteIfContextTest, Temperature) {
 TEST_F(WriteIfContextTest, TemperatureSmall) {
     c_.has.temperature = true;
     c_.temperature     = -273.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00040000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x0000BBC0));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -558,7 +561,7 @@ TEST_F(WriteIfContextTest, TemperatureSmall) {
 TEST_F(WriteIfContextTest, TemperatureLarge) {
     c_.has.temperature = true;
     c_.temperature     = 511.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00040000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00007FC0));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -567,8 +570,8 @@ TEST_F(WriteIfContextTest, TemperatureLarge) {
 TEST_F(WriteIfContextTest, TemperatureInvalidSmall) {
     c_.has.temperature = true;
     c_.temperature     = -274.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), VRT_ERR_BOUNDS_TEMPERATURE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, false), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_TEMPERATURE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_NONE), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00040000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x0000BB80));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -577,14 +580,14 @@ TEST_F(WriteIfContextTest, TemperatureInvalidSmall) {
 TEST_F(WriteIfContextTest, TemperatureInvalidLarge) {
     c_.has.temperature = true;
     c_.temperature     = 512.0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), VRT_ERR_BOUNDS_TEMPERATURE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, false), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_TEMPERATURE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_NONE), 2);
 }
 
 TEST_F(WriteIfContextTest, DeviceIdentifierOui) {
     c_.has.device_identifier = true;
     c_.device_identifier.oui = 0x00FFFFFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00020000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00FFFFFF));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
@@ -595,8 +598,8 @@ TEST_F(WriteIfContextTest, DeviceIdentifierOuiInvalid) {
     c_.has.device_identifier         = true;
     c_.device_identifier.oui         = 0x01FFFFFF;
     c_.device_identifier.device_code = 0xABAF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_OUI);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_OUI);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_NONE), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00020000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00FFFFFF));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x0000ABAF));
@@ -606,7 +609,7 @@ TEST_F(WriteIfContextTest, DeviceIdentifierOuiInvalid) {
 TEST_F(WriteIfContextTest, DeviceIdentifierDeviceCode) {
     c_.has.device_identifier         = true;
     c_.device_identifier.device_code = 0xABAF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00020000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x0000ABAF));
@@ -616,7 +619,7 @@ TEST_F(WriteIfContextTest, DeviceIdentifierDeviceCode) {
 TEST_F(WriteIfContextTest, StateAndEventIndicatorsHasCalibratedTime) {
     c_.has.state_and_event_indicators                 = true;
     c_.state_and_event_indicators.has.calibrated_time = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x80000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -625,7 +628,7 @@ TEST_F(WriteIfContextTest, StateAndEventIndicatorsHasCalibratedTime) {
 TEST_F(WriteIfContextTest, StateAndEventIndicatorsHasValidData) {
     c_.has.state_and_event_indicators            = true;
     c_.state_and_event_indicators.has.valid_data = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x40000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -634,7 +637,7 @@ TEST_F(WriteIfContextTest, StateAndEventIndicatorsHasValidData) {
 TEST_F(WriteIfContextTest, StateAndEventIndicatorsHasReferenceLock) {
     c_.has.state_and_event_indicators                = true;
     c_.state_and_event_indicators.has.reference_lock = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x20000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -643,7 +646,7 @@ TEST_F(WriteIfContextTest, StateAndEventIndicatorsHasReferenceLock) {
 TEST_F(WriteIfContextTest, StateAndEventIndicatorsHasAgcOrMgc) {
     c_.has.state_and_event_indicators            = true;
     c_.state_and_event_indicators.has.agc_or_mgc = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x10000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -652,7 +655,7 @@ TEST_F(WriteIfContextTest, StateAndEventIndicatorsHasAgcOrMgc) {
 TEST_F(WriteIfContextTest, StateAndEventIndicatorsHasDetectedSignal) {
     c_.has.state_and_event_indicators                 = true;
     c_.state_and_event_indicators.has.detected_signal = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x08000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -661,7 +664,7 @@ TEST_F(WriteIfContextTest, StateAndEventIndicatorsHasDetectedSignal) {
 TEST_F(WriteIfContextTest, StateAndEventIndicatorsHasSpectralInversion) {
     c_.has.state_and_event_indicators                    = true;
     c_.state_and_event_indicators.has.spectral_inversion = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x04000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -670,7 +673,7 @@ TEST_F(WriteIfContextTest, StateAndEventIndicatorsHasSpectralInversion) {
 TEST_F(WriteIfContextTest, StateAndEventIndicatorsHasOverRange) {
     c_.has.state_and_event_indicators            = true;
     c_.state_and_event_indicators.has.over_range = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x02000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -679,7 +682,7 @@ TEST_F(WriteIfContextTest, StateAndEventIndicatorsHasOverRange) {
 TEST_F(WriteIfContextTest, StateAndEventIndicatorsHasSampleLoss) {
     c_.has.state_and_event_indicators             = true;
     c_.state_and_event_indicators.has.sample_loss = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x01000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -688,7 +691,7 @@ TEST_F(WriteIfContextTest, StateAndEventIndicatorsHasSampleLoss) {
 TEST_F(WriteIfContextTest, StateAndEventIndicatorsCalibratedTime) {
     c_.has.state_and_event_indicators             = true;
     c_.state_and_event_indicators.calibrated_time = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -697,7 +700,7 @@ TEST_F(WriteIfContextTest, StateAndEventIndicatorsCalibratedTime) {
 TEST_F(WriteIfContextTest, StateAndEventIndicatorsValidData) {
     c_.has.state_and_event_indicators        = true;
     c_.state_and_event_indicators.valid_data = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -706,7 +709,7 @@ TEST_F(WriteIfContextTest, StateAndEventIndicatorsValidData) {
 TEST_F(WriteIfContextTest, StateAndEventIndicatorsReferenceLock) {
     c_.has.state_and_event_indicators            = true;
     c_.state_and_event_indicators.reference_lock = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -715,7 +718,7 @@ TEST_F(WriteIfContextTest, StateAndEventIndicatorsReferenceLock) {
 TEST_F(WriteIfContextTest, StateAndEventIndicatorsAgcOrMgc) {
     c_.has.state_and_event_indicators        = true;
     c_.state_and_event_indicators.agc_or_mgc = VRT_AOM_AGC;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -724,7 +727,7 @@ TEST_F(WriteIfContextTest, StateAndEventIndicatorsAgcOrMgc) {
 TEST_F(WriteIfContextTest, StateAndEventIndicatorsDetectedSignal) {
     c_.has.state_and_event_indicators             = true;
     c_.state_and_event_indicators.detected_signal = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -733,7 +736,7 @@ TEST_F(WriteIfContextTest, StateAndEventIndicatorsDetectedSignal) {
 TEST_F(WriteIfContextTest, StateAndEventIndicatorsSpectralInversion) {
     c_.has.state_and_event_indicators                = true;
     c_.state_and_event_indicators.spectral_inversion = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -742,7 +745,7 @@ TEST_F(WriteIfContextTest, StateAndEventIndicatorsSpectralInversion) {
 TEST_F(WriteIfContextTest, StateAndEventIndicatorsOverRange) {
     c_.has.state_and_event_indicators        = true;
     c_.state_and_event_indicators.over_range = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -751,7 +754,7 @@ TEST_F(WriteIfContextTest, StateAndEventIndicatorsOverRange) {
 TEST_F(WriteIfContextTest, StateAndEventIndicatorsSampleLoss) {
     c_.has.state_and_event_indicators         = true;
     c_.state_and_event_indicators.sample_loss = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -761,7 +764,7 @@ TEST_F(WriteIfContextTest, StateAndEventIndicatorsBothCalibratedTime) {
     c_.has.state_and_event_indicators                 = true;
     c_.state_and_event_indicators.has.calibrated_time = true;
     c_.state_and_event_indicators.calibrated_time     = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x80080000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -771,7 +774,7 @@ TEST_F(WriteIfContextTest, StateAndEventIndicatorsBothValidData) {
     c_.has.state_and_event_indicators            = true;
     c_.state_and_event_indicators.has.valid_data = true;
     c_.state_and_event_indicators.valid_data     = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x40040000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -781,7 +784,7 @@ TEST_F(WriteIfContextTest, StateAndEventIndicatorsBothReferenceLock) {
     c_.has.state_and_event_indicators                = true;
     c_.state_and_event_indicators.has.reference_lock = true;
     c_.state_and_event_indicators.reference_lock     = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x20020000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -791,7 +794,7 @@ TEST_F(WriteIfContextTest, StateAndEventIndicatorsBothAgcOrMgc) {
     c_.has.state_and_event_indicators            = true;
     c_.state_and_event_indicators.has.agc_or_mgc = true;
     c_.state_and_event_indicators.agc_or_mgc     = VRT_AOM_AGC;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x10010000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -801,7 +804,7 @@ TEST_F(WriteIfContextTest, StateAndEventIndicatorsBothDetectedSignal) {
     c_.has.state_and_event_indicators                 = true;
     c_.state_and_event_indicators.has.detected_signal = true;
     c_.state_and_event_indicators.detected_signal     = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x08008000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -811,7 +814,7 @@ TEST_F(WriteIfContextTest, StateAndEventIndicatorsBothSpectralInversion) {
     c_.has.state_and_event_indicators                    = true;
     c_.state_and_event_indicators.has.spectral_inversion = true;
     c_.state_and_event_indicators.spectral_inversion     = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x04004000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -821,7 +824,7 @@ TEST_F(WriteIfContextTest, StateAndEventIndicatorsBothOverRange) {
     c_.has.state_and_event_indicators            = true;
     c_.state_and_event_indicators.has.over_range = true;
     c_.state_and_event_indicators.over_range     = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x02002000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -831,7 +834,7 @@ TEST_F(WriteIfContextTest, StateAndEventIndicatorsBothSampleLoss) {
     c_.has.state_and_event_indicators             = true;
     c_.state_and_event_indicators.has.sample_loss = true;
     c_.state_and_event_indicators.sample_loss     = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x01001000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -840,7 +843,7 @@ TEST_F(WriteIfContextTest, StateAndEventIndicatorsBothSampleLoss) {
 TEST_F(WriteIfContextTest, StateAndEventIndicatorsBothUserDefined) {
     c_.has.state_and_event_indicators          = true;
     c_.state_and_event_indicators.user_defined = 0xFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00010000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x000000FF));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -849,7 +852,7 @@ TEST_F(WriteIfContextTest, StateAndEventIndicatorsBothUserDefined) {
 TEST_F(WriteIfContextTest, DataPacketPayloadFormatPackingMethod) {
     c_.has.data_packet_payload_format            = true;
     c_.data_packet_payload_format.packing_method = VRT_PM_LINK_EFFICIENT;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x80000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
@@ -859,8 +862,8 @@ TEST_F(WriteIfContextTest, DataPacketPayloadFormatPackingMethod) {
 TEST_F(WriteIfContextTest, DataPacketPayloadFormatPackingMethodInvalidSmall) {
     c_.has.data_packet_payload_format            = true;
     c_.data_packet_payload_format.packing_method = static_cast<vrt_packing_method>(-1);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_INVALID_PACKING_METHOD);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), VRT_ERR_INVALID_PACKING_METHOD);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_NONE), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x80000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
@@ -870,8 +873,8 @@ TEST_F(WriteIfContextTest, DataPacketPayloadFormatPackingMethodInvalidSmall) {
 TEST_F(WriteIfContextTest, DataPacketPayloadFormatPackingMethodInvalidLarge) {
     c_.has.data_packet_payload_format            = true;
     c_.data_packet_payload_format.packing_method = static_cast<vrt_packing_method>(2);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_INVALID_PACKING_METHOD);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), VRT_ERR_INVALID_PACKING_METHOD);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_NONE), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
@@ -881,7 +884,7 @@ TEST_F(WriteIfContextTest, DataPacketPayloadFormatPackingMethodInvalidLarge) {
 TEST_F(WriteIfContextTest, DataPacketPayloadFormatRealOrComplex) {
     c_.has.data_packet_payload_format             = true;
     c_.data_packet_payload_format.real_or_complex = VRT_ROC_COMPLEX_POLAR;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x40000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
@@ -891,8 +894,8 @@ TEST_F(WriteIfContextTest, DataPacketPayloadFormatRealOrComplex) {
 TEST_F(WriteIfContextTest, DataPacketPayloadFormatRealOrComplexInvalidSmall) {
     c_.has.data_packet_payload_format             = true;
     c_.data_packet_payload_format.real_or_complex = static_cast<vrt_real_complex>(-1);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_INVALID_REAL_OR_COMPLEX);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), VRT_ERR_INVALID_REAL_OR_COMPLEX);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_NONE), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x60000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
@@ -902,8 +905,8 @@ TEST_F(WriteIfContextTest, DataPacketPayloadFormatRealOrComplexInvalidSmall) {
 TEST_F(WriteIfContextTest, DataPacketPayloadFormatRealOrComplexInvalidLarge) {
     c_.has.data_packet_payload_format             = true;
     c_.data_packet_payload_format.real_or_complex = static_cast<vrt_real_complex>(3);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_INVALID_REAL_OR_COMPLEX);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), VRT_ERR_INVALID_REAL_OR_COMPLEX);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_NONE), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x60000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
@@ -913,7 +916,7 @@ TEST_F(WriteIfContextTest, DataPacketPayloadFormatRealOrComplexInvalidLarge) {
 TEST_F(WriteIfContextTest, DataPacketPayloadFormatDataItemFormat) {
     c_.has.data_packet_payload_format              = true;
     c_.data_packet_payload_format.data_item_format = VRT_DIF_UNSIGNED_VRT_6_BIT_EXPONENT;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x16000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
@@ -923,8 +926,8 @@ TEST_F(WriteIfContextTest, DataPacketPayloadFormatDataItemFormat) {
 TEST_F(WriteIfContextTest, DataPacketPayloadFormatDataItemFormatInvalid1) {
     c_.has.data_packet_payload_format              = true;
     c_.data_packet_payload_format.data_item_format = static_cast<vrt_data_item_format>(-1);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_INVALID_DATA_ITEM_FORMAT);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), VRT_ERR_INVALID_DATA_ITEM_FORMAT);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_NONE), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x1F000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
@@ -934,8 +937,8 @@ TEST_F(WriteIfContextTest, DataPacketPayloadFormatDataItemFormatInvalid1) {
 TEST_F(WriteIfContextTest, DataPacketPayloadFormatDataItemFormatInvalid2) {
     c_.has.data_packet_payload_format              = true;
     c_.data_packet_payload_format.data_item_format = static_cast<vrt_data_item_format>(0x07);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_INVALID_DATA_ITEM_FORMAT);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), VRT_ERR_INVALID_DATA_ITEM_FORMAT);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_NONE), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x07000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
@@ -945,8 +948,8 @@ TEST_F(WriteIfContextTest, DataPacketPayloadFormatDataItemFormatInvalid2) {
 TEST_F(WriteIfContextTest, DataPacketPayloadFormatDataItemFormatInvalid3) {
     c_.has.data_packet_payload_format              = true;
     c_.data_packet_payload_format.data_item_format = static_cast<vrt_data_item_format>(0x0D);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_INVALID_DATA_ITEM_FORMAT);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), VRT_ERR_INVALID_DATA_ITEM_FORMAT);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_NONE), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x0D000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
@@ -956,8 +959,8 @@ TEST_F(WriteIfContextTest, DataPacketPayloadFormatDataItemFormatInvalid3) {
 TEST_F(WriteIfContextTest, DataPacketPayloadFormatDataItemFormatInvalid4) {
     c_.has.data_packet_payload_format              = true;
     c_.data_packet_payload_format.data_item_format = static_cast<vrt_data_item_format>(0x17);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_INVALID_DATA_ITEM_FORMAT);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), VRT_ERR_INVALID_DATA_ITEM_FORMAT);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_NONE), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x17000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
@@ -967,7 +970,7 @@ TEST_F(WriteIfContextTest, DataPacketPayloadFormatDataItemFormatInvalid4) {
 TEST_F(WriteIfContextTest, DataPacketPayloadFormatSampleComponentRepeat) {
     c_.has.data_packet_payload_format                     = true;
     c_.data_packet_payload_format.sample_component_repeat = true;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00800000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
@@ -977,7 +980,7 @@ TEST_F(WriteIfContextTest, DataPacketPayloadFormatSampleComponentRepeat) {
 TEST_F(WriteIfContextTest, DataPacketPayloadFormatEventTagSize) {
     c_.has.data_packet_payload_format            = true;
     c_.data_packet_payload_format.event_tag_size = 0x07;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00700000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
@@ -987,8 +990,8 @@ TEST_F(WriteIfContextTest, DataPacketPayloadFormatEventTagSize) {
 TEST_F(WriteIfContextTest, DataPacketPayloadFormatEventTagSizeInvalid) {
     c_.has.data_packet_payload_format            = true;
     c_.data_packet_payload_format.event_tag_size = 0x08;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_EVENT_TAG_SIZE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_EVENT_TAG_SIZE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_NONE), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
@@ -998,7 +1001,7 @@ TEST_F(WriteIfContextTest, DataPacketPayloadFormatEventTagSizeInvalid) {
 TEST_F(WriteIfContextTest, DataPacketPayloadFormatChannelTagSize) {
     c_.has.data_packet_payload_format              = true;
     c_.data_packet_payload_format.channel_tag_size = 0x0F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x000F0000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
@@ -1008,8 +1011,8 @@ TEST_F(WriteIfContextTest, DataPacketPayloadFormatChannelTagSize) {
 TEST_F(WriteIfContextTest, DataPacketPayloadFormatChannelTagSizeInvalid) {
     c_.has.data_packet_payload_format              = true;
     c_.data_packet_payload_format.channel_tag_size = 0x10;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_CHANNEL_TAG_SIZE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_CHANNEL_TAG_SIZE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_NONE), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
@@ -1019,7 +1022,7 @@ TEST_F(WriteIfContextTest, DataPacketPayloadFormatChannelTagSizeInvalid) {
 TEST_F(WriteIfContextTest, DataPacketPayloadFormatItemPackingFieldSize) {
     c_.has.data_packet_payload_format                     = true;
     c_.data_packet_payload_format.item_packing_field_size = 0x3F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000FC0));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
@@ -1029,8 +1032,8 @@ TEST_F(WriteIfContextTest, DataPacketPayloadFormatItemPackingFieldSize) {
 TEST_F(WriteIfContextTest, DataPacketPayloadFormatItemPackingFieldSizeInvalid) {
     c_.has.data_packet_payload_format                     = true;
     c_.data_packet_payload_format.item_packing_field_size = 0x40;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_ITEM_PACKING_FIELD_SIZE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_ITEM_PACKING_FIELD_SIZE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_NONE), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
@@ -1040,7 +1043,7 @@ TEST_F(WriteIfContextTest, DataPacketPayloadFormatItemPackingFieldSizeInvalid) {
 TEST_F(WriteIfContextTest, DataPacketPayloadFormatDataItemSize) {
     c_.has.data_packet_payload_format            = true;
     c_.data_packet_payload_format.data_item_size = 0x3F;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x0000003F));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
@@ -1050,8 +1053,8 @@ TEST_F(WriteIfContextTest, DataPacketPayloadFormatDataItemSize) {
 TEST_F(WriteIfContextTest, DataPacketPayloadFormatDataItemSizeInvalid) {
     c_.has.data_packet_payload_format            = true;
     c_.data_packet_payload_format.data_item_size = 0x40;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_DATA_ITEM_SIZE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_DATA_ITEM_SIZE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_NONE), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
@@ -1061,7 +1064,7 @@ TEST_F(WriteIfContextTest, DataPacketPayloadFormatDataItemSizeInvalid) {
 TEST_F(WriteIfContextTest, DataPacketPayloadFormatRepeatCount) {
     c_.has.data_packet_payload_format          = true;
     c_.data_packet_payload_format.repeat_count = 0xFFFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xFFFF0000));
@@ -1071,7 +1074,7 @@ TEST_F(WriteIfContextTest, DataPacketPayloadFormatRepeatCount) {
 TEST_F(WriteIfContextTest, DataPacketPayloadFormatVectorSize) {
     c_.has.data_packet_payload_format         = true;
     c_.data_packet_payload_format.vector_size = 0xFFFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00008000));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x0000FFFF));
@@ -1081,7 +1084,7 @@ TEST_F(WriteIfContextTest, DataPacketPayloadFormatVectorSize) {
 TEST_F(WriteIfContextTest, FormattedGpsGeolocationTsi) {
     c_.has.formatted_gps_geolocation = true;
     c_.formatted_gps_geolocation.tsi = VRT_TSI_OTHER;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, true);
@@ -1091,8 +1094,8 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationTsi) {
 TEST_F(WriteIfContextTest, FormattedGpsGeolocationTsiInvalidSmall) {
     c_.has.formatted_gps_geolocation = true;
     c_.formatted_gps_geolocation.tsi = static_cast<vrt_tsi>(-1);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_INVALID_TSI);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_INVALID_TSI);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, true);
@@ -1102,8 +1105,8 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationTsiInvalidSmall) {
 TEST_F(WriteIfContextTest, FormattedGpsGeolocationTsiInvalidLarge) {
     c_.has.formatted_gps_geolocation = true;
     c_.formatted_gps_geolocation.tsi = static_cast<vrt_tsi>(4);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_INVALID_TSI);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_INVALID_TSI);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
@@ -1112,7 +1115,7 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationTsiInvalidLarge) {
 TEST_F(WriteIfContextTest, FormattedGpsGeolocationTsf) {
     c_.has.formatted_gps_geolocation = true;
     c_.formatted_gps_geolocation.tsf = VRT_TSF_FREE_RUNNING_COUNT;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, true);
@@ -1122,8 +1125,8 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationTsf) {
 TEST_F(WriteIfContextTest, FormattedGpsGeolocationTsfInvalidSmall) {
     c_.has.formatted_gps_geolocation = true;
     c_.formatted_gps_geolocation.tsf = static_cast<vrt_tsf>(-1);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_INVALID_TSF);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_INVALID_TSF);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, true);
@@ -1133,8 +1136,8 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationTsfInvalidSmall) {
 TEST_F(WriteIfContextTest, FormattedGpsGeolocationTsfInvalidLarge) {
     c_.has.formatted_gps_geolocation = true;
     c_.formatted_gps_geolocation.tsf = static_cast<vrt_tsf>(4);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_INVALID_TSF);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_INVALID_TSF);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
@@ -1143,7 +1146,7 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationTsfInvalidLarge) {
 TEST_F(WriteIfContextTest, FormattedGpsGeolocationOui) {
     c_.has.formatted_gps_geolocation = true;
     c_.formatted_gps_geolocation.oui = 0x00FFFFFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, true);
@@ -1153,8 +1156,8 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationOui) {
 TEST_F(WriteIfContextTest, FormattedGpsGeolocationOuiInvalid) {
     c_.has.formatted_gps_geolocation = true;
     c_.formatted_gps_geolocation.oui = 0x01FFFFFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_OUI);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_OUI);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, true);
@@ -1165,7 +1168,7 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationIntegerSecondTimestamp) {
     c_.has.formatted_gps_geolocation                      = true;
     c_.formatted_gps_geolocation.tsi                      = VRT_TSI_UTC;
     c_.formatted_gps_geolocation.integer_second_timestamp = 0xABABABAB;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {{1, 2}}, true);
@@ -1177,8 +1180,8 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationIntegerSecondTimestampInvalid)
     c_.has.formatted_gps_geolocation                      = true;
     c_.formatted_gps_geolocation.tsi                      = VRT_TSI_UNDEFINED;
     c_.formatted_gps_geolocation.integer_second_timestamp = 0xABABABAB;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {2}, true);
@@ -1189,7 +1192,7 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationFractionalSecondTimestamp) {
     c_.has.formatted_gps_geolocation                         = true;
     c_.formatted_gps_geolocation.tsf                         = VRT_TSF_REAL_TIME;
     c_.formatted_gps_geolocation.fractional_second_timestamp = 0x000000E8D4A50FFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {{1, 3, 4}}, true);
@@ -1202,8 +1205,8 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationFractionalSecondTimestampInval
     c_.has.formatted_gps_geolocation                         = true;
     c_.formatted_gps_geolocation.tsf                         = VRT_TSF_UNDEFINED;
     c_.formatted_gps_geolocation.fractional_second_timestamp = 0x000000E8D4A50FFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_SET_FRACTIONAL_SECOND_TIMESTAMP);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_SET_FRACTIONAL_SECOND_TIMESTAMP);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {{3, 4}}, true);
@@ -1215,8 +1218,8 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationFractionalSecondTimestampInval
     c_.has.formatted_gps_geolocation                         = true;
     c_.formatted_gps_geolocation.tsf                         = VRT_TSF_REAL_TIME;
     c_.formatted_gps_geolocation.fractional_second_timestamp = 0x000000E8D4A51000;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_REAL_TIME);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_REAL_TIME);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {{1, 3, 4}}, true);
@@ -1228,7 +1231,7 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationFractionalSecondTimestampInval
 TEST_F(WriteIfContextTest, FormattedGpsGeolocationLatitude) {
     c_.has.formatted_gps_geolocation      = true;
     c_.formatted_gps_geolocation.latitude = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
@@ -1237,7 +1240,7 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationLatitude) {
 TEST_F(WriteIfContextTest, FormattedGpsGeolocationLongitude) {
     c_.has.formatted_gps_geolocation       = true;
     c_.formatted_gps_geolocation.longitude = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
@@ -1246,7 +1249,7 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationLongitude) {
 TEST_F(WriteIfContextTest, FormattedGpsGeolocationAltitude) {
     c_.has.formatted_gps_geolocation      = true;
     c_.formatted_gps_geolocation.altitude = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
@@ -1255,7 +1258,7 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationAltitude) {
 TEST_F(WriteIfContextTest, FormattedGpsGeolocationSpeedOverGround) {
     c_.has.formatted_gps_geolocation               = true;
     c_.formatted_gps_geolocation.speed_over_ground = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
@@ -1264,7 +1267,7 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationSpeedOverGround) {
 TEST_F(WriteIfContextTest, FormattedGpsGeolocationHeadingAngle) {
     c_.has.formatted_gps_geolocation           = true;
     c_.formatted_gps_geolocation.heading_angle = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
@@ -1273,7 +1276,7 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationHeadingAngle) {
 TEST_F(WriteIfContextTest, FormattedGpsGeolocationTrackAngle) {
     c_.has.formatted_gps_geolocation         = true;
     c_.formatted_gps_geolocation.track_angle = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
@@ -1282,7 +1285,7 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationTrackAngle) {
 TEST_F(WriteIfContextTest, FormattedGpsGeolocationMagneticVariation) {
     c_.has.formatted_gps_geolocation                = true;
     c_.formatted_gps_geolocation.magnetic_variation = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
@@ -1292,7 +1295,7 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothLatitude) {
     c_.has.formatted_gps_geolocation          = true;
     c_.formatted_gps_geolocation.has.latitude = true;
     c_.formatted_gps_geolocation.latitude     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {5}, true);
@@ -1303,7 +1306,7 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothLatitudeSmall) {
     c_.has.formatted_gps_geolocation          = true;
     c_.formatted_gps_geolocation.has.latitude = true;
     c_.formatted_gps_geolocation.latitude     = -90.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {5}, true);
@@ -1314,7 +1317,7 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothLatitudeLarge) {
     c_.has.formatted_gps_geolocation          = true;
     c_.formatted_gps_geolocation.has.latitude = true;
     c_.formatted_gps_geolocation.latitude     = 90.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {5}, true);
@@ -1325,8 +1328,8 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothLatitudeInvalidSmall) {
     c_.has.formatted_gps_geolocation          = true;
     c_.formatted_gps_geolocation.has.latitude = true;
     c_.formatted_gps_geolocation.latitude     = -91.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_LATITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_LATITUDE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {5}, true);
@@ -1337,8 +1340,8 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothLatitudeInvalidLarge) {
     c_.has.formatted_gps_geolocation          = true;
     c_.formatted_gps_geolocation.has.latitude = true;
     c_.formatted_gps_geolocation.latitude     = 91.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_LATITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_LATITUDE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {5}, true);
@@ -1349,7 +1352,7 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothLongitude) {
     c_.has.formatted_gps_geolocation           = true;
     c_.formatted_gps_geolocation.has.longitude = true;
     c_.formatted_gps_geolocation.longitude     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {6}, true);
@@ -1360,7 +1363,7 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothLongitudeSmall) {
     c_.has.formatted_gps_geolocation           = true;
     c_.formatted_gps_geolocation.has.longitude = true;
     c_.formatted_gps_geolocation.longitude     = -180.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {6}, true);
@@ -1371,7 +1374,7 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothLongitudeLarge) {
     c_.has.formatted_gps_geolocation           = true;
     c_.formatted_gps_geolocation.has.longitude = true;
     c_.formatted_gps_geolocation.longitude     = 180.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {6}, true);
@@ -1382,8 +1385,8 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothLongitudeInvalidSmall) {
     c_.has.formatted_gps_geolocation           = true;
     c_.formatted_gps_geolocation.has.longitude = true;
     c_.formatted_gps_geolocation.longitude     = -181.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_LONGITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_LONGITUDE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {6}, true);
@@ -1394,8 +1397,8 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothLongitudeInvalidLarge) {
     c_.has.formatted_gps_geolocation           = true;
     c_.formatted_gps_geolocation.has.longitude = true;
     c_.formatted_gps_geolocation.longitude     = 181.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_LONGITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_LONGITUDE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {6}, true);
@@ -1406,7 +1409,7 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothAltitude) {
     c_.has.formatted_gps_geolocation          = true;
     c_.formatted_gps_geolocation.has.altitude = true;
     c_.formatted_gps_geolocation.altitude     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {7}, true);
@@ -1417,7 +1420,7 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothAltitudeSmall) {
     c_.has.formatted_gps_geolocation          = true;
     c_.formatted_gps_geolocation.has.altitude = true;
     c_.formatted_gps_geolocation.altitude     = -67108e3;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {7}, true);
@@ -1428,7 +1431,7 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothAltitudeLarge) {
     c_.has.formatted_gps_geolocation          = true;
     c_.formatted_gps_geolocation.has.altitude = true;
     c_.formatted_gps_geolocation.altitude     = 67108e3;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {7}, true);
@@ -1439,23 +1442,23 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothAltitudeInvalidSmall) {
     c_.has.formatted_gps_geolocation          = true;
     c_.formatted_gps_geolocation.has.altitude = true;
     c_.formatted_gps_geolocation.altitude     = -67109e3;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_ALTITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_ALTITUDE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
 }
 
 TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothAltitudeInvalidLarge) {
     c_.has.formatted_gps_geolocation          = true;
     c_.formatted_gps_geolocation.has.altitude = true;
     c_.formatted_gps_geolocation.altitude     = 67109e3;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_ALTITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_ALTITUDE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
 }
 
 TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothSpeedOverGround) {
     c_.has.formatted_gps_geolocation                   = true;
     c_.formatted_gps_geolocation.has.speed_over_ground = true;
     c_.formatted_gps_geolocation.speed_over_ground     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {8}, true);
@@ -1466,7 +1469,7 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothSpeedOverGroundSmall) {
     c_.has.formatted_gps_geolocation                   = true;
     c_.formatted_gps_geolocation.has.speed_over_ground = true;
     c_.formatted_gps_geolocation.speed_over_ground     = 0.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {8}, true);
@@ -1477,7 +1480,7 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothSpeedOverGroundLarge) {
     c_.has.formatted_gps_geolocation                   = true;
     c_.formatted_gps_geolocation.has.speed_over_ground = true;
     c_.formatted_gps_geolocation.speed_over_ground     = 65535.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {8}, true);
@@ -1488,8 +1491,8 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothSpeedOverGroundInvalidSmal
     c_.has.formatted_gps_geolocation                   = true;
     c_.formatted_gps_geolocation.has.speed_over_ground = true;
     c_.formatted_gps_geolocation.speed_over_ground     = -1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_SPEED_OVER_GROUND);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_SPEED_OVER_GROUND);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {8}, true);
@@ -1500,15 +1503,15 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothSpeedOverGroundInvalidLarg
     c_.has.formatted_gps_geolocation                   = true;
     c_.formatted_gps_geolocation.has.speed_over_ground = true;
     c_.formatted_gps_geolocation.speed_over_ground     = 65536.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_SPEED_OVER_GROUND);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_SPEED_OVER_GROUND);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
 }
 
 TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothHeadingAngle) {
     c_.has.formatted_gps_geolocation               = true;
     c_.formatted_gps_geolocation.has.heading_angle = true;
     c_.formatted_gps_geolocation.heading_angle     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {9}, true);
@@ -1519,7 +1522,7 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothHeadingAngleSmall) {
     c_.has.formatted_gps_geolocation               = true;
     c_.formatted_gps_geolocation.has.heading_angle = true;
     c_.formatted_gps_geolocation.heading_angle     = 0.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {9}, true);
@@ -1530,7 +1533,7 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothHeadingAngleLarge) {
     c_.has.formatted_gps_geolocation               = true;
     c_.formatted_gps_geolocation.has.heading_angle = true;
     c_.formatted_gps_geolocation.heading_angle     = 359.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {9}, true);
@@ -1541,8 +1544,8 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothHeadingAngleInvalidSmall)
     c_.has.formatted_gps_geolocation               = true;
     c_.formatted_gps_geolocation.has.heading_angle = true;
     c_.formatted_gps_geolocation.heading_angle     = -1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_HEADING_ANGLE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_HEADING_ANGLE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {9}, true);
@@ -1553,8 +1556,8 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothHeadingAngleInvalidLarge)
     c_.has.formatted_gps_geolocation               = true;
     c_.formatted_gps_geolocation.has.heading_angle = true;
     c_.formatted_gps_geolocation.heading_angle     = 360.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_HEADING_ANGLE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_HEADING_ANGLE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {9}, true);
@@ -1565,7 +1568,7 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothTrackAngle) {
     c_.has.formatted_gps_geolocation             = true;
     c_.formatted_gps_geolocation.has.track_angle = true;
     c_.formatted_gps_geolocation.track_angle     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {10}, true);
@@ -1576,7 +1579,7 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothTrackAngleSmall) {
     c_.has.formatted_gps_geolocation             = true;
     c_.formatted_gps_geolocation.has.track_angle = true;
     c_.formatted_gps_geolocation.track_angle     = 0.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {10}, true);
@@ -1587,7 +1590,7 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothTrackAngleLarge) {
     c_.has.formatted_gps_geolocation             = true;
     c_.formatted_gps_geolocation.has.track_angle = true;
     c_.formatted_gps_geolocation.track_angle     = 359.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {10}, true);
@@ -1598,8 +1601,8 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothTrackAngleInvalidSmall) {
     c_.has.formatted_gps_geolocation             = true;
     c_.formatted_gps_geolocation.has.track_angle = true;
     c_.formatted_gps_geolocation.track_angle     = -1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_TRACK_ANGLE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_TRACK_ANGLE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {10}, true);
@@ -1610,8 +1613,8 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothTrackAngleInvalidLarge) {
     c_.has.formatted_gps_geolocation             = true;
     c_.formatted_gps_geolocation.has.track_angle = true;
     c_.formatted_gps_geolocation.track_angle     = 360.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_TRACK_ANGLE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_TRACK_ANGLE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {10}, true);
@@ -1622,7 +1625,7 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothMagneticVariation) {
     c_.has.formatted_gps_geolocation                    = true;
     c_.formatted_gps_geolocation.has.magnetic_variation = true;
     c_.formatted_gps_geolocation.magnetic_variation     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {11}, true);
@@ -1633,7 +1636,7 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothMagneticVariationSmall) {
     c_.has.formatted_gps_geolocation                    = true;
     c_.formatted_gps_geolocation.has.magnetic_variation = true;
     c_.formatted_gps_geolocation.magnetic_variation     = -180.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {11}, true);
@@ -1644,7 +1647,7 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothMagneticVariationLarge) {
     c_.has.formatted_gps_geolocation                    = true;
     c_.formatted_gps_geolocation.has.magnetic_variation = true;
     c_.formatted_gps_geolocation.magnetic_variation     = 180.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {11}, true);
@@ -1655,8 +1658,8 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothMagneticVariationInvalidSm
     c_.has.formatted_gps_geolocation                    = true;
     c_.formatted_gps_geolocation.has.magnetic_variation = true;
     c_.formatted_gps_geolocation.magnetic_variation     = -181.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_MAGNETIC_VARIATION);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_MAGNETIC_VARIATION);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {11}, true);
@@ -1667,8 +1670,8 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothMagneticVariationInvalidLa
     c_.has.formatted_gps_geolocation                    = true;
     c_.formatted_gps_geolocation.has.magnetic_variation = true;
     c_.formatted_gps_geolocation.magnetic_variation     = 181.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_MAGNETIC_VARIATION);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_MAGNETIC_VARIATION);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00004000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {11}, true);
@@ -1678,7 +1681,7 @@ TEST_F(WriteIfContextTest, FormattedGpsGeolocationBothMagneticVariationInvalidLa
 TEST_F(WriteIfContextTest, FormattedInsGeolocationTsi) {
     c_.has.formatted_ins_geolocation = true;
     c_.formatted_ins_geolocation.tsi = VRT_TSI_OTHER;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, true);
@@ -1688,8 +1691,8 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationTsi) {
 TEST_F(WriteIfContextTest, FormattedInsGeolocationTsiInvalidSmall) {
     c_.has.formatted_ins_geolocation = true;
     c_.formatted_ins_geolocation.tsi = static_cast<vrt_tsi>(-1);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_INVALID_TSI);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_INVALID_TSI);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, true);
@@ -1699,8 +1702,8 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationTsiInvalidSmall) {
 TEST_F(WriteIfContextTest, FormattedInsGeolocationTsiInvalidLarge) {
     c_.has.formatted_ins_geolocation = true;
     c_.formatted_ins_geolocation.tsi = static_cast<vrt_tsi>(4);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_INVALID_TSI);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_INVALID_TSI);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
@@ -1709,7 +1712,7 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationTsiInvalidLarge) {
 TEST_F(WriteIfContextTest, FormattedInsGeolocationTsf) {
     c_.has.formatted_ins_geolocation = true;
     c_.formatted_ins_geolocation.tsf = VRT_TSF_FREE_RUNNING_COUNT;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, true);
@@ -1719,8 +1722,8 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationTsf) {
 TEST_F(WriteIfContextTest, FormattedInsGeolocationTsfInvalidSmall) {
     c_.has.formatted_ins_geolocation = true;
     c_.formatted_ins_geolocation.tsf = static_cast<vrt_tsf>(-1);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_INVALID_TSF);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_INVALID_TSF);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, true);
@@ -1730,8 +1733,8 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationTsfInvalidSmall) {
 TEST_F(WriteIfContextTest, FormattedInsGeolocationTsfInvalidLarge) {
     c_.has.formatted_ins_geolocation = true;
     c_.formatted_ins_geolocation.tsf = static_cast<vrt_tsf>(4);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_INVALID_TSF);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_INVALID_TSF);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
@@ -1740,7 +1743,7 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationTsfInvalidLarge) {
 TEST_F(WriteIfContextTest, FormattedInsGeolocationOui) {
     c_.has.formatted_ins_geolocation = true;
     c_.formatted_ins_geolocation.oui = 0x00FFFFFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, true);
@@ -1750,8 +1753,8 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationOui) {
 TEST_F(WriteIfContextTest, FormattedInsGeolocationOuiInvalid) {
     c_.has.formatted_ins_geolocation = true;
     c_.formatted_ins_geolocation.oui = 0x01FFFFFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_OUI);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_OUI);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, true);
@@ -1762,7 +1765,7 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationIntegerSecondTimestamp) {
     c_.has.formatted_ins_geolocation                      = true;
     c_.formatted_ins_geolocation.tsi                      = VRT_TSI_UTC;
     c_.formatted_ins_geolocation.integer_second_timestamp = 0xABABABAB;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {{1, 2}}, true);
@@ -1774,8 +1777,8 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationIntegerSecondTimestampInvalid)
     c_.has.formatted_ins_geolocation                      = true;
     c_.formatted_ins_geolocation.tsi                      = VRT_TSI_UNDEFINED;
     c_.formatted_ins_geolocation.integer_second_timestamp = 0xABABABAB;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {2}, true);
@@ -1786,7 +1789,7 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationFractionalSecondTimestamp) {
     c_.has.formatted_ins_geolocation                         = true;
     c_.formatted_ins_geolocation.tsf                         = VRT_TSF_REAL_TIME;
     c_.formatted_ins_geolocation.fractional_second_timestamp = 0x000000E8D4A50FFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {{1, 3, 4}}, true);
@@ -1799,8 +1802,8 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationFractionalSecondTimestampInval
     c_.has.formatted_ins_geolocation                         = true;
     c_.formatted_ins_geolocation.tsf                         = VRT_TSF_UNDEFINED;
     c_.formatted_ins_geolocation.fractional_second_timestamp = 0x000000E8D4A50FFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_SET_FRACTIONAL_SECOND_TIMESTAMP);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_SET_FRACTIONAL_SECOND_TIMESTAMP);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {{3, 4}}, true);
@@ -1812,8 +1815,8 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationFractionalSecondTimestampInval
     c_.has.formatted_ins_geolocation                         = true;
     c_.formatted_ins_geolocation.tsf                         = VRT_TSF_REAL_TIME;
     c_.formatted_ins_geolocation.fractional_second_timestamp = 0x000000E8D4A51000;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_REAL_TIME);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_REAL_TIME);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {{1, 3, 4}}, true);
@@ -1825,7 +1828,7 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationFractionalSecondTimestampInval
 TEST_F(WriteIfContextTest, FormattedInsGeolocationLatitude) {
     c_.has.formatted_ins_geolocation      = true;
     c_.formatted_ins_geolocation.latitude = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
@@ -1834,7 +1837,7 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationLatitude) {
 TEST_F(WriteIfContextTest, FormattedInsGeolocationLongitude) {
     c_.has.formatted_ins_geolocation       = true;
     c_.formatted_ins_geolocation.longitude = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
@@ -1843,7 +1846,7 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationLongitude) {
 TEST_F(WriteIfContextTest, FormattedInsGeolocationAltitude) {
     c_.has.formatted_ins_geolocation      = true;
     c_.formatted_ins_geolocation.altitude = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
@@ -1852,7 +1855,7 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationAltitude) {
 TEST_F(WriteIfContextTest, FormattedInsGeolocationSpeedOverGround) {
     c_.has.formatted_ins_geolocation               = true;
     c_.formatted_ins_geolocation.speed_over_ground = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
@@ -1861,7 +1864,7 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationSpeedOverGround) {
 TEST_F(WriteIfContextTest, FormattedInsGeolocationHeadingAngle) {
     c_.has.formatted_ins_geolocation           = true;
     c_.formatted_ins_geolocation.heading_angle = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
@@ -1870,7 +1873,7 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationHeadingAngle) {
 TEST_F(WriteIfContextTest, FormattedInsGeolocationTrackAngle) {
     c_.has.formatted_ins_geolocation         = true;
     c_.formatted_ins_geolocation.track_angle = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
@@ -1879,7 +1882,7 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationTrackAngle) {
 TEST_F(WriteIfContextTest, FormattedInsGeolocationMagneticVariation) {
     c_.has.formatted_ins_geolocation                = true;
     c_.formatted_ins_geolocation.magnetic_variation = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, true);
@@ -1889,7 +1892,7 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationBothLatitude) {
     c_.has.formatted_ins_geolocation          = true;
     c_.formatted_ins_geolocation.has.latitude = true;
     c_.formatted_ins_geolocation.latitude     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {5}, true);
@@ -1900,7 +1903,7 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationBothLatitudeSmall) {
     c_.has.formatted_ins_geolocation          = true;
     c_.formatted_ins_geolocation.has.latitude = true;
     c_.formatted_ins_geolocation.latitude     = -90.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {5}, true);
@@ -1911,7 +1914,7 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationBothLatitudeLarge) {
     c_.has.formatted_ins_geolocation          = true;
     c_.formatted_ins_geolocation.has.latitude = true;
     c_.formatted_ins_geolocation.latitude     = 90.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {5}, true);
@@ -1922,8 +1925,8 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationBothLatitudeInvalidSmall) {
     c_.has.formatted_ins_geolocation          = true;
     c_.formatted_ins_geolocation.has.latitude = true;
     c_.formatted_ins_geolocation.latitude     = -91.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_LATITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_LATITUDE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {5}, true);
@@ -1934,8 +1937,8 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationBothLatitudeInvalidLarge) {
     c_.has.formatted_ins_geolocation          = true;
     c_.formatted_ins_geolocation.has.latitude = true;
     c_.formatted_ins_geolocation.latitude     = 91.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_LATITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_LATITUDE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {5}, true);
@@ -1946,7 +1949,7 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationBothLongitude) {
     c_.has.formatted_ins_geolocation           = true;
     c_.formatted_ins_geolocation.has.longitude = true;
     c_.formatted_ins_geolocation.longitude     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {6}, true);
@@ -1957,7 +1960,7 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationBothLongitudeSmall) {
     c_.has.formatted_ins_geolocation           = true;
     c_.formatted_ins_geolocation.has.longitude = true;
     c_.formatted_ins_geolocation.longitude     = -180.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {6}, true);
@@ -1968,7 +1971,7 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationBothLongitudeLarge) {
     c_.has.formatted_ins_geolocation           = true;
     c_.formatted_ins_geolocation.has.longitude = true;
     c_.formatted_ins_geolocation.longitude     = 180.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {6}, true);
@@ -1979,8 +1982,8 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationBothLongitudeInvalidSmall) {
     c_.has.formatted_ins_geolocation           = true;
     c_.formatted_ins_geolocation.has.longitude = true;
     c_.formatted_ins_geolocation.longitude     = -181.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_LONGITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_LONGITUDE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {6}, true);
@@ -1991,8 +1994,8 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationBothLongitudeInvalidLarge) {
     c_.has.formatted_ins_geolocation           = true;
     c_.formatted_ins_geolocation.has.longitude = true;
     c_.formatted_ins_geolocation.longitude     = 181.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_LONGITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_LONGITUDE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {6}, true);
@@ -2003,7 +2006,7 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationBothAltitude) {
     c_.has.formatted_ins_geolocation          = true;
     c_.formatted_ins_geolocation.has.altitude = true;
     c_.formatted_ins_geolocation.altitude     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {7}, true);
@@ -2014,7 +2017,7 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationBothAltitudeSmall) {
     c_.has.formatted_ins_geolocation          = true;
     c_.formatted_ins_geolocation.has.altitude = true;
     c_.formatted_ins_geolocation.altitude     = -67108e3;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {7}, true);
@@ -2025,7 +2028,7 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationBothAltitudeLarge) {
     c_.has.formatted_ins_geolocation          = true;
     c_.formatted_ins_geolocation.has.altitude = true;
     c_.formatted_ins_geolocation.altitude     = 67108e3;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {7}, true);
@@ -2036,23 +2039,23 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationBothAltitudeInvalidSmall) {
     c_.has.formatted_ins_geolocation          = true;
     c_.formatted_ins_geolocation.has.altitude = true;
     c_.formatted_ins_geolocation.altitude     = -67109e3;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_ALTITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_ALTITUDE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
 }
 
 TEST_F(WriteIfContextTest, FormattedInsGeolocationBothAltitudeInvalidLarge) {
     c_.has.formatted_ins_geolocation          = true;
     c_.formatted_ins_geolocation.has.altitude = true;
     c_.formatted_ins_geolocation.altitude     = 67109e3;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_ALTITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_ALTITUDE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
 }
 
 TEST_F(WriteIfContextTest, FormattedInsGeolocationBothSpeedOverGround) {
     c_.has.formatted_ins_geolocation                   = true;
     c_.formatted_ins_geolocation.has.speed_over_ground = true;
     c_.formatted_ins_geolocation.speed_over_ground     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {8}, true);
@@ -2063,7 +2066,7 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationBothSpeedOverGroundSmall) {
     c_.has.formatted_ins_geolocation                   = true;
     c_.formatted_ins_geolocation.has.speed_over_ground = true;
     c_.formatted_ins_geolocation.speed_over_ground     = 0.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {8}, true);
@@ -2074,7 +2077,7 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationBothSpeedOverGroundLarge) {
     c_.has.formatted_ins_geolocation                   = true;
     c_.formatted_ins_geolocation.has.speed_over_ground = true;
     c_.formatted_ins_geolocation.speed_over_ground     = 65535.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {8}, true);
@@ -2085,8 +2088,8 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationBothSpeedOverGroundInvalidSmal
     c_.has.formatted_ins_geolocation                   = true;
     c_.formatted_ins_geolocation.has.speed_over_ground = true;
     c_.formatted_ins_geolocation.speed_over_ground     = -1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_SPEED_OVER_GROUND);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_SPEED_OVER_GROUND);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {8}, true);
@@ -2097,15 +2100,15 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationBothSpeedOverGroundInvalidLarg
     c_.has.formatted_ins_geolocation                   = true;
     c_.formatted_ins_geolocation.has.speed_over_ground = true;
     c_.formatted_ins_geolocation.speed_over_ground     = 65536.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_SPEED_OVER_GROUND);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_SPEED_OVER_GROUND);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
 }
 
 TEST_F(WriteIfContextTest, FormattedInsGeolocationBothHeadingAngle) {
     c_.has.formatted_ins_geolocation               = true;
     c_.formatted_ins_geolocation.has.heading_angle = true;
     c_.formatted_ins_geolocation.heading_angle     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {9}, true);
@@ -2116,7 +2119,7 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationBothHeadingAngleSmall) {
     c_.has.formatted_ins_geolocation               = true;
     c_.formatted_ins_geolocation.has.heading_angle = true;
     c_.formatted_ins_geolocation.heading_angle     = 0.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {9}, true);
@@ -2127,7 +2130,7 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationBothHeadingAngleLarge) {
     c_.has.formatted_ins_geolocation               = true;
     c_.formatted_ins_geolocation.has.heading_angle = true;
     c_.formatted_ins_geolocation.heading_angle     = 359.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {9}, true);
@@ -2138,8 +2141,8 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationBothHeadingAngleInvalidSmall)
     c_.has.formatted_ins_geolocation               = true;
     c_.formatted_ins_geolocation.has.heading_angle = true;
     c_.formatted_ins_geolocation.heading_angle     = -1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_HEADING_ANGLE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_HEADING_ANGLE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {9}, true);
@@ -2150,8 +2153,8 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationBothHeadingAngleInvalidLarge)
     c_.has.formatted_ins_geolocation               = true;
     c_.formatted_ins_geolocation.has.heading_angle = true;
     c_.formatted_ins_geolocation.heading_angle     = 360.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_HEADING_ANGLE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_HEADING_ANGLE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {9}, true);
@@ -2162,7 +2165,7 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationBothTrackAngle) {
     c_.has.formatted_ins_geolocation             = true;
     c_.formatted_ins_geolocation.has.track_angle = true;
     c_.formatted_ins_geolocation.track_angle     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {10}, true);
@@ -2173,7 +2176,7 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationBothTrackAngleSmall) {
     c_.has.formatted_ins_geolocation             = true;
     c_.formatted_ins_geolocation.has.track_angle = true;
     c_.formatted_ins_geolocation.track_angle     = 0.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {10}, true);
@@ -2184,7 +2187,7 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationBothTrackAngleLarge) {
     c_.has.formatted_ins_geolocation             = true;
     c_.formatted_ins_geolocation.has.track_angle = true;
     c_.formatted_ins_geolocation.track_angle     = 359.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {10}, true);
@@ -2195,8 +2198,8 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationBothTrackAngleInvalidSmall) {
     c_.has.formatted_ins_geolocation             = true;
     c_.formatted_ins_geolocation.has.track_angle = true;
     c_.formatted_ins_geolocation.track_angle     = -1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_TRACK_ANGLE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_TRACK_ANGLE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {10}, true);
@@ -2207,8 +2210,8 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationBothTrackAngleInvalidLarge) {
     c_.has.formatted_ins_geolocation             = true;
     c_.formatted_ins_geolocation.has.track_angle = true;
     c_.formatted_ins_geolocation.track_angle     = 360.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_TRACK_ANGLE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_TRACK_ANGLE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {10}, true);
@@ -2219,7 +2222,7 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationBothMagneticVariation) {
     c_.has.formatted_ins_geolocation                    = true;
     c_.formatted_ins_geolocation.has.magnetic_variation = true;
     c_.formatted_ins_geolocation.magnetic_variation     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {11}, true);
@@ -2230,7 +2233,7 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationBothMagneticVariationSmall) {
     c_.has.formatted_ins_geolocation                    = true;
     c_.formatted_ins_geolocation.has.magnetic_variation = true;
     c_.formatted_ins_geolocation.magnetic_variation     = -180.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {11}, true);
@@ -2241,7 +2244,7 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationBothMagneticVariationLarge) {
     c_.has.formatted_ins_geolocation                    = true;
     c_.formatted_ins_geolocation.has.magnetic_variation = true;
     c_.formatted_ins_geolocation.magnetic_variation     = 180.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {11}, true);
@@ -2252,8 +2255,8 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationBothMagneticVariationInvalidSm
     c_.has.formatted_ins_geolocation                    = true;
     c_.formatted_ins_geolocation.has.magnetic_variation = true;
     c_.formatted_ins_geolocation.magnetic_variation     = -181.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_MAGNETIC_VARIATION);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_MAGNETIC_VARIATION);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {11}, true);
@@ -2264,8 +2267,8 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationBothMagneticVariationInvalidLa
     c_.has.formatted_ins_geolocation                    = true;
     c_.formatted_ins_geolocation.has.magnetic_variation = true;
     c_.formatted_ins_geolocation.magnetic_variation     = 181.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, true), VRT_ERR_BOUNDS_MAGNETIC_VARIATION);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, false), 12);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_MAGNETIC_VARIATION);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 12, VRT_VALIDATION_NONE), 12);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00002000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {11}, true);
@@ -2275,7 +2278,7 @@ TEST_F(WriteIfContextTest, FormattedInsGeolocationBothMagneticVariationInvalidLa
 TEST_F(WriteIfContextTest, EcefEphemerisTsi) {
     c_.has.ecef_ephemeris = true;
     c_.ecef_ephemeris.tsi = VRT_TSI_OTHER;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, false);
@@ -2285,8 +2288,8 @@ TEST_F(WriteIfContextTest, EcefEphemerisTsi) {
 TEST_F(WriteIfContextTest, EcefEphemerisTsiInvalidSmall) {
     c_.has.ecef_ephemeris = true;
     c_.ecef_ephemeris.tsi = static_cast<vrt_tsi>(-1);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_INVALID_TSI);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_INVALID_TSI);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, false);
@@ -2296,8 +2299,8 @@ TEST_F(WriteIfContextTest, EcefEphemerisTsiInvalidSmall) {
 TEST_F(WriteIfContextTest, EcefEphemerisTsiInvalidLarge) {
     c_.has.ecef_ephemeris = true;
     c_.ecef_ephemeris.tsi = static_cast<vrt_tsi>(4);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_INVALID_TSI);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_INVALID_TSI);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
@@ -2306,7 +2309,7 @@ TEST_F(WriteIfContextTest, EcefEphemerisTsiInvalidLarge) {
 TEST_F(WriteIfContextTest, EcefEphemerisTsf) {
     c_.has.ecef_ephemeris = true;
     c_.ecef_ephemeris.tsf = VRT_TSF_FREE_RUNNING_COUNT;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, false);
@@ -2316,8 +2319,8 @@ TEST_F(WriteIfContextTest, EcefEphemerisTsf) {
 TEST_F(WriteIfContextTest, EcefEphemerisTsfInvalidSmall) {
     c_.has.ecef_ephemeris = true;
     c_.ecef_ephemeris.tsf = static_cast<vrt_tsf>(-1);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_INVALID_TSF);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_INVALID_TSF);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, false);
@@ -2327,8 +2330,8 @@ TEST_F(WriteIfContextTest, EcefEphemerisTsfInvalidSmall) {
 TEST_F(WriteIfContextTest, EcefEphemerisTsfInvalidLarge) {
     c_.has.ecef_ephemeris = true;
     c_.ecef_ephemeris.tsf = static_cast<vrt_tsf>(4);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_INVALID_TSF);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_INVALID_TSF);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
@@ -2337,7 +2340,7 @@ TEST_F(WriteIfContextTest, EcefEphemerisTsfInvalidLarge) {
 TEST_F(WriteIfContextTest, EcefEphemerisOui) {
     c_.has.ecef_ephemeris = true;
     c_.ecef_ephemeris.oui = 0x00FFFFFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, false);
@@ -2347,8 +2350,8 @@ TEST_F(WriteIfContextTest, EcefEphemerisOui) {
 TEST_F(WriteIfContextTest, EcefEphemerisOuiInvalid) {
     c_.has.ecef_ephemeris = true;
     c_.ecef_ephemeris.oui = 0x01FFFFFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_OUI);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_OUI);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, false);
@@ -2359,7 +2362,7 @@ TEST_F(WriteIfContextTest, EcefEphemerisIntegerSecondTimestamp) {
     c_.has.ecef_ephemeris                      = true;
     c_.ecef_ephemeris.tsi                      = VRT_TSI_UTC;
     c_.ecef_ephemeris.integer_second_timestamp = 0xABABABAB;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1, 2}, false);
@@ -2371,8 +2374,8 @@ TEST_F(WriteIfContextTest, EcefEphemerisIntegerSecondTimestampInvalid) {
     c_.has.ecef_ephemeris                      = true;
     c_.ecef_ephemeris.tsi                      = VRT_TSI_UNDEFINED;
     c_.ecef_ephemeris.integer_second_timestamp = 0xABABABAB;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {2}, false);
@@ -2383,7 +2386,7 @@ TEST_F(WriteIfContextTest, EcefEphemerisFractionalSecondTimestamp) {
     c_.has.ecef_ephemeris                         = true;
     c_.ecef_ephemeris.tsf                         = VRT_TSF_REAL_TIME;
     c_.ecef_ephemeris.fractional_second_timestamp = 0x000000E8D4A50FFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1, 3, 4}, false);
@@ -2396,8 +2399,8 @@ TEST_F(WriteIfContextTest, EcefEphemerisFractionalSecondTimestampInvalid1) {
     c_.has.ecef_ephemeris                         = true;
     c_.ecef_ephemeris.tsf                         = VRT_TSF_UNDEFINED;
     c_.ecef_ephemeris.fractional_second_timestamp = 0x000000E8D4A50FFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_SET_FRACTIONAL_SECOND_TIMESTAMP);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_SET_FRACTIONAL_SECOND_TIMESTAMP);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {3, 4}, false);
@@ -2409,8 +2412,8 @@ TEST_F(WriteIfContextTest, EcefEphemerisFractionalSecondTimestampInvalid2) {
     c_.has.ecef_ephemeris                         = true;
     c_.ecef_ephemeris.tsf                         = VRT_TSF_REAL_TIME;
     c_.ecef_ephemeris.fractional_second_timestamp = 0x000000E8D4A51000;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_REAL_TIME);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_REAL_TIME);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1, 3, 4}, false);
@@ -2422,7 +2425,7 @@ TEST_F(WriteIfContextTest, EcefEphemerisFractionalSecondTimestampInvalid2) {
 TEST_F(WriteIfContextTest, EcefEphemerisPositionX) {
     c_.has.ecef_ephemeris        = true;
     c_.ecef_ephemeris.position_x = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
@@ -2431,7 +2434,7 @@ TEST_F(WriteIfContextTest, EcefEphemerisPositionX) {
 TEST_F(WriteIfContextTest, EcefEphemerisPositionY) {
     c_.has.ecef_ephemeris        = true;
     c_.ecef_ephemeris.position_y = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
@@ -2440,7 +2443,7 @@ TEST_F(WriteIfContextTest, EcefEphemerisPositionY) {
 TEST_F(WriteIfContextTest, EcefEphemerisPositionZ) {
     c_.has.ecef_ephemeris        = true;
     c_.ecef_ephemeris.position_z = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
@@ -2450,7 +2453,7 @@ TEST_F(WriteIfContextTest, EcefEphemerisPositionZ) {
 TEST_F(WriteIfContextTest, EcefEphemerisAttitudeAlpha) {
     c_.has.ecef_ephemeris            = true;
     c_.ecef_ephemeris.attitude_alpha = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
@@ -2459,7 +2462,7 @@ TEST_F(WriteIfContextTest, EcefEphemerisAttitudeAlpha) {
 TEST_F(WriteIfContextTest, EcefEphemerisAttitudeBeta) {
     c_.has.ecef_ephemeris           = true;
     c_.ecef_ephemeris.attitude_beta = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
@@ -2468,7 +2471,7 @@ TEST_F(WriteIfContextTest, EcefEphemerisAttitudeBeta) {
 TEST_F(WriteIfContextTest, EcefEphemerisAttitudePhi) {
     c_.has.ecef_ephemeris          = true;
     c_.ecef_ephemeris.attitude_phi = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
@@ -2477,7 +2480,7 @@ TEST_F(WriteIfContextTest, EcefEphemerisAttitudePhi) {
 TEST_F(WriteIfContextTest, EcefEphemerisVelocityDx) {
     c_.has.ecef_ephemeris         = true;
     c_.ecef_ephemeris.velocity_dx = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
@@ -2486,7 +2489,7 @@ TEST_F(WriteIfContextTest, EcefEphemerisVelocityDx) {
 TEST_F(WriteIfContextTest, EcefEphemerisVelocityDy) {
     c_.has.ecef_ephemeris         = true;
     c_.ecef_ephemeris.velocity_dy = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
@@ -2495,7 +2498,7 @@ TEST_F(WriteIfContextTest, EcefEphemerisVelocityDy) {
 TEST_F(WriteIfContextTest, EcefEphemerisVelocityDz) {
     c_.has.ecef_ephemeris         = true;
     c_.ecef_ephemeris.velocity_dz = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
@@ -2505,7 +2508,7 @@ TEST_F(WriteIfContextTest, EcefEphemerisBothPositionX) {
     c_.has.ecef_ephemeris            = true;
     c_.ecef_ephemeris.has.position_x = true;
     c_.ecef_ephemeris.position_x     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {5}, false);
@@ -2516,7 +2519,7 @@ TEST_F(WriteIfContextTest, EcefEphemerisBothPositionXSmall) {
     c_.has.ecef_ephemeris            = true;
     c_.ecef_ephemeris.has.position_x = true;
     c_.ecef_ephemeris.position_x     = -67108864;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {5}, false);
@@ -2527,7 +2530,7 @@ TEST_F(WriteIfContextTest, EcefEphemerisBothPositionXLarge) {
     c_.has.ecef_ephemeris            = true;
     c_.ecef_ephemeris.has.position_x = true;
     c_.ecef_ephemeris.position_x     = 67108863;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {5}, false);
@@ -2538,23 +2541,23 @@ TEST_F(WriteIfContextTest, EcefEphemerisBothPositionXInvalidSmall) {
     c_.has.ecef_ephemeris            = true;
     c_.ecef_ephemeris.has.position_x = true;
     c_.ecef_ephemeris.position_x     = -67108865;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_POSITION);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, EcefEphemerisBothPositionXInvalidLarge) {
     c_.has.ecef_ephemeris            = true;
     c_.ecef_ephemeris.has.position_x = true;
     c_.ecef_ephemeris.position_x     = 67108864;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_POSITION);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, EcefEphemerisBothPositionY) {
     c_.has.ecef_ephemeris            = true;
     c_.ecef_ephemeris.has.position_y = true;
     c_.ecef_ephemeris.position_y     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {6}, false);
@@ -2565,7 +2568,7 @@ TEST_F(WriteIfContextTest, EcefEphemerisBothPositionYSmall) {
     c_.has.ecef_ephemeris            = true;
     c_.ecef_ephemeris.has.position_y = true;
     c_.ecef_ephemeris.position_y     = -67108864;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {6}, false);
@@ -2576,7 +2579,7 @@ TEST_F(WriteIfContextTest, EcefEphemerisBothPositionYLarge) {
     c_.has.ecef_ephemeris            = true;
     c_.ecef_ephemeris.has.position_y = true;
     c_.ecef_ephemeris.position_y     = 67108863;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {6}, false);
@@ -2587,23 +2590,23 @@ TEST_F(WriteIfContextTest, EcefEphemerisBothPositionYInvalidSmall) {
     c_.has.ecef_ephemeris            = true;
     c_.ecef_ephemeris.has.position_y = true;
     c_.ecef_ephemeris.position_y     = -67108865;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_POSITION);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, EcefEphemerisBothPositionYInvalidLarge) {
     c_.has.ecef_ephemeris            = true;
     c_.ecef_ephemeris.has.position_y = true;
     c_.ecef_ephemeris.position_y     = 67108864;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_POSITION);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, EcefEphemerisBothPositionZ) {
     c_.has.ecef_ephemeris            = true;
     c_.ecef_ephemeris.has.position_z = true;
     c_.ecef_ephemeris.position_z     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {7}, false);
@@ -2614,7 +2617,7 @@ TEST_F(WriteIfContextTest, EcefEphemerisBothPositionZSmall) {
     c_.has.ecef_ephemeris            = true;
     c_.ecef_ephemeris.has.position_z = true;
     c_.ecef_ephemeris.position_z     = -67108864;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {7}, false);
@@ -2625,7 +2628,7 @@ TEST_F(WriteIfContextTest, EcefEphemerisBothPositionZLarge) {
     c_.has.ecef_ephemeris            = true;
     c_.ecef_ephemeris.has.position_z = true;
     c_.ecef_ephemeris.position_z     = 67108863;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {7}, false);
@@ -2636,23 +2639,23 @@ TEST_F(WriteIfContextTest, EcefEphemerisBothPositionZInvalidSmall) {
     c_.has.ecef_ephemeris            = true;
     c_.ecef_ephemeris.has.position_z = true;
     c_.ecef_ephemeris.position_z     = -67108865;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_POSITION);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, EcefEphemerisBothPositionZInvalidLarge) {
     c_.has.ecef_ephemeris            = true;
     c_.ecef_ephemeris.has.position_z = true;
     c_.ecef_ephemeris.position_z     = 67108864;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_POSITION);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, EcefEphemerisBothAttitudeAlpha) {
     c_.has.ecef_ephemeris                = true;
     c_.ecef_ephemeris.has.attitude_alpha = true;
     c_.ecef_ephemeris.attitude_alpha     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {8}, false);
@@ -2663,7 +2666,7 @@ TEST_F(WriteIfContextTest, EcefEphemerisBothAttitudeAlphaSmall) {
     c_.has.ecef_ephemeris                = true;
     c_.ecef_ephemeris.has.attitude_alpha = true;
     c_.ecef_ephemeris.attitude_alpha     = -512;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {8}, false);
@@ -2674,7 +2677,7 @@ TEST_F(WriteIfContextTest, EcefEphemerisBothAttitudeAlphaLarge) {
     c_.has.ecef_ephemeris                = true;
     c_.ecef_ephemeris.has.attitude_alpha = true;
     c_.ecef_ephemeris.attitude_alpha     = 511;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {8}, false);
@@ -2685,23 +2688,23 @@ TEST_F(WriteIfContextTest, EcefEphemerisBothAttitudeAlphaInvalidSmall) {
     c_.has.ecef_ephemeris                = true;
     c_.ecef_ephemeris.has.attitude_alpha = true;
     c_.ecef_ephemeris.attitude_alpha     = -513;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_ATTITUDE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, EcefEphemerisBothAttitudeAlphaInvalidLarge) {
     c_.has.ecef_ephemeris                = true;
     c_.ecef_ephemeris.has.attitude_alpha = true;
     c_.ecef_ephemeris.attitude_alpha     = 512;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_ATTITUDE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, EcefEphemerisBothAttitudeBeta) {
     c_.has.ecef_ephemeris               = true;
     c_.ecef_ephemeris.has.attitude_beta = true;
     c_.ecef_ephemeris.attitude_beta     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {9}, false);
@@ -2712,7 +2715,7 @@ TEST_F(WriteIfContextTest, EcefEphemerisBothAttitudeBetaSmall) {
     c_.has.ecef_ephemeris               = true;
     c_.ecef_ephemeris.has.attitude_beta = true;
     c_.ecef_ephemeris.attitude_beta     = -512;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {9}, false);
@@ -2723,7 +2726,7 @@ TEST_F(WriteIfContextTest, EcefEphemerisBothAttitudeBetaLarge) {
     c_.has.ecef_ephemeris               = true;
     c_.ecef_ephemeris.has.attitude_beta = true;
     c_.ecef_ephemeris.attitude_beta     = 511;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {9}, false);
@@ -2734,23 +2737,23 @@ TEST_F(WriteIfContextTest, EcefEphemerisBothAttitudeBetaInvalidSmall) {
     c_.has.ecef_ephemeris               = true;
     c_.ecef_ephemeris.has.attitude_beta = true;
     c_.ecef_ephemeris.attitude_beta     = -513;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_ATTITUDE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, EcefEphemerisBothAttitudeBetaInvalidLarge) {
     c_.has.ecef_ephemeris               = true;
     c_.ecef_ephemeris.has.attitude_beta = true;
     c_.ecef_ephemeris.attitude_beta     = 512;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_ATTITUDE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, EcefEphemerisBothAttitudePhi) {
     c_.has.ecef_ephemeris              = true;
     c_.ecef_ephemeris.has.attitude_phi = true;
     c_.ecef_ephemeris.attitude_phi     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {10}, false);
@@ -2761,7 +2764,7 @@ TEST_F(WriteIfContextTest, EcefEphemerisBothAttitudePhiSmall) {
     c_.has.ecef_ephemeris              = true;
     c_.ecef_ephemeris.has.attitude_phi = true;
     c_.ecef_ephemeris.attitude_phi     = -512;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {10}, false);
@@ -2772,7 +2775,7 @@ TEST_F(WriteIfContextTest, EcefEphemerisBothAttitudePhiLarge) {
     c_.has.ecef_ephemeris              = true;
     c_.ecef_ephemeris.has.attitude_phi = true;
     c_.ecef_ephemeris.attitude_phi     = 511;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {10}, false);
@@ -2783,23 +2786,23 @@ TEST_F(WriteIfContextTest, EcefEphemerisBothAttitudePhiInvalidSmall) {
     c_.has.ecef_ephemeris              = true;
     c_.ecef_ephemeris.has.attitude_phi = true;
     c_.ecef_ephemeris.attitude_phi     = -513;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_ATTITUDE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, EcefEphemerisBothAttitudePhiInvalidLarge) {
     c_.has.ecef_ephemeris              = true;
     c_.ecef_ephemeris.has.attitude_phi = true;
     c_.ecef_ephemeris.attitude_phi     = 512;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_ATTITUDE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, EcefEphemerisBothVelocityDx) {
     c_.has.ecef_ephemeris             = true;
     c_.ecef_ephemeris.has.velocity_dx = true;
     c_.ecef_ephemeris.velocity_dx     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {11}, false);
@@ -2810,7 +2813,7 @@ TEST_F(WriteIfContextTest, EcefEphemerisBothVelocityDxSmall) {
     c_.has.ecef_ephemeris             = true;
     c_.ecef_ephemeris.has.velocity_dx = true;
     c_.ecef_ephemeris.velocity_dx     = -32768;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {11}, false);
@@ -2821,7 +2824,7 @@ TEST_F(WriteIfContextTest, EcefEphemerisBothVelocityDxLarge) {
     c_.has.ecef_ephemeris             = true;
     c_.ecef_ephemeris.has.velocity_dx = true;
     c_.ecef_ephemeris.velocity_dx     = 32767;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {11}, false);
@@ -2832,23 +2835,23 @@ TEST_F(WriteIfContextTest, EcefEphemerisBothVelocityDxInvalidSmall) {
     c_.has.ecef_ephemeris             = true;
     c_.ecef_ephemeris.has.velocity_dx = true;
     c_.ecef_ephemeris.velocity_dx     = -32769;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_VELOCITY);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, EcefEphemerisBothVelocityDxInvalidLarge) {
     c_.has.ecef_ephemeris             = true;
     c_.ecef_ephemeris.has.velocity_dx = true;
     c_.ecef_ephemeris.velocity_dx     = 32768;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_VELOCITY);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, EcefEphemerisBothVelocityDy) {
     c_.has.ecef_ephemeris             = true;
     c_.ecef_ephemeris.has.velocity_dy = true;
     c_.ecef_ephemeris.velocity_dy     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {12}, false);
@@ -2859,7 +2862,7 @@ TEST_F(WriteIfContextTest, EcefEphemerisBothVelocityDySmall) {
     c_.has.ecef_ephemeris             = true;
     c_.ecef_ephemeris.has.velocity_dy = true;
     c_.ecef_ephemeris.velocity_dy     = -32768;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {12}, false);
@@ -2870,7 +2873,7 @@ TEST_F(WriteIfContextTest, EcefEphemerisBothVelocityDyLarge) {
     c_.has.ecef_ephemeris             = true;
     c_.ecef_ephemeris.has.velocity_dy = true;
     c_.ecef_ephemeris.velocity_dy     = 32767;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {12}, false);
@@ -2881,23 +2884,23 @@ TEST_F(WriteIfContextTest, EcefEphemerisBothVelocityDyInvalidSmall) {
     c_.has.ecef_ephemeris             = true;
     c_.ecef_ephemeris.has.velocity_dy = true;
     c_.ecef_ephemeris.velocity_dy     = -32769;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_VELOCITY);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, EcefEphemerisBothVelocityDyInvalidLarge) {
     c_.has.ecef_ephemeris             = true;
     c_.ecef_ephemeris.has.velocity_dy = true;
     c_.ecef_ephemeris.velocity_dy     = 32768;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_VELOCITY);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, EcefEphemerisBothVelocityDz) {
     c_.has.ecef_ephemeris             = true;
     c_.ecef_ephemeris.has.velocity_dz = true;
     c_.ecef_ephemeris.velocity_dz     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {13}, false);
@@ -2908,7 +2911,7 @@ TEST_F(WriteIfContextTest, EcefEphemerisBothVelocityDzSmall) {
     c_.has.ecef_ephemeris             = true;
     c_.ecef_ephemeris.has.velocity_dz = true;
     c_.ecef_ephemeris.velocity_dz     = -32768;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {13}, false);
@@ -2919,7 +2922,7 @@ TEST_F(WriteIfContextTest, EcefEphemerisBothVelocityDzLarge) {
     c_.has.ecef_ephemeris             = true;
     c_.ecef_ephemeris.has.velocity_dz = true;
     c_.ecef_ephemeris.velocity_dz     = 32767;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00001000));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {13}, false);
@@ -2930,22 +2933,22 @@ TEST_F(WriteIfContextTest, EcefEphemerisBothVelocityDzInvalidSmall) {
     c_.has.ecef_ephemeris             = true;
     c_.ecef_ephemeris.has.velocity_dz = true;
     c_.ecef_ephemeris.velocity_dz     = -32769;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_VELOCITY);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, EcefEphemerisBothVelocityDzInvalidLarge) {
     c_.has.ecef_ephemeris             = true;
     c_.ecef_ephemeris.has.velocity_dz = true;
     c_.ecef_ephemeris.velocity_dz     = 32768;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_VELOCITY);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, RelativeEphemerisTsi) {
     c_.has.relative_ephemeris = true;
     c_.relative_ephemeris.tsi = VRT_TSI_OTHER;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, false);
@@ -2955,8 +2958,8 @@ TEST_F(WriteIfContextTest, RelativeEphemerisTsi) {
 TEST_F(WriteIfContextTest, RelativeEphemerisTsiInvalidSmall) {
     c_.has.relative_ephemeris = true;
     c_.relative_ephemeris.tsi = static_cast<vrt_tsi>(-1);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_INVALID_TSI);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_INVALID_TSI);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, false);
@@ -2966,8 +2969,8 @@ TEST_F(WriteIfContextTest, RelativeEphemerisTsiInvalidSmall) {
 TEST_F(WriteIfContextTest, RelativeEphemerisTsiInvalidLarge) {
     c_.has.relative_ephemeris = true;
     c_.relative_ephemeris.tsi = static_cast<vrt_tsi>(4);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_INVALID_TSI);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_INVALID_TSI);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
@@ -2976,7 +2979,7 @@ TEST_F(WriteIfContextTest, RelativeEphemerisTsiInvalidLarge) {
 TEST_F(WriteIfContextTest, RelativeEphemerisTsf) {
     c_.has.relative_ephemeris = true;
     c_.relative_ephemeris.tsf = VRT_TSF_FREE_RUNNING_COUNT;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, false);
@@ -2986,8 +2989,8 @@ TEST_F(WriteIfContextTest, RelativeEphemerisTsf) {
 TEST_F(WriteIfContextTest, RelativeEphemerisTsfInvalidSmall) {
     c_.has.relative_ephemeris = true;
     c_.relative_ephemeris.tsf = static_cast<vrt_tsf>(-1);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_INVALID_TSF);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_INVALID_TSF);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, false);
@@ -2997,8 +3000,8 @@ TEST_F(WriteIfContextTest, RelativeEphemerisTsfInvalidSmall) {
 TEST_F(WriteIfContextTest, RelativeEphemerisTsfInvalidLarge) {
     c_.has.relative_ephemeris = true;
     c_.relative_ephemeris.tsf = static_cast<vrt_tsf>(4);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_INVALID_TSF);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_INVALID_TSF);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
@@ -3007,7 +3010,7 @@ TEST_F(WriteIfContextTest, RelativeEphemerisTsfInvalidLarge) {
 TEST_F(WriteIfContextTest, RelativeEphemerisOui) {
     c_.has.relative_ephemeris = true;
     c_.relative_ephemeris.oui = 0x00FFFFFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, false);
@@ -3017,8 +3020,8 @@ TEST_F(WriteIfContextTest, RelativeEphemerisOui) {
 TEST_F(WriteIfContextTest, RelativeEphemerisOuiInvalid) {
     c_.has.relative_ephemeris = true;
     c_.relative_ephemeris.oui = 0x01FFFFFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_OUI);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_OUI);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1}, false);
@@ -3029,7 +3032,7 @@ TEST_F(WriteIfContextTest, RelativeEphemerisIntegerSecondTimestamp) {
     c_.has.relative_ephemeris                      = true;
     c_.relative_ephemeris.tsi                      = VRT_TSI_UTC;
     c_.relative_ephemeris.integer_second_timestamp = 0xABABABAB;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1, 2}, false);
@@ -3041,8 +3044,8 @@ TEST_F(WriteIfContextTest, RelativeEphemerisIntegerSecondTimestampInvalid) {
     c_.has.relative_ephemeris                      = true;
     c_.relative_ephemeris.tsi                      = VRT_TSI_UNDEFINED;
     c_.relative_ephemeris.integer_second_timestamp = 0xABABABAB;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_SET_INTEGER_SECOND_TIMESTAMP);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {2}, false);
@@ -3053,7 +3056,7 @@ TEST_F(WriteIfContextTest, RelativeEphemerisFractionalSecondTimestamp) {
     c_.has.relative_ephemeris                         = true;
     c_.relative_ephemeris.tsf                         = VRT_TSF_REAL_TIME;
     c_.relative_ephemeris.fractional_second_timestamp = 0x000000E8D4A50FFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1, 3, 4}, false);
@@ -3066,8 +3069,8 @@ TEST_F(WriteIfContextTest, RelativeEphemerisFractionalSecondTimestampInvalid1) {
     c_.has.relative_ephemeris                         = true;
     c_.relative_ephemeris.tsf                         = VRT_TSF_UNDEFINED;
     c_.relative_ephemeris.fractional_second_timestamp = 0x000000E8D4A50FFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_SET_FRACTIONAL_SECOND_TIMESTAMP);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_SET_FRACTIONAL_SECOND_TIMESTAMP);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {3, 4}, false);
@@ -3079,8 +3082,8 @@ TEST_F(WriteIfContextTest, RelativeEphemerisFractionalSecondTimestampInvalid2) {
     c_.has.relative_ephemeris                         = true;
     c_.relative_ephemeris.tsf                         = VRT_TSF_REAL_TIME;
     c_.relative_ephemeris.fractional_second_timestamp = 0x000000E8D4A51000;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_REAL_TIME);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_REAL_TIME);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {1, 3, 4}, false);
@@ -3092,7 +3095,7 @@ TEST_F(WriteIfContextTest, RelativeEphemerisFractionalSecondTimestampInvalid2) {
 TEST_F(WriteIfContextTest, RelativeEphemerisPositionX) {
     c_.has.relative_ephemeris        = true;
     c_.relative_ephemeris.position_x = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
@@ -3101,7 +3104,7 @@ TEST_F(WriteIfContextTest, RelativeEphemerisPositionX) {
 TEST_F(WriteIfContextTest, RelativeEphemerisPositionXSmall) {
     c_.has.relative_ephemeris        = true;
     c_.relative_ephemeris.position_x = -67108864;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
@@ -3110,7 +3113,7 @@ TEST_F(WriteIfContextTest, RelativeEphemerisPositionXSmall) {
 TEST_F(WriteIfContextTest, RelativeEphemerisPositionY) {
     c_.has.relative_ephemeris        = true;
     c_.relative_ephemeris.position_y = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
@@ -3119,7 +3122,7 @@ TEST_F(WriteIfContextTest, RelativeEphemerisPositionY) {
 TEST_F(WriteIfContextTest, RelativeEphemerisPositionZ) {
     c_.has.relative_ephemeris        = true;
     c_.relative_ephemeris.position_z = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
@@ -3129,7 +3132,7 @@ TEST_F(WriteIfContextTest, RelativeEphemerisPositionZ) {
 TEST_F(WriteIfContextTest, RelativeEphemerisAttitudeAlpha) {
     c_.has.relative_ephemeris            = true;
     c_.relative_ephemeris.attitude_alpha = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
@@ -3138,7 +3141,7 @@ TEST_F(WriteIfContextTest, RelativeEphemerisAttitudeAlpha) {
 TEST_F(WriteIfContextTest, RelativeEphemerisAttitudeBeta) {
     c_.has.relative_ephemeris           = true;
     c_.relative_ephemeris.attitude_beta = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
@@ -3147,7 +3150,7 @@ TEST_F(WriteIfContextTest, RelativeEphemerisAttitudeBeta) {
 TEST_F(WriteIfContextTest, RelativeEphemerisAttitudePhi) {
     c_.has.relative_ephemeris          = true;
     c_.relative_ephemeris.attitude_phi = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
@@ -3156,7 +3159,7 @@ TEST_F(WriteIfContextTest, RelativeEphemerisAttitudePhi) {
 TEST_F(WriteIfContextTest, RelativeEphemerisVelocityDx) {
     c_.has.relative_ephemeris         = true;
     c_.relative_ephemeris.velocity_dx = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
@@ -3165,7 +3168,7 @@ TEST_F(WriteIfContextTest, RelativeEphemerisVelocityDx) {
 TEST_F(WriteIfContextTest, RelativeEphemerisVelocityDy) {
     c_.has.relative_ephemeris         = true;
     c_.relative_ephemeris.velocity_dy = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
@@ -3174,7 +3177,7 @@ TEST_F(WriteIfContextTest, RelativeEphemerisVelocityDy) {
 TEST_F(WriteIfContextTest, RelativeEphemerisVelocityDz) {
     c_.has.relative_ephemeris         = true;
     c_.relative_ephemeris.velocity_dz = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {}, false);
@@ -3184,7 +3187,7 @@ TEST_F(WriteIfContextTest, RelativeEphemerisBothPositionX) {
     c_.has.relative_ephemeris            = true;
     c_.relative_ephemeris.has.position_x = true;
     c_.relative_ephemeris.position_x     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {5}, false);
@@ -3195,7 +3198,7 @@ TEST_F(WriteIfContextTest, RelativeEphemerisBothPositionXSmall) {
     c_.has.relative_ephemeris            = true;
     c_.relative_ephemeris.has.position_x = true;
     c_.relative_ephemeris.position_x     = -67108864;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {5}, false);
@@ -3206,7 +3209,7 @@ TEST_F(WriteIfContextTest, RelativeEphemerisBothPositionXLarge) {
     c_.has.relative_ephemeris            = true;
     c_.relative_ephemeris.has.position_x = true;
     c_.relative_ephemeris.position_x     = 67108863;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {5}, false);
@@ -3217,23 +3220,23 @@ TEST_F(WriteIfContextTest, RelativeEphemerisBothPositionXInvalidSmall) {
     c_.has.relative_ephemeris            = true;
     c_.relative_ephemeris.has.position_x = true;
     c_.relative_ephemeris.position_x     = -67108865;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_POSITION);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, RelativeEphemerisBothPositionXInvalidLarge) {
     c_.has.relative_ephemeris            = true;
     c_.relative_ephemeris.has.position_x = true;
     c_.relative_ephemeris.position_x     = 67108864;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_POSITION);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, RelativeEphemerisBothPositionY) {
     c_.has.relative_ephemeris            = true;
     c_.relative_ephemeris.has.position_y = true;
     c_.relative_ephemeris.position_y     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {6}, false);
@@ -3244,7 +3247,7 @@ TEST_F(WriteIfContextTest, RelativeEphemerisBothPositionYSmall) {
     c_.has.relative_ephemeris            = true;
     c_.relative_ephemeris.has.position_y = true;
     c_.relative_ephemeris.position_y     = -67108864;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {6}, false);
@@ -3255,7 +3258,7 @@ TEST_F(WriteIfContextTest, RelativeEphemerisBothPositionYLarge) {
     c_.has.relative_ephemeris            = true;
     c_.relative_ephemeris.has.position_y = true;
     c_.relative_ephemeris.position_y     = 67108863;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {6}, false);
@@ -3266,23 +3269,23 @@ TEST_F(WriteIfContextTest, RelativeEphemerisBothPositionYInvalidSmall) {
     c_.has.relative_ephemeris            = true;
     c_.relative_ephemeris.has.position_y = true;
     c_.relative_ephemeris.position_y     = -67108865;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_POSITION);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, RelativeEphemerisBothPositionYInvalidLarge) {
     c_.has.relative_ephemeris            = true;
     c_.relative_ephemeris.has.position_y = true;
     c_.relative_ephemeris.position_y     = 67108864;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_POSITION);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, RelativeEphemerisBothPositionZ) {
     c_.has.relative_ephemeris            = true;
     c_.relative_ephemeris.has.position_z = true;
     c_.relative_ephemeris.position_z     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {7}, false);
@@ -3293,7 +3296,7 @@ TEST_F(WriteIfContextTest, RelativeEphemerisBothPositionZSmall) {
     c_.has.relative_ephemeris            = true;
     c_.relative_ephemeris.has.position_z = true;
     c_.relative_ephemeris.position_z     = -67108864;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {7}, false);
@@ -3304,7 +3307,7 @@ TEST_F(WriteIfContextTest, RelativeEphemerisBothPositionZLarge) {
     c_.has.relative_ephemeris            = true;
     c_.relative_ephemeris.has.position_z = true;
     c_.relative_ephemeris.position_z     = 67108863;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {7}, false);
@@ -3315,23 +3318,23 @@ TEST_F(WriteIfContextTest, RelativeEphemerisBothPositionZInvalidSmall) {
     c_.has.relative_ephemeris            = true;
     c_.relative_ephemeris.has.position_z = true;
     c_.relative_ephemeris.position_z     = -67108865;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_POSITION);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, RelativeEphemerisBothPositionZInvalidLarge) {
     c_.has.relative_ephemeris            = true;
     c_.relative_ephemeris.has.position_z = true;
     c_.relative_ephemeris.position_z     = 67108864;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_POSITION);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_POSITION);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, RelativeEphemerisBothAttitudeAlpha) {
     c_.has.relative_ephemeris                = true;
     c_.relative_ephemeris.has.attitude_alpha = true;
     c_.relative_ephemeris.attitude_alpha     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {8}, false);
@@ -3342,7 +3345,7 @@ TEST_F(WriteIfContextTest, RelativeEphemerisBothAttitudeAlphaSmall) {
     c_.has.relative_ephemeris                = true;
     c_.relative_ephemeris.has.attitude_alpha = true;
     c_.relative_ephemeris.attitude_alpha     = -512;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {8}, false);
@@ -3353,7 +3356,7 @@ TEST_F(WriteIfContextTest, RelativeEphemerisBothAttitudeAlphaLarge) {
     c_.has.relative_ephemeris                = true;
     c_.relative_ephemeris.has.attitude_alpha = true;
     c_.relative_ephemeris.attitude_alpha     = 511;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {8}, false);
@@ -3364,23 +3367,23 @@ TEST_F(WriteIfContextTest, RelativeEphemerisBothAttitudeAlphaInvalidSmall) {
     c_.has.relative_ephemeris                = true;
     c_.relative_ephemeris.has.attitude_alpha = true;
     c_.relative_ephemeris.attitude_alpha     = -513;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_ATTITUDE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, RelativeEphemerisBothAttitudeAlphaInvalidLarge) {
     c_.has.relative_ephemeris                = true;
     c_.relative_ephemeris.has.attitude_alpha = true;
     c_.relative_ephemeris.attitude_alpha     = 512;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_ATTITUDE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, RelativeEphemerisBothAttitudeBeta) {
     c_.has.relative_ephemeris               = true;
     c_.relative_ephemeris.has.attitude_beta = true;
     c_.relative_ephemeris.attitude_beta     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {9}, false);
@@ -3391,7 +3394,7 @@ TEST_F(WriteIfContextTest, RelativeEphemerisBothAttitudeBetaSmall) {
     c_.has.relative_ephemeris               = true;
     c_.relative_ephemeris.has.attitude_beta = true;
     c_.relative_ephemeris.attitude_beta     = -512;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {9}, false);
@@ -3402,7 +3405,7 @@ TEST_F(WriteIfContextTest, RelativeEphemerisBothAttitudeBetaLarge) {
     c_.has.relative_ephemeris               = true;
     c_.relative_ephemeris.has.attitude_beta = true;
     c_.relative_ephemeris.attitude_beta     = 511;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {9}, false);
@@ -3413,23 +3416,23 @@ TEST_F(WriteIfContextTest, RelativeEphemerisBothAttitudeBetaInvalidSmall) {
     c_.has.relative_ephemeris               = true;
     c_.relative_ephemeris.has.attitude_beta = true;
     c_.relative_ephemeris.attitude_beta     = -513;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_ATTITUDE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, RelativeEphemerisBothAttitudeBetaInvalidLarge) {
     c_.has.relative_ephemeris               = true;
     c_.relative_ephemeris.has.attitude_beta = true;
     c_.relative_ephemeris.attitude_beta     = 512;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_ATTITUDE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, RelativeEphemerisBothAttitudePhi) {
     c_.has.relative_ephemeris              = true;
     c_.relative_ephemeris.has.attitude_phi = true;
     c_.relative_ephemeris.attitude_phi     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {10}, false);
@@ -3440,7 +3443,7 @@ TEST_F(WriteIfContextTest, RelativeEphemerisBothAttitudePhiSmall) {
     c_.has.relative_ephemeris              = true;
     c_.relative_ephemeris.has.attitude_phi = true;
     c_.relative_ephemeris.attitude_phi     = -512;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {10}, false);
@@ -3451,7 +3454,7 @@ TEST_F(WriteIfContextTest, RelativeEphemerisBothAttitudePhiLarge) {
     c_.has.relative_ephemeris              = true;
     c_.relative_ephemeris.has.attitude_phi = true;
     c_.relative_ephemeris.attitude_phi     = 511;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {10}, false);
@@ -3462,23 +3465,23 @@ TEST_F(WriteIfContextTest, RelativeEphemerisBothAttitudePhiInvalidSmall) {
     c_.has.relative_ephemeris              = true;
     c_.relative_ephemeris.has.attitude_phi = true;
     c_.relative_ephemeris.attitude_phi     = -513;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_ATTITUDE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, RelativeEphemerisBothAttitudePhiInvalidLarge) {
     c_.has.relative_ephemeris              = true;
     c_.relative_ephemeris.has.attitude_phi = true;
     c_.relative_ephemeris.attitude_phi     = 512;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_ATTITUDE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_ATTITUDE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, RelativeEphemerisBothVelocityDx) {
     c_.has.relative_ephemeris             = true;
     c_.relative_ephemeris.has.velocity_dx = true;
     c_.relative_ephemeris.velocity_dx     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {11}, false);
@@ -3489,7 +3492,7 @@ TEST_F(WriteIfContextTest, RelativeEphemerisBothVelocityDxSmall) {
     c_.has.relative_ephemeris             = true;
     c_.relative_ephemeris.has.velocity_dx = true;
     c_.relative_ephemeris.velocity_dx     = -32768;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {11}, false);
@@ -3500,7 +3503,7 @@ TEST_F(WriteIfContextTest, RelativeEphemerisBothVelocityDxLarge) {
     c_.has.relative_ephemeris             = true;
     c_.relative_ephemeris.has.velocity_dx = true;
     c_.relative_ephemeris.velocity_dx     = 32767;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {11}, false);
@@ -3511,23 +3514,23 @@ TEST_F(WriteIfContextTest, RelativeEphemerisBothVelocityDxInvalidSmall) {
     c_.has.relative_ephemeris             = true;
     c_.relative_ephemeris.has.velocity_dx = true;
     c_.relative_ephemeris.velocity_dx     = -32769;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_VELOCITY);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, RelativeEphemerisBothVelocityDxInvalidLarge) {
     c_.has.relative_ephemeris             = true;
     c_.relative_ephemeris.has.velocity_dx = true;
     c_.relative_ephemeris.velocity_dx     = 32768;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_VELOCITY);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, RelativeEphemerisBothVelocityDy) {
     c_.has.relative_ephemeris             = true;
     c_.relative_ephemeris.has.velocity_dy = true;
     c_.relative_ephemeris.velocity_dy     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {12}, false);
@@ -3538,7 +3541,7 @@ TEST_F(WriteIfContextTest, RelativeEphemerisBothVelocityDySmall) {
     c_.has.relative_ephemeris             = true;
     c_.relative_ephemeris.has.velocity_dy = true;
     c_.relative_ephemeris.velocity_dy     = -32768;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {12}, false);
@@ -3549,7 +3552,7 @@ TEST_F(WriteIfContextTest, RelativeEphemerisBothVelocityDyLarge) {
     c_.has.relative_ephemeris             = true;
     c_.relative_ephemeris.has.velocity_dy = true;
     c_.relative_ephemeris.velocity_dy     = 32767;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {12}, false);
@@ -3560,23 +3563,23 @@ TEST_F(WriteIfContextTest, RelativeEphemerisBothVelocityDyInvalidSmall) {
     c_.has.relative_ephemeris             = true;
     c_.relative_ephemeris.has.velocity_dy = true;
     c_.relative_ephemeris.velocity_dy     = -32769;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_VELOCITY);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, RelativeEphemerisBothVelocityDyInvalidLarge) {
     c_.has.relative_ephemeris             = true;
     c_.relative_ephemeris.has.velocity_dy = true;
     c_.relative_ephemeris.velocity_dy     = 32768;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_VELOCITY);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, RelativeEphemerisBothVelocityDz) {
     c_.has.relative_ephemeris             = true;
     c_.relative_ephemeris.has.velocity_dz = true;
     c_.relative_ephemeris.velocity_dz     = 1.0;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {13}, false);
@@ -3587,7 +3590,7 @@ TEST_F(WriteIfContextTest, RelativeEphemerisBothVelocityDzSmall) {
     c_.has.relative_ephemeris             = true;
     c_.relative_ephemeris.has.velocity_dz = true;
     c_.relative_ephemeris.velocity_dz     = -32768;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {13}, false);
@@ -3598,7 +3601,7 @@ TEST_F(WriteIfContextTest, RelativeEphemerisBothVelocityDzLarge) {
     c_.has.relative_ephemeris             = true;
     c_.relative_ephemeris.has.velocity_dz = true;
     c_.relative_ephemeris.velocity_dz     = 32767;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), 14);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000800));
     SCOPED_TRACE(::testing::UnitTest::GetInstance()->current_test_info()->name());
     buf_cmp_geolocation_ephemeris(buf_, {13}, false);
@@ -3609,22 +3612,22 @@ TEST_F(WriteIfContextTest, RelativeEphemerisBothVelocityDzInvalidSmall) {
     c_.has.relative_ephemeris             = true;
     c_.relative_ephemeris.has.velocity_dz = true;
     c_.relative_ephemeris.velocity_dz     = -32769;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_VELOCITY);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, RelativeEphemerisBothVelocityDzInvalidLarge) {
     c_.has.relative_ephemeris             = true;
     c_.relative_ephemeris.has.velocity_dz = true;
     c_.relative_ephemeris.velocity_dz     = 32768;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, true), VRT_ERR_BOUNDS_VELOCITY);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, false), 14);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_VELOCITY);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 14, VRT_VALIDATION_NONE), 14);
 }
 
 TEST_F(WriteIfContextTest, EphemerisReferenceIdentifier) {
     c_.has.ephemeris_reference_identifier = true;
     c_.ephemeris_reference_identifier     = 0xFEFEFEFE;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, true), 2);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 2, VRT_VALIDATION_FULL), 2);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000400));
     ASSERT_EQ(Hex(buf_[1]), Hex(0xFEFEFEFE));
     ASSERT_EQ(Hex(buf_[2]), Hex(0xBAADF00D));
@@ -3633,7 +3636,7 @@ TEST_F(WriteIfContextTest, EphemerisReferenceIdentifier) {
 TEST_F(WriteIfContextTest, GpsAsciiOui) {
     c_.has.gps_ascii = true;
     c_.gps_ascii.oui = 0x00FFFFFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000200));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00FFFFFF));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
@@ -3643,8 +3646,8 @@ TEST_F(WriteIfContextTest, GpsAsciiOui) {
 TEST_F(WriteIfContextTest, GpsAsciiOuiInvalid) {
     c_.has.gps_ascii = true;
     c_.gps_ascii.oui = 0x01FFFFFF;
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, true), VRT_ERR_BOUNDS_OUI);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, false), 3);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_OUI);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 3, VRT_VALIDATION_NONE), 3);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000200));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00FFFFFF));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
@@ -3655,7 +3658,7 @@ TEST_F(WriteIfContextTest, GpsAsciiAscii) {
     c_.has.gps_ascii             = true;
     c_.gps_ascii.number_of_words = 5;
     c_.gps_ascii.ascii           = "What's your name?";
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 8, true), 8);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 8, VRT_VALIDATION_FULL), 8);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000200));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000005));
@@ -3670,7 +3673,7 @@ TEST_F(WriteIfContextTest, ContextAssociationListsSource) {
     l[0]                                                         = 0xABABABAB;
     l[0x1FE]                                                     = 0xCBCBCBCB;
     c_.context_association_lists.source_context_association_list = l.data();
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 0x202, true), 0x202);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 0x202, VRT_VALIDATION_FULL), 0x202);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000100));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x01FF0000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
@@ -3686,8 +3689,10 @@ TEST_F(WriteIfContextTest, ContextAssociationListsSourceInvalid) {
     l[0]                                                         = 0xABABABAB;
     l[0x1FE]                                                     = 0xCBCBCBCB;
     c_.context_association_lists.source_context_association_list = l.data();
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 0x202, true), VRT_ERR_BOUNDS_SOURCE_LIST_SIZE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 0x202, false), 0x003);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 0x202, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_SOURCE_LIST_SIZE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 0x202, VRT_VALIDATION_STRUCTURAL),
+              VRT_ERR_BOUNDS_SOURCE_LIST_SIZE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 0x202, VRT_VALIDATION_NONE), 0x003);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000100));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
@@ -3701,7 +3706,7 @@ TEST_F(WriteIfContextTest, ContextAssociationListsSystem) {
     l[0]                                                         = 0xABABABAB;
     l[0x1FE]                                                     = 0xCBCBCBCB;
     c_.context_association_lists.system_context_association_list = l.data();
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 0x202, true), 0x202);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 0x202, VRT_VALIDATION_FULL), 0x202);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000100));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x000001FF));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
@@ -3717,8 +3722,8 @@ TEST_F(WriteIfContextTest, ContextAssociationListsSystemInvalid) {
     l[0]                                                         = 0xABABABAB;
     l[0x1FE]                                                     = 0xCBCBCBCB;
     c_.context_association_lists.system_context_association_list = l.data();
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 0x202, true), VRT_ERR_BOUNDS_SYSTEM_LIST_SIZE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 0x202, false), 0x003);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 0x202, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_SYSTEM_LIST_SIZE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 0x202, VRT_VALIDATION_NONE), 0x003);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000100));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00000000));
@@ -3732,7 +3737,7 @@ TEST_F(WriteIfContextTest, ContextAssociationListsVectorComponent) {
     l[0]                                                                   = 0xABABABAB;
     l[0x1FE]                                                               = 0xCBCBCBCB;
     c_.context_association_lists.vector_component_context_association_list = l.data();
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 0x202, true), 0x202);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 0x202, VRT_VALIDATION_FULL), 0x202);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000100));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x01FF0000));
@@ -3748,7 +3753,7 @@ TEST_F(WriteIfContextTest, ContextAssociationListsAsynchronous) {
     l[0]                                                                       = 0xABABABAB;
     l[0x1FE]                                                                   = 0xCBCBCBCB;
     c_.context_association_lists.asynchronous_channel_context_association_list = l.data();
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 0x202, true), 0x202);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 0x202, VRT_VALIDATION_FULL), 0x202);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000100));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x000001FF));
@@ -3762,7 +3767,7 @@ TEST_F(WriteIfContextTest, ContextAssociationListsAsynchronousInvalid) {
     c_.context_association_lists.asynchronous_channel_list_size                = 0x8000;
     std::array<uint32_t, 0x1FF> l                                              = {};
     c_.context_association_lists.asynchronous_channel_context_association_list = l.data();
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 0x8000, true), VRT_ERR_BOUNDS_CHANNEL_LIST_SIZE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 0x8000, VRT_VALIDATION_FULL), VRT_ERR_BOUNDS_CHANNEL_LIST_SIZE);
 }
 
 TEST_F(WriteIfContextTest, ContextAssociationListsAsynchronousTag) {
@@ -3779,7 +3784,7 @@ TEST_F(WriteIfContextTest, ContextAssociationListsAsynchronousTag) {
     l2[2]                                                                      = 0xCDCDCDCD;
     c_.context_association_lists.asynchronous_channel_context_association_list = l1.data();
     c_.context_association_lists.asynchronous_channel_tag_list                 = l2.data();
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 9, true), 9);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 9, VRT_VALIDATION_FULL), 9);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x00000100));
     ASSERT_EQ(Hex(buf_[1]), Hex(0x00000000));
     ASSERT_EQ(Hex(buf_[2]), Hex(0x00008003));
@@ -3875,8 +3880,8 @@ TEST_F(WriteIfContextTest, EveryOther1) {
     c_.gps_ascii.number_of_words = 3;
     c_.gps_ascii.ascii           = "Lorem ipsum!";
 
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 43, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 44, false), 44);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 43, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 44, VRT_VALIDATION_NONE), 44);
     ASSERT_EQ(Hex(buf_[0]), Hex(0xAAAAAA00)); /* Context indicators */
     ASSERT_EQ(Hex(buf_[1]), Hex(0xFFFFFFFF)); /* Bandwidth */
     ASSERT_EQ(Hex(buf_[2]), Hex(0xFFF00000));
@@ -4025,8 +4030,8 @@ TEST_F(WriteIfContextTest, EveryOther2) {
     c_.context_association_lists.asynchronous_channel_context_association_list = l4.data();
     c_.context_association_lists.asynchronous_channel_tag_list                 = l5.data();
 
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 48, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 49, false), 49);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 48, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 49, VRT_VALIDATION_NONE), 49);
     ASSERT_EQ(Hex(buf_[0]), Hex(0x55555500)); /* Context indicators */
     ASSERT_EQ(Hex(buf_[1]), Hex(0xACACACAC)); /* Reference point identifier */
     ASSERT_EQ(Hex(buf_[2]), Hex(0xFFFFFFFF)); /* IF reference frequency */
@@ -4260,8 +4265,8 @@ TEST_F(WriteIfContextTest, All) {
     c_.context_association_lists.asynchronous_channel_context_association_list = l4.data();
     c_.context_association_lists.asynchronous_channel_tag_list                 = l5.data();
 
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 91, true), VRT_ERR_BUFFER_SIZE);
-    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 92, false), 92);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 91, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+    ASSERT_EQ(vrt_write_if_context(&c_, buf_.data(), 92, VRT_VALIDATION_NONE), 92);
     ASSERT_EQ(Hex(buf_[0]), Hex(0xFFFFFF00)); /* Context indicators */
     ASSERT_EQ(Hex(buf_[1]), Hex(0xACACACAC)); /* Reference point identifier */
     ASSERT_EQ(Hex(buf_[2]), Hex(0xFFFFFFFF)); /* Bandwidth */
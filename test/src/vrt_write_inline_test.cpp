@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+
+#include <vrt/vrt_error_code.h>
+#include <vrt/vrt_init.h>
+#include <vrt/vrt_read.h>
+#include <vrt/vrt_types.h>
+#include <vrt/vrt_util.h>
+#include <vrt/vrt_write.h>
+#include <vrt/vrt_write_inline.h>
+
+class WriteInlineTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        vrt_init_packet(&p_);
+        lib_.fill(0xBAADF00D);
+        inl_.fill(0xBAADF00D);
+    }
+
+    /**
+     * Decode header from a header word, for all combinations of packet type, indicator bits, TSM, TSI, and TSF.
+     *
+     * \param i Index of combination.
+     */
+    void set_header(uint32_t i) {
+        uint32_t h = (i << 20U) & 0xFDF00000U;
+        ASSERT_EQ(vrt_read_header(&h, 1, &p_.header, VRT_VALIDATION_NONE), 1);
+        p_.header.packet_count = static_cast<uint8_t>(i);
+        p_.header.packet_size  = static_cast<uint16_t>(i);
+    }
+
+    static constexpr uint32_t       n_headers_{1U << 12U};
+    static constexpr vrt_validation levels_[3]{VRT_VALIDATION_NONE, VRT_VALIDATION_STRUCTURAL, VRT_VALIDATION_FULL};
+    vrt_packet                      p_{};
+    std::array<uint32_t, 8>         lib_{};
+    std::array<uint32_t, 8>         inl_{};
+};
+
+TEST_F(WriteInlineTest, Header) {
+    for (vrt_validation v : levels_) {
+        for (uint32_t i = 0; i < n_headers_; ++i) {
+            set_header(i);
+            ASSERT_EQ(vrt_write_header_inline(&p_.header, inl_.data(), inl_.size(), v),
+                      vrt_write_header(&p_.header, lib_.data(), lib_.size(), v))
+                << "header " << i << ", validate " << v;
+            ASSERT_EQ(inl_, lib_);
+        }
+    }
+}
+
+TEST_F(WriteInlineTest, HeaderInvalid) {
+    p_.header.packet_type = static_cast<vrt_packet_type>(0xF);
+    ASSERT_EQ(vrt_write_header_inline(&p_.header, inl_.data(), inl_.size(), VRT_VALIDATION_STRUCTURAL),
+              VRT_ERR_INVALID_PACKET_TYPE);
+    p_.header.packet_type  = VRT_PT_IF_DATA_WITH_STREAM_ID;
+    p_.header.packet_count = 0x10;
+    ASSERT_EQ(vrt_write_header_inline(&p_.header, inl_.data(), inl_.size(), VRT_VALIDATION_FULL),
+              VRT_ERR_BOUNDS_PACKET_COUNT);
+}
+
+TEST_F(WriteInlineTest, HeaderBufferSize) {
+    ASSERT_EQ(vrt_write_header_inline(&p_.header, inl_.data(), 0, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+}
+
+TEST_F(WriteInlineTest, HeaderBe) {
+    for (uint32_t i = 0; i < n_headers_; ++i) {
+        set_header(i);
+        ASSERT_EQ(vrt_write_header_be_inline(&p_.header, inl_.data(), inl_.size(), VRT_VALIDATION_FULL),
+                  vrt_write_header_be(&p_.header, lib_.data(), lib_.size(), VRT_VALIDATION_FULL));
+        ASSERT_EQ(inl_, lib_);
+    }
+}
+
+TEST_F(WriteInlineTest, Fields) {
+    p_.fields.stream_id                       = 0x12345678;
+    p_.fields.class_id.oui                    = 0x01123456;
+    p_.fields.class_id.information_class_code = 0x9ABC;
+    p_.fields.class_id.packet_class_code      = 0xDEF0;
+    p_.fields.integer_seconds_timestamp       = 0x11111111;
+    p_.fields.fractional_seconds_timestamp    = 1000000000000;
+    for (vrt_validation v : levels_) {
+        for (uint32_t i = 0; i < n_headers_; ++i) {
+            set_header(i);
+            ASSERT_EQ(vrt_write_fields_inline(&p_.header, &p_.fields, inl_.data(), inl_.size(), v),
+                      vrt_write_fields(&p_.header, &p_.fields, lib_.data(), lib_.size(), v))
+                << "header " << i << ", validate " << v;
+            ASSERT_EQ(inl_, lib_);
+        }
+    }
+}
+
+TEST_F(WriteInlineTest, FieldsBufferSize) {
+    p_.header.packet_type = VRT_PT_IF_DATA_WITH_STREAM_ID;
+    ASSERT_EQ(vrt_write_fields_inline(&p_.header, &p_.fields, inl_.data(), 0, VRT_VALIDATION_FULL),
+              VRT_ERR_BUFFER_SIZE);
+}
+
+TEST_F(WriteInlineTest, FieldsBe) {
+    p_.fields.stream_id                    = 0x12345678;
+    p_.fields.class_id.oui                 = 0x00123456;
+    p_.fields.integer_seconds_timestamp    = 0x11111111;
+    p_.fields.fractional_seconds_timestamp = 999999999999;
+    for (uint32_t i = 0; i < n_headers_; ++i) {
+        set_header(i);
+        ASSERT_EQ(vrt_write_fields_be_inline(&p_.header, &p_.fields, inl_.data(), inl_.size(), VRT_VALIDATION_FULL),
+                  vrt_write_fields_be(&p_.header, &p_.fields, lib_.data(), lib_.size(), VRT_VALIDATION_FULL));
+        ASSERT_EQ(inl_, lib_);
+    }
+}
+
+TEST_F(WriteInlineTest, Trailer) {
+    for (vrt_validation v : levels_) {
+        for (uint32_t i = 0; i < 0x10000; ++i) {
+            uint32_t t = (i * 0x00010001U) ^ 0x5A5A0000U;
+            ASSERT_EQ(vrt_read_trailer(&t, 1, &p_.trailer), 1);
+            p_.trailer.associated_context_packet_count = static_cast<uint8_t>(i);
+            ASSERT_EQ(vrt_write_trailer_inline(&p_.trailer, inl_.data(), inl_.size(), v),
+                      vrt_write_trailer(&p_.trailer, lib_.data(), lib_.size(), v))
+                << "trailer " << t << ", validate " << v;
+            ASSERT_EQ(inl_, lib_);
+        }
+    }
+}
+
+TEST_F(WriteInlineTest, TrailerBufferSize) {
+    ASSERT_EQ(vrt_write_trailer_inline(&p_.trailer, inl_.data(), 0, VRT_VALIDATION_FULL), VRT_ERR_BUFFER_SIZE);
+}
+
+TEST_F(WriteInlineTest, TrailerBe) {
+    p_.trailer.has.valid_data = true;
+    p_.trailer.valid_data     = true;
+    ASSERT_EQ(vrt_write_trailer_be_inline(&p_.trailer, inl_.data(), inl_.size(), VRT_VALIDATION_FULL),
+              vrt_write_trailer_be(&p_.trailer, lib_.data(), lib_.size(), VRT_VALIDATION_FULL));
+    ASSERT_EQ(inl_, lib_);
+}